@@ -0,0 +1,429 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file IndexMap.hpp
+ */
+
+#ifndef GEOSX_COMMON_INDEXMAP_HPP
+#define GEOSX_COMMON_INDEXMAP_HPP
+
+#include "common/DataTypes.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <vector>
+
+namespace geosx
+{
+
+/**
+ * @brief Tag selecting the open addressing implementation of mapBase.
+ */
+struct OpenAddressing
+{};
+
+/**
+ * @class mapBase< TKEY, TVAL, OpenAddressing >
+ * @brief Hash map with integral keys, stored in a single flat array of key/value pairs.
+ * @tparam TKEY integral key type
+ * @tparam TVAL value type
+ *
+ * Collisions are resolved with linear probing and the load factor is kept below 3/4, so a lookup
+ * usually touches a single cache line and an insertion never allocates unless the table grows.
+ * The interface is the subset of std::unordered_map used with global to local maps
+ * (find, count, at, operator[], insert, reserve, clear and iteration), so the map can be used
+ * with the templated mapBase functions (packing, lookups) without modification.
+ *
+ * The largest value of @p TKEY is reserved to mark empty slots and cannot be inserted.
+ * Erasing single keys is not supported.
+ */
+template< typename TKEY, typename TVAL >
+class mapBase< TKEY, TVAL, OpenAddressing >
+{
+  static_assert( std::is_integral< TKEY >::value, "The open addressing map requires an integral key type." );
+
+public:
+
+  /// Key type
+  using key_type = TKEY;
+
+  /// Mapped value type
+  using mapped_type = TVAL;
+
+  /// Type of the stored key/value pairs
+  using value_type = std::pair< TKEY, TVAL >;
+
+  /// Size type
+  using size_type = localIndex;
+
+  /**
+   * @brief Forward iterator over the occupied slots.
+   * @tparam VALUE value_type, or value_type const for a const iterator
+   */
+  template< typename VALUE >
+  class IteratorBase
+  {
+public:
+
+    /// @cond DO_NOT_DOCUMENT
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = std::remove_const_t< VALUE >;
+    using difference_type = std::ptrdiff_t;
+    using pointer = VALUE *;
+    using reference = VALUE &;
+    /// @endcond
+
+    /**
+     * @brief Constructor, moves to the first occupied slot in [current, last).
+     * @param current the first slot to consider
+     * @param last the end of the slots
+     */
+    IteratorBase( VALUE * const current, VALUE * const last ):
+      m_current( current ),
+      m_last( last )
+    {
+      skipEmpty();
+    }
+
+    /**
+     * @brief Conversion from a non-const iterator.
+     * @tparam OTHER the value type of the other iterator
+     * @param other the iterator to convert
+     */
+    template< typename OTHER, typename = std::enable_if_t< std::is_convertible< OTHER *, VALUE * >::value > >
+    IteratorBase( IteratorBase< OTHER > const & other ):
+      m_current( other.m_current ),
+      m_last( other.m_last )
+    {}
+
+    /// @return the current key/value pair
+    reference operator*() const
+    { return *m_current; }
+
+    /// @return a pointer to the current key/value pair
+    pointer operator->() const
+    { return m_current; }
+
+    /// @return this iterator, moved to the next occupied slot
+    IteratorBase & operator++()
+    {
+      ++m_current;
+      skipEmpty();
+      return *this;
+    }
+
+    /// @return a copy of this iterator before it is moved to the next occupied slot
+    IteratorBase operator++( int )
+    {
+      IteratorBase copy( *this );
+      ++( *this );
+      return copy;
+    }
+
+    /**
+     * @param rhs the iterator to compare to
+     * @return true if both iterators point to the same slot
+     */
+    bool operator==( IteratorBase const & rhs ) const
+    { return m_current == rhs.m_current; }
+
+    /**
+     * @param rhs the iterator to compare to
+     * @return true if the iterators point to different slots
+     */
+    bool operator!=( IteratorBase const & rhs ) const
+    { return m_current != rhs.m_current; }
+
+private:
+
+    template< typename OTHER >
+    friend class IteratorBase;
+
+    void skipEmpty()
+    {
+      while( m_current != m_last && m_current->first == emptyKey() )
+      {
+        ++m_current;
+      }
+    }
+
+    VALUE * m_current;
+    VALUE * m_last;
+  };
+
+  /// Iterator type
+  using iterator = IteratorBase< value_type >;
+
+  /// Const iterator type
+  using const_iterator = IteratorBase< value_type const >;
+
+  /**
+   * @brief Constructor, creates an empty map without allocating.
+   */
+  mapBase():
+    m_slots(),
+    m_size( 0 ),
+    m_shift( 64 )
+  {}
+
+  /// @return the number of entries in the map
+  size_type size() const
+  { return m_size; }
+
+  /// @return true if the map has no entries
+  bool empty() const
+  { return m_size == 0; }
+
+  /**
+   * @brief Remove all the entries, keeping the allocated table.
+   */
+  void clear()
+  {
+    std::fill( m_slots.begin(), m_slots.end(), value_type( emptyKey(), TVAL() ) );
+    m_size = 0;
+  }
+
+  /**
+   * @brief Grow the table so that it can hold @p numEntries entries without rehashing.
+   * @param numEntries the number of entries
+   */
+  void reserve( size_type const numEntries )
+  {
+    std::size_t const capacity = requiredCapacity( numEntries );
+    if( capacity > m_slots.size() )
+    {
+      rehash( capacity );
+    }
+  }
+
+  /// @return an iterator to the first entry
+  iterator begin()
+  { return iterator( m_slots.data(), m_slots.data() + m_slots.size() ); }
+
+  /// @return a const iterator to the first entry
+  const_iterator begin() const
+  { return const_iterator( m_slots.data(), m_slots.data() + m_slots.size() ); }
+
+  /// @return an iterator past the last entry
+  iterator end()
+  { return iterator( m_slots.data() + m_slots.size(), m_slots.data() + m_slots.size() ); }
+
+  /// @return a const iterator past the last entry
+  const_iterator end() const
+  { return const_iterator( m_slots.data() + m_slots.size(), m_slots.data() + m_slots.size() ); }
+
+  /**
+   * @param key the key to look for
+   * @return an iterator to the entry of @p key, or end() if there is none
+   */
+  iterator find( TKEY const key )
+  {
+    std::ptrdiff_t const slot = findSlot( key );
+    return slot < 0 ? end() : iterator( m_slots.data() + slot, m_slots.data() + m_slots.size() );
+  }
+
+  /**
+   * @copydoc find( TKEY const )
+   */
+  const_iterator find( TKEY const key ) const
+  {
+    std::ptrdiff_t const slot = findSlot( key );
+    return slot < 0 ? end() : const_iterator( m_slots.data() + slot, m_slots.data() + m_slots.size() );
+  }
+
+  /**
+   * @param key the key to look for
+   * @return 1 if the map has an entry for @p key, 0 otherwise
+   */
+  size_type count( TKEY const key ) const
+  { return findSlot( key ) < 0 ? 0 : 1; }
+
+  /**
+   * @param key the key to look for
+   * @return a reference to the value mapped to @p key, which must be in the map
+   */
+  TVAL & at( TKEY const key )
+  {
+    std::ptrdiff_t const slot = findSlot( key );
+    GEOSX_ERROR_IF( slot < 0, "Key " << key << " is not in the map." );
+    return m_slots[ slot ].second;
+  }
+
+  /**
+   * @copydoc at( TKEY const )
+   */
+  TVAL const & at( TKEY const key ) const
+  {
+    std::ptrdiff_t const slot = findSlot( key );
+    GEOSX_ERROR_IF( slot < 0, "Key " << key << " is not in the map." );
+    return m_slots[ slot ].second;
+  }
+
+  /**
+   * @param key the key to look for
+   * @return a reference to the value mapped to @p key, default constructed if the key was not in the map
+   */
+  TVAL & operator[]( TKEY const key )
+  { return insert( value_type( key, TVAL() ) ).first->second; }
+
+  /**
+   * @brief Insert a key/value pair if the key is not in the map yet.
+   * @param value the key/value pair
+   * @return an iterator to the entry of the key, and whether the pair was inserted
+   */
+  std::pair< iterator, bool > insert( value_type const & value )
+  {
+    GEOSX_ERROR_IF( value.first == emptyKey(), "Key " << value.first << " is reserved for empty slots." );
+
+    if( 4 * ( m_size + 1 ) > 3 * LvArray::integerConversion< size_type >( m_slots.size() ) )
+    {
+      rehash( requiredCapacity( m_size + 1 ) );
+    }
+
+    std::size_t const mask = m_slots.size() - 1;
+    std::size_t slot = hash( value.first );
+    while( m_slots[ slot ].first != emptyKey() )
+    {
+      if( m_slots[ slot ].first == value.first )
+      {
+        return { iterator( m_slots.data() + slot, m_slots.data() + m_slots.size() ), false };
+      }
+      slot = ( slot + 1 ) & mask;
+    }
+
+    m_slots[ slot ] = value;
+    ++m_size;
+    return { iterator( m_slots.data() + slot, m_slots.data() + m_slots.size() ), true };
+  }
+
+  /**
+   * @brief Look up a batch of keys.
+   * @param keys the keys to look for
+   * @param values the values mapped to @p keys, or @p notFound for the keys that are not in the map
+   * @param notFound the value returned for the keys that are not in the map
+   *
+   * Lookups don't modify the map, so this may be called concurrently from several threads.
+   */
+  void lookup( arrayView1d< TKEY const > const & keys,
+               arrayView1d< TVAL > const & values,
+               TVAL const & notFound ) const
+  {
+    GEOSX_ASSERT_EQ( keys.size(), values.size() );
+    for( localIndex i = 0; i < keys.size(); ++i )
+    {
+      std::ptrdiff_t const slot = findSlot( keys[ i ] );
+      values[ i ] = slot < 0 ? notFound : m_slots[ slot ].second;
+    }
+  }
+
+private:
+
+  /// @return the key marking an empty slot
+  static constexpr TKEY emptyKey()
+  { return std::numeric_limits< TKEY >::max(); }
+
+  /**
+   * @param numEntries a number of entries
+   * @return the smallest power of two table size holding @p numEntries entries below the maximum load factor
+   */
+  static std::size_t requiredCapacity( size_type const numEntries )
+  {
+    std::size_t capacity = 8;
+    while( 3 * capacity < 4 * static_cast< std::size_t >( numEntries ) )
+    {
+      capacity *= 2;
+    }
+    return capacity;
+  }
+
+  /**
+   * @param key a key
+   * @return the home slot of @p key, the upper bits of a Fibonacci hash of the key
+   */
+  std::size_t hash( TKEY const key ) const
+  { return static_cast< std::size_t >( ( static_cast< std::uint64_t >( key ) * UINT64_C( 0x9E3779B97F4A7C15 ) ) >> m_shift ); }
+
+  /**
+   * @param key the key to look for
+   * @return the slot holding @p key, or -1 if the key is not in the map
+   */
+  std::ptrdiff_t findSlot( TKEY const key ) const
+  {
+    if( m_size == 0 || key == emptyKey() )
+    {
+      return -1;
+    }
+
+    std::size_t const mask = m_slots.size() - 1;
+    std::size_t slot = hash( key );
+    while( m_slots[ slot ].first != emptyKey() )
+    {
+      if( m_slots[ slot ].first == key )
+      {
+        return static_cast< std::ptrdiff_t >( slot );
+      }
+      slot = ( slot + 1 ) & mask;
+    }
+    return -1;
+  }
+
+  /**
+   * @brief Move the entries to a new table.
+   * @param capacity the size of the new table, a power of two
+   */
+  void rehash( std::size_t const capacity )
+  {
+    std::vector< value_type > oldSlots( capacity, value_type( emptyKey(), TVAL() ) );
+    oldSlots.swap( m_slots );
+
+    m_shift = 64;
+    for( std::size_t c = capacity; c > 1; c /= 2 )
+    {
+      --m_shift;
+    }
+
+    std::size_t const mask = capacity - 1;
+    for( value_type & entry : oldSlots )
+    {
+      if( entry.first != emptyKey() )
+      {
+        std::size_t slot = hash( entry.first );
+        while( m_slots[ slot ].first != emptyKey() )
+        {
+          slot = ( slot + 1 ) & mask;
+        }
+        m_slots[ slot ] = std::move( entry );
+      }
+    }
+  }
+
+  /// The table of key/value pairs, empty slots have the key emptyKey()
+  std::vector< value_type > m_slots;
+
+  /// The number of entries
+  size_type m_size;
+
+  /// The shift applied to the 64 bit hash to get a slot in the table
+  int m_shift;
+};
+
+/// Open addressing hash map type, for integral keys.
+template< typename TKEY, typename TVAL >
+using indexMap = mapBase< TKEY, TVAL, OpenAddressing >;
+
+}
+
+#endif /* GEOSX_COMMON_INDEXMAP_HPP */
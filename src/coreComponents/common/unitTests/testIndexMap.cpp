@@ -0,0 +1,102 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+
+#include "common/IndexMap.hpp"
+
+#include <random>
+#include <unordered_map>
+
+using namespace geosx;
+
+TEST( IndexMap, insertAndFind )
+{
+  indexMap< globalIndex, localIndex > map;
+  EXPECT_TRUE( map.empty() );
+  EXPECT_TRUE( map.find( 3 ) == map.end() );
+  EXPECT_EQ( map.count( 3 ), 0 );
+
+  map[ 3 ] = 10;
+  map[ 1000000000000 ] = 11;
+  EXPECT_TRUE( map.insert( { 7, 12 } ).second );
+  EXPECT_FALSE( map.insert( { 7, 13 } ).second );
+
+  EXPECT_EQ( map.size(), 3 );
+  EXPECT_EQ( map.at( 3 ), 10 );
+  EXPECT_EQ( map.at( 1000000000000 ), 11 );
+  EXPECT_EQ( map.at( 7 ), 12 );
+  EXPECT_EQ( map.count( 7 ), 1 );
+  EXPECT_EQ( map.count( 8 ), 0 );
+  EXPECT_EQ( map.find( 3 )->second, 10 );
+
+  map.clear();
+  EXPECT_TRUE( map.empty() );
+  EXPECT_TRUE( map.begin() == map.end() );
+  EXPECT_EQ( map.count( 3 ), 0 );
+}
+
+TEST( IndexMap, matchesUnorderedMap )
+{
+  std::mt19937_64 gen( 2020 );
+  std::uniform_int_distribution< globalIndex > dist( 0, 1000000 );
+
+  indexMap< globalIndex, localIndex > map;
+  std::unordered_map< globalIndex, localIndex > reference;
+  for( localIndex i = 0; i < 20000; ++i )
+  {
+    globalIndex const key = dist( gen );
+    map[ key ] = i;
+    reference[ key ] = i;
+  }
+
+  ASSERT_EQ( map.size(), reference.size() );
+  for( auto const & entry : reference )
+  {
+    EXPECT_EQ( map.at( entry.first ), entry.second );
+  }
+
+  // iteration visits each entry exactly once
+  localIndex numVisited = 0;
+  indexMap< globalIndex, localIndex > const & constMap = map;
+  for( auto const & entry : constMap )
+  {
+    EXPECT_EQ( reference.at( entry.first ), entry.second );
+    ++numVisited;
+  }
+  EXPECT_EQ( numVisited, map.size() );
+}
+
+TEST( IndexMap, batchLookup )
+{
+  indexMap< globalIndex, localIndex > map;
+  map.reserve( 100 );
+  for( localIndex i = 0; i < 100; ++i )
+  {
+    map[ 2 * i ] = i;
+  }
+
+  array1d< globalIndex > keys( 200 );
+  array1d< localIndex > values( 200 );
+  for( localIndex i = 0; i < 200; ++i )
+  {
+    keys[ i ] = i;
+  }
+
+  map.lookup( keys, values, -1 );
+  for( localIndex i = 0; i < 200; ++i )
+  {
+    EXPECT_EQ( values[ i ], i % 2 == 0 ? i / 2 : -1 );
+  }
+}
@@ -35,8 +35,24 @@ namespace constitutive
 
 MultiFluidPVTPackageWrapper::MultiFluidPVTPackageWrapper( std::string const & name, Group * const parent )
   : MultiFluidBase( name, parent ),
-  m_fluid( nullptr )
-{}
+  m_fluid( nullptr ),
+  m_flashCacheTolerance( 0.0 ),
+  m_flashCacheStatistics( 2 )
+{
+  registerWrapper( viewKeyStruct::flashCacheStateString, &m_flashCacheState )->
+    setPlotLevel( PlotLevel::NOPLOT )->
+    setRestartFlags( RestartFlags::NO_WRITE )->
+    setDescription( "Pressure, temperature and composition of the last phase equilibrium calculation" );
+
+  registerWrapper( viewKeyStruct::flashCacheToleranceString, &m_flashCacheTolerance )->
+    setApplyDefaultValue( 0.0 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Relative pressure and temperature and absolute composition change below which a cell reuses its last flash, negative to disable. "
+                    "The default 0 only reuses the flash of an unchanged state. "
+                    "A positive value keeps phase properties and derivatives that lag the current state by up to this tolerance, "
+                    "which perturbs the residual and Jacobian by a similar relative amount and can slow down or stall Newton convergence. "
+                    "Cached flashes are discarded at the beginning of each time step" );
+}
 
 MultiFluidPVTPackageWrapper::~MultiFluidPVTPackageWrapper()
 {}
@@ -86,6 +102,28 @@ MultiFluidPVTPackageWrapper::deliverClone( string const & name,
   return clone;
 }
 
+void MultiFluidPVTPackageWrapper::allocateConstitutiveData( dataRepository::Group * const parent,
+                                                            localIndex const numConstitutivePointsPerParentIndex )
+{
+  MultiFluidBase::allocateConstitutiveData( parent, numConstitutivePointsPerParentIndex );
+
+  // a negative composition never matches, so that the first update of each point performs the flash
+  m_flashCacheState.resize( parent->size(), numConstitutivePointsPerParentIndex, numFluidComponents() + 2 );
+  invalidateFlashCache();
+}
+
+void MultiFluidPVTPackageWrapper::invalidateFlashCache()
+{
+  m_flashCacheState.setValues< serialPolicy >( -1.0 );
+}
+
+void MultiFluidPVTPackageWrapper::collectFlashCacheStatistics( globalIndex & numHits, globalIndex & numMisses )
+{
+  numHits += m_flashCacheStatistics[0];
+  numMisses += m_flashCacheStatistics[1];
+  m_flashCacheStatistics.setValues< serialPolicy >( 0 );
+}
+
 void MultiFluidPVTPackageWrapperUpdate::Compute( real64 pressure,
                                                  real64 temperature,
                                                  arraySlice1d< real64 const, 0 > const & composition,
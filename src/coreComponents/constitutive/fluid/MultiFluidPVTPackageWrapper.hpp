@@ -38,6 +38,11 @@ namespace constitutive
 /**
  * @brief Kernel wrapper class for MultiFluidPVTPackage.
  * @note Not thread-safe, do not use with any parallel launch policy.
+ *
+ * The wrapper keeps, for each point, the pressure, temperature and composition
+ * of the last phase equilibrium calculation. When an update is requested for a
+ * state that does not differ from the cached one by more than the cache
+ * tolerance, the flash is skipped and the stored properties are kept.
  */
 class MultiFluidPVTPackageWrapperUpdate final : public MultiFluidBaseUpdate
 {
@@ -66,7 +71,10 @@ public:
                                      arrayView2d< real64 > const & totalDensity,
                                      arrayView2d< real64 > const & dTotalDensity_dPressure,
                                      arrayView2d< real64 > const & dTotalDensity_dTemperature,
-                                     arrayView3d< real64 > const & dTotalDensity_dGlobalCompFraction )
+                                     arrayView3d< real64 > const & dTotalDensity_dGlobalCompFraction,
+                                     arrayView3d< real64 > const & flashCacheState,
+                                     real64 const flashCacheTolerance,
+                                     arrayView1d< globalIndex > const & flashCacheStatistics )
     : MultiFluidBaseUpdate( componentMolarWeight,
                             useMass,
                             phaseFraction,
@@ -90,7 +98,10 @@ public:
                             dTotalDensity_dTemperature,
                             dTotalDensity_dGlobalCompFraction ),
     m_fluid( fluid ),
-    m_phaseTypes( phaseTypes )
+    m_phaseTypes( phaseTypes ),
+    m_flashCacheState( flashCacheState ),
+    m_flashCacheTolerance( flashCacheTolerance ),
+    m_flashCacheStatistics( flashCacheStatistics )
   {}
 
   /// Default copy constructor
@@ -145,6 +156,13 @@ public:
                        real64 const temperature,
                        arraySlice1d< real64 const > const & composition ) const override
   {
+    if( checkFlashCache( m_flashCacheState[k][q], pressure, temperature, composition ) )
+    {
+      ++m_flashCacheStatistics[0];
+      return;
+    }
+    ++m_flashCacheStatistics[1];
+
     Compute( pressure,
              temperature,
              composition,
@@ -172,10 +190,55 @@ public:
 
 private:
 
+  /**
+   * @brief Compare a state with the cached state of a point, and replace the latter on a miss.
+   * @param cachedState the cached pressure, temperature and composition of the point
+   * @param pressure the pressure
+   * @param temperature the temperature
+   * @param composition the composition
+   * @return true if the cached phase equilibrium can be reused
+   */
+  GEOSX_FORCE_INLINE
+  bool checkFlashCache( arraySlice1d< real64 > const & cachedState,
+                        real64 const pressure,
+                        real64 const temperature,
+                        arraySlice1d< real64 const > const & composition ) const
+  {
+    localIndex const NC = numComponents();
+
+    bool hit = m_flashCacheTolerance >= 0.0
+               && fabs( pressure - cachedState[0] ) <= m_flashCacheTolerance * fabs( cachedState[0] )
+               && fabs( temperature - cachedState[1] ) <= m_flashCacheTolerance * fabs( cachedState[1] );
+    for( localIndex ic = 0; hit && ic < NC; ++ic )
+    {
+      hit = fabs( composition[ic] - cachedState[2+ic] ) <= m_flashCacheTolerance;
+    }
+
+    if( !hit )
+    {
+      cachedState[0] = pressure;
+      cachedState[1] = temperature;
+      for( localIndex ic = 0; ic < NC; ++ic )
+      {
+        cachedState[2+ic] = composition[ic];
+      }
+    }
+    return hit;
+  }
+
   PVTPackage::MultiphaseSystem & m_fluid;
 
   arrayView1d< PVTPackage::PHASE_TYPE > m_phaseTypes;
 
+  /// Pressure, temperature and composition of the last flash of each point
+  arrayView3d< real64 > m_flashCacheState;
+
+  /// Tolerance below which the cached phase equilibrium is reused
+  real64 const m_flashCacheTolerance;
+
+  /// Number of cache hits and misses
+  arrayView1d< globalIndex > m_flashCacheStatistics;
+
 };
 
 class MultiFluidPVTPackageWrapper : public MultiFluidBase
@@ -190,6 +253,30 @@ public:
   deliverClone( string const & name,
                 Group * const parent ) const override;
 
+  virtual void allocateConstitutiveData( dataRepository::Group * const parent,
+                                         localIndex const numConstitutivePointsPerParentIndex ) override;
+
+  /**
+   * @brief Discard the cached phase equilibria, so that the next update of each point performs a flash.
+   *
+   * Called at the beginning of a time step, so that a positive cache tolerance cannot carry
+   * the phase equilibrium of a previous step into the converged state of the next one.
+   */
+  void invalidateFlashCache();
+
+  /**
+   * @brief Add the flash cache statistics gathered since the last call, and reset them.
+   * @param[inout] numHits the number of updates that reused the cached phase equilibrium
+   * @param[inout] numMisses the number of updates that performed a phase equilibrium calculation
+   */
+  void collectFlashCacheStatistics( globalIndex & numHits, globalIndex & numMisses );
+
+  struct viewKeyStruct : MultiFluidBase::viewKeyStruct
+  {
+    static constexpr auto flashCacheStateString = "flashCacheState";
+    static constexpr auto flashCacheToleranceString = "flashCacheTolerance";
+  };
+
   /// Type of kernel wrapper for in-kernel update
   using KernelWrapper = MultiFluidPVTPackageWrapperUpdate;
 
@@ -222,7 +309,10 @@ public:
                           m_totalDensity,
                           m_dTotalDensity_dPressure,
                           m_dTotalDensity_dTemperature,
-                          m_dTotalDensity_dGlobalCompFraction );
+                          m_dTotalDensity_dGlobalCompFraction,
+                          m_flashCacheState,
+                          m_flashCacheTolerance,
+                          m_flashCacheStatistics );
   }
 
 protected:
@@ -239,6 +329,15 @@ protected:
 
   /// PVTPackage phase labels
   array1d< PVTPackage::PHASE_TYPE > m_phaseTypes;
+
+  /// Pressure, temperature and composition of the last flash of each point
+  array3d< real64 > m_flashCacheState;
+
+  /// Tolerance below which the cached phase equilibrium is reused
+  real64 m_flashCacheTolerance;
+
+  /// Number of cache hits and misses since the last collection
+  array1d< globalIndex > m_flashCacheStatistics;
 };
 
 } //namespace constitutive
@@ -20,8 +20,7 @@
 #include "common/Path.hpp"
 #include "managers/ProblemManager.hpp"
 #include "constitutive/fluid/MultiFluidUtils.hpp"
-#include "PVTFunctions/FlashModelBase.hpp"
-#include "PVTFunctions/PVTFunctionBase.hpp"
+#include "PVTFunctions/pvtFunctionSelector.hpp"
 
 
 namespace geosx
@@ -89,8 +88,10 @@ void MultiPhaseMultiComponentFluid::PostProcessInput()
   MultiFluidBase::PostProcessInput();
 
   localIndex const NP = numFluidPhases();
+  localIndex const NC = numFluidComponents();
 
   GEOSX_ERROR_IF( m_phasePVTParaFiles.size() != NP, "The number of phasePVTParaFiles is not the same as the number of phases!" );
+  GEOSX_ERROR_IF( NC != 2 && NC != 3, "The number of components must be 2 or 3, got " << NC );
 
   CreatePVTModels();
 
@@ -257,17 +258,49 @@ void MultiPhaseMultiComponentFluidUpdate::Compute( real64 pressure,
   GEOSX_UNUSED_VAR( phaseFrac, phaseDens, phaseVisc, phaseCompFrac, totalDens );
 #endif
 
-  localIndex constexpr maxNumComp = MultiFluidBase::MAX_NUM_COMPONENTS;
+  switch( numComponents() )
+  {
+    case 2:
+    {
+      compute< 2 >( pressure, temperature, composition, phaseFrac, phaseDens, phaseVisc, phaseCompFrac, totalDens );
+      break;
+    }
+    case 3:
+    {
+      compute< 3 >( pressure, temperature, composition, phaseFrac, phaseDens, phaseVisc, phaseCompFrac, totalDens );
+      break;
+    }
+    default:
+    {
+      GEOSX_ERROR( "Unsupported number of components: " << numComponents() );
+    }
+  }
+}
+
+template< int NC >
+void MultiPhaseMultiComponentFluidUpdate::compute( real64 const pressure,
+                                                   real64 const temperature,
+                                                   arraySlice1d< real64 const > const & composition,
+                                                   CompositionalVarContainer< 1 > const & phaseFrac,
+                                                   CompositionalVarContainer< 1 > const & phaseDens,
+                                                   CompositionalVarContainer< 1 > const & phaseVisc,
+                                                   CompositionalVarContainer< 2 > const & phaseCompFrac,
+                                                   CompositionalVarContainer< 0 > const & totalDens ) const
+{
+  using EvalArgsNC = EvalCompArgs< NC >;
+
   localIndex constexpr maxNumPhase = MultiFluidBase::MAX_NUM_PHASES;
-  localIndex const NC = numComponents();
   localIndex const NP = numPhases();
 
-  stackArray1d< EvalVarArgs, maxNumComp > C( NC );
+  // temperature conversion from Kelvin to the Celsius degrees expected by the PVT functions
+  real64 constexpr TK = 273.15;
+
+  stackArray1d< EvalArgsNC, NC > C( NC );
 
   if( m_useMass )
   {
-    stackArray1d< EvalVarArgs, maxNumComp > X( NC );
-    EvalVarArgs totalMolality = 0.0;
+    stackArray1d< EvalArgsNC, NC > X( NC );
+    EvalArgsNC totalMolality = 0.0;
     for( localIndex ic = 0; ic < NC; ++ic )
     {
       X[ic].m_var = composition[ic];
@@ -292,40 +325,51 @@ void MultiPhaseMultiComponentFluidUpdate::Compute( real64 pressure,
     }
   }
 
-  EvalVarArgs P =  pressure;
+  EvalArgsNC P = pressure;
   P.m_der[0] = 1.0;
 
-  static real64 TK = 273.15;
-  EvalVarArgs T =  temperature - TK;
+  EvalArgsNC T = temperature - TK;
 
-  stackArray1d< EvalVarArgs, maxNumPhase > phaseFractionTemp( NP );
-  stackArray2d< EvalVarArgs, maxNumPhase * maxNumComp > phaseCompFractionTemp( NP, NC );
+  stackArray1d< EvalArgsNC, maxNumPhase > phaseFractionTemp( NP );
+  stackArray2d< EvalArgsNC, maxNumPhase * NC > phaseCompFractionTemp( NP, NC );
 
   //phaseFractionTemp and phaseCompFractionTemp all are mole fraction,
   //w.r.t mole fraction or mass fraction (useMass)
-  m_flashModel->Partition( P, T, C, phaseFractionTemp, phaseCompFractionTemp );
+  flashModelPassThru( *m_flashModel, [&]( auto const & flashModel )
+  {
+    flashModel.template Partition< NC >( P, T, C, phaseFractionTemp, phaseCompFractionTemp );
+  } );
 
-  stackArray1d< EvalVarArgs, maxNumPhase > phaseDensityTemp( NP );
-  stackArray1d< EvalVarArgs, maxNumPhase > phaseViscosityTemp( NP );
+  stackArray1d< EvalArgsNC, maxNumPhase > phaseDensityTemp( NP );
+  stackArray1d< EvalArgsNC, maxNumPhase > phaseViscosityTemp( NP );
+  stackArray1d< EvalArgsNC, maxNumPhase > molarPhaseDensityTemp( NP );
 
   for( localIndex ip = 0; ip < NP; ++ip )
   {
     // molarDensity or massDensity (useMass)
-    m_phaseDensityFuns[ip]->Evaluation( P, T, phaseCompFractionTemp[ip], phaseDensityTemp[ip], m_useMass );
-    m_phaseViscosityFuns[ip]->Evaluation( P, T, phaseCompFractionTemp[ip], phaseViscosityTemp[ip] );
+    pvtFunctionPassThru( *m_phaseDensityFuns[ip], [&]( auto const & densityFun )
+    {
+      densityFun.template Evaluation< NC >( P, T, phaseCompFractionTemp[ip], phaseDensityTemp[ip], m_useMass );
+      if( m_useMass )
+      {
+        densityFun.template Evaluation< NC >( P, T, phaseCompFractionTemp[ip], molarPhaseDensityTemp[ip], 0 );
+      }
+    } );
+    pvtFunctionPassThru( *m_phaseViscosityFuns[ip], [&]( auto const & viscosityFun )
+    {
+      viscosityFun.template Evaluation< NC >( P, T, phaseCompFractionTemp[ip], phaseViscosityTemp[ip] );
+    } );
   }
 
   if( m_useMass )
   {
-    stackArray1d< EvalVarArgs, maxNumPhase > phaseMW( NP );
+    stackArray1d< EvalArgsNC, maxNumPhase > phaseMW( NP );
     for( localIndex ip = 0; ip < NP; ++ip )
     {
-      EvalVarArgs molarPhaseDensity;
-      m_phaseDensityFuns[ip]->Evaluation( P, T, phaseCompFractionTemp[ip], molarPhaseDensity, 0 );
-      phaseMW[ip] =  phaseDensityTemp[ip] /  molarPhaseDensity;
+      phaseMW[ip] =  phaseDensityTemp[ip] /  molarPhaseDensityTemp[ip];
     }
 
-    EvalVarArgs totalMass = 0.0;
+    EvalArgsNC totalMass = 0.0;
     for( localIndex ip = 0; ip < NP; ++ip )
     {
       phaseFractionTemp[ip] *= phaseMW[ip];
@@ -350,7 +394,7 @@ void MultiPhaseMultiComponentFluidUpdate::Compute( real64 pressure,
     }
   }
 
-  EvalVarArgs totalDensityTemp = 0.0;
+  EvalArgsNC totalDensityTemp = 0.0;
   for( localIndex ip = 0; ip < NP; ++ip )
   {
     totalDensityTemp += phaseFractionTemp[ip] / phaseDensityTemp[ip];
@@ -44,6 +44,9 @@ class FlashModel;
 namespace constitutive
 {
 
+template< int DIM >
+struct CompositionalVarContainer;
+
 /**
  * @brief Kernel wrapper class for MultiPhaseMultiComponentFluid.
  * @note Not thread-safe, do not use with any parallel launch policy.
@@ -183,6 +186,20 @@ public:
 
 private:
 
+  /**
+   * @brief Compute the fluid properties with derivatives sized for @p NC components.
+   * @tparam NC the number of components
+   */
+  template< int NC >
+  void compute( real64 const pressure,
+                real64 const temperature,
+                arraySlice1d< real64 const > const & composition,
+                CompositionalVarContainer< 1 > const & phaseFrac,
+                CompositionalVarContainer< 1 > const & phaseDens,
+                CompositionalVarContainer< 1 > const & phaseVisc,
+                CompositionalVarContainer< 2 > const & phaseCompFrac,
+                CompositionalVarContainer< 0 > const & totalDens ) const;
+
   std::vector< std::shared_ptr< PVTProps::PVTFunction const > > m_phaseDensityFuns;
   std::vector< std::shared_ptr< PVTProps::PVTFunction const > > m_phaseViscosityFuns;
   std::shared_ptr< PVTProps::FlashModel const > m_flashModel;
@@ -29,7 +29,7 @@ namespace PVTProps
 BrineCO2DensityFunction::BrineCO2DensityFunction( string_array const & inputPara,
                                                   string_array const & componentNames,
                                                   real64_array const & componentMolarWeight ):
-  PVTFunction( inputPara[1], componentNames, componentMolarWeight )
+  PVTFunction( inputPara[1], PVTFuncModel::BRINECO2DENSITY, componentNames, componentMolarWeight )
 {
   bool notFound = 1;
 
@@ -138,49 +138,6 @@ void BrineCO2DensityFunction::MakeTable( string_array const & inputPara )
 }
 
 
-void BrineCO2DensityFunction::Evaluation( EvalVarArgs const & pressure, EvalVarArgs const & temperature,
-                                          arraySlice1d< EvalVarArgs const > const & phaseComposition, EvalVarArgs & value, bool useMass ) const
-{
-  EvalArgs2D P, T, density;
-  P.m_var = pressure.m_var;
-  P.m_der[0] = 1.0;
-
-  T.m_var = temperature.m_var;
-  T.m_der[1] = 1.0;
-
-  density = m_BrineDensityTable->Value( P, T );
-
-  constexpr real64 a = 37.51;
-  constexpr real64 b = -9.585e-2;
-  constexpr real64 c = 8.740e-4;
-  constexpr real64 d = -5.044e-7;
-
-  real64 temp = T.m_var;
-
-  real64 const V = (a + b * temp + c * temp * temp + d * temp * temp * temp) * 1e-6;
-
-  real64 const CO2MW = m_componentMolarWeight[m_CO2Index];
-  real64 const waterMW = m_componentMolarWeight[m_waterIndex];
-
-  EvalVarArgs den, C, X;
-
-  den.m_var = density.m_var;
-  den.m_der[0] = density.m_der[0];
-
-  X = phaseComposition[m_CO2Index];
-
-  C = X * den / (waterMW * (1.0 - X));
-
-  if( useMass )
-  {
-    value = den + CO2MW * C - C * den * V;
-  }
-  else
-  {
-    value = den / waterMW + C - C * den * V / waterMW;
-  }
-}
-
 void BrineCO2DensityFunction::CalculateBrineDensity( real64_array const & pressure, real64_array const & temperature, real64 const & salinity,
                                                      real64_array2d const & density )
 {
@@ -48,11 +48,12 @@ public:
 
   }
 
-  virtual void Evaluation( EvalVarArgs const & pressure,
-                           EvalVarArgs const & temperature,
-                           arraySlice1d< EvalVarArgs const > const & phaseComposition,
-                           EvalVarArgs & value,
-                           bool useMass = 0 ) const override;
+  template< int NC >
+  void Evaluation( EvalCompArgs< NC > const & pressure,
+                   EvalCompArgs< NC > const & temperature,
+                   arraySlice1d< EvalCompArgs< NC > const > const & phaseComposition,
+                   EvalCompArgs< NC > & value,
+                   bool useMass = 0 ) const;
 
 
 private:
@@ -67,6 +68,53 @@ private:
 
 };
 
+template< int NC >
+void BrineCO2DensityFunction::Evaluation( EvalCompArgs< NC > const & pressure,
+                                          EvalCompArgs< NC > const & temperature,
+                                          arraySlice1d< EvalCompArgs< NC > const > const & phaseComposition,
+                                          EvalCompArgs< NC > & value,
+                                          bool useMass ) const
+{
+  EvalArgs2D P, T, density;
+  P.m_var = pressure.m_var;
+  P.m_der[0] = 1.0;
+
+  T.m_var = temperature.m_var;
+  T.m_der[1] = 1.0;
+
+  density = m_BrineDensityTable->Value( P, T );
+
+  constexpr real64 a = 37.51;
+  constexpr real64 b = -9.585e-2;
+  constexpr real64 c = 8.740e-4;
+  constexpr real64 d = -5.044e-7;
+
+  real64 temp = T.m_var;
+
+  real64 const V = (a + b * temp + c * temp * temp + d * temp * temp * temp) * 1e-6;
+
+  real64 const CO2MW = m_componentMolarWeight[m_CO2Index];
+  real64 const waterMW = m_componentMolarWeight[m_waterIndex];
+
+  EvalCompArgs< NC > den, C, X;
+
+  den.m_var = density.m_var;
+  den.m_der[0] = density.m_der[0];
+
+  X = phaseComposition[m_CO2Index];
+
+  C = X * den / (waterMW * (1.0 - X));
+
+  if( useMass )
+  {
+    value = den + CO2MW * C - C * den * V;
+  }
+  else
+  {
+    value = den / waterMW + C - C * den * V / waterMW;
+  }
+}
+
 }
 
 }
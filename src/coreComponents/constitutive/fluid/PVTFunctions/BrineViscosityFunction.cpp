@@ -30,7 +30,7 @@ namespace PVTProps
 BrineViscosityFunction::BrineViscosityFunction( string_array const & inputPara,
                                                 string_array const & componentNames,
                                                 real64_array const & componentMolarWeight ):
-  PVTFunction( inputPara[1], componentNames, componentMolarWeight )
+  PVTFunction( inputPara[1], PVTFuncModel::BRINEVISCOSITY, componentNames, componentMolarWeight )
 {
 
   MakeCoef( inputPara );
@@ -73,15 +73,6 @@ void BrineViscosityFunction::MakeCoef( string_array const & inputPara )
 }
 
 
-void BrineViscosityFunction::Evaluation( EvalVarArgs const & GEOSX_UNUSED_PARAM(
-                                           pressure ), EvalVarArgs const & temperature, arraySlice1d< EvalVarArgs const > const & GEOSX_UNUSED_PARAM(
-                                           phaseComposition ), EvalVarArgs & value, bool GEOSX_UNUSED_PARAM( useMass )) const
-{
-
-  value = m_coef0 + m_coef1 * temperature;
-
-}
-
 REGISTER_CATALOG_ENTRY( PVTFunction,
                         BrineViscosityFunction,
                         string_array const &, string_array const &, real64_array const & )
@@ -48,10 +48,12 @@ public:
 
   }
 
-  virtual void Evaluation( EvalVarArgs const & pressure,
-                           EvalVarArgs const & temperature,
-                           arraySlice1d< EvalVarArgs const > const & phaseComposition,
-                           EvalVarArgs & value, bool useMass = 0 ) const override;
+  template< int NC >
+  void Evaluation( EvalCompArgs< NC > const & pressure,
+                   EvalCompArgs< NC > const & temperature,
+                   arraySlice1d< EvalCompArgs< NC > const > const & phaseComposition,
+                   EvalCompArgs< NC > & value,
+                   bool useMass = 0 ) const;
 
 private:
 
@@ -62,6 +64,16 @@ private:
 
 };
 
+template< int NC >
+void BrineViscosityFunction::Evaluation( EvalCompArgs< NC > const & GEOSX_UNUSED_PARAM( pressure ),
+                                         EvalCompArgs< NC > const & temperature,
+                                         arraySlice1d< EvalCompArgs< NC > const > const & GEOSX_UNUSED_PARAM( phaseComposition ),
+                                         EvalCompArgs< NC > & value,
+                                         bool GEOSX_UNUSED_PARAM( useMass ) ) const
+{
+  value = m_coef0 + m_coef1 * temperature;
+}
+
 }
 
 }
@@ -28,8 +28,6 @@ using namespace stringutilities;
 namespace PVTProps
 {
 
-constexpr real64 minForDivision = 1e-10;
-
 constexpr real64 T_K_f = 273.15;
 constexpr real64 P_Pa_f = 1e+5;
 constexpr real64 P_c = 73.773 * P_Pa_f;
@@ -172,7 +170,7 @@ CO2SolubilityFunction::CO2SolubilityFunction( string_array const & inputPara,
                                               string_array const & phaseNames,
                                               string_array const & componentNames,
                                               real64_array const & componentMolarWeight ):
-  FlashModel( inputPara[1], componentNames, componentMolarWeight )
+  FlashModel( inputPara[1], FlashModelType::CO2SOLUBILITY, componentNames, componentMolarWeight )
 {
 
   bool notFound = 1;
@@ -316,75 +314,6 @@ void CO2SolubilityFunction::MakeTable( string_array const & inputPara )
 
 }
 
-void CO2SolubilityFunction::Partition( EvalVarArgs const & pressure, EvalVarArgs const & temperature, arraySlice1d< EvalVarArgs const > const & compFraction,
-                                       arraySlice1d< EvalVarArgs > const & phaseFraction, arraySlice2d< EvalVarArgs > const & phaseCompFraction ) const
-{
-
-  EvalArgs2D P, T, solubility;
-  P.m_var = pressure.m_var;
-  P.m_der[0] = 1.0;
-
-  T.m_var = temperature.m_var;
-  T.m_der[1] = 1.0;
-
-  //solubiltiy mol/kg(water)  X = Csat/W
-  solubility = m_CO2SolubilityTable->Value( P, T );
-
-  real64 const waterMW = m_componentMolarWeight[m_waterIndex];
-
-  solubility *= waterMW;
-
-  EvalVarArgs X, Y;
-
-  X.m_var = solubility.m_var;
-  X.m_der[0] = solubility.m_der[0];
-
-  //Y = C/W = z/(1-z)
-
-  if( compFraction[m_CO2Index].m_var > 1.0 - minForDivision )
-  {
-    Y = compFraction[m_CO2Index] / minForDivision;
-  }
-  else
-  {
-    Y = compFraction[m_CO2Index] / (1.0 - compFraction[m_CO2Index]);
-  }
-
-  if( Y < X )
-  {
-    //liquid phase only
-
-    phaseFraction[m_phaseLiquidIndex] = 1.0;
-    phaseFraction[m_phaseGasIndex] = 0.0;
-
-    for( localIndex c = 0; c < m_componentNames.size(); ++c )
-    {
-      phaseCompFraction[m_phaseLiquidIndex][c] = compFraction[c];
-    }
-
-  }
-  else
-  {
-    // two-phase
-    // liquid phase fraction = (Csat + W) / (C + W) = (Csat/W + 1) / (C/W + 1)
-
-    phaseFraction[m_phaseLiquidIndex] = (X + 1.0)/ (Y + 1.0);
-    phaseFraction[m_phaseGasIndex] = 1.0 - phaseFraction[m_phaseLiquidIndex];
-
-    //liquid phase composition  CO2 = Csat / (Csat + W) = (Csat/W) / (Csat/W + 1)
-
-    phaseCompFraction[m_phaseLiquidIndex][m_CO2Index] = X / (X + 1.0);
-    phaseCompFraction[m_phaseLiquidIndex][m_waterIndex] = 1.0 - phaseCompFraction[m_phaseLiquidIndex][m_CO2Index];
-
-    //gas phase composition  CO2 = 1.0
-
-    phaseCompFraction[m_phaseGasIndex][m_CO2Index] = 1.0;
-    phaseCompFraction[m_phaseGasIndex][m_waterIndex] = 0.0;
-
-  }
-}
-
-
 REGISTER_CATALOG_ENTRY( FlashModel,
                         CO2SolubilityFunction,
                         string_array const &, string_array const &, string_array const &, real64_array const & )
@@ -43,11 +43,12 @@ public:
   static string CatalogName()                    { return m_catalogName; }
   virtual string getCatalogName() const override final { return CatalogName(); }
 
-  virtual void Partition( EvalVarArgs const & pressure,
-                          EvalVarArgs const & temperature,
-                          arraySlice1d< EvalVarArgs const > const & compFraction,
-                          arraySlice1d< EvalVarArgs > const & phaseFraction,
-                          arraySlice2d< EvalVarArgs > const & phaseCompFraction ) const override;
+  template< int NC >
+  void Partition( EvalCompArgs< NC > const & pressure,
+                  EvalCompArgs< NC > const & temperature,
+                  arraySlice1d< EvalCompArgs< NC > const > const & compFraction,
+                  arraySlice1d< EvalCompArgs< NC > > const & phaseFraction,
+                  arraySlice2d< EvalCompArgs< NC > > const & phaseCompFraction ) const;
 
 private:
 
@@ -60,6 +61,79 @@ private:
   localIndex m_phaseLiquidIndex;
 };
 
+template< int NC >
+void CO2SolubilityFunction::Partition( EvalCompArgs< NC > const & pressure,
+                                       EvalCompArgs< NC > const & temperature,
+                                       arraySlice1d< EvalCompArgs< NC > const > const & compFraction,
+                                       arraySlice1d< EvalCompArgs< NC > > const & phaseFraction,
+                                       arraySlice2d< EvalCompArgs< NC > > const & phaseCompFraction ) const
+{
+  constexpr real64 minForDivision = 1e-10;
+
+  EvalArgs2D P, T, solubility;
+  P.m_var = pressure.m_var;
+  P.m_der[0] = 1.0;
+
+  T.m_var = temperature.m_var;
+  T.m_der[1] = 1.0;
+
+  //solubiltiy mol/kg(water)  X = Csat/W
+  solubility = m_CO2SolubilityTable->Value( P, T );
+
+  real64 const waterMW = m_componentMolarWeight[m_waterIndex];
+
+  solubility *= waterMW;
+
+  EvalCompArgs< NC > X, Y;
+
+  X.m_var = solubility.m_var;
+  X.m_der[0] = solubility.m_der[0];
+
+  //Y = C/W = z/(1-z)
+
+  if( compFraction[m_CO2Index].m_var > 1.0 - minForDivision )
+  {
+    Y = compFraction[m_CO2Index] / minForDivision;
+  }
+  else
+  {
+    Y = compFraction[m_CO2Index] / (1.0 - compFraction[m_CO2Index]);
+  }
+
+  if( Y < X )
+  {
+    //liquid phase only
+
+    phaseFraction[m_phaseLiquidIndex] = 1.0;
+    phaseFraction[m_phaseGasIndex] = 0.0;
+
+    for( localIndex c = 0; c < NC; ++c )
+    {
+      phaseCompFraction[m_phaseLiquidIndex][c] = compFraction[c];
+    }
+
+  }
+  else
+  {
+    // two-phase
+    // liquid phase fraction = (Csat + W) / (C + W) = (Csat/W + 1) / (C/W + 1)
+
+    phaseFraction[m_phaseLiquidIndex] = (X + 1.0)/ (Y + 1.0);
+    phaseFraction[m_phaseGasIndex] = 1.0 - phaseFraction[m_phaseLiquidIndex];
+
+    //liquid phase composition  CO2 = Csat / (Csat + W) = (Csat/W) / (Csat/W + 1)
+
+    phaseCompFraction[m_phaseLiquidIndex][m_CO2Index] = X / (X + 1.0);
+    phaseCompFraction[m_phaseLiquidIndex][m_waterIndex] = 1.0 - phaseCompFraction[m_phaseLiquidIndex][m_CO2Index];
+
+    //gas phase composition  CO2 = 1.0
+
+    phaseCompFraction[m_phaseGasIndex][m_CO2Index] = 1.0;
+    phaseCompFraction[m_phaseGasIndex][m_waterIndex] = 0.0;
+
+  }
+}
+
 }
 
 }
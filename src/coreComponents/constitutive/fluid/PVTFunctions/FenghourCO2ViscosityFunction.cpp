@@ -29,7 +29,7 @@ namespace PVTProps
 FenghourCO2ViscosityFunction::FenghourCO2ViscosityFunction( string_array const & inputPara,
                                                             string_array const & componentNames,
                                                             real64_array const & componentMolarWeight ):
-  PVTFunction( inputPara[1], componentNames, componentMolarWeight )
+  PVTFunction( inputPara[1], PVTFuncModel::FENGHOURCO2VISCOSITY, componentNames, componentMolarWeight )
 {
 
   MakeTable( inputPara );
@@ -104,22 +104,6 @@ void FenghourCO2ViscosityFunction::MakeTable( string_array const & inputPara )
 
 }
 
-void FenghourCO2ViscosityFunction::Evaluation( EvalVarArgs const & pressure, EvalVarArgs const & temperature, arraySlice1d< EvalVarArgs const > const & GEOSX_UNUSED_PARAM(
-                                                 phaseComposition ), EvalVarArgs & value, bool GEOSX_UNUSED_PARAM( useMass )) const
-{
-  EvalArgs2D P, T, viscosity;
-  P.m_var = pressure.m_var;
-  P.m_der[0] = 1.0;
-
-  T.m_var = temperature.m_var;
-  T.m_der[1] = 1.0;
-
-  viscosity = m_CO2ViscosityTable->Value( P, T );
-
-  value.m_var = viscosity.m_var;
-  value.m_der[0] = viscosity.m_der[0];
-}
-
 void FenghourCO2ViscosityFunction::FenghourCO2Viscosity( real64 const & Tcent, real64 const & den, real64 & vis )
 {
   constexpr real64 espar = 251.196;
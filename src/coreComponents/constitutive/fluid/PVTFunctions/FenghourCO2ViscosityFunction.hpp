@@ -47,10 +47,12 @@ public:
 
   }
 
-  virtual void Evaluation( EvalVarArgs const & pressure,
-                           EvalVarArgs const & temperature,
-                           arraySlice1d< EvalVarArgs const > const & phaseComposition,
-                           EvalVarArgs & value, bool useMass = 0 ) const override;
+  template< int NC >
+  void Evaluation( EvalCompArgs< NC > const & pressure,
+                   EvalCompArgs< NC > const & temperature,
+                   arraySlice1d< EvalCompArgs< NC > const > const & phaseComposition,
+                   EvalCompArgs< NC > & value,
+                   bool useMass = 0 ) const;
 
 
 private:
@@ -65,6 +67,26 @@ private:
   TableFunctionPtr m_CO2ViscosityTable;
 };
 
+template< int NC >
+void FenghourCO2ViscosityFunction::Evaluation( EvalCompArgs< NC > const & pressure,
+                                               EvalCompArgs< NC > const & temperature,
+                                               arraySlice1d< EvalCompArgs< NC > const > const & GEOSX_UNUSED_PARAM( phaseComposition ),
+                                               EvalCompArgs< NC > & value,
+                                               bool GEOSX_UNUSED_PARAM( useMass ) ) const
+{
+  EvalArgs2D P, T, viscosity;
+  P.m_var = pressure.m_var;
+  P.m_der[0] = 1.0;
+
+  T.m_var = temperature.m_var;
+  T.m_der[1] = 1.0;
+
+  viscosity = m_CO2ViscosityTable->Value( P, T );
+
+  value.m_var = viscosity.m_var;
+  value.m_der[0] = viscosity.m_der[0];
+}
+
 }
 
 }
@@ -28,15 +28,19 @@ namespace geosx
 namespace PVTProps
 {
 
+/// Concrete flash models, used to dispatch the partitions without virtual calls
+enum class FlashModelType {CO2SOLUBILITY};
 
 class FlashModel
 {
 public:
 
   FlashModel( string const & name,
+              FlashModelType const modelType,
               string_array const & componentNames,
               real64_array const & componentMolarWeight ):
     m_modelName( name ),
+    m_modelType( modelType ),
     m_componentNames( componentNames ),
     m_componentMolarWeight( componentMolarWeight )
   {}
@@ -60,18 +64,21 @@ public:
     return m_modelName;
   }
 
+  FlashModelType ModelType() const
+  {
+    return m_modelType;
+  }
+
   //partition
   //input: P, T, totalCompFraction
   //output: phaseFraction, phaseCompFraction
-
-  virtual void Partition( EvalVarArgs const & pressure,
-                          EvalVarArgs const & temperature,
-                          arraySlice1d< EvalVarArgs const > const & compFraction,
-                          arraySlice1d< EvalVarArgs > const & phaseFraction,
-                          arraySlice2d< EvalVarArgs > const & phaseCompFraction ) const = 0;
+  //
+  //each model implements a non-virtual Partition templated on the number of
+  //components, called through flashModelPassThru (see pvtFunctionSelector.hpp)
 
 protected:
   string m_modelName;
+  FlashModelType m_modelType;
   string_array m_componentNames;
   real64_array m_componentMolarWeight;
 
@@ -30,12 +30,19 @@ namespace PVTProps
 
 enum class PVTFuncType {UNKNOWN, DENSITY, VISCOSITY};
 
+/// Concrete PVT function models, used to dispatch the evaluations without virtual calls
+enum class PVTFuncModel {BRINECO2DENSITY, BRINEVISCOSITY, FENGHOURCO2VISCOSITY, SPANWAGNERCO2DENSITY};
+
 class PVTFunction
 {
 public:
 
-  PVTFunction( string const & name, string_array const & componentNames, real64_array const & componentMolarWeight ):
+  PVTFunction( string const & name,
+               PVTFuncModel const functionModel,
+               string_array const & componentNames,
+               real64_array const & componentMolarWeight ):
     m_functionName( name ),
+    m_functionModel( functionModel ),
     m_componentNames( componentNames ),
     m_componentMolarWeight( componentMolarWeight )
   {}
@@ -61,16 +68,22 @@ public:
 
   virtual PVTFuncType FunctionType() const = 0;
 
+  PVTFuncModel FunctionModel() const
+  {
+    return m_functionModel;
+  }
+
   //phase density/viscosity
   //input: P, T, phaseCompFraction
   //output: phase density/viscoty
-
-  virtual void Evaluation( EvalVarArgs const & pressure, EvalVarArgs const & temperature, arraySlice1d< EvalVarArgs const > const & phaseComposition,
-                           EvalVarArgs & value, bool useMass = 0 ) const = 0;
+  //
+  //each model implements a non-virtual Evaluation templated on the number of
+  //components, called through pvtFunctionPassThru (see pvtFunctionSelector.hpp)
 
 protected:
 
   string m_functionName;
+  PVTFuncModel m_functionModel;
   string_array m_componentNames;
   real64_array m_componentMolarWeight;
 
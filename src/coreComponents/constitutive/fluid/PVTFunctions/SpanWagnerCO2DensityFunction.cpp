@@ -125,7 +125,7 @@ real64 f( const real64 & T, const real64 & P, const real64 & rho )
 
 
 SpanWagnerCO2DensityFunction::SpanWagnerCO2DensityFunction( string_array const & inputPara, string_array const & componentNames,
-                                                            real64_array const & componentMolarWeight ): PVTFunction( inputPara[1], componentNames,
+                                                            real64_array const & componentMolarWeight ): PVTFunction( inputPara[1], PVTFuncModel::SPANWAGNERCO2DENSITY, componentNames,
                                                                                                                       componentMolarWeight )
 {
 
@@ -220,33 +220,6 @@ void SpanWagnerCO2DensityFunction::MakeTable( string_array const & inputPara )
 }
 
 
-void SpanWagnerCO2DensityFunction::Evaluation( EvalVarArgs const & pressure, EvalVarArgs const & temperature, arraySlice1d< EvalVarArgs const > const & GEOSX_UNUSED_PARAM(
-                                                 phaseComposition ), EvalVarArgs & value, bool useMass ) const
-{
-
-  EvalArgs2D P, T, density;
-  P.m_var = pressure.m_var;
-  P.m_der[0] = 1.0;
-
-  T.m_var = temperature.m_var;
-  T.m_der[1] = 1.0;
-
-  density = m_CO2DensityTable->Value( P, T );
-
-  real64 CO2MW = m_componentMolarWeight[m_CO2Index];
-
-  if( !useMass )
-  {
-
-    density /= CO2MW;
-
-  }
-
-  value.m_var = density.m_var;
-  value.m_der[0] = density.m_der[0];
-
-}
-
 void SpanWagnerCO2DensityFunction::CalculateCO2Density( real64_array const & pressure, real64_array const & temperature, real64_array2d const & density )
 {
 
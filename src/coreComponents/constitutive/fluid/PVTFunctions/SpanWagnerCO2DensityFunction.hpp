@@ -49,8 +49,12 @@ public:
     return PVTFuncType::DENSITY;
   }
 
-  virtual void Evaluation( EvalVarArgs const & pressure, EvalVarArgs const & temperature, arraySlice1d< EvalVarArgs const > const & phaseComposition,
-                           EvalVarArgs & value, bool useMass = 0 ) const override;
+  template< int NC >
+  void Evaluation( EvalCompArgs< NC > const & pressure,
+                   EvalCompArgs< NC > const & temperature,
+                   arraySlice1d< EvalCompArgs< NC > const > const & phaseComposition,
+                   EvalCompArgs< NC > & value,
+                   bool useMass = 0 ) const;
 
   static void CalculateCO2Density( real64_array const & pressure, real64_array const & temperature, real64_array2d const & density );
 
@@ -66,6 +70,33 @@ private:
 
 };
 
+template< int NC >
+void SpanWagnerCO2DensityFunction::Evaluation( EvalCompArgs< NC > const & pressure,
+                                               EvalCompArgs< NC > const & temperature,
+                                               arraySlice1d< EvalCompArgs< NC > const > const & GEOSX_UNUSED_PARAM( phaseComposition ),
+                                               EvalCompArgs< NC > & value,
+                                               bool useMass ) const
+{
+  EvalArgs2D P, T, density;
+  P.m_var = pressure.m_var;
+  P.m_der[0] = 1.0;
+
+  T.m_var = temperature.m_var;
+  T.m_der[1] = 1.0;
+
+  density = m_CO2DensityTable->Value( P, T );
+
+  real64 CO2MW = m_componentMolarWeight[m_CO2Index];
+
+  if( !useMass )
+  {
+    density /= CO2MW;
+  }
+
+  value.m_var = density.m_var;
+  value.m_der[0] = density.m_der[0];
+}
+
 }
 
 }
@@ -28,8 +28,6 @@ namespace geosx
 namespace PVTProps
 {
 
-constexpr localIndex MAX_VAR_DIM = 10;
-
 template< typename T, int Dim >
 class EvalArgs
 {
@@ -186,7 +184,7 @@ public:
 
   bool operator==( const EvalArgs & arg ) const
   {
-    if( this->m_var != arg._m_var ) return false;
+    if( this->m_var != arg.m_var ) return false;
 
     for( localIndex i = 0; i < Dim; ++i )
     {
@@ -413,7 +411,15 @@ inline bool operator<=( const T & arg1, const EvalArgs< T, Dim > & arg2 )
 typedef EvalArgs< real64, 1 > EvalArgs1D;
 typedef EvalArgs< real64, 2 > EvalArgs2D;
 typedef EvalArgs< real64, 3 > EvalArgs3D;
-typedef EvalArgs< real64, MAX_VAR_DIM > EvalVarArgs;
+
+/**
+ * @brief Value with its derivatives with respect to pressure and to the fractions of @p NC components.
+ * @tparam NC the number of components
+ *
+ * The derivative with respect to pressure is stored first, followed by the component derivatives.
+ */
+template< int NC >
+using EvalCompArgs = EvalArgs< real64, NC + 1 >;
 
 class TableFunctionBase
 {
@@ -0,0 +1,97 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file pvtFunctionSelector.hpp
+ */
+
+#ifndef GEOSX_CONSTITUTIVE_FLUID_PVTFUNCTIONS_PVTFUNCTIONSELECTOR_HPP_
+#define GEOSX_CONSTITUTIVE_FLUID_PVTFUNCTIONS_PVTFUNCTIONSELECTOR_HPP_
+
+#include "constitutive/fluid/PVTFunctions/BrineCO2DensityFunction.hpp"
+#include "constitutive/fluid/PVTFunctions/BrineViscosityFunction.hpp"
+#include "constitutive/fluid/PVTFunctions/CO2SolubilityFunction.hpp"
+#include "constitutive/fluid/PVTFunctions/FenghourCO2ViscosityFunction.hpp"
+#include "constitutive/fluid/PVTFunctions/SpanWagnerCO2DensityFunction.hpp"
+
+namespace geosx
+{
+
+namespace PVTProps
+{
+
+/**
+ * @brief Call a generic lambda with the PVT function cast to its concrete type.
+ * @tparam LAMBDA the type of @p lambda
+ * @param function the PVT function
+ * @param lambda the lambda, that takes the cast function as its argument
+ *
+ * The concrete type is selected from the model stored in the function, so the
+ * evaluations, which are templated on the number of components, are called
+ * without virtual dispatch.
+ */
+template< typename LAMBDA >
+void pvtFunctionPassThru( PVTFunction const & function,
+                          LAMBDA && lambda )
+{
+  switch( function.FunctionModel() )
+  {
+    case PVTFuncModel::BRINECO2DENSITY:
+    {
+      lambda( static_cast< BrineCO2DensityFunction const & >( function ) );
+      break;
+    }
+    case PVTFuncModel::BRINEVISCOSITY:
+    {
+      lambda( static_cast< BrineViscosityFunction const & >( function ) );
+      break;
+    }
+    case PVTFuncModel::FENGHOURCO2VISCOSITY:
+    {
+      lambda( static_cast< FenghourCO2ViscosityFunction const & >( function ) );
+      break;
+    }
+    case PVTFuncModel::SPANWAGNERCO2DENSITY:
+    {
+      lambda( static_cast< SpanWagnerCO2DensityFunction const & >( function ) );
+      break;
+    }
+  }
+}
+
+/**
+ * @brief Call a generic lambda with the flash model cast to its concrete type.
+ * @tparam LAMBDA the type of @p lambda
+ * @param flashModel the flash model
+ * @param lambda the lambda, that takes the cast model as its argument
+ */
+template< typename LAMBDA >
+void flashModelPassThru( FlashModel const & flashModel,
+                         LAMBDA && lambda )
+{
+  switch( flashModel.ModelType() )
+  {
+    case FlashModelType::CO2SOLUBILITY:
+    {
+      lambda( static_cast< CO2SolubilityFunction const & >( flashModel ) );
+      break;
+    }
+  }
+}
+
+} // namespace PVTProps
+
+} // namespace geosx
+
+#endif //GEOSX_CONSTITUTIVE_FLUID_PVTFUNCTIONS_PVTFUNCTIONSELECTOR_HPP_
@@ -108,13 +108,25 @@ static const char * pvdo_str = "#P[Pa]\tBo[m3/sm3]\tVisc(Pa.s)\n"
 static const char * pvdw_str = "#\tPref[bar]\tBw[m3/sm3]\tCp[1/bar]\t    Visc[cP]\n"
                                "\t30600000.1\t1.03\t\t0.00000000041\t0.0003";
 
+/// CO2-brine PVT and flash parameters written into temporary files during testing
+
+static const char * pvtgas_str = "DensityFun SpanWagnerCO2Density 1e6 1.5e7 5e4 94 96 1\n"
+                                 "ViscosityFun FenghourCO2Viscosity 1e6 1.5e7 5e4 94 96 1";
+
+static const char * pvtliquid_str = "DensityFun BrineCO2Density 1e6 1.5e7 5e4 94 96 1 0\n"
+                                    "ViscosityFun BrineViscosity 0";
+
+static const char * co2flash_str = "FlashModel CO2Solubility 1e6 1.5e7 5e4 94 96 1 0";
+
 void testNumericalDerivatives( MultiFluidBase & fluid,
                                real64 const P,
                                real64 const T,
                                arraySlice1d< real64 > const & composition,
                                real64 const perturbParameter,
                                real64 const relTol,
-                               real64 const absTol = std::numeric_limits< real64 >::max() )
+                               real64 const absTol = std::numeric_limits< real64 >::max(),
+                               bool const checkTemperature = true,
+                               bool const renormalizeComposition = true )
 {
   localIndex const NC = fluid.numFluidComponents();
   localIndex const NP = fluid.numFluidPhases();
@@ -210,6 +222,7 @@ void testNumericalDerivatives( MultiFluidBase & fluid,
     }
 
     // update temperature and check derivatives
+    if( checkTemperature )
     {
       real64 const dT = perturbParameter * (T + perturbParameter);
       fluidWrapper.Update( 0, 0, P, T + dT, composition );
@@ -248,11 +261,14 @@ void testNumericalDerivatives( MultiFluidBase & fluid,
       compNew[jc] += dC;
 
       // renormalize
-      real64 sum = 0.0;
-      for( localIndex ic = 0; ic < NC; ++ic )
-        sum += compNew[ic];
-      for( localIndex ic = 0; ic < NC; ++ic )
-        compNew[ic] /= sum;
+      if( renormalizeComposition )
+      {
+        real64 sum = 0.0;
+        for( localIndex ic = 0; ic < NC; ++ic )
+          sum += compNew[ic];
+        for( localIndex ic = 0; ic < NC; ++ic )
+          compNew[ic] /= sum;
+      }
 
       fluidWrapper.Update( 0, 0, P, T, compNew );
 
@@ -356,6 +372,53 @@ TEST_F( CompositionalFluidTest, numericalDerivativesMass )
   testNumericalDerivatives( *fluid, P, T, comp, eps, relTol );
 }
 
+TEST_F( CompositionalFluidTest, flashCacheReuse )
+{
+  fluid->setMassFlag( false );
+  fluid->allocateConstitutiveData( fluid->getParent(), 1 );
+
+  MultiFluidPVTPackageWrapper & pvtFluid = *fluid->group_cast< MultiFluidPVTPackageWrapper * >();
+  pvtFluid.getReference< real64 >( MultiFluidPVTPackageWrapper::viewKeyStruct::flashCacheToleranceString ) = 1e-6;
+
+  real64 const P = 5e6;
+  real64 const T = 297.15;
+  array1d< real64 > comp( 4 );
+  comp[0] = 0.099; comp[1] = 0.3; comp[2] = 0.6; comp[3] = 0.001;
+
+  MultiFluidPVTPackageWrapper::KernelWrapper fluidWrapper = pvtFluid.createKernelWrapper();
+  fluidWrapper.Update( 0, 0, P, T, comp.toSliceConst() );
+  real64 const totalDens = fluid->totalDensity()[0][0];
+
+  // an unchanged state and a change below the tolerance reuse the phase equilibrium
+  fluidWrapper.Update( 0, 0, P, T, comp.toSliceConst() );
+  fluidWrapper.Update( 0, 0, P * ( 1.0 + 1e-8 ), T, comp.toSliceConst() );
+  EXPECT_EQ( fluid->totalDensity()[0][0], totalDens );
+
+  // a change above the tolerance triggers a new calculation
+  fluidWrapper.Update( 0, 0, P * 1.01, T, comp.toSliceConst() );
+  EXPECT_NE( fluid->totalDensity()[0][0], totalDens );
+
+  globalIndex numHits = 0;
+  globalIndex numMisses = 0;
+  pvtFluid.collectFlashCacheStatistics( numHits, numMisses );
+  EXPECT_EQ( numHits, 2 );
+  EXPECT_EQ( numMisses, 2 );
+
+  // the statistics are reset once collected
+  numHits = 0;
+  numMisses = 0;
+  pvtFluid.collectFlashCacheStatistics( numHits, numMisses );
+  EXPECT_EQ( numHits, 0 );
+  EXPECT_EQ( numMisses, 0 );
+
+  // once the cache is invalidated, as at the beginning of a time step, even an unchanged state is flashed
+  pvtFluid.invalidateFlashCache();
+  fluidWrapper.Update( 0, 0, P * 1.01, T, comp.toSliceConst() );
+  pvtFluid.collectFlashCacheStatistics( numHits, numMisses );
+  EXPECT_EQ( numHits, 0 );
+  EXPECT_EQ( numMisses, 1 );
+}
+
 MultiFluidBase * makeLiveOilFluid( string const & name, Group * parent )
 {
   auto fluid = parent->RegisterGroup< BlackOilFluid >( name );
@@ -422,6 +485,33 @@ MultiFluidBase * makeDeadOilFluid( string const & name, Group * parent )
   return fluid;
 }
 
+MultiFluidBase * makeCO2BrineFluid( string const & name, Group * parent )
+{
+  auto fluid = parent->RegisterGroup< MultiPhaseMultiComponentFluid >( name );
+
+  auto & compNames = fluid->getReference< string_array >( MultiFluidBase::viewKeyStruct::componentNamesString );
+  compNames.resize( 2 );
+  compNames[0] = "co2"; compNames[1] = "water";
+
+  auto & molarWgt = fluid->getReference< array1d< real64 > >( MultiFluidBase::viewKeyStruct::componentMolarWeightString );
+  molarWgt.resize( 2 );
+  molarWgt[0] = 44e-3; molarWgt[1] = 18e-3;
+
+  auto & phaseNames = fluid->getReference< string_array >( MultiFluidBase::viewKeyStruct::phaseNamesString );
+  phaseNames.resize( 2 );
+  phaseNames[0] = "gas"; phaseNames[1] = "water";
+
+  auto & pvtFileNames = fluid->getReference< path_array >( MultiPhaseMultiComponentFluid::viewKeyStruct::phasePVTParaFilesString );
+  pvtFileNames.resize( 2 );
+  pvtFileNames[0] = "pvtgas.txt"; pvtFileNames[1] = "pvtliquid.txt";
+
+  auto & flashFileName = fluid->getReference< Path >( MultiPhaseMultiComponentFluid::viewKeyStruct::flashModelParaFileString );
+  flashFileName = "co2flash.txt";
+
+  fluid->PostProcessInputRecursive();
+  return fluid;
+}
+
 void writeTableToFile( std::string const & filename, char const * str )
 {
   std::ofstream os( filename );
@@ -560,6 +650,92 @@ TEST_F( DeadOilFluidTest, numericalDerivativesMass )
   testNumericalDerivatives( *fluid, P, T, comp, eps, relTol, absTol );
 }
 
+class CO2BrineFluidTest : public ::testing::Test
+{
+protected:
+
+  virtual void SetUp() override
+  {
+    writeTableToFile( "pvtgas.txt", pvtgas_str );
+    writeTableToFile( "pvtliquid.txt", pvtliquid_str );
+    writeTableToFile( "co2flash.txt", co2flash_str );
+
+    parent = std::make_unique< Group >( "parent", nullptr );
+    parent->resize( 1 );
+    fluid = makeCO2BrineFluid( "fluid", parent.get());
+
+    parent->Initialize( parent.get() );
+    parent->InitializePostInitialConditions( parent.get() );
+  }
+
+  virtual void TearDown() override
+  {
+    removeFile( "pvtgas.txt" );
+    removeFile( "pvtliquid.txt" );
+    removeFile( "co2flash.txt" );
+  }
+
+  /**
+   * @brief Check the derivatives of the fluid against finite differences.
+   * @param relTol the relative tolerance
+   * @param absTol the absolute tolerance
+   *
+   * The model is isothermal and reports zero temperature derivatives, which are checked as such.
+   * Its composition derivatives are partial derivatives with respect to each component fraction,
+   * the composition is hence perturbed without renormalization.
+   */
+  void testDerivatives( real64 const relTol, real64 const absTol )
+  {
+    // two-phase conditions, away from the nodes of the PVT tables
+    real64 const P = 5.012e6;
+    real64 const T = 368.5;
+    array1d< real64 > comp( 2 );
+    comp[0] = 0.3; comp[1] = 0.7;
+
+    real64 const eps = sqrt( std::numeric_limits< real64 >::epsilon());
+
+    testNumericalDerivatives( *fluid, P, T, comp, eps, relTol, absTol, false, false );
+
+    localIndex const NP = fluid->numFluidPhases();
+    localIndex const NC = fluid->numFluidComponents();
+    arrayView3d< real64 const > const & phaseFrac = fluid->phaseFraction();
+    ASSERT_GT( phaseFrac[0][0][0], 0.0 );
+    ASSERT_GT( phaseFrac[0][0][1], 0.0 );
+
+    arrayView3d< real64 const > const & dPhaseFrac_dT = fluid->dPhaseFraction_dTemperature();
+    arrayView3d< real64 const > const & dPhaseDens_dT = fluid->dPhaseDensity_dTemperature();
+    arrayView3d< real64 const > const & dPhaseVisc_dT = fluid->dPhaseViscosity_dTemperature();
+    arrayView4d< real64 const > const & dPhaseCompFrac_dT = fluid->dPhaseCompFraction_dTemperature();
+    arrayView2d< real64 const > const & dTotalDens_dT = fluid->dTotalDensity_dTemperature();
+    for( localIndex ip = 0; ip < NP; ++ip )
+    {
+      EXPECT_EQ( dPhaseFrac_dT[0][0][ip], 0.0 );
+      EXPECT_EQ( dPhaseDens_dT[0][0][ip], 0.0 );
+      EXPECT_EQ( dPhaseVisc_dT[0][0][ip], 0.0 );
+      for( localIndex ic = 0; ic < NC; ++ic )
+      {
+        EXPECT_EQ( dPhaseCompFrac_dT[0][0][ip][ic], 0.0 );
+      }
+    }
+    EXPECT_EQ( dTotalDens_dT[0][0], 0.0 );
+  }
+
+  std::unique_ptr< Group > parent;
+  MultiFluidBase * fluid;
+};
+
+TEST_F( CO2BrineFluidTest, numericalDerivativesMolar )
+{
+  fluid->setMassFlag( false );
+  testDerivatives( 1e-4, 1e-14 );
+}
+
+TEST_F( CO2BrineFluidTest, numericalDerivativesMass )
+{
+  fluid->setMassFlag( true );
+  testDerivatives( 1e-3, 1e-14 );
+}
+
 int main( int argc, char * * argv )
 {
   ::testing::InitGoogleTest( &argc, argv );
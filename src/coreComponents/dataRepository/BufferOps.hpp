@@ -18,6 +18,7 @@
 #define GEOSX_DATAREPOSITORY_BUFFEROPS_HPP_
 
 #include "common/DataTypes.hpp"
+#include "common/IndexMap.hpp"
 #include "codingUtilities/Utilities.hpp"
 #include "codingUtilities/static_if.hpp"
 #include "codingUtilities/traits.hpp"
@@ -437,7 +438,7 @@ inline localIndex Unpack( buffer_unit_type const * & buffer,
 //------------------------------------------------------------------------------
 inline localIndex UnpackSyncList( buffer_unit_type const * & buffer,
                                   localIndex_array & var,
-                                  std::unordered_map< globalIndex, localIndex > const & globalToLocalMap );
+                                  indexMap< globalIndex, localIndex > const & globalToLocalMap );
 
 //------------------------------------------------------------------------------
 template< typename SORTED, int USD >
@@ -943,17 +943,22 @@ inline
 localIndex
 UnpackSyncList( buffer_unit_type const * & buffer,
                 localIndex_array & var,
-                std::unordered_map< globalIndex, localIndex > const & globalToLocalMap )
+                indexMap< globalIndex, localIndex > const & globalToLocalMap )
 {
   localIndex length;
   localIndex sizeOfUnpackedChars = Unpack( buffer, length );
   var.resize( length );
 
+  array1d< globalIndex > unpackedGlobalIndices( length );
   for( localIndex a=0; a<length; ++a )
   {
-    globalIndex unpackedGlobalIndex;
-    sizeOfUnpackedChars += Unpack( buffer, unpackedGlobalIndex );
-    var[a] = globalToLocalMap.at( unpackedGlobalIndex );
+    sizeOfUnpackedChars += Unpack( buffer, unpackedGlobalIndices[a] );
+  }
+
+  globalToLocalMap.lookup( unpackedGlobalIndices, var, -1 );
+  for( localIndex a=0; a<length; ++a )
+  {
+    GEOSX_ERROR_IF( var[a] < 0, "Global index " << unpackedGlobalIndices[a] << " is not on this rank." );
   }
 
   return sizeOfUnpackedChars;
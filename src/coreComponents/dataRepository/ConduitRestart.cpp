@@ -25,6 +25,12 @@
 // TPL includes
 #include <conduit_relay.hpp>
 
+// System includes
+#include <cstring>
+#include <deque>
+#include <future>
+#include <memory>
+
 namespace geosx
 {
 namespace dataRepository
@@ -32,24 +38,160 @@ namespace dataRepository
 
 conduit::Node rootConduitNode;
 
+namespace
+{
+
+/// Writes started by writeTreeAsync, oldest first.
+std::deque< std::shared_future< void > > pendingWrites;
+
+/// Tag of the messages exchanged within an aggregation group.
+int constexpr aggregationTag = 0;
+
+/// Name of the tree of a rank in an aggregated restart file.
+std::string treeName( int const rank )
+{
+  char buffer[ 32 ];
+  std::snprintf( buffer, 32, "rank_%07d", rank );
+  return buffer;
+}
+
+/// Serialize a node as the size of its compact schema, the schema and the compact data.
+array1d< char > serializeNode( conduit::Node const & node )
+{
+  conduit::Schema schema;
+  node.schema().compact_to( schema );
+  std::string const schemaString = schema.to_json();
+
+  std::vector< conduit::uint8 > data;
+  node.serialize( data );
+
+  std::size_t const schemaSize = schemaString.size();
+  array1d< char > buffer( sizeof( std::size_t ) + schemaSize + data.size() );
+  std::memcpy( buffer.data(), &schemaSize, sizeof( std::size_t ) );
+  std::memcpy( buffer.data() + sizeof( std::size_t ), schemaString.data(), schemaSize );
+  std::memcpy( buffer.data() + sizeof( std::size_t ) + schemaSize, data.data(), data.size() );
+  return buffer;
+}
+
+/// Rebuild a node, copying the data, from a buffer created by serializeNode.
+void deserializeNode( array1d< char > & buffer, conduit::Node & node )
+{
+  std::size_t schemaSize;
+  std::memcpy( &schemaSize, buffer.data(), sizeof( std::size_t ) );
+
+  conduit::Schema const schema( std::string( buffer.data() + sizeof( std::size_t ), schemaSize ) );
+  node.set_data_using_schema( schema, buffer.data() + sizeof( std::size_t ) + schemaSize );
+}
+
+/// Write the trees of a group of ranks into a single file, through the first rank of the group.
+void writeAggregatedTree( std::string const & filePath, int const ranksPerFile )
+{
+  int const rank = MpiWrapper::Comm_rank( MPI_COMM_GEOSX );
+  MPI_Comm groupComm = MpiWrapper::Comm_split( MPI_COMM_GEOSX, rank / ranksPerFile, rank );
+  int const groupRank = MpiWrapper::Comm_rank( groupComm );
+  int const groupSize = MpiWrapper::Comm_size( groupComm );
+
+  if( groupRank == 0 )
+  {
+    GEOSX_LOG_RANK( "Writing out restart file at " << filePath );
+
+    conduit::Node fileNode;
+    fileNode[ treeName( rank ) ].set_external( rootConduitNode );
+    conduit::relay::io::save( fileNode, filePath, "hdf5" );
+
+    // Append the trees of the other ranks one at a time to bound the memory used
+    for( int i = 1; i < groupSize; ++i )
+    {
+      array1d< char > buffer;
+      MpiWrapper::recv( buffer, i, aggregationTag, groupComm, MPI_STATUS_IGNORE );
+
+      fileNode.reset();
+      deserializeNode( buffer, fileNode[ treeName( rank + i ) ] );
+      conduit::relay::io::save_merged( fileNode, filePath, "hdf5" );
+    }
+  }
+  else
+  {
+    array1d< char > const buffer = serializeNode( rootConduitNode );
+    MPI_Request request;
+    MpiWrapper::iSend( buffer.toViewConst(), 0, aggregationTag, groupComm, &request );
+    MpiWrapper::Wait( &request, MPI_STATUS_IGNORE );
+  }
+
+  MpiWrapper::Comm_free( groupComm );
+}
+
+/// Read the trees of a group of ranks from a single file, through the first rank of the group.
+void loadAggregatedTree( std::string const & filePath, int const ranksPerFile )
+{
+  int const rank = MpiWrapper::Comm_rank( MPI_COMM_GEOSX );
+  MPI_Comm groupComm = MpiWrapper::Comm_split( MPI_COMM_GEOSX, rank / ranksPerFile, rank );
+  int const groupRank = MpiWrapper::Comm_rank( groupComm );
+  int const groupSize = MpiWrapper::Comm_size( groupComm );
+
+  if( groupRank == 0 )
+  {
+    GEOSX_LOG_RANK( "Reading in restart file at " << filePath );
+    conduit::relay::io::load( filePath + ":" + treeName( rank ), "hdf5", rootConduitNode );
+
+    for( int i = 1; i < groupSize; ++i )
+    {
+      conduit::Node memberNode;
+      conduit::relay::io::load( filePath + ":" + treeName( rank + i ), "hdf5", memberNode );
+
+      array1d< char > const buffer = serializeNode( memberNode );
+      MPI_Request request;
+      MpiWrapper::iSend( buffer.toViewConst(), i, aggregationTag, groupComm, &request );
+      MpiWrapper::Wait( &request, MPI_STATUS_IGNORE );
+    }
+  }
+  else
+  {
+    array1d< char > buffer;
+    MpiWrapper::recv( buffer, 0, aggregationTag, groupComm, MPI_STATUS_IGNORE );
+    deserializeNode( buffer, rootConduitNode );
+  }
+
+  MpiWrapper::Comm_free( groupComm );
+}
+
+}
+
 
-std::string writeRootFile( conduit::Node & root, std::string const & rootPath )
+std::string writeRootFile( conduit::Node & root, std::string const & rootPath, int const ranksPerFile )
 {
   std::string rootDirName, rootFileName;
   splitPath( rootPath, rootDirName, rootFileName );
 
-  if( MpiWrapper::Comm_rank() == 0 )
+  int const rank = MpiWrapper::Comm_rank();
+  int const size = MpiWrapper::Comm_size();
+  bool const aggregated = ranksPerFile > 1;
+
+  if( rank == 0 )
   {
     makeDirsForPath( rootPath );
 
     root[ "protocol/name" ] = "hdf5";
     root[ "protocol/version" ] = CONDUIT_VERSION;
 
-    root[ "number_of_files" ] = MpiWrapper::Comm_size();
-    root[ "file_pattern" ] = rootFileName + "/rank_%07d.hdf5";
+    if( aggregated )
+    {
+      root[ "number_of_files" ] = ( size + ranksPerFile - 1 ) / ranksPerFile;
+      root[ "file_pattern" ] = rootFileName + "/group_%07d.hdf5";
+
+      root[ "number_of_trees" ] = size;
+      root[ "tree_pattern" ] = "rank_%07d/";
 
-    root[ "number_of_trees" ] = 1;
-    root[ "tree_pattern" ] = "/";
+      root[ "ranks_per_file" ] = ranksPerFile;
+    }
+    else
+    {
+      root[ "number_of_files" ] = size;
+      root[ "file_pattern" ] = rootFileName + "/rank_%07d.hdf5";
+
+      root[ "number_of_trees" ] = 1;
+      root[ "tree_pattern" ] = "/";
+    }
 
     conduit::relay::io::save( root, rootPath + ".root", "hdf5" );
   }
@@ -57,21 +199,39 @@ std::string writeRootFile( conduit::Node & root, std::string const & rootPath )
   MpiWrapper::Barrier( MPI_COMM_GEOSX );
 
   std::vector< char > buffer( rootPath.size() + 64 );
-  GEOSX_ERROR_IF_GE( std::snprintf( buffer.data(), buffer.size(), "%s/rank_%07d.hdf5", rootPath.data(), MpiWrapper::Comm_rank() ), 1024 );
+  GEOSX_ERROR_IF_GE( std::snprintf( buffer.data(), buffer.size(),
+                                    aggregated ? "%s/group_%07d.hdf5" : "%s/rank_%07d.hdf5",
+                                    rootPath.data(),
+                                    aggregated ? rank / ranksPerFile : rank ), 1024 );
   return buffer.data();
 }
 
 
-std::string readRootNode( std::string const & rootPath )
+std::string readRootNode( std::string const & rootPath, int & ranksPerFile )
 {
   std::string rankFilePattern;
+  ranksPerFile = 1;
   if( MpiWrapper::Comm_rank() == 0 )
   {
     conduit::Node node;
     conduit::relay::io::load( rootPath + ".root", "hdf5", node );
 
-    int const nFiles = node.fetch_child( "number_of_files" ).value();
-    GEOSX_ERROR_IF_NE( nFiles, MpiWrapper::Comm_size() );
+    // Each rank tree holds the data of one partition of the mesh: restarting on a different number of
+    // ranks would require repartitioning and is not supported, whatever the number of files
+    int numWriteRanks;
+    if( node.has_child( "ranks_per_file" ) )
+    {
+      // Aggregated restart: the grouping is the one used when writing, whatever the current settings
+      ranksPerFile = node.fetch_child( "ranks_per_file" ).value();
+      numWriteRanks = node.fetch_child( "number_of_trees" ).value();
+    }
+    else
+    {
+      numWriteRanks = node.fetch_child( "number_of_files" ).value();
+    }
+    GEOSX_ERROR_IF_NE_MSG( numWriteRanks, MpiWrapper::Comm_size(),
+                           "Restart " << rootPath << " was written by " << numWriteRanks << " ranks and must be "
+                           "read by as many ranks (restarting on a different number of ranks is not supported)" );
 
     std::string const filePattern = node.fetch_child( "file_pattern" ).as_string();
 
@@ -83,28 +243,89 @@ std::string readRootNode( std::string const & rootPath )
   }
 
   MpiWrapper::Broadcast( rankFilePattern, 0 );
+  MpiWrapper::Broadcast( ranksPerFile, 0 );
 
+  int const rank = MpiWrapper::Comm_rank();
   char buffer[ 1024 ];
-  GEOSX_ERROR_IF_GE( std::snprintf( buffer, 1024, rankFilePattern.data(), MpiWrapper::Comm_rank() ), 1024 );
+  GEOSX_ERROR_IF_GE( std::snprintf( buffer, 1024, rankFilePattern.data(), ranksPerFile > 1 ? rank / ranksPerFile : rank ), 1024 );
   return buffer;
 }
 
 /* Write out a restart file. */
-void writeTree( std::string const & path )
+void writeTree( std::string const & path, int const ranksPerFile )
 {
   GEOSX_MARK_FUNCTION;
 
+  waitForPendingWrites();
+
   conduit::Node root;
-  std::string const filePathForRank = writeRootFile( root, path );
+  std::string const filePathForRank = writeRootFile( root, path, ranksPerFile );
+  if( ranksPerFile > 1 )
+  {
+    writeAggregatedTree( filePathForRank, ranksPerFile );
+    return;
+  }
+
   GEOSX_LOG_RANK( "Writing out restart file at " << filePathForRank );
   conduit::relay::io::save( rootConduitNode, filePathForRank, "hdf5" );
 }
 
 
+void writeTreeAsync( std::string const & path, int const maxPendingWrites )
+{
+  GEOSX_MARK_FUNCTION;
+
+  GEOSX_ERROR_IF_LT( maxPendingWrites, 1 );
+  while( pendingWrites.size() >= static_cast< std::size_t >( maxPendingWrites ) )
+  {
+    pendingWrites.front().get();
+    pendingWrites.pop_front();
+  }
+
+  // The root file involves MPI and is written synchronously.
+  conduit::Node root;
+  std::string const filePathForRank = writeRootFile( root, path );
+
+  // Deep copy of the tree, since the wrappers are pushed into it as external pointers.
+  std::shared_ptr< conduit::Node const > const snapshot = std::make_shared< conduit::Node const >( rootConduitNode );
+
+  // Writes are chained so that at most one thread uses HDF5 for restarts at any time.
+  std::shared_future< void > const previous = pendingWrites.empty() ? std::shared_future< void >() : pendingWrites.back();
+  pendingWrites.emplace_back( std::async( std::launch::async, [snapshot, filePathForRank, previous]()
+  {
+    if( previous.valid() )
+    {
+      previous.wait();
+    }
+    GEOSX_LOG_RANK( "Writing out restart file at " << filePathForRank );
+    conduit::relay::io::save( *snapshot, filePathForRank, "hdf5" );
+  } ).share() );
+}
+
+
+void waitForPendingWrites()
+{
+  GEOSX_MARK_FUNCTION;
+
+  while( !pendingWrites.empty() )
+  {
+    pendingWrites.front().get();
+    pendingWrites.pop_front();
+  }
+}
+
+
 void loadTree( std::string const & path )
 {
   GEOSX_MARK_FUNCTION;
-  std::string const filePathForRank = readRootNode( path );
+  int ranksPerFile;
+  std::string const filePathForRank = readRootNode( path, ranksPerFile );
+  if( ranksPerFile > 1 )
+  {
+    loadAggregatedTree( filePathForRank, ranksPerFile );
+    return;
+  }
+
   GEOSX_LOG_RANK( "Reading in restart file at " << filePathForRank );
   conduit::relay::io::load( filePathForRank, "hdf5", rootConduitNode );
 }
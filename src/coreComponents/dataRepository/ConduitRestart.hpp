@@ -88,10 +88,21 @@ using conduitTypeInfo = internal::conduitTypeInfo< std::remove_const_t< std::rem
 
 extern conduit::Node rootConduitNode;
 
-std::string writeRootFile( conduit::Node & root, std::string const & rootPath );
+// With ranksPerFile > 1, the trees of consecutive groups of ranksPerFile ranks are aggregated into a single
+// file by the first rank of each group.
+std::string writeRootFile( conduit::Node & root, std::string const & rootPath, int const ranksPerFile = 1 );
 
-void writeTree( std::string const & path );
+void writeTree( std::string const & path, int const ranksPerFile = 1 );
 
+// Snapshot rootConduitNode and write it from a background thread. Blocks while
+// maxPendingWrites snapshots are still being written.
+void writeTreeAsync( std::string const & path, int const maxPendingWrites );
+
+// Block until all the snapshots handed to writeTreeAsync are written.
+void waitForPendingWrites();
+
+// Read a restart written by writeTree or writeTreeAsync. It must be read by as many ranks as wrote it, the number
+// of files (ranksPerFile) only changes the grouping of the rank trees.
 void loadTree( std::string const & path );
 
 } // namespace dataRepository
@@ -23,6 +23,7 @@
 
 // TPL includes
 #include <gtest/gtest.h>
+#include <conduit_relay.hpp>
 
 // System includes
 #include <random>
@@ -55,7 +56,7 @@ public:
     delete m_group;
   }
 
-  void test()
+  void test( int const ranksPerFile, bool const asynchronous = false )
   {
     T value;
     fill( value, 100 );
@@ -65,12 +66,20 @@ public:
 
     // Write out the tree
     m_group->prepareToWrite();
-    writeTree( m_fileName );
+    if( asynchronous )
+    {
+      writeTreeAsync( m_fileName, 1 );
+    }
+    else
+    {
+      writeTree( m_fileName, ranksPerFile );
+    }
     m_group->finishWriting();
 
-    // Delete geosx tree and reset the conduit tree.
+    // Delete geosx tree and reset the conduit tree. A pending asynchronous write only uses its own snapshot.
     delete m_group;
     rootConduitNode.reset();
+    waitForPendingWrites();
 
     // Load in the tree
     loadTree( m_fileName );
@@ -129,7 +138,45 @@ TYPED_TEST_SUITE( SingleWrapperTest, TestTypes, );
 
 TYPED_TEST( SingleWrapperTest, WriteAndRead )
 {
-  this->test();
+  this->test( 1 );
+}
+
+TYPED_TEST( SingleWrapperTest, WriteAndReadAggregated )
+{
+  this->test( 2 );
+}
+
+TYPED_TEST( SingleWrapperTest, WriteAsynchronouslyAndRead )
+{
+  this->test( 1, true );
+}
+
+// Run on 4 ranks (see CMakeLists.txt), the rank trees are aggregated two by two into 2 files
+TEST( ConduitRestart, AggregatedFiles )
+{
+  int const rank = MpiWrapper::Comm_rank();
+  int const size = MpiWrapper::Comm_size();
+  int const ranksPerFile = 2;
+  std::string const fileName = "testRestartBasic_AggregatedFiles";
+
+  rootConduitNode.reset();
+  rootConduitNode[ "rank" ] = rank;
+  writeTree( fileName, ranksPerFile );
+
+  if( rank == 0 )
+  {
+    conduit::Node root;
+    conduit::relay::io::load( fileName + ".root", "hdf5", root );
+    EXPECT_EQ( root[ "number_of_files" ].to_int(), ( size + ranksPerFile - 1 ) / ranksPerFile );
+    EXPECT_EQ( root[ "number_of_trees" ].to_int(), size );
+    EXPECT_EQ( root[ "ranks_per_file" ].to_int(), ranksPerFile );
+  }
+
+  // Each rank reads back its own tree
+  rootConduitNode.reset();
+  loadTree( fileName );
+  EXPECT_EQ( rootConduitNode[ "rank" ].to_int(), rank );
+  rootConduitNode.reset();
 }
 
 } // namespace testing
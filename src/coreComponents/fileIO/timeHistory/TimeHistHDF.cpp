@@ -83,6 +83,48 @@ inline hid_t GetHDFArrayDataType( std::type_index const & type, hsize_t const ra
   return H5Tarray_create( GetHDFDataType( type ), rank, dims );
 }
 
+/**
+ * @brief Get a dataset transfer property list performing collective writes when the file is accessed in parallel.
+ * @param parallelAccess Whether the file is accessed in parallel through MPI-IO.
+ * @return The transfer property list, to be released with H5Pclose if it is not H5P_DEFAULT.
+ */
+inline hid_t GetHDFTransferProperties( bool const parallelAccess )
+{
+#ifdef GEOSX_USE_MPI
+  if( parallelAccess )
+  {
+    hid_t dxplId = H5Pcreate( H5P_DATASET_XFER );
+    H5Pset_dxpl_mpio( dxplId, H5FD_MPIO_COLLECTIVE );
+    return dxplId;
+  }
+#else
+  GEOSX_UNUSED_VAR( parallelAccess );
+#endif
+  return H5P_DEFAULT;
+}
+
+/**
+ * @brief Compute the number of history states to reserve in the file to receive the buffered states.
+ * @param writeLimit The number of states currently reserved in the file.
+ * @param requested The number of states that must fit in the file.
+ * @param overallocMultiple Integer to scale the reserved space by when it runs out.
+ * @param chunkSize The number of states per chunk, the result is a multiple of it.
+ * @return The new number of states to reserve in the file.
+ */
+inline localIndex GetHDFWriteLimit( localIndex writeLimit,
+                                    localIndex const requested,
+                                    localIndex const overallocMultiple,
+                                    localIndex const chunkSize )
+{
+  writeLimit = std::max( writeLimit, chunkSize );
+  while( requested > writeLimit )
+  {
+    writeLimit *= std::max( overallocMultiple, localIndex( 2 ) );
+  }
+  // grow by whole chunks so that no chunk is ever partially covered by the extent of the dataset
+  return ( ( writeLimit + chunkSize - 1 ) / chunkSize ) * chunkSize;
+}
+
 HDFFile::HDFFile( string const & fnm, bool deleteExisting, bool parallelAccess, MPI_Comm comm ):
   m_filename( ),
   m_fileId( 0 ),
@@ -94,8 +136,13 @@ HDFFile::HDFFile( string const & fnm, bool deleteExisting, bool parallelAccess,
 #ifdef GEOSX_USE_MPI
   if( m_mpioFapl )
   {
+    // let MPI-IO aggregate the collective writes onto its collective buffering nodes
+    MPI_Info info;
+    MPI_Info_create( &info );
+    MPI_Info_set( info, "romio_cb_write", "enable" );
     m_faplId = H5Pcreate( H5P_FILE_ACCESS );
-    H5Pset_fapl_mpio( m_faplId, m_comm, MPI_INFO_NULL );
+    H5Pset_fapl_mpio( m_faplId, m_comm, info );
+    MPI_Info_free( &info );
     m_filename = fnm + ".hdf5";
   }
   else
@@ -153,6 +200,7 @@ HDFHistIO::HDFHistIO( string const & filename,
   BufferedHistoryIO(),
   m_filename( filename ),
   m_overallocMultiple( overallocMultiple ),
+  m_chunkSize( std::max( initAlloc, localIndex( 1 ) ) ),
   m_globalIdxOffset( 0 ),
   m_globalIdxCount( 0 ),
   m_writeLimit( initAlloc ),
@@ -217,7 +265,8 @@ void HDFHistIO::init( bool exists_okay )
     historyFileDims[0] = LvArray::integerConversion< hsize_t >( m_writeLimit );
 
     std::vector< hsize_t > dimChunks( m_rank+1 );
-    dimChunks[0] = 1;
+    // chunks span as many states as the collection buffer initially holds, so a flush fills whole chunks
+    dimChunks[0] = LvArray::integerConversion< hsize_t >( m_chunkSize );
 
     for( hsize_t dd = 1; dd < m_rank+1; ++dd )
     {
@@ -254,20 +303,20 @@ void HDFHistIO::init( bool exists_okay )
   }
 }
 
-void HDFHistIO::write( )
+void HDFHistIO::flush( )
 {
-  // don't need to write if nothing is buffered, this should only happen if the output event occurs before the collection event
+  // don't need to write if nothing is staged, this should only happen if the output event occurs before the collection event
   if( m_subcomm != MPI_COMM_NULL )
   {
     // practically these should all be the same unless something has gone wrong, in which case the file might still become malformed
     localIndex maxBuffered = 0;
-    MpiWrapper::allReduce( &m_bufferedCount, &maxBuffered, 1, MPI_MAX, m_subcomm );
+    MpiWrapper::allReduce( &m_stagedCount, &maxBuffered, 1, MPI_MAX, m_subcomm );
     if( maxBuffered > 0 )
     {
-      resizeFileIfNeeded( maxBuffered );
       HDFFile target( m_filename, false, true, m_subcomm );
 
       hid_t dataset = H5Dopen( target, m_name.c_str(), H5P_DEFAULT );
+      resizeFileIfNeeded( dataset, maxBuffered );
       hid_t filespace = H5Dget_space( dataset );
 
       std::vector< hsize_t > fileOffset( m_rank+1 );
@@ -286,12 +335,17 @@ void HDFHistIO::write( )
       H5Sselect_hyperslab( fileHyperslab, H5S_SELECT_SET, &fileOffset[0], nullptr, &bufferedCounts[0], nullptr );
 
       buffer_unit_type * dataBuffer = nullptr;
-      // if local rank is writting nothing, m_dataBuffer is never alloc'd so don't try to access it
+      // if local rank is writting nothing, m_stagedBuffer is never alloc'd so don't try to access it
       if( m_typeCount != 0 )
       {
-        dataBuffer = &m_dataBuffer[0];
+        dataBuffer = &m_stagedBuffer[0];
+      }
+      hid_t dxplId = GetHDFTransferProperties( true );
+      H5Dwrite( dataset, m_hdfType, memspace, fileHyperslab, dxplId, dataBuffer );
+      if( dxplId != H5P_DEFAULT )
+      {
+        H5Pclose( dxplId );
       }
-      H5Dwrite( dataset, m_hdfType, memspace, fileHyperslab, H5P_DEFAULT, dataBuffer );
 
       H5Sclose( memspace );
       H5Sclose( filespace );
@@ -300,7 +354,7 @@ void HDFHistIO::write( )
       m_writeHead += maxBuffered;
     }
   }
-  emptyBuffer( );
+  m_stagedCount = 0;
 }
 
 void HDFHistIO::compressInFile( )
@@ -322,28 +376,19 @@ void HDFHistIO::compressInFile( )
   }
 }
 
-inline void HDFHistIO::resizeFileIfNeeded( localIndex buffered_count )
+void HDFHistIO::resizeFileIfNeeded( hid_t dataset, localIndex bufferedCount )
 {
-  if( m_subcomm != MPI_COMM_NULL )
+  if( m_writeHead + bufferedCount > m_writeLimit )
   {
-    HDFFile target( m_filename, false, true, m_subcomm );
-    if( m_writeHead + buffered_count > m_writeLimit )
+    m_writeLimit = GetHDFWriteLimit( m_writeLimit, m_writeHead + bufferedCount, m_overallocMultiple, m_chunkSize );
+    std::vector< hsize_t > maxFileDims( m_rank+1 );
+    maxFileDims[0] = LvArray::integerConversion< hsize_t >( m_writeLimit );
+    maxFileDims[1] = LvArray::integerConversion< hsize_t >( m_globalIdxCount );
+    for( hsize_t dd = 2; dd < m_rank+1; ++dd )
     {
-      while( m_writeHead + buffered_count > m_writeLimit )
-      {
-        m_writeLimit *= m_overallocMultiple;
-      }
-      std::vector< hsize_t > maxFileDims( m_rank+1 );
-      maxFileDims[0] = LvArray::integerConversion< hsize_t >( m_writeLimit );
-      maxFileDims[1] = LvArray::integerConversion< hsize_t >( m_globalIdxCount );
-      for( hsize_t dd = 2; dd < m_rank+1; ++dd )
-      {
-        maxFileDims[dd] = m_dims[dd-1];
-      }
-      hid_t dataset = H5Dopen( target, m_name.c_str(), H5P_DEFAULT );
-      H5Dset_extent( dataset, &maxFileDims[0] );
-      H5Dclose( dataset );
+      maxFileDims[dd] = m_dims[dd-1];
     }
+    H5Dset_extent( dataset, &maxFileDims[0] );
   }
 }
 
@@ -373,6 +418,7 @@ HDFSerialHistIO::HDFSerialHistIO( string const & filename,
   BufferedHistoryIO(),
   m_filename( filename ),
   m_overallocMultiple( overallocMultiple ),
+  m_chunkSize( std::max( initAlloc, localIndex( 1 ) ) ),
   m_writeLimit( initAlloc ),
   m_writeHead( writeHead ),
   m_hdfType( GetHDFDataType( typeId )),
@@ -400,7 +446,8 @@ void HDFSerialHistIO::init( bool exists_okay )
     historyFileDims[0] = LvArray::integerConversion< hsize_t >( m_writeLimit );
 
     std::vector< hsize_t > dimChunks( m_rank+1 );
-    dimChunks[0] = 1;
+    // chunks span as many states as the collection buffer initially holds, so a flush fills whole chunks
+    dimChunks[0] = LvArray::integerConversion< hsize_t >( m_chunkSize );
 
     for( hsize_t dd = 1; dd < m_rank+1; ++dd )
     {
@@ -436,15 +483,15 @@ void HDFSerialHistIO::init( bool exists_okay )
   }
 }
 
-void HDFSerialHistIO::write( )
+void HDFSerialHistIO::flush( )
 {
-  // don't need to write if nothing is buffered, this should only happen if the output event occurs before the collection event
-  if( m_typeCount > 0 && m_bufferedCount > 0 )
+  // don't need to write if nothing is staged, this should only happen if the output event occurs before the collection event
+  if( m_typeCount > 0 && m_stagedCount > 0 )
   {
-    resizeFileIfNeeded( m_bufferedCount );
     HDFFile target( m_filename, false, false, m_comm );
 
     hid_t dataset = H5Dopen( target, m_name.c_str(), H5P_DEFAULT );
+    resizeFileIfNeeded( dataset, m_stagedCount );
     hid_t filespace = H5Dget_space( dataset );
 
     std::vector< hsize_t > fileOffset( m_rank+1 );
@@ -452,7 +499,7 @@ void HDFSerialHistIO::write( )
     fileOffset[1] = 0;
 
     std::vector< hsize_t > bufferedCounts( m_rank+1 );
-    bufferedCounts[0] = LvArray::integerConversion< hsize_t >( m_bufferedCount );
+    bufferedCounts[0] = LvArray::integerConversion< hsize_t >( m_stagedCount );
     for( hsize_t dd = 1; dd < m_rank+1; ++dd )
     {
       bufferedCounts[dd] = m_dims[dd-1];
@@ -462,21 +509,15 @@ void HDFSerialHistIO::write( )
     hid_t fileHyperslab = filespace;
     H5Sselect_hyperslab( fileHyperslab, H5S_SELECT_SET, &fileOffset[0], nullptr, &bufferedCounts[0], nullptr );
 
-    buffer_unit_type * dataBuffer = nullptr;
-    // if local rank is writting nothing, m_dataBuffer is never alloc'd so don't try to access it
-    if( m_typeCount != 0 )
-    {
-      dataBuffer = &m_dataBuffer[0];
-    }
-    H5Dwrite( dataset, m_hdfType, memspace, fileHyperslab, H5P_DEFAULT, dataBuffer );
+    H5Dwrite( dataset, m_hdfType, memspace, fileHyperslab, H5P_DEFAULT, &m_stagedBuffer[0] );
 
     H5Sclose( memspace );
     H5Sclose( filespace );
     H5Dclose( dataset );
 
-    m_writeHead += m_bufferedCount;
-    emptyBuffer( );
+    m_writeHead += m_stagedCount;
   }
+  m_stagedCount = 0;
 }
 
 void HDFSerialHistIO::compressInFile( )
@@ -498,28 +539,19 @@ void HDFSerialHistIO::compressInFile( )
   }
 }
 
-inline void HDFSerialHistIO::resizeFileIfNeeded( localIndex buffered_count )
+void HDFSerialHistIO::resizeFileIfNeeded( hid_t dataset, localIndex bufferedCount )
 {
-  if( m_typeCount > 0 )
+  if( m_writeHead + bufferedCount > m_writeLimit )
   {
-    HDFFile target( m_filename, false, false, m_comm );
-    if( m_writeHead + buffered_count > m_writeLimit )
+    m_writeLimit = GetHDFWriteLimit( m_writeLimit, m_writeHead + bufferedCount, m_overallocMultiple, m_chunkSize );
+    std::vector< hsize_t > maxFileDims( m_rank+1 );
+    maxFileDims[0] = LvArray::integerConversion< hsize_t >( m_writeLimit );
+    maxFileDims[1] = m_dims[0];
+    for( hsize_t dd = 2; dd < m_rank+1; ++dd )
     {
-      while( m_writeHead + buffered_count > m_writeLimit )
-      {
-        m_writeLimit *= m_overallocMultiple;
-      }
-      std::vector< hsize_t > maxFileDims( m_rank+1 );
-      maxFileDims[0] = LvArray::integerConversion< hsize_t >( m_writeLimit );
-      maxFileDims[1] = m_dims[0];
-      for( hsize_t dd = 2; dd < m_rank+1; ++dd )
-      {
-        maxFileDims[dd] = m_dims[dd-1];
-      }
-      hid_t dataset = H5Dopen( target, m_name.c_str(), H5P_DEFAULT );
-      H5Dset_extent( dataset, &maxFileDims[0] );
-      H5Dclose( dataset );
+      maxFileDims[dd] = m_dims[dd-1];
     }
+    H5Dset_extent( dataset, &maxFileDims[0] );
   }
 }
 
@@ -115,7 +115,7 @@ public:
    * @param name The name to use to create/modify the dataset for the history data.
    * @param typeId The std::type_index(typeid(T)) of the underlying data type.
    * @param writeHead How many time history states have been written to the file (used on restart and to compress data on exit).
-   * @param initAlloc How many states to preallocate the internal buffer to hold.
+   * @param initAlloc How many states to preallocate the internal buffer to hold, also used as the number of states per chunk in the file.
    * @param overallocMultiple Integer to scale the internal buffer when we fill the existing space.
    * @param comm A communicator where every rank will participate in writting to the output file.
    */
@@ -134,7 +134,7 @@ public:
    * @param filename The filename to perform history output to.
    * @param spec HistoryMetadata to use to call the other constructor.
    * @param writeHead How many time states have been written to the file (used on restart and to compress data on exit).
-   * @param initAlloc How many states to preallocate the internal buffer to hold.
+   * @param initAlloc How many states to preallocate the internal buffer to hold, also used as the number of states per chunk in the file.
    * @param overallocMultiple Integer to scale the internal buffer when we fill the existing space.
    * @param comm A communicator where every rank will participate in writing to the output file.
    */
@@ -161,17 +161,19 @@ public:
   /// @copydoc geosx::BufferedHistoryIO::init
   virtual void init( bool existsOkay ) override;
 
-  /// @copydoc geosx::BufferedHistoryIO::write
-  virtual void write( ) override;
+  /// @copydoc geosx::BufferedHistoryIO::flush
+  virtual void flush( ) override;
 
   /// @copydoc geosx::BufferedHistoryIO::compressInFile
   virtual void compressInFile( ) override;
 
   /**
    * @brief Resize the dataspace in the target file if needed to perform the current write of buffered states.
+   * @param dataset The open dataset to resize.
    * @param bufferedCount The number of buffered states to use to determine if the file needs to be resized.
+   * @note The dataset grows by whole chunks.
    */
-  inline void resizeFileIfNeeded( localIndex bufferedCount );
+  void resizeFileIfNeeded( hid_t dataset, localIndex bufferedCount );
 
 protected:
   virtual void resizeBuffer( ) override;
@@ -182,6 +184,8 @@ private:
   string m_filename;
   /// How much to scale the internal and file allocations by when room runs out
   const localIndex m_overallocMultiple;
+  /// The number of history states per chunk in the file, equal to the initial capacity of the buffer
+  const localIndex m_chunkSize;
   /// The global index offset for this mpi rank for this data set
   globalIndex m_globalIdxOffset;
   /// The global index count for this mpi rank for this data set
@@ -226,7 +230,7 @@ public:
    * @param name The name to use to create/modify the dataset for the history data.
    * @param typeId The std::type_index(typeid(T)) of the underlying data type.
    * @param writeHead How many time history states have been written to the file (used on restart and to compress data on exit).
-   * @param initAlloc How many states to preallocate the internal buffer to hold.
+   * @param initAlloc How many states to preallocate the internal buffer to hold, also used as the number of states per chunk in the file.
    * @param overallocMultiple Integer to scale the internal buffer when we fill the existing space.
    * @param comm A communicator where every rank will participate in writting to the output file.
    */
@@ -245,7 +249,7 @@ public:
    * @param filename The filename to perform history output to.
    * @param spec HistoryMetadata to use to call the other constructor.
    * @param writeHead How many time states have been written to the file (used on restart and to compress data on exit).
-   * @param initAlloc How many states to preallocate the internal buffer to hold.
+   * @param initAlloc How many states to preallocate the internal buffer to hold, also used as the number of states per chunk in the file.
    * @param overallocMultiple Integer to scale the internal buffer when we fill the existing space.
    * @param comm A communicator where every rank will participate in writing to the output file.
    */
@@ -272,17 +276,19 @@ public:
   /// @copydoc geosx::BufferedHistoryIO::init
   virtual void init( bool existsOkay ) override;
 
-  /// @copydoc geosx::BufferedHistoryIO::write
-  virtual void write( ) override;
+  /// @copydoc geosx::BufferedHistoryIO::flush
+  virtual void flush( ) override;
 
   /// @copydoc geosx::BufferedHistoryIO::compressInFile
   virtual void compressInFile( ) override;
 
   /**
    * @brief Resize the dataspace in the target file if needed to perform the current write of buffered states.
+   * @param dataset The open dataset to resize.
    * @param bufferedCount The number of buffered states to use to determine if the file needs to be resized.
+   * @note The dataset grows by whole chunks.
    */
-  inline void resizeFileIfNeeded( localIndex bufferedCount );
+  void resizeFileIfNeeded( hid_t dataset, localIndex bufferedCount );
 
 protected:
   virtual void resizeBuffer( ) override;
@@ -293,6 +299,8 @@ private:
   string m_filename;
   /// How much to scale the internal and file allocations by when room runs out
   const localIndex m_overallocMultiple;
+  /// The number of history states per chunk in the file, equal to the initial capacity of the buffer
+  const localIndex m_chunkSize;
   /// The current limit in discrete history counts for this data set in the file
   localIndex m_writeLimit;
   /// The current history count for this data set in the file
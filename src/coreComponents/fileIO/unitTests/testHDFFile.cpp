@@ -108,6 +108,70 @@ TEST( testHDFIO, IdxArrayHistory )
   }
 }
 
+TEST( testHDFIO, ChunkedStagedHistory )
+{
+  string filename( "chunked_history" );
+  {
+    HDFFile( filename, true, true, MPI_COMM_GEOSX );
+  }
+  HistoryMetadata spec( "Chunked History", 1, std::type_index( typeid(real64)));
+
+  localIndex const chunkSize = 4;
+  localIndex const numRecords = 10;
+  HDFHistIO io( filename, spec, 0, chunkSize );
+  io.init( false );
+
+  bool pendingFlush = false;
+  for( localIndex tidx = 0; tidx < numRecords; ++tidx )
+  {
+    real64 const value = tidx;
+    buffer_unit_type * buffer = io.getBufferHead( );
+    memcpy( buffer, &value, sizeof(real64));
+    // the staged records are only written after collection has resumed
+    if( pendingFlush )
+    {
+      io.flush( );
+      pendingFlush = false;
+    }
+    if( io.getBufferedCount() == 3 )
+    {
+      io.stage( );
+      pendingFlush = true;
+    }
+  }
+  if( pendingFlush )
+  {
+    io.flush( );
+  }
+  io.write( );
+  io.compressInFile( );
+
+  hid_t file = H5Fopen( ( filename + ".hdf5" ).c_str(), H5F_ACC_RDONLY, H5P_DEFAULT );
+  hid_t dataset = H5Dopen( file, spec.getName().c_str(), H5P_DEFAULT );
+
+  hid_t filespace = H5Dget_space( dataset );
+  hsize_t dims[2];
+  H5Sget_simple_extent_dims( filespace, dims, nullptr );
+  EXPECT_EQ( dims[0], LvArray::integerConversion< hsize_t >( numRecords ) );
+
+  hid_t dcpl = H5Dget_create_plist( dataset );
+  hsize_t chunkDims[2];
+  H5Pget_chunk( dcpl, 2, chunkDims );
+  EXPECT_EQ( chunkDims[0], LvArray::integerConversion< hsize_t >( chunkSize ) );
+
+  std::vector< real64 > values( numRecords );
+  H5Dread( dataset, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, values.data() );
+  for( localIndex tidx = 0; tidx < numRecords; ++tidx )
+  {
+    EXPECT_DOUBLE_EQ( values[tidx], real64( tidx ) );
+  }
+
+  H5Pclose( dcpl );
+  H5Sclose( filespace );
+  H5Dclose( dataset );
+  H5Fclose( file );
+}
+
 int main( int ac, char * av[] )
 {
   ::testing::InitGoogleTest( &ac, av );
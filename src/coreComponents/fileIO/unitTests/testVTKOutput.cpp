@@ -0,0 +1,187 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// Source includes
+#include "codingUtilities/StringUtilities.hpp"
+#include "fileIO/vtk/VTKPolyDataWriterInterface.hpp"
+#include "managers/initialization.hpp"
+#include "managers/ProblemManager.hpp"
+#include "physicsSolvers/fluidFlow/unitTests/testCompFlowUtils.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+
+// System includes
+#include <fstream>
+#include <iterator>
+
+using namespace geosx;
+using namespace geosx::testing;
+
+char const * const xmlInput =
+  "<Problem>\n"
+  "  <Solvers>\n"
+  "    <SinglePhaseFVM name=\"singleflow\"\n"
+  "                    discretization=\"tpfaFlow\"\n"
+  "                    targetRegions=\"{Region1, Region2}\"\n"
+  "                    fluidNames=\"{water}\"\n"
+  "                    solidNames=\"{rock}\">\n"
+  "      <NonlinearSolverParameters newtonTol=\"1.0e-6\"\n"
+  "                                 newtonMaxIter=\"2\"/>\n"
+  "      <LinearSolverParameters solverType=\"gmres\"\n"
+  "                              krylovTol=\"1.0e-10\"/>\n"
+  "    </SinglePhaseFVM>\n"
+  "  </Solvers>\n"
+  "  <Mesh>\n"
+  "    <InternalMesh name=\"mesh1\"\n"
+  "                  elementTypes=\"{C3D8}\"\n"
+  "                  xCoords=\"{0, 2, 5}\"\n"
+  "                  yCoords=\"{0, 2}\"\n"
+  "                  zCoords=\"{0, 1}\"\n"
+  "                  nx=\"{2, 3}\"\n"
+  "                  ny=\"{2}\"\n"
+  "                  nz=\"{1}\"\n"
+  "                  cellBlockNames=\"{cb1, cb2}\"/>\n"
+  "  </Mesh>\n"
+  "  <NumericalMethods>\n"
+  "    <FiniteVolume>\n"
+  "      <TwoPointFluxApproximation name=\"tpfaFlow\"\n"
+  "                                 fieldName=\"pressure\"\n"
+  "                                 coefficientName=\"permeability\"/>\n"
+  "    </FiniteVolume>\n"
+  "  </NumericalMethods>\n"
+  "  <ElementRegions>\n"
+  "    <CellElementRegion name=\"Region1\" cellBlocks=\"{cb1}\" materialList=\"{water, rock}\"/>\n"
+  "    <CellElementRegion name=\"Region2\" cellBlocks=\"{cb2}\" materialList=\"{water, rock}\"/>\n"
+  "  </ElementRegions>\n"
+  "  <Constitutive>\n"
+  "    <CompressibleSinglePhaseFluid name=\"water\"\n"
+  "                                  defaultDensity=\"1000\"\n"
+  "                                  defaultViscosity=\"0.001\"\n"
+  "                                  referencePressure=\"0.0\"\n"
+  "                                  referenceDensity=\"1000\"\n"
+  "                                  compressibility=\"5e-10\"\n"
+  "                                  referenceViscosity=\"0.001\"\n"
+  "                                  viscosibility=\"0.0\"/>\n"
+  "    <PoreVolumeCompressibleSolid name=\"rock\"\n"
+  "                                 referencePressure=\"0.0\"\n"
+  "                                 compressibility=\"1e-9\"/>\n"
+  "  </Constitutive>\n"
+  "</Problem>";
+
+/**
+ * @brief Check that an output reusing the cached geometry of a previous output
+ *        is identical to an output that builds its geometry from scratch.
+ */
+class VTKOutputTest : public ::testing::Test
+{
+public:
+
+  VTKOutputTest()
+    : problemManager( std::make_unique< ProblemManager >( "Problem", nullptr ) )
+  {}
+
+protected:
+
+  void SetUp() override
+  {
+    setupProblemFromXML( *problemManager, xmlInput );
+  }
+
+  /// Set a pressure field that varies from cell to cell, so that consecutive outputs differ
+  void setPressure( real64 const scale )
+  {
+    ElementRegionManager & elemManager = *problemManager->getDomainPartition()->getMeshBody( 0 )->getMeshLevel( 0 )->getElemManager();
+    elemManager.forElementSubRegions< CellElementSubRegion >( [&]( CellElementSubRegion & subRegion )
+    {
+      arrayView1d< real64 > const & pres = subRegion.getReference< array1d< real64 > >( "pressure" );
+      pres.move( LvArray::MemorySpace::CPU, true );
+      for( localIndex ei = 0; ei < subRegion.size(); ++ei )
+      {
+        pres[ei] = scale * ( ei + 1 );
+      }
+    } );
+  }
+
+  /// Path of the file of a region written by this rank, relative to the output folder
+  static string regionFile( real64 const time, string const & regionName )
+  {
+    return std::to_string( time ) + "/" +
+           stringutilities::PadValue( MpiWrapper::Comm_rank(), std::to_string( MpiWrapper::Comm_size() ).size() ) +
+           "_" + regionName + ".vtu";
+  }
+
+  static string readFile( string const & path )
+  {
+    std::ifstream file( path, std::ios::binary );
+    EXPECT_TRUE( file.good() ) << path;
+    return string( std::istreambuf_iterator< char >( file ), std::istreambuf_iterator< char >() );
+  }
+
+  /**
+   * @brief Write the mesh twice with a geometry cache, and once without, and compare the last outputs.
+   * @param mode the output mode
+   * @param suffix suffix of the output folders
+   */
+  void checkCachedGeometry( vtk::VTKOutputMode const mode, string const & suffix )
+  {
+    DomainPartition const & domain = *problemManager->getDomainPartition();
+    real64 const time = 1.0;
+
+    // the second output reuses the geometry built by the first one, with different field values
+    vtk::VTKPolyDataWriterInterface cachedWriter( "vtkCachedGeometry" + suffix );
+    cachedWriter.SetOutputMode( mode );
+    cachedWriter.SetPlotLevel( 1 );
+    cachedWriter.SetCacheGeometry( true );
+    setPressure( 1.0 );
+    cachedWriter.Write( 0.0, 0, domain );
+    setPressure( 2.0 );
+    cachedWriter.Write( time, 1, domain );
+
+    vtk::VTKPolyDataWriterInterface freshWriter( "vtkFreshGeometry" + suffix );
+    freshWriter.SetOutputMode( mode );
+    freshWriter.SetPlotLevel( 1 );
+    freshWriter.SetCacheGeometry( false );
+    freshWriter.Write( time, 1, domain );
+
+    for( string const regionName : { "Region1", "Region2" } )
+    {
+      string const cached = readFile( "vtkCachedGeometry" + suffix + "/" + regionFile( time, regionName ) );
+      string const fresh = readFile( "vtkFreshGeometry" + suffix + "/" + regionFile( time, regionName ) );
+      EXPECT_FALSE( fresh.empty() );
+      EXPECT_TRUE( cached == fresh ) << regionName;
+    }
+  }
+
+  std::unique_ptr< ProblemManager > problemManager;
+};
+
+TEST_F( VTKOutputTest, cachedGeometryMatchesFreshWriteBinary )
+{
+  checkCachedGeometry( vtk::VTKOutputMode::BINARY, "Binary" );
+}
+
+TEST_F( VTKOutputTest, cachedGeometryMatchesFreshWriteAscii )
+{
+  checkCachedGeometry( vtk::VTKOutputMode::ASCII, "Ascii" );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
@@ -23,6 +23,7 @@
 #include <vtkExtentTranslator.h>
 
 // System includes
+#include <cstring>
 #include <unordered_set>
 #include <sys/stat.h>
 
@@ -73,6 +74,65 @@ int ToVTKCellType( const string & elementType )
   return vtkIdentifier;
 }
 
+/*!
+ * @brief Number of scalar values written to VTK for a value of type \p T
+ * @tparam T the type of the values stored in a GEOSX array
+ */
+template< typename T >
+struct ScalarsPerValue
+{
+  /// One scalar for arithmetic types
+  static constexpr integer value = 1;
+};
+
+/// R1Tensors are written as three scalars
+template<>
+struct ScalarsPerValue< R1Tensor >
+{
+  /// Three scalars for R1Tensor
+  static constexpr integer value = 3;
+};
+
+/*!
+ * @brief Tells if the rows of an array are stored contiguously, one after the other
+ * @param[in] array the array
+ * @return true if the unit stride dimension is the last one
+ */
+template< typename T, int NDIM, int USD >
+bool isRowMajor( ArrayView< T const, NDIM, USD > const & GEOSX_UNUSED_PARAM( array ) )
+{
+  return USD == NDIM - 1;
+}
+
+/*!
+ * @brief Copies \p size values into a VTK buffer, converting them to real64
+ * @param[in] source pointer to the first value
+ * @param[in] size the number of values to copy
+ * @param[in] destination pointer to the VTK buffer
+ * @return pointer past the last value written
+ */
+template< typename T >
+real64 * CopyToVTK( T const * const source, localIndex const size, real64 * const destination )
+{
+  std::copy( source, source + size, destination );
+  return destination + size;
+}
+
+/// @copydoc CopyToVTK
+real64 * CopyToVTK( real64 const * const source, localIndex const size, real64 * const destination )
+{
+  std::memcpy( destination, source, size * sizeof( real64 ) );
+  return destination + size;
+}
+
+/// @copydoc CopyToVTK
+real64 * CopyToVTK( R1Tensor const * const source, localIndex const size, real64 * const destination )
+{
+  static_assert( sizeof( R1Tensor ) == 3 * sizeof( real64 ), "R1Tensor must be made of three contiguous real64" );
+  std::memcpy( destination, source, 3 * size * sizeof( real64 ) );
+  return destination + 3 * size;
+}
+
 void VTKPolyDataWriterInterface::gatherNbElementsInRegion( ElementRegionBase const & er,
                                                            array1d< localIndex > & nbElemsInRegion ) const
 {
@@ -85,7 +145,9 @@ void VTKPolyDataWriterInterface::gatherNbElementsInRegion( ElementRegionBase con
 VTKPolyDataWriterInterface::VTKPolyDataWriterInterface( string const & outputName ):
   m_outputFolder( outputName ),
   m_pvd( outputName + ".pvd" ),
-  m_previousCycle( -1 )
+  m_previousCycle( -1 ),
+  m_outputMode( VTKOutputMode::BINARY ),
+  m_cacheGeometry( false )
 {
   int const mpiRank = MpiWrapper::Comm_rank( MPI_COMM_GEOSX );
   if( mpiRank == 0 )
@@ -264,38 +326,44 @@ void VTKPolyDataWriterInterface::WriteField( WrapperBase const & wrapperBase,
                                              localIndex size, localIndex & count ) const
 {
   std::type_info const & typeID = wrapperBase.get_typeid();
-  if( typeID==typeid(r1_array) )
-  {
-    // We need a special case for the R1 array
-    // Because those array are not stored the same way than the classical array2d which is
-    // preferable to store a vector on each element.
-    data->SetNumberOfComponents( 3 );
-  }
   rtTypes::ApplyArrayTypeLambda2( rtTypes::typeID( typeID ),
                                   true,
-                                  [&]( auto array, auto GEOSX_UNUSED_PARAM( Type ) )->void
+                                  [&]( auto array, auto Type )->void
   {
     typedef decltype( array ) arrayType;
+    typedef decltype( Type ) valueType;
     Wrapper< arrayType > const & wrapperT = Wrapper< arrayType >::cast( wrapperBase );
     traits::ViewTypeConst< arrayType > const sourceArray = wrapperT.reference().toViewConst();
-    if( typeID!=typeid(r1_array) )
+
+    // R1Tensor values are output as three components
+    integer nbOfComponents = ScalarsPerValue< valueType >::value;
+    localIndex valuesPerRow = 1;
+    for( localIndex i = 1; i < arrayType::NDIM; i++ )
     {
-      integer nbOfComponents = 1;
-      for( localIndex i = 1; i < arrayType::NDIM; i++ )
-      {
-        nbOfComponents = nbOfComponents * sourceArray.size( i );
-      }
-      data->SetNumberOfComponents( nbOfComponents );
+      valuesPerRow = valuesPerRow * sourceArray.size( i );
     }
-    for( localIndex i = 0; i < size; i++ )
+    nbOfComponents = nbOfComponents * LvArray::integerConversion< integer >( valuesPerRow );
+    data->SetNumberOfComponents( nbOfComponents );
+    data->SetNumberOfValues( count + size * nbOfComponents );
+
+    real64 * destination = data->GetPointer( count );
+    if( isRowMajor( sourceArray ) )
     {
-      LvArray::forValuesInSlice( sourceArray[i], [&]( auto const & value )
+      // the first size rows are contiguous in memory, copy them in one go
+      destination = CopyToVTK( sourceArray.data(), size * valuesPerRow, destination );
+    }
+    else
+    {
+      for( localIndex i = 0; i < size; i++ )
       {
-        data->CustomInsertValue( count++, value );
-      } );
+        LvArray::forValuesInSlice( sourceArray[i], [&]( auto const & value )
+        {
+          destination = CopyToVTK( &value, 1, destination );
+        } );
+      }
     }
+    count = count + size * nbOfComponents;
   } );
-
 }
 
 void VTKPolyDataWriterInterface::WriteNodeFields( vtkSmartPointer< vtkPointData > const pointdata,
@@ -348,19 +416,47 @@ void VTKPolyDataWriterInterface::WriteElementFields( vtkSmartPointer< vtkCellDat
     celldata->AddArray( data );
   }
 }
+template< typename LAMBDA >
+VTKPolyDataWriterInterface::RegionGeometry const &
+VTKPolyDataWriterInterface::GetRegionGeometry( string const & regionName,
+                                               std::vector< localIndex > const & signature,
+                                               LAMBDA && buildGeometry )
+{
+  RegionGeometry & geometry = m_geometryCache[ regionName ];
+  if( !m_cacheGeometry || geometry.points == nullptr || geometry.signature != signature )
+  {
+    geometry = RegionGeometry();
+    geometry.signature = signature;
+    buildGeometry( geometry );
+  }
+  return geometry;
+}
+
 void VTKPolyDataWriterInterface::WriteCellElementRegions( real64 time,
                                                           ElementRegionManager const & elemManager,
-                                                          NodeManager const & nodeManager ) const
+                                                          NodeManager const & nodeManager )
 {
+  // the points are shared by all the CellElementRegions, only build them if a region needs them
+  vtkSmartPointer< vtkPoints > VTKPoints;
   elemManager.forElementRegions< CellElementRegion >( [&]( CellElementRegion const & er )->void
   {
     if( er.getNumberOfElements< CellElementSubRegion >() != 0 )
     {
+      std::vector< localIndex > const signature = { nodeManager.size(), er.getNumberOfElements< CellElementSubRegion >() };
+      RegionGeometry const & geometry = GetRegionGeometry( er.getName(), signature, [&]( RegionGeometry & newGeometry )
+      {
+        if( VTKPoints == nullptr )
+        {
+          VTKPoints = GetVTKPoints( nodeManager );
+        }
+        newGeometry.points = VTKPoints;
+        auto VTKCells = GetVTKCells( er );
+        newGeometry.cellTypes = std::move( VTKCells.first );
+        newGeometry.cells = VTKCells.second;
+      } );
       vtkSmartPointer< vtkUnstructuredGrid > ug = vtkUnstructuredGrid::New();
-      auto VTKPoints = GetVTKPoints( nodeManager );
-      ug->SetPoints( VTKPoints );
-      auto VTKCells = GetVTKCells( er );
-      ug->SetCells( VTKCells.first.data(), VTKCells.second );
+      ug->SetPoints( geometry.points );
+      ug->SetCells( const_cast< int * >( geometry.cellTypes.data() ), geometry.cells );
       WriteElementFields< CellElementSubRegion >( ug->GetCellData(), er );
       WriteNodeFields( ug->GetPointData(), nodeManager );
       WriteUnstructuredGrid( ug, time, er.getName() );
@@ -369,15 +465,20 @@ void VTKPolyDataWriterInterface::WriteCellElementRegions( real64 time,
 }
 
 void VTKPolyDataWriterInterface::WriteWellElementRegions( real64 time, ElementRegionManager const & elemManager,
-                                                          NodeManager const & nodeManager ) const
+                                                          NodeManager const & nodeManager )
 {
   elemManager.forElementRegions< WellElementRegion >( [&]( WellElementRegion const & er )->void
   {
     auto esr = er.GetSubRegion( 0 )->group_cast< WellElementSubRegion const * >();
+    RegionGeometry const & geometry = GetRegionGeometry( er.getName(), { esr->size() }, [&]( RegionGeometry & newGeometry )
+    {
+      auto VTKWell = GetWell( *esr, nodeManager );
+      newGeometry.points = VTKWell.first;
+      newGeometry.cells = VTKWell.second;
+    } );
     vtkSmartPointer< vtkUnstructuredGrid > ug = vtkUnstructuredGrid::New();
-    auto VTKWell = GetWell( *esr, nodeManager );
-    ug->SetPoints( VTKWell.first );
-    ug->SetCells( VTK_LINE, VTKWell.second );
+    ug->SetPoints( geometry.points );
+    ug->SetCells( VTK_LINE, geometry.cells );
     WriteElementFields< WellElementSubRegion >( ug->GetCellData(), er );
     WriteUnstructuredGrid( ug, time, er.getName() );
   } );
@@ -385,7 +486,7 @@ void VTKPolyDataWriterInterface::WriteWellElementRegions( real64 time, ElementRe
 
 void VTKPolyDataWriterInterface::WriteSurfaceElementRegions( real64 time,
                                                              ElementRegionManager const & elemManager,
-                                                             NodeManager const & nodeManager ) const
+                                                             NodeManager const & nodeManager )
 {
   elemManager.forElementRegions< SurfaceElementRegion >( [&]( SurfaceElementRegion const & er )->void
   {
@@ -394,9 +495,15 @@ void VTKPolyDataWriterInterface::WriteSurfaceElementRegions( real64 time,
     {
       auto esr = er.GetSubRegion( 0 )->group_cast< EmbeddedSurfaceSubRegion const * >();
 
-      auto VTKSurface = GetEmbeddedSurface( *esr, nodeManager );
-      ug->SetPoints( VTKSurface.first );
-      ug->SetCells( VTK_POLYGON, VTKSurface.second );
+      std::vector< localIndex > const signature = { esr->size(), nodeManager.embSurfNodesPosition().size( 0 ) };
+      RegionGeometry const & geometry = GetRegionGeometry( er.getName(), signature, [&]( RegionGeometry & newGeometry )
+      {
+        auto VTKSurface = GetEmbeddedSurface( *esr, nodeManager );
+        newGeometry.points = VTKSurface.first;
+        newGeometry.cells = VTKSurface.second;
+      } );
+      ug->SetPoints( geometry.points );
+      ug->SetCells( VTK_POLYGON, geometry.cells );
 
       WriteElementFields< EmbeddedSurfaceSubRegion >( ug->GetCellData(), er );
     }
@@ -404,16 +511,21 @@ void VTKPolyDataWriterInterface::WriteSurfaceElementRegions( real64 time,
     {
       auto esr = er.GetSubRegion( 0 )->group_cast< FaceElementSubRegion const * >();
 
-      auto VTKSurface = GetSurface( *esr, nodeManager );
+      RegionGeometry const & geometry = GetRegionGeometry( er.getName(), { esr->size() }, [&]( RegionGeometry & newGeometry )
+      {
+        auto VTKSurface = GetSurface( *esr, nodeManager );
+        newGeometry.points = VTKSurface.first;
+        newGeometry.cells = VTKSurface.second;
+      } );
 
-      ug->SetPoints( VTKSurface.first );
+      ug->SetPoints( geometry.points );
       if( esr->numNodesPerElement() == 8 )
       {
-        ug->SetCells( VTK_HEXAHEDRON, VTKSurface.second );
+        ug->SetCells( VTK_HEXAHEDRON, geometry.cells );
       }
       else if( esr->numNodesPerElement() == 6 )
       {
-        ug->SetCells( VTK_WEDGE, VTKSurface.second );
+        ug->SetCells( VTK_WEDGE, geometry.cells );
       }
       else
       {
@@ -501,7 +613,9 @@ void VTKPolyDataWriterInterface::WriteUnstructuredGrid( vtkSmartPointer< vtkUnst
   vtuWriter->SetFileName( vtuFilePath.c_str() );
   if( m_outputMode == VTKOutputMode::BINARY )
   {
-    vtuWriter->SetDataModeToBinary();
+    // raw appended data is written in one block, without the base64 encoding of the inline binary mode
+    vtuWriter->SetDataModeToAppended();
+    vtuWriter->EncodeAppendedDataOff();
   }
   else if( m_outputMode == VTKOutputMode::ASCII )
   {
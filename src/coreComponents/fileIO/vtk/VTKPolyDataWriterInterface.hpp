@@ -77,6 +77,21 @@ public:
     m_outputMode = mode;
   }
 
+  /*!
+   * @brief Enable or disable the caching of the mesh geometry between two outputs
+   * @details When enabled, the points and cell connectivities of a region are built once and reused
+   * by the following outputs, as long as the number of points and cells of that region is unchanged.
+   * @param[in] cacheGeometry true to reuse the geometry between outputs
+   */
+  void SetCacheGeometry( bool cacheGeometry )
+  {
+    m_cacheGeometry = cacheGeometry;
+    if( !cacheGeometry )
+    {
+      m_geometryCache.clear();
+    }
+  }
+
   /*!
    * @brief Main method of this class. Write all the files for one time step.
    * @details This method writes a .pvd file (if a previous one was created from a precedent time step,
@@ -146,7 +161,7 @@ private:
    * @param[in] elemManager the ElementRegionManager containing the CellElementRegions to be output
    * @param[in] nodeManager the NodeManager containing the nodes of the domain to be output
    */
-  void WriteCellElementRegions( real64 time, ElementRegionManager const & elemManager, NodeManager const & nodeManager ) const;
+  void WriteCellElementRegions( real64 time, ElementRegionManager const & elemManager, NodeManager const & nodeManager );
 
   /*!
    * @brief Gets the cell connectivities as
@@ -172,7 +187,7 @@ private:
    * @param[in] elemManager the ElementRegionManager containing the WellElementRegions to be output
    * @param[in] nodeManager the NodeManager containing the nodes of the domain to be output
    */
-  void WriteWellElementRegions( real64 time, ElementRegionManager const & elemManager, NodeManager const & nodeManager ) const;
+  void WriteWellElementRegions( real64 time, ElementRegionManager const & elemManager, NodeManager const & nodeManager );
 
   /*!
    * @brief Gets the cell connectivities and the vertices coordinates
@@ -217,7 +232,7 @@ private:
    */
   void WriteSurfaceElementRegions( real64 time,
                                    ElementRegionManager const & elemManager,
-                                   NodeManager const & nodeManager ) const;
+                                   NodeManager const & nodeManager );
 
   /*!
    * @brief Writes a VTM file for the time-step \p time.
@@ -266,6 +281,31 @@ private:
    */
   void WriteUnstructuredGrid( vtkSmartPointer< vtkUnstructuredGrid > ug, double time, string const & name ) const;
 
+  /// Points, cell connectivities and cell types of a region
+  struct RegionGeometry
+  {
+    /// Sizes describing the topology the geometry was built for
+    std::vector< localIndex > signature;
+    /// Vertices coordinates
+    vtkSmartPointer< vtkPoints > points;
+    /// Cell connectivities
+    vtkSmartPointer< vtkCellArray > cells;
+    /// Type of each cell
+    std::vector< int > cellTypes;
+  };
+
+  /*!
+   * @brief Gets the geometry of a region, building it only if it is not cached for the current topology
+   * @param[in] regionName the name of the region
+   * @param[in] signature sizes identifying the topology of the region (number of points, cells, ...)
+   * @param[in] buildGeometry a lambda filling a RegionGeometry from scratch
+   * @return the geometry of the region
+   */
+  template< typename LAMBDA >
+  RegionGeometry const & GetRegionGeometry( string const & regionName,
+                                            std::vector< localIndex > const & signature,
+                                            LAMBDA && buildGeometry );
+
 private:
 
   /// Folder name in which all the files will be written
@@ -283,6 +323,12 @@ private:
 
   /// Output mode, could be ASCII or BINARAY
   VTKOutputMode m_outputMode;
+
+  /// Whether the geometry of the regions is kept between two outputs
+  bool m_cacheGeometry;
+
+  /// Geometry of the regions written so far, keyed by region name
+  std::map< string, RegionGeometry > m_geometryCache;
 };
 
 } // namespace vtk
@@ -0,0 +1,448 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include "ImplicitKernelBase.hpp"
+
+/**
+ * @file AssemblyMapKernelBase.hpp
+ */
+
+#ifndef GEOSX_FINITEELEMENT_ASSEMBLYMAPKERNELBASE_HPP_
+#define GEOSX_FINITEELEMENT_ASSEMBLYMAPKERNELBASE_HPP_
+
+
+
+namespace geosx
+{
+
+namespace finiteElement
+{
+
+//*****************************************************************************
+//*****************************************************************************
+//*****************************************************************************
+/**
+ * @class AssemblyMapKernelBase
+ * @brief Define the kernel that computes the assembly map of a matrix.
+ * @copydoc geosx::finiteElement::KernelBase
+ *
+ * ### AssemblyMapKernelBase Description
+ * For each element, each row of the element local system and each trial
+ * support point, the assembly map holds the position within the matrix row of
+ * the column of the first degree of freedom of the support point. The columns
+ * of the other degrees of freedom of the support point follow it, since a
+ * support point has consecutive degree of freedom numbers and the columns of a
+ * row are sorted. Rows that are not owned by the rank are marked with -1.
+ *
+ * The binary searches over the row columns are hence done once per sparsity
+ * pattern instead of once per assembly.
+ */
+template< typename SUBREGION_TYPE,
+          typename CONSTITUTIVE_TYPE,
+          typename FE_TYPE,
+          int NUM_DOF_PER_TEST_SP,
+          int NUM_DOF_PER_TRIAL_SP >
+class AssemblyMapKernelBase : public ImplicitKernelBase< SUBREGION_TYPE,
+                                                         CONSTITUTIVE_TYPE,
+                                                         FE_TYPE,
+                                                         NUM_DOF_PER_TEST_SP,
+                                                         NUM_DOF_PER_TRIAL_SP >
+{
+public:
+  /// Alias for the base class. (i.e. #geosx::finiteElement::ImplicitKernelBase)
+  using Base = ImplicitKernelBase< SUBREGION_TYPE,
+                                   CONSTITUTIVE_TYPE,
+                                   FE_TYPE,
+                                   NUM_DOF_PER_TEST_SP,
+                                   NUM_DOF_PER_TRIAL_SP >;
+
+
+  using typename Base::StackVariables;
+  using Base::numTrialSupportPointsPerElem;
+  using Base::numDofPerTrialSupportPoint;
+  using Base::m_dofRankOffset;
+
+  using Base::setup;
+
+  /**
+   * @brief Constructor
+   * @param nodeManager Reference to the NodeManager object.
+   * @param edgeManager Reference to the EdgeManager object.
+   * @param faceManager Reference to the FaceManager object.
+   * @param inputDofNumber The dof number for the primary field.
+   * @param rankOffset dof index offset of current rank
+   * @param inputMatrix The matrix, with its final sparsity pattern.
+   * @param assemblyMapName The name of the assembly map to fill.
+   * @copydoc geosx::finiteElement::KernelBase::KernelBase
+   */
+  AssemblyMapKernelBase( NodeManager const & nodeManager,
+                         EdgeManager const & edgeManager,
+                         FaceManager const & faceManager,
+                         SUBREGION_TYPE & elementSubRegion,
+                         FE_TYPE const & finiteElementSpace,
+                         CONSTITUTIVE_TYPE * const inputConstitutiveType,
+                         arrayView1d< globalIndex const > const & inputDofNumber,
+                         globalIndex const rankOffset,
+                         CRSMatrixView< real64 const, globalIndex const > const & inputMatrix,
+                         string const & assemblyMapName ):
+    Base( nodeManager,
+          edgeManager,
+          faceManager,
+          elementSubRegion,
+          finiteElementSpace,
+          inputConstitutiveType,
+          inputDofNumber,
+          rankOffset,
+          CRSMatrixView< real64, globalIndex const >(),
+          arrayView1d< real64 >() ),
+    m_columns( inputMatrix ),
+    m_mapToFill( resizeAssemblyMap( elementSubRegion, assemblyMapName ) )
+  {}
+
+
+  /**
+   * @copydoc geosx::finiteElement::KernelBase::complete
+   *
+   * In this implementation, only the positions of the columns of the element
+   * local system within the matrix rows are computed.
+   */
+  GEOSX_FORCE_INLINE
+  real64 complete( localIndex const k,
+                   StackVariables & stack ) const
+  {
+    for( localIndex r=0; r<stack.numRows; ++r )
+    {
+      localIndex const row = stack.localRowDofIndex[r] - m_dofRankOffset;
+      if( row < 0 || row >= m_columns.numRows() )
+      {
+        for( localIndex b=0; b<numTrialSupportPointsPerElem; ++b )
+        {
+          m_mapToFill[k][r][b] = -1;
+        }
+        continue;
+      }
+
+      arraySlice1d< globalIndex const > const columns = m_columns.getColumns( row );
+      for( localIndex b=0; b<numTrialSupportPointsPerElem; ++b )
+      {
+        globalIndex const firstColumn = stack.localColDofIndex[ b * numDofPerTrialSupportPoint ];
+
+        localIndex lower = 0;
+        localIndex upper = columns.size();
+        while( lower < upper )
+        {
+          localIndex const middle = lower + ( upper - lower ) / 2;
+          if( columns[middle] < firstColumn )
+          {
+            lower = middle + 1;
+          }
+          else
+          {
+            upper = middle;
+          }
+        }
+
+        GEOSX_ERROR_IF( lower + numDofPerTrialSupportPoint > columns.size() ||
+                        columns[lower] != firstColumn ||
+                        columns[lower + numDofPerTrialSupportPoint - 1] != firstColumn + numDofPerTrialSupportPoint - 1,
+                        "Column " << firstColumn << " of element " << k << " is missing from row " << row );
+
+        m_mapToFill[k][r][b] = LvArray::integerConversion< integer >( lower );
+      }
+    }
+    return 0;
+  }
+
+
+
+  /**
+   * @brief Kernel Launcher.
+   * @tparam POLICY The RAJA policy to use for the launch.
+   * @tparam KERNEL_TYPE The type of Kernel to execute.
+   * @param numElems The number of elements to process in this launch.
+   * @param kernelComponent The instantiation of KERNEL_TYPE to execute.
+   * @return 0
+   *
+   * Only the setup() and complete() functions of the kernel are called.
+   */
+  template< typename POLICY,
+            typename KERNEL_TYPE >
+  static
+  real64
+  kernelLaunch( localIndex const numElems,
+                KERNEL_TYPE const & kernelComponent )
+  {
+    GEOSX_MARK_FUNCTION;
+
+    forAll< POLICY >( numElems,
+                      [=] ( localIndex const k )
+    {
+      typename KERNEL_TYPE::StackVariables stack;
+
+      kernelComponent.setup( k, stack );
+
+      kernelComponent.complete( k, stack );
+
+    } );
+    return 0;
+  }
+
+private:
+
+  /**
+   * @brief Size the assembly map of a subregion for this kernel.
+   * @param elementSubRegion The subregion holding the assembly map.
+   * @param assemblyMapName The name of the assembly map.
+   * @return A view to the assembly map.
+   */
+  static arrayView3d< integer > resizeAssemblyMap( SUBREGION_TYPE & elementSubRegion,
+                                                   string const & assemblyMapName )
+  {
+    localIndex const numRows = StackVariables::numRows;
+    localIndex const numTrialSupportPoints = numTrialSupportPointsPerElem;
+
+    array3d< integer > & assemblyMap = elementSubRegion.template getReference< array3d< integer > >( assemblyMapName );
+    assemblyMap.resizeDimension< 1, 2 >( numRows, numTrialSupportPoints );
+    return assemblyMap.toView();
+  }
+
+  /// The matrix providing the columns of each row.
+  CRSMatrixView< real64 const, globalIndex const > const m_columns;
+
+  /// The assembly map to fill.
+  arrayView3d< integer > const m_mapToFill;
+};
+
+
+//*****************************************************************************
+//*****************************************************************************
+//*****************************************************************************
+/**
+ * @brief Helper struct to define a specialization of
+ *   #::geosx::finiteElement::AssemblyMapKernelBase that may be used to compute the assembly map.
+ * @tparam KERNEL_TEMPLATE Templated class that defines the physics kernel.
+ */
+template< template< typename,
+                    typename,
+                    typename > class KERNEL_TEMPLATE >
+struct AssemblyMapHelper
+{
+
+  /**
+   * Defines an alias for the specialization of
+   * #geosx::finiteElement::AssemblyMapKernelBase from the compile time
+   * constants defined in @p KERNEL_TEMPLATE.
+   */
+  template< typename SUBREGION_TYPE,
+            typename CONSTITUTIVE_TYPE,
+            typename FE_TYPE >
+  using Kernel = AssemblyMapKernelBase< SUBREGION_TYPE,
+                                        CONSTITUTIVE_TYPE,
+                                        FE_TYPE,
+                                        KERNEL_TEMPLATE< SUBREGION_TYPE,
+                                                         CONSTITUTIVE_TYPE,
+                                                         FE_TYPE >::numDofPerTestSupportPoint,
+                                        KERNEL_TEMPLATE< SUBREGION_TYPE,
+                                                         CONSTITUTIVE_TYPE,
+                                                         FE_TYPE >::numDofPerTrialSupportPoint
+                                        >;
+};
+
+
+//*****************************************************************************
+//*****************************************************************************
+//*****************************************************************************
+/**
+ * @brief Greedily color the elements of a subregion so that no two elements
+ *        of the same color share a node.
+ * @tparam SUBREGION_TYPE The type of the subregion.
+ * @param elementSubRegion The subregion to color.
+ * @param numNodes The number of nodes on the rank.
+ * @param colorOffsets The offsets of each color in @p coloredElements.
+ * @param coloredElements The elements sorted by color.
+ * @return false if more than 64 colors would be needed, in which case the
+ *         outputs are left empty.
+ */
+template< typename SUBREGION_TYPE >
+bool colorElements( SUBREGION_TYPE const & elementSubRegion,
+                    localIndex const numNodes,
+                    array1d< localIndex > & colorOffsets,
+                    array1d< localIndex > & coloredElements )
+{
+  GEOSX_MARK_FUNCTION;
+
+  localIndex constexpr maxNumColors = 64;
+
+  auto const & elemsToNodes = elementSubRegion.nodeList();
+  localIndex const numElems = elementSubRegion.size();
+  localIndex const numNodesPerElem = elementSubRegion.numNodesPerElement();
+
+  colorOffsets.clear();
+  coloredElements.clear();
+
+  // bit c of nodeColors[a] is set when an element of color c uses node a
+  array1d< std::uint64_t > nodeColors( numNodes );
+  array1d< localIndex > elemColors( numElems );
+  array1d< localIndex > colorSizes( maxNumColors );
+  localIndex numColors = 0;
+
+  for( localIndex k = 0; k < numElems; ++k )
+  {
+    std::uint64_t usedColors = 0;
+    for( localIndex a = 0; a < numNodesPerElem; ++a )
+    {
+      usedColors |= nodeColors[ elemsToNodes[k][a] ];
+    }
+
+    if( usedColors == ~std::uint64_t( 0 ) )
+    {
+      return false;
+    }
+
+    localIndex color = 0;
+    while( usedColors & ( std::uint64_t( 1 ) << color ) )
+    {
+      ++color;
+    }
+
+    for( localIndex a = 0; a < numNodesPerElem; ++a )
+    {
+      nodeColors[ elemsToNodes[k][a] ] |= std::uint64_t( 1 ) << color;
+    }
+    elemColors[k] = color;
+    ++colorSizes[color];
+    numColors = std::max( numColors, color + 1 );
+  }
+
+  colorOffsets.resize( numColors + 1 );
+  for( localIndex color = 0; color < numColors; ++color )
+  {
+    colorOffsets[color + 1] = colorOffsets[color] + colorSizes[color];
+  }
+
+  coloredElements.resize( numElems );
+  colorSizes.setValues< serialPolicy >( 0 );
+  for( localIndex k = 0; k < numElems; ++k )
+  {
+    localIndex const color = elemColors[k];
+    coloredElements[ colorOffsets[color] + colorSizes[color]++ ] = k;
+  }
+
+  return true;
+}
+
+
+//*****************************************************************************
+//*****************************************************************************
+//*****************************************************************************
+/**
+ * @brief Computes the assembly maps of a matrix.
+ * @tparam REGION_TYPE The type of region to loop over.
+ * @tparam KERNEL_TEMPLATE The type of template for the physics kernel, which
+ *                         conforms to the interface specified by KernelBase.
+ * @param mesh The MeshLevel object.
+ * @param targetRegions The names of the target regions(of type @p REGION_TYPE)
+ *                      to apply the @p KERNEL_TEMPLATE.
+ * @param discretizationName The name of the finite element discretization.
+ * @param inputDofNumber The global degree of freedom numbers.
+ * @param rankOffset Offset of dof indices on curren rank.
+ * @param inputMatrix The matrix, with its final sparsity pattern.
+ * @param assemblyMapName The name under which the assembly maps are registered
+ *                        on the subregions.
+ * @param useColoring Whether to also color the elements, so that kernels
+ *                    using the assembly map may add their contributions to
+ *                    the global system without atomics.
+ * @return 0
+ *
+ * The assembly map must be recomputed whenever the sparsity pattern of
+ * @p inputMatrix changes, and may only be passed to kernels assembling into
+ * @p inputMatrix. See #geosx::finiteElement::AssemblyMapKernelBase for a
+ * description of the map, and #geosx::finiteElement::ImplicitKernelBase for its
+ * use.
+ */
+template< typename REGION_TYPE,
+          template< typename SUBREGION_TYPE,
+                    typename CONSTITUTIVE_TYPE,
+                    typename FE_TYPE > class KERNEL_TEMPLATE >
+static
+real64 fillAssemblyMaps( MeshLevel & mesh,
+                         arrayView1d< string const > const & targetRegions,
+                         string const & discretizationName,
+                         arrayView1d< globalIndex const > const & inputDofNumber,
+                         globalIndex const rankOffset,
+                         CRSMatrixView< real64 const, globalIndex const > const & inputMatrix,
+                         string const & assemblyMapName,
+                         bool const useColoring )
+{
+  GEOSX_MARK_FUNCTION;
+
+  localIndex const numNodes = mesh.getNodeManager()->size();
+  string const colorOffsetsName = assemblyMapName + AssemblyMapKeys::colorOffsetsString;
+  string const coloredElementsName = assemblyMapName + AssemblyMapKeys::coloredElementsString;
+
+  mesh.getElemManager()->forElementSubRegions< REGION_TYPE >( targetRegions,
+                                                              [&]( localIndex const,
+                                                                   auto & elementSubRegion )
+  {
+    if( !elementSubRegion.hasWrapper( assemblyMapName ) )
+    {
+      elementSubRegion.template registerWrapper< array3d< integer > >( assemblyMapName )->
+        setPlotLevel( dataRepository::PlotLevel::NOPLOT )->
+        setRestartFlags( dataRepository::RestartFlags::NO_WRITE );
+      elementSubRegion.template registerWrapper< array1d< localIndex > >( colorOffsetsName )->
+        setPlotLevel( dataRepository::PlotLevel::NOPLOT )->
+        setRestartFlags( dataRepository::RestartFlags::NO_WRITE )->
+        setSizedFromParent( 0 );
+      elementSubRegion.template registerWrapper< array1d< localIndex > >( coloredElementsName )->
+        setPlotLevel( dataRepository::PlotLevel::NOPLOT )->
+        setRestartFlags( dataRepository::RestartFlags::NO_WRITE )->
+        setSizedFromParent( 0 );
+    }
+
+    array1d< localIndex > & colorOffsets = elementSubRegion.template getReference< array1d< localIndex > >( colorOffsetsName );
+    array1d< localIndex > & coloredElements = elementSubRegion.template getReference< array1d< localIndex > >( coloredElementsName );
+    if( !useColoring )
+    {
+      colorOffsets.clear();
+      coloredElements.clear();
+    }
+    else if( !colorElements( elementSubRegion, numNodes, colorOffsets, coloredElements ) )
+    {
+      GEOSX_LOG_RANK( "Could not color the elements of " << elementSubRegion.getName() <<
+                      ", their contributions are added with atomics" );
+    }
+  } );
+
+  regionBasedKernelApplication< parallelHostPolicy,
+                                constitutive::NullModel,
+                                REGION_TYPE,
+                                AssemblyMapHelper< KERNEL_TEMPLATE >::template Kernel
+                                >( mesh,
+                                   targetRegions,
+                                   discretizationName,
+                                   arrayView1d< string const >(),
+                                   inputDofNumber,
+                                   rankOffset,
+                                   inputMatrix,
+                                   assemblyMapName );
+
+  return 0;
+}
+
+}
+}
+
+
+
+#endif /* GEOSX_FINITEELEMENT_ASSEMBLYMAPKERNELBASE_HPP_ */
@@ -29,6 +29,22 @@ namespace geosx
 namespace finiteElement
 {
 
+/**
+ * @struct AssemblyMapKeys
+ * @brief Suffixes appended to the name of an assembly map to obtain the names
+ *        of the element coloring wrappers registered along with it.
+ *
+ * See #geosx::finiteElement::fillAssemblyMaps for a description of the data.
+ */
+struct AssemblyMapKeys
+{
+  /// Suffix of the offsets of each color in the list of colored elements.
+  static constexpr auto colorOffsetsString = "ColorOffsets";
+
+  /// Suffix of the list of elements sorted by color.
+  static constexpr auto coloredElementsString = "ColoredElements";
+};
+
 //*****************************************************************************
 //*****************************************************************************
 //*****************************************************************************
@@ -77,6 +93,9 @@ public:
    * @param rankOffset dof index offset of current rank
    * @param inputMatrix Reference to the Jacobian matrix.
    * @param inputRhs Reference to the RHS vector.
+   * @param assemblyMapName The name of the assembly map registered on
+   *                        @p elementSubRegion, or an empty string to insert
+   *                        the element contributions with a binary search.
    * @copydoc geosx::finiteElement::KernelBase::KernelBase
    */
   ImplicitKernelBase( NodeManager const & nodeManager,
@@ -88,14 +107,22 @@ public:
                       arrayView1d< globalIndex const > const & inputDofNumber,
                       globalIndex const rankOffset,
                       CRSMatrixView< real64, globalIndex const > const & inputMatrix,
-                      arrayView1d< real64 > const & inputRhs ):
+                      arrayView1d< real64 > const & inputRhs,
+                      string const & assemblyMapName = string() ):
     Base( elementSubRegion,
           finiteElementSpace,
           inputConstitutiveType ),
     m_dofNumber( inputDofNumber ),
     m_dofRankOffset( rankOffset ),
     m_matrix( inputMatrix ),
-    m_rhs( inputRhs )
+    m_rhs( inputRhs ),
+    m_assemblyMap( getAssemblyMapData< array3d< integer > >( elementSubRegion, assemblyMapName, "" ) ),
+    m_colorOffsets( getAssemblyMapData< array1d< localIndex > >( elementSubRegion,
+                                                                 assemblyMapName,
+                                                                 AssemblyMapKeys::colorOffsetsString ) ),
+    m_coloredElements( getAssemblyMapData< array1d< localIndex > >( elementSubRegion,
+                                                                    assemblyMapName,
+                                                                    AssemblyMapKeys::coloredElementsString ) )
   {
     GEOSX_UNUSED_VAR( nodeManager );
     GEOSX_UNUSED_VAR( edgeManager );
@@ -176,7 +203,94 @@ public:
   }
 
 
+  /**
+   * @brief Kernel Launcher.
+   * @tparam POLICY The RAJA policy to use for the launch.
+   * @tparam KERNEL_TYPE The type of Kernel to execute.
+   * @param numElems The number of elements to process in this launch.
+   * @param kernelComponent The instantiation of KERNEL_TYPE to execute.
+   * @return The maximum residual contribution.
+   *
+   * ### ImplicitKernelBase::kernelLaunch() Description
+   *
+   * When the assembly map comes with an element coloring, the elements are
+   * launched one color at a time. Since no two elements of a color share a
+   * support point, the contributions are then added to the global system
+   * without atomics. Otherwise this is #geosx::finiteElement::KernelBase::kernelLaunch.
+   *
+   * The colored launch processes one element per loop iteration, whatever the
+   * batch size of @p POLICY. Solvers reject batched policies with a coloring.
+   */
+  template< typename POLICY,
+            typename KERNEL_TYPE >
+  static
+  real64
+  kernelLaunch( localIndex const numElems,
+                KERNEL_TYPE const & kernelComponent )
+  {
+    if( kernelComponent.m_colorOffsets.empty() )
+    {
+      return Base::template kernelLaunch< POLICY, KERNEL_TYPE >( numElems, kernelComponent );
+    }
+
+    GEOSX_MARK_FUNCTION;
+
+    RAJA::ReduceMax< ReducePolicy< POLICY >, real64 > maxResidual( 0 );
+
+    arrayView1d< localIndex const > const & coloredElements = kernelComponent.m_coloredElements;
+    localIndex const numColors = kernelComponent.m_colorOffsets.size() - 1;
+    for( localIndex color = 0; color < numColors; ++color )
+    {
+      localIndex const colorOffset = kernelComponent.m_colorOffsets[color];
+      forAll< POLICY >( kernelComponent.m_colorOffsets[color+1] - colorOffset,
+                        [=] GEOSX_HOST_DEVICE ( localIndex const i )
+      {
+        localIndex const k = coloredElements[colorOffset + i];
+        typename KERNEL_TYPE::StackVariables stack;
+
+        kernelComponent.setup( k, stack );
+        for( integer q=0; q<Base::numQuadraturePointsPerElem; ++q )
+        {
+          kernelComponent.quadraturePointKernel( k, q, stack );
+        }
+        maxResidual.max( kernelComponent.complete( k, stack ) );
+      } );
+    }
+    return maxResidual.get();
+  }
+
+
 protected:
+
+  /**
+   * @brief Add a row of the element local system to the global system.
+   * @param k The element index.
+   * @param localRow The row of the element local system.
+   * @param dof The local row of the global system, which must be owned by the rank.
+   * @param stack The stack variables holding the element local system.
+   *
+   * The row is scattered directly to the matrix entries given by the assembly
+   * map when one is available, and inserted with a binary search over the row
+   * columns otherwise. Atomics are only used when the elements are not
+   * processed one color at a time.
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  void addToGlobalRow( localIndex const k,
+                       localIndex const localRow,
+                       localIndex const dof,
+                       StackVariables const & stack ) const
+  {
+    if( m_colorOffsets.empty() )
+    {
+      addToGlobalRowImpl< parallelDeviceAtomic >( k, localRow, dof, stack );
+    }
+    else
+    {
+      addToGlobalRowImpl< serialAtomic >( k, localRow, dof, stack );
+    }
+  }
+
   /// The global degree of freedom number
   arrayView1d< globalIndex const > const m_dofNumber;
 
@@ -189,6 +303,76 @@ protected:
   /// The global residaul vector.
   arrayView1d< real64 > const m_rhs;
 
+  /// Position of the first column of each trial support point within the
+  /// matrix rows, for each element and row of the element local system.
+  /// Empty if no assembly map is used.
+  arrayView3d< integer const > const m_assemblyMap;
+
+  /// The offsets of each color in m_coloredElements. Empty if the elements
+  /// are not processed one color at a time.
+  arrayView1d< localIndex const > const m_colorOffsets;
+
+  /// The elements sorted by color.
+  arrayView1d< localIndex const > const m_coloredElements;
+
+private:
+
+  /**
+   * @brief Get a view to the data stored with an assembly map.
+   * @tparam ARRAY The type of the stored data.
+   * @param elementSubRegion The subregion holding the assembly map.
+   * @param assemblyMapName The name of the assembly map, possibly empty.
+   * @param suffix The suffix identifying the data.
+   * @return A view to the data, or an empty view if @p assemblyMapName is empty.
+   */
+  template< typename ARRAY >
+  static traits::ViewTypeConst< ARRAY >
+  getAssemblyMapData( SUBREGION_TYPE const & elementSubRegion,
+                      string const & assemblyMapName,
+                      string const & suffix )
+  {
+    if( assemblyMapName.empty() )
+    {
+      return traits::ViewTypeConst< ARRAY >();
+    }
+    return elementSubRegion.template getReference< ARRAY >( assemblyMapName + suffix ).toViewConst();
+  }
+
+  /**
+   * @copydoc addToGlobalRow
+   * @tparam ATOMIC_POLICY The atomic policy used to add the contributions.
+   */
+  template< typename ATOMIC_POLICY >
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  void addToGlobalRowImpl( localIndex const k,
+                           localIndex const localRow,
+                           localIndex const dof,
+                           StackVariables const & stack ) const
+  {
+    if( m_assemblyMap.empty() )
+    {
+      m_matrix.template addToRowBinarySearchUnsorted< ATOMIC_POLICY >( dof,
+                                                                       stack.localColDofIndex,
+                                                                       stack.localJacobian[ localRow ],
+                                                                       StackVariables::numCols );
+    }
+    else
+    {
+      arraySlice1d< real64 > const entries = m_matrix.getEntries( dof );
+      for( localIndex b=0; b<numTrialSupportPointsPerElem; ++b )
+      {
+        integer const position = m_assemblyMap[k][localRow][b];
+        for( int j=0; j<numDofPerTrialSupportPoint; ++j )
+        {
+          RAJA::atomicAdd< ATOMIC_POLICY >( &entries[ position + j ],
+                                            stack.localJacobian[ localRow ][ b * numDofPerTrialSupportPoint + j ] );
+        }
+      }
+    }
+    RAJA::atomicAdd< ATOMIC_POLICY >( &m_rhs[ dof ], stack.localResidual[ localRow ] );
+  }
+
 };
 
 }
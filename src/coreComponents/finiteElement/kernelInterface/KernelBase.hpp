@@ -272,7 +272,7 @@ public:
   template< typename POLICY,
             typename KERNEL_TYPE >
   static
-  real64
+  std::enable_if_t< !isBatchedPolicy< POLICY >::value, real64 >
   kernelLaunch( localIndex const numElems,
                 KERNEL_TYPE const & kernelComponent )
   {
@@ -297,6 +297,108 @@ public:
   }
   //END_kernelLauncher
 
+  /**
+   * @brief Kernel Launcher for the batched host policies.
+   * @copydetails kernelLaunch
+   */
+  template< typename POLICY,
+            typename KERNEL_TYPE >
+  static
+  std::enable_if_t< isBatchedPolicy< POLICY >::value, real64 >
+  kernelLaunch( localIndex const numElems,
+                KERNEL_TYPE const & kernelComponent )
+  {
+    return batchedKernelLaunch< POLICY, KERNEL_TYPE >( numElems,
+                                                       kernelComponent,
+                                                       [] ( localIndex const i ) { return i; } );
+  }
+
+  /**
+   * @brief Launch a kernel over batches of elements.
+   * @tparam POLICY The batched host policy to use for the launch.
+   * @tparam KERNEL_TYPE The type of Kernel to execute.
+   * @tparam ELEMENT_INDEX The type of @p elementIndex.
+   * @param numIndices The number of elements to process in this launch.
+   * @param kernelComponent The instantiation of KERNEL_TYPE to execute.
+   * @param elementIndex A callable giving the element index of a loop index.
+   * @return The maximum residual contribution.
+   *
+   * Each loop iteration processes POLICY::batchSize elements. The setup, each
+   * quadrature point and the completion are performed for all the elements of
+   * the batch before moving to the next stage, which exposes independent work
+   * to the vectorizer. The complete() calls are not vectorized since they
+   * scatter to shared data. The remainder elements are processed one by one.
+   */
+  template< typename POLICY,
+            typename KERNEL_TYPE,
+            typename ELEMENT_INDEX >
+  static
+  real64
+  batchedKernelLaunch( localIndex const numIndices,
+                       KERNEL_TYPE const & kernelComponent,
+                       ELEMENT_INDEX const elementIndex )
+  {
+    GEOSX_MARK_FUNCTION;
+
+    constexpr int batchSize = POLICY::batchSize;
+    localIndex const numBatches = ( numIndices + batchSize - 1 ) / batchSize;
+
+    RAJA::ReduceMax< ReducePolicy< POLICY >, real64 > maxResidual( 0 );
+
+    forAll< POLICY >( numBatches,
+                      [=] ( localIndex const batch )
+    {
+      localIndex const first = batch * batchSize;
+
+      if( first + batchSize <= numIndices )
+      {
+        localIndex k[ batchSize ];
+        typename KERNEL_TYPE::StackVariables stack[ batchSize ];
+
+        for( int lane = 0; lane < batchSize; ++lane )
+        {
+          k[ lane ] = elementIndex( first + lane );
+        }
+
+        PRAGMA_OMP( "omp simd" )
+        for( int lane = 0; lane < batchSize; ++lane )
+        {
+          kernelComponent.setup( k[ lane ], stack[ lane ] );
+        }
+
+        for( integer q=0; q<KERNEL_TYPE::numQuadraturePointsPerElem; ++q )
+        {
+          PRAGMA_OMP( "omp simd" )
+          for( int lane = 0; lane < batchSize; ++lane )
+          {
+            kernelComponent.quadraturePointKernel( k[ lane ], q, stack[ lane ] );
+          }
+        }
+
+        for( int lane = 0; lane < batchSize; ++lane )
+        {
+          maxResidual.max( kernelComponent.complete( k[ lane ], stack[ lane ] ) );
+        }
+      }
+      else
+      {
+        for( localIndex i = first; i < numIndices; ++i )
+        {
+          localIndex const ki = elementIndex( i );
+          typename KERNEL_TYPE::StackVariables stack;
+
+          kernelComponent.setup( ki, stack );
+          for( integer q=0; q<KERNEL_TYPE::numQuadraturePointsPerElem; ++q )
+          {
+            kernelComponent.quadraturePointKernel( ki, q, stack );
+          }
+          maxResidual.max( kernelComponent.complete( ki, stack ) );
+        }
+      }
+    } );
+    return maxResidual.get();
+  }
+
 protected:
   /// The element to nodes map.
   traits::ViewTypeConst< typename SUBREGION_TYPE::NodeMapType::base_type > const m_elemsToNodes;
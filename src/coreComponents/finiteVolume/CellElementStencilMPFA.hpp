@@ -97,6 +97,21 @@ public:
   localIndex stencilSize( localIndex index ) const
   { return m_elementRegionIndices.sizeOfArray( index ); }
 
+  /**
+   * @brief Give the number of points between which the flux is.
+   *
+   * The two cells sharing the face always come first in a stencil entry,
+   * the remaining points only contribute to the flux through the weights.
+   *
+   * @param[in] index of the stencil entry for which to query the size
+   * @return the number of points.
+   */
+  constexpr localIndex numPointsInFlux( localIndex index ) const
+  {
+    GEOSX_UNUSED_VAR( index );
+    return NUM_POINT_IN_FLUX;
+  }
+
 };
 
 } /* namespace geosx */
@@ -27,6 +27,12 @@ CellElementStencilTPFA::CellElementStencilTPFA():
   StencilBase< CellElementStencilTPFA_Traits, CellElementStencilTPFA >()
 {}
 
+void CellElementStencilTPFA::move( LvArray::MemorySpace const space )
+{
+  StencilBase< CellElementStencilTPFA_Traits, CellElementStencilTPFA >::move( space );
+  m_flatElementIndices.move( space, true );
+}
+
 
 void CellElementStencilTPFA::add( localIndex const numPts,
                                   localIndex const * const elementRegionIndices,
@@ -54,4 +60,20 @@ void CellElementStencilTPFA::add( localIndex const numPts,
   m_connectorIndices[connectorIndex] = oldSize;
 }
 
+void CellElementStencilTPFA::computeFlatElementIndices( FlatCellIndex const & flatIndex )
+{
+  localIndex const numConn = size();
+  m_flatElementIndices.resize( numConn, MAX_STENCIL_SIZE );
+
+  for( localIndex iconn = 0; iconn < numConn; ++iconn )
+  {
+    for( localIndex k = 0; k < MAX_STENCIL_SIZE; ++k )
+    {
+      m_flatElementIndices( iconn, k ) = flatIndex( m_elementRegionIndices( iconn, k ),
+                                                    m_elementSubRegionIndices( iconn, k ),
+                                                    m_elementIndices( iconn, k ) );
+    }
+  }
+}
+
 } /* namespace geosx */
@@ -21,6 +21,8 @@
 
 #include "StencilBase.hpp"
 
+#include "mesh/FlatCellIndex.hpp"
+
 namespace geosx
 {
 
@@ -72,6 +74,8 @@ public:
    */
   CellElementStencilTPFA();
 
+  virtual void move( LvArray::MemorySpace const space ) override final;
+
   virtual void add( localIndex const numPts,
                     localIndex const * const elementRegionIndices,
                     localIndex const * const elementSubRegionIndices,
@@ -97,6 +101,36 @@ public:
     return MAX_STENCIL_SIZE;
   }
 
+  /**
+   * @brief Give the number of points between which the flux is.
+   * @param[in] index of the stencil entry for which to query the size
+   * @return the number of points.
+   */
+  constexpr localIndex numPointsInFlux( localIndex index ) const
+  {
+    GEOSX_UNUSED_VAR( index );
+    return NUM_POINT_IN_FLUX;
+  }
+
+  /**
+   * @brief Compute the flat indices of the stencil cells.
+   * @param[in] flatIndex the flat cell numbering of the mesh level the stencil is built on
+   *
+   * Must be called again whenever the stencil or the element subregion sizes change.
+   */
+  void computeFlatElementIndices( FlatCellIndex const & flatIndex );
+
+  /**
+   * @brief Const access to the flat indices of the stencil cells.
+   * @return the flat indices, indexed by [connection][point]
+   */
+  arrayView2d< localIndex const > getFlatElementIndices() const
+  { return m_flatElementIndices.toViewConst(); }
+
+private:
+
+  /// Flat indices of the stencil cells, see FlatCellIndex
+  array2d< localIndex > m_flatElementIndices;
 };
 
 } /* namespace geosx */
@@ -124,6 +124,17 @@ public:
   localIndex stencilSize( localIndex index ) const
   { return m_elementRegionIndices.sizeOfArray( index ); }
 
+  /**
+   * @brief Give the number of points between which the flux is.
+   *
+   * All the elements of a fracture connector are connected to each other.
+   *
+   * @param[in] index of the stencil entry for which to query the size
+   * @return the number of points.
+   */
+  localIndex numPointsInFlux( localIndex index ) const
+  { return stencilSize( index ); }
+
   /**
    * @brief Give the array of vectors pointing from the cell center to the edge center.
    * @return The array of vectors pointing from the cell center to the edge center
@@ -23,6 +23,7 @@
 #include "dataRepository/Group.hpp"
 #include "finiteVolume/FluxStencil.hpp"
 #include "CellElementStencilTPFA.hpp"
+#include "CellElementStencilMPFA.hpp"
 #include "FaceElementStencil.hpp"
 #include "managers/DomainPartition.hpp"
 
@@ -285,8 +286,8 @@ TYPE & FluxApproximationBase::getStencil( MeshLevel & mesh, string const & name
 template< typename LAMBDA >
 void FluxApproximationBase::forAllStencils( MeshLevel const & mesh, LAMBDA && lambda ) const
 {
-  //TODO remove dependence on CellElementStencilTPFA and FaceElementStencil
-  forStencils< CellElementStencilTPFA, FaceElementStencil >( mesh, std::forward< LAMBDA >( lambda ) );
+  //TODO remove dependence on CellElementStencilTPFA, CellElementStencilMPFA and FaceElementStencil
+  forStencils< CellElementStencilTPFA, CellElementStencilMPFA, FaceElementStencil >( mesh, std::forward< LAMBDA >( lambda ) );
 }
 
 template< typename TYPE, typename ... TYPES, typename LAMBDA >
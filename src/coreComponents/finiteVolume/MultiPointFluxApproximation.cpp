@@ -0,0 +1,515 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file MultiPointFluxApproximation.cpp
+ *
+ */
+#include "MultiPointFluxApproximation.hpp"
+
+#include "codingUtilities/Utilities.hpp"
+#include "finiteVolume/CellElementStencilMPFA.hpp"
+#include "LvArray/src/tensorOps.hpp"
+
+#include <algorithm>
+
+namespace geosx
+{
+
+using namespace dataRepository;
+
+namespace
+{
+
+/// A stencil point with its global index and accumulated weight
+struct WeightedCell
+{
+  CellDescriptor cell;
+  globalIndex cellGlobalIndex;
+  real64 weight;
+};
+
+/**
+ * @brief Solve A X = B in place with Gaussian elimination and partial pivoting.
+ * @param n number of rows/columns of A
+ * @param m number of columns of B
+ * @param A row-major n x n matrix, destroyed on output
+ * @param B row-major n x m matrix, overwritten with the solution X
+ * @return false if A is numerically singular
+ */
+bool solveDense( localIndex const n,
+                 localIndex const m,
+                 std::vector< real64 > & A,
+                 std::vector< real64 > & B )
+{
+  real64 scale = 0.0;
+  for( real64 const a : A )
+  {
+    scale = std::max( scale, std::fabs( a ) );
+  }
+
+  for( localIndex k = 0; k < n; ++k )
+  {
+    localIndex pivot = k;
+    for( localIndex i = k + 1; i < n; ++i )
+    {
+      if( std::fabs( A[i*n+k] ) > std::fabs( A[pivot*n+k] ) )
+      {
+        pivot = i;
+      }
+    }
+    if( std::fabs( A[pivot*n+k] ) <= 1e-14 * scale )
+    {
+      return false;
+    }
+    if( pivot != k )
+    {
+      std::swap_ranges( A.begin() + k*n, A.begin() + (k+1)*n, A.begin() + pivot*n );
+      std::swap_ranges( B.begin() + k*m, B.begin() + (k+1)*m, B.begin() + pivot*m );
+    }
+    for( localIndex i = k + 1; i < n; ++i )
+    {
+      real64 const factor = A[i*n+k] / A[k*n+k];
+      for( localIndex j = k; j < n; ++j )
+      {
+        A[i*n+j] -= factor * A[k*n+j];
+      }
+      for( localIndex j = 0; j < m; ++j )
+      {
+        B[i*m+j] -= factor * B[k*m+j];
+      }
+    }
+  }
+
+  for( localIndex k = n - 1; k >= 0; --k )
+  {
+    for( localIndex j = 0; j < m; ++j )
+    {
+      real64 value = B[k*m+j];
+      for( localIndex i = k + 1; i < n; ++i )
+      {
+        value -= A[k*n+i] * B[i*m+j];
+      }
+      B[k*m+j] = value / A[k*n+k];
+    }
+  }
+  return true;
+}
+
+}
+
+MultiPointFluxApproximation::MultiPointFluxApproximation( std::string const & name,
+                                                          Group * const parent )
+  : TwoPointFluxApproximation( name, parent )
+{
+  deregisterWrapper( viewKeyStruct::cellStencilString );
+  registerWrapper< CellElementStencilMPFA >( viewKeyStruct::cellStencilString )->
+    setRestartFlags( RestartFlags::NO_WRITE );
+}
+
+void MultiPointFluxApproximation::registerCellStencil( Group & stencilGroup ) const
+{
+  stencilGroup.registerWrapper< CellElementStencilMPFA >( viewKeyStruct::cellStencilString )->
+    setRestartFlags( RestartFlags::NO_WRITE );
+}
+
+void MultiPointFluxApproximation::computeCellStencil( MeshLevel & mesh ) const
+{
+  NodeManager const & nodeManager = *mesh.getNodeManager();
+  FaceManager const & faceManager = *mesh.getFaceManager();
+  ElementRegionManager const & elemManager = *mesh.getElemManager();
+
+  CellElementStencilMPFA & stencil = getStencil< CellElementStencilMPFA >( mesh, viewKeyStruct::cellStencilString );
+
+  arrayView2d< localIndex const > const & elemRegionList = faceManager.elementRegionList();
+  arrayView2d< localIndex const > const & elemSubRegionList = faceManager.elementSubRegionList();
+  arrayView2d< localIndex const > const & elemList = faceManager.elementList();
+  ArrayOfArraysView< localIndex const > const & faceToNodes = faceManager.nodeList().toViewConst();
+  ArrayOfSetsView< localIndex const > const & nodeToFaces = nodeManager.faceList().toViewConst();
+
+  arrayView1d< real64 const > const & faceArea = faceManager.faceArea();
+  arrayView2d< real64 const > const & faceCenter = faceManager.faceCenter();
+  arrayView2d< real64 const > const & faceNormal = faceManager.faceNormal();
+
+  arrayView1d< real64 const > const & transMultiplier =
+    faceManager.getReference< array1d< real64 > >( m_coeffName + viewKeyStruct::transMultiplierString );
+
+  ElementRegionManager::ElementViewAccessor< arrayView2d< real64 const > > const elemCenter =
+    elemManager.ConstructArrayViewAccessor< real64, 2 >( CellBlock::viewKeyStruct::elementCenterString );
+
+  ElementRegionManager::ElementViewAccessor< arrayView1d< R1Tensor const > > const coefficient =
+    elemManager.ConstructArrayViewAccessor< R1Tensor, 1 >( m_coeffName );
+
+  ElementRegionManager::ElementViewAccessor< arrayView1d< globalIndex const > > const elemGlobalIndex =
+    elemManager.ConstructArrayViewAccessor< globalIndex, 1 >( ObjectManagerBase::viewKeyStruct::localToGlobalMapString );
+
+  ElementRegionManager::ElementViewAccessor< arrayView1d< integer const > > const elemGhostRank =
+    elemManager.ConstructArrayViewAccessor< integer, 1 >( ObjectManagerBase::viewKeyStruct::ghostRankString );
+
+  // make a list of region indices to be included
+  SortedArray< localIndex > regionFilter;
+  for( string const & regionName : m_targetRegions )
+  {
+    regionFilter.insert( elemManager.GetRegions().getIndex( regionName ) );
+  }
+
+  // the coefficient is a diagonal tensor, given by its values along the mesh axes; a field of any other
+  // type (such as a full tensor) is not found by the accessor, and must not be silently read as diagonal
+  for( localIndex const er : regionFilter )
+  {
+    ElementRegionBase const & region = *elemManager.GetRegion( er );
+    for( localIndex esr = 0; esr < region.numSubRegions(); ++esr )
+    {
+      GEOSX_ERROR_IF( coefficient[er][esr].size() != region.GetSubRegion( esr )->size(),
+                      "MultiPointFluxApproximation: coefficient " << m_coeffName << " in region " << region.getName() <<
+                      " must be a diagonal tensor (array1d< R1Tensor >), full tensors are not supported" );
+    }
+  }
+
+  real64 const lengthTolerance = m_lengthScale * m_areaRelTol;
+  real64 const areaTolerance = lengthTolerance * lengthTolerance;
+
+  auto const isTargetCell = [&]( localIndex const kf, localIndex const ke )
+  {
+    return elemList[kf][ke] >= 0 && regionFilter.contains( elemRegionList[kf][ke] );
+  };
+
+  // Faces across which flux is exchanged between two cells of the target regions
+  auto const isOpenFace = [&]( localIndex const kf )
+  {
+    return isTargetCell( kf, 0 ) && isTargetCell( kf, 1 ) &&
+           !isZero( transMultiplier[kf] ) && faceArea[kf] >= areaTolerance;
+  };
+
+  // Faces for which a stencil entry is created (same filters as the two-point approximation)
+  array1d< integer > isStencilFace( faceManager.size() );
+  forAll< serialPolicy >( faceManager.size(), [&]( localIndex const kf )
+  {
+    isStencilFace[kf] = isOpenFace( kf ) &&
+                        ( elemGhostRank[elemRegionList[kf][0]][elemSubRegionList[kf][0]][elemList[kf][0]] < 0 ||
+                          elemGhostRank[elemRegionList[kf][1]][elemSubRegionList[kf][1]][elemList[kf][1]] < 0 );
+  } );
+
+  // Sub-face flux contributions, accumulated over the nodes of each stencil face
+  std::vector< std::vector< WeightedCell > > faceStencils( faceManager.size() );
+
+  std::vector< localIndex > regionFaces;
+  std::vector< CellDescriptor > regionCells;
+  std::vector< localIndex > unknownIndex;
+  std::vector< real64 > subFaceCoef;
+  std::vector< real64 > subFaceCellCoef;
+  std::vector< real64 > A;
+  std::vector< real64 > B;
+
+  for( localIndex kn = 0; kn < nodeManager.size(); ++kn )
+  {
+    // Skip nodes that do not belong to any stencil face
+    bool hasStencilFace = false;
+    for( localIndex const kf : nodeToFaces[kn] )
+    {
+      hasStencilFace = hasStencilFace || isStencilFace[kf];
+    }
+    if( !hasStencilFace )
+    {
+      continue;
+    }
+
+    // Collect the faces and cells of the interaction region
+    regionFaces.clear();
+    regionCells.clear();
+    for( localIndex const kf : nodeToFaces[kn] )
+    {
+      if( faceArea[kf] < areaTolerance || !( isTargetCell( kf, 0 ) || isTargetCell( kf, 1 ) ) )
+      {
+        continue;
+      }
+      regionFaces.push_back( kf );
+      for( localIndex ke = 0; ke < 2; ++ke )
+      {
+        if( !isTargetCell( kf, ke ) )
+        {
+          continue;
+        }
+        CellDescriptor cell{ elemRegionList[kf][ke], elemSubRegionList[kf][ke], elemList[kf][ke] };
+        if( std::find_if( regionCells.begin(), regionCells.end(),
+                          [&]( CellDescriptor const & c ){ return cell == c; } ) == regionCells.end() )
+        {
+          regionCells.push_back( cell );
+        }
+      }
+    }
+
+    localIndex const numFaces = LvArray::integerConversion< localIndex >( regionFaces.size() );
+    localIndex const numCells = LvArray::integerConversion< localIndex >( regionCells.size() );
+
+    auto const cellIndexInRegion = [&]( localIndex const kf, localIndex const ke ) -> localIndex
+    {
+      CellDescriptor cell{ elemRegionList[kf][ke], elemSubRegionList[kf][ke], elemList[kf][ke] };
+      return std::distance( regionCells.begin(),
+                            std::find_if( regionCells.begin(), regionCells.end(),
+                                          [&]( CellDescriptor const & c ){ return cell == c; } ) );
+    };
+
+    // One continuity unknown per open face, one per half-face (no-flow) otherwise
+    unknownIndex.assign( 2 * numFaces, -1 );
+    localIndex numUnknowns = 0;
+    for( localIndex i = 0; i < numFaces; ++i )
+    {
+      localIndex const kf = regionFaces[i];
+      if( isOpenFace( kf ) )
+      {
+        unknownIndex[2*i] = numUnknowns;
+        unknownIndex[2*i+1] = numUnknowns++;
+      }
+      else
+      {
+        for( localIndex ke = 0; ke < 2; ++ke )
+        {
+          if( isTargetCell( kf, ke ) )
+          {
+            unknownIndex[2*i+ke] = numUnknowns++;
+          }
+        }
+      }
+    }
+
+    // Outward sub-face flux of each half-face: sum_g subFaceCoef[g] * u_g - subFaceCellCoef * p_K
+    subFaceCoef.assign( 2 * numFaces * numUnknowns, 0.0 );
+    subFaceCellCoef.assign( 2 * numFaces, 0.0 );
+
+    for( localIndex ic = 0; ic < numCells; ++ic )
+    {
+      CellDescriptor const & cell = regionCells[ic];
+      arraySlice1d< real64 const > const cellCenter = elemCenter[cell.region][cell.subRegion][cell.index];
+
+      // Half-faces of the cell in the interaction region
+      stackArray1d< localIndex, 16 > halfFaces;
+      for( localIndex i = 0; i < numFaces; ++i )
+      {
+        for( localIndex ke = 0; ke < 2; ++ke )
+        {
+          if( isTargetCell( regionFaces[i], ke ) && cellIndexInRegion( regionFaces[i], ke ) == ic )
+          {
+            halfFaces.emplace_back( 2*i+ke );
+          }
+        }
+      }
+
+      // Least-squares gradient reconstruction G = (D^T D)^{-1} D^T, with rows of D given by x_f - x_K
+      localIndex const numHalfFaces = halfFaces.size();
+      stackArray2d< real64, 48 > D( numHalfFaces, 3 );
+      real64 DtD[ 3 ][ 3 ] = { { 0.0 } };
+      for( localIndex j = 0; j < numHalfFaces; ++j )
+      {
+        localIndex const kf = regionFaces[halfFaces[j] / 2];
+        for( localIndex d = 0; d < 3; ++d )
+        {
+          D( j, d ) = faceCenter[kf][d] - cellCenter[d];
+        }
+        for( localIndex d1 = 0; d1 < 3; ++d1 )
+        {
+          for( localIndex d2 = 0; d2 < 3; ++d2 )
+          {
+            DtD[d1][d2] += D( j, d1 ) * D( j, d2 );
+          }
+        }
+      }
+
+      real64 const det = LvArray::tensorOps::invert< 3 >( DtD );
+      GEOSX_ERROR_IF( numHalfFaces < 3 || std::fabs( det ) < areaTolerance * areaTolerance * areaTolerance,
+                      "MultiPointFluxApproximation: degenerate interaction region around node " << kn );
+
+      real64 cellCoefficient[ 3 ];
+      LvArray::tensorOps::copy< 3 >( cellCoefficient, coefficient[cell.region][cell.subRegion][cell.index] );
+
+      for( localIndex j = 0; j < numHalfFaces; ++j )
+      {
+        localIndex const hf = halfFaces[j];
+        localIndex const kf = regionFaces[hf / 2];
+
+        real64 outwardNormal[ 3 ], conormal[ 3 ];
+        LvArray::tensorOps::copy< 3 >( outwardNormal, faceNormal[kf] );
+        if( LvArray::tensorOps::AiBi< 3 >( outwardNormal, D[j] ) < 0.0 )
+        {
+          LvArray::tensorOps::scale< 3 >( outwardNormal, -1 );
+        }
+        LvArray::tensorOps::hadamardProduct< 3 >( conormal, cellCoefficient, outwardNormal );
+
+        real64 const subFaceArea = faceArea[kf] / faceToNodes.sizeOfArray( kf );
+
+        for( localIndex g = 0; g < numHalfFaces; ++g )
+        {
+          // column g of G applied to the conormal
+          real64 coef = 0.0;
+          for( localIndex d1 = 0; d1 < 3; ++d1 )
+          {
+            for( localIndex d2 = 0; d2 < 3; ++d2 )
+            {
+              coef += conormal[d1] * DtD[d1][d2] * D( g, d2 );
+            }
+          }
+          coef *= -subFaceArea;
+          subFaceCoef[hf * numUnknowns + unknownIndex[halfFaces[g]]] += coef;
+          subFaceCellCoef[hf] += coef;
+        }
+      }
+    }
+
+    // Flux continuity (or no-flow) equations: A u = B p
+    A.assign( numUnknowns * numUnknowns, 0.0 );
+    B.assign( numUnknowns * numCells, 0.0 );
+    for( localIndex i = 0; i < numFaces; ++i )
+    {
+      for( localIndex ke = 0; ke < 2; ++ke )
+      {
+        localIndex const hf = 2*i+ke;
+        if( unknownIndex[hf] < 0 )
+        {
+          continue;
+        }
+        localIndex const row = unknownIndex[hf];
+        for( localIndex g = 0; g < numUnknowns; ++g )
+        {
+          A[row * numUnknowns + g] += subFaceCoef[hf * numUnknowns + g];
+        }
+        B[row * numCells + cellIndexInRegion( regionFaces[i], ke )] += subFaceCellCoef[hf];
+      }
+    }
+
+    GEOSX_ERROR_IF( !solveDense( numUnknowns, numCells, A, B ),
+                    "MultiPointFluxApproximation: singular local system around node " << kn );
+
+    // Express the sub-face flux out of the first cell of each stencil face in terms of cell pressures
+    for( localIndex i = 0; i < numFaces; ++i )
+    {
+      localIndex const kf = regionFaces[i];
+      if( !isStencilFace[kf] )
+      {
+        continue;
+      }
+
+      localIndex const hf = 2*i;
+      localIndex const firstCell = cellIndexInRegion( kf, 0 );
+      std::vector< WeightedCell > & faceStencil = faceStencils[kf];
+
+      for( localIndex ic = 0; ic < numCells; ++ic )
+      {
+        real64 weight = ( ic == firstCell ) ? -subFaceCellCoef[hf] : 0.0;
+        for( localIndex g = 0; g < numUnknowns; ++g )
+        {
+          weight += subFaceCoef[hf * numUnknowns + g] * B[g * numCells + ic];
+        }
+
+        CellDescriptor const & cell = regionCells[ic];
+        auto it = std::find_if( faceStencil.begin(), faceStencil.end(),
+                                [&]( WeightedCell & wc ){ return wc.cell == cell; } );
+        if( it == faceStencil.end() )
+        {
+          faceStencil.push_back( { cell, elemGlobalIndex[cell.region][cell.subRegion][cell.index], weight } );
+        }
+        else
+        {
+          it->weight += weight;
+        }
+      }
+    }
+  }
+
+  stencil.reserve( faceManager.size() );
+
+  localIndex constexpr maxStencilSize = CellElementStencilMPFA::MAX_STENCIL_SIZE;
+
+  for( localIndex kf = 0; kf < faceManager.size(); ++kf )
+  {
+    if( !isStencilFace[kf] )
+    {
+      continue;
+    }
+
+    std::vector< WeightedCell > & faceStencil = faceStencils[kf];
+
+    // The two cells sharing the face come first, in order of global indices
+    for( localIndex ke = 0; ke < 2; ++ke )
+    {
+      CellDescriptor cell{ elemRegionList[kf][ke], elemSubRegionList[kf][ke], elemList[kf][ke] };
+      auto it = std::find_if( faceStencil.begin(), faceStencil.end(),
+                              [&]( WeightedCell & wc ){ return wc.cell == cell; } );
+      GEOSX_ASSERT( it != faceStencil.end() );
+      std::iter_swap( faceStencil.begin() + ke, it );
+    }
+
+    real64 const sign = ( faceStencil[0].cellGlobalIndex < faceStencil[1].cellGlobalIndex ) ? 1.0 : -1.0;
+    if( sign < 0 )
+    {
+      std::swap( faceStencil[0], faceStencil[1] );
+    }
+
+    std::sort( faceStencil.begin() + 2, faceStencil.end(),
+               []( WeightedCell const & a, WeightedCell const & b ){ return a.cellGlobalIndex < b.cellGlobalIndex; } );
+
+    real64 maxWeight = 0.0;
+    for( WeightedCell const & wc : faceStencil )
+    {
+      maxWeight = std::max( maxWeight, std::fabs( wc.weight ) );
+    }
+
+    stackArray1d< localIndex, maxStencilSize > regionIndex;
+    stackArray1d< localIndex, maxStencilSize > subRegionIndex;
+    stackArray1d< localIndex, maxStencilSize > elementIndex;
+    stackArray1d< real64, maxStencilSize > stencilWeights;
+
+    for( localIndex k = 0; k < LvArray::integerConversion< localIndex >( faceStencil.size() ); ++k )
+    {
+      WeightedCell const & wc = faceStencil[k];
+
+      // Drop points that do not contribute, except for the two cells sharing the face
+      if( k >= 2 && std::fabs( wc.weight ) <= 1e-12 * maxWeight )
+      {
+        continue;
+      }
+
+      GEOSX_ERROR_IF( regionIndex.size() >= maxStencilSize,
+                      "MultiPointFluxApproximation: maximum stencil size exceeded for face " << kf );
+
+      regionIndex.emplace_back( wc.cell.region );
+      subRegionIndex.emplace_back( wc.cell.subRegion );
+      elementIndex.emplace_back( wc.cell.index );
+      stencilWeights.emplace_back( sign * transMultiplier[kf] * wc.weight );
+    }
+
+    stencil.add( regionIndex.size(),
+                 regionIndex.data(),
+                 subRegionIndex.data(),
+                 elementIndex.data(),
+                 stencilWeights.data(),
+                 kf );
+  }
+}
+
+void MultiPointFluxApproximation::addToFractureStencil( MeshLevel & GEOSX_UNUSED_PARAM( mesh ),
+                                                        string const & GEOSX_UNUSED_PARAM( faceElementRegionName ),
+                                                        bool const GEOSX_UNUSED_PARAM( initFlag ) ) const
+{
+  GEOSX_ERROR( "MultiPointFluxApproximation: fracture stencils are not supported" );
+}
+
+void MultiPointFluxApproximation::addEDFracToFractureStencil( MeshLevel & GEOSX_UNUSED_PARAM( mesh ),
+                                                              string const & GEOSX_UNUSED_PARAM( embeddedSurfaceRegionName ) ) const
+{
+  GEOSX_ERROR( "MultiPointFluxApproximation: embedded fracture stencils are not supported" );
+}
+
+REGISTER_CATALOG_ENTRY( FluxApproximationBase, MultiPointFluxApproximation, std::string const &, Group * const )
+
+}
@@ -0,0 +1,80 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file MultiPointFluxApproximation.hpp
+ */
+
+#ifndef GEOSX_FINITEVOLUME_MULTIPOINTFLUXAPPROXIMATION_HPP_
+#define GEOSX_FINITEVOLUME_MULTIPOINTFLUXAPPROXIMATION_HPP_
+
+#include "finiteVolume/TwoPointFluxApproximation.hpp"
+
+namespace geosx
+{
+
+/**
+ * @class MultiPointFluxApproximation
+ *
+ * Provides management of the interior stencil points when using a multi-point flux approximation.
+ *
+ * Interior face transmissibilities are computed with the O(0)-method: an interaction region is
+ * built around each mesh node, a linear pressure is reconstructed in each cell from the face center
+ * continuity points at that node, and flux continuity across the sub-faces is enforced to eliminate
+ * the face unknowns. Each sub-face flux then depends on all cells of the interaction region, and the
+ * sub-face contributions are summed to form the full face stencil. On K-orthogonal grids the method
+ * reduces to the two-point approximation.
+ * As in the two-point approximation, the coefficient (permeability) is a diagonal tensor given by its
+ * values along the mesh axes; coefficient fields holding full tensors are rejected.
+ *
+ * Boundary stencils are inherited from TwoPointFluxApproximation; fracture stencils are not supported.
+ */
+class MultiPointFluxApproximation : public TwoPointFluxApproximation
+{
+public:
+
+  /**
+   * @brief Static Factory Catalog Functions.
+   * @return the catalog name
+   */
+  static std::string CatalogName() { return "MultiPointFluxApproximation"; }
+
+  MultiPointFluxApproximation() = delete;
+
+  /**
+   * @brief Constructor.
+   * @param name the name of the MultiPointFluxApproximation in the data repository
+   * @param parent the parent group of this group.
+   */
+  MultiPointFluxApproximation( std::string const & name, dataRepository::Group * const parent );
+
+protected:
+
+  virtual void registerCellStencil( Group & stencilGroup ) const override;
+
+  virtual void computeCellStencil( MeshLevel & mesh ) const override;
+
+  virtual void addToFractureStencil( MeshLevel & mesh,
+                                     string const & faceElementRegionName,
+                                     bool const initFlag ) const override;
+
+  virtual void addEDFracToFractureStencil( MeshLevel & mesh,
+                                           string const & embeddedSurfaceRegionName ) const override;
+
+};
+
+}
+
+
+#endif //GEOSX_FINITEVOLUME_MULTIPOINTFLUXAPPROXIMATION_HPP_
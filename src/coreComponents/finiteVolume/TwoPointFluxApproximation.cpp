@@ -193,6 +193,8 @@ void TwoPointFluxApproximation::computeCellStencil( MeshLevel & mesh ) const
                  stencilWeights.data(),
                  kf );
   } );
+
+  stencil.computeFlatElementIndices( FlatCellIndex( elemManager ) );
 }
 
 void TwoPointFluxApproximation::registerFractureStencil( Group & stencilGroup ) const
@@ -608,6 +610,8 @@ void TwoPointFluxApproximation::addToFractureStencil( MeshLevel & mesh,
       }
     } );
   }
+
+  cellStencil.computeFlatElementIndices( FlatCellIndex( *elemManager ) );
 }
 
 void TwoPointFluxApproximation::addEDFracToFractureStencil( MeshLevel & mesh,
@@ -756,6 +760,8 @@ void TwoPointFluxApproximation::addEDFracToFractureStencil( MeshLevel & mesh,
       connectorIndex++;
     }
   }
+
+  cellStencil.computeFlatElementIndices( FlatCellIndex( elemManager ) );
 }
 
 void TwoPointFluxApproximation::registerBoundaryStencil( Group & stencilGroup, string const & setName ) const
@@ -0,0 +1,441 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// Source includes
+#include "finiteVolume/CellElementStencilMPFA.hpp"
+#include "finiteVolume/CellElementStencilTPFA.hpp"
+#include "finiteVolume/FiniteVolumeManager.hpp"
+#include "finiteVolume/FluxApproximationBase.hpp"
+#include "managers/initialization.hpp"
+#include "managers/NumericalMethodsManager.hpp"
+#include "managers/ProblemManager.hpp"
+#include "mesh/FlatCellIndex.hpp"
+#include "physicsSolvers/fluidFlow/unitTests/testCompFlowUtils.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+
+// System includes
+#include <map>
+
+using namespace geosx;
+using namespace geosx::testing;
+
+char const * const xmlInputHeader =
+  "<Problem>\n"
+  "  <Solvers>\n"
+  "    <SinglePhaseFVM name=\"singleflow\"\n"
+  "                    discretization=\"fluidMPFA\"\n"
+  "                    targetRegions=\"{region}\"\n"
+  "                    fluidNames=\"{water}\"\n"
+  "                    solidNames=\"{rock}\">\n"
+  "      <NonlinearSolverParameters newtonTol=\"1.0e-6\"\n"
+  "                                 newtonMaxIter=\"2\"/>\n"
+  "      <LinearSolverParameters solverType=\"gmres\"\n"
+  "                              krylovTol=\"1.0e-10\"/>\n"
+  "    </SinglePhaseFVM>\n"
+  "  </Solvers>\n";
+
+// K-orthogonal grid: the multi-point stencil must collapse to two points
+char const * const meshInputOrthogonal =
+  "  <Mesh>\n"
+  "    <InternalMesh name=\"mesh\"\n"
+  "                  elementTypes=\"{C3D8}\"\n"
+  "                  xCoords=\"{0, 3}\"\n"
+  "                  yCoords=\"{0, 2}\"\n"
+  "                  zCoords=\"{0, 1}\"\n"
+  "                  nx=\"{3}\"\n"
+  "                  ny=\"{4}\"\n"
+  "                  nz=\"{2}\"\n"
+  "                  cellBlockNames=\"{cb}\"/>\n"
+  "  </Mesh>\n";
+
+// Sheared grid: cell-center lines are not aligned with the K-normals of the faces
+char const * const meshInputSkewed =
+  "  <Mesh>\n"
+  "    <InternalMesh name=\"mesh\"\n"
+  "                  elementTypes=\"{C3D8}\"\n"
+  "                  xCoords=\"{0, 4}\"\n"
+  "                  yCoords=\"{0, 4}\"\n"
+  "                  zCoords=\"{0, 3}\"\n"
+  "                  nx=\"{4}\"\n"
+  "                  ny=\"{4}\"\n"
+  "                  nz=\"{3}\"\n"
+  "                  skewAngle=\"0.4\"\n"
+  "                  cellBlockNames=\"{cb}\"/>\n"
+  "  </Mesh>\n";
+
+char const * const xmlInputFooter =
+  "  <NumericalMethods>\n"
+  "    <FiniteVolume>\n"
+  "      <MultiPointFluxApproximation name=\"fluidMPFA\"\n"
+  "                                   fieldName=\"pressure\"\n"
+  "                                   coefficientName=\"permeability\"/>\n"
+  "      <TwoPointFluxApproximation name=\"fluidTPFA\"\n"
+  "                                 fieldName=\"pressure\"\n"
+  "                                 coefficientName=\"permeability\"\n"
+  "                                 targetRegions=\"{region}\"/>\n"
+  "    </FiniteVolume>\n"
+  "  </NumericalMethods>\n"
+  "  <ElementRegions>\n"
+  "    <CellElementRegion name=\"region\" cellBlocks=\"{cb}\" materialList=\"{water, rock}\"/>\n"
+  "  </ElementRegions>\n"
+  "  <Constitutive>\n"
+  "    <CompressibleSinglePhaseFluid name=\"water\"\n"
+  "                                  defaultDensity=\"1000\"\n"
+  "                                  defaultViscosity=\"0.001\"\n"
+  "                                  referencePressure=\"0.0\"\n"
+  "                                  referenceDensity=\"1000\"\n"
+  "                                  compressibility=\"5e-10\"\n"
+  "                                  referenceViscosity=\"0.001\"\n"
+  "                                  viscosibility=\"0.0\"/>\n"
+  "    <PoreVolumeCompressibleSolid name=\"rock\"\n"
+  "                                 referencePressure=\"0.0\"\n"
+  "                                 compressibility=\"1e-9\"/>\n"
+  "  </Constitutive>\n"
+  "  <FieldSpecifications>\n"
+  "    <FieldSpecification name=\"permx\"\n"
+  "                        component=\"0\"\n"
+  "                        initialCondition=\"1\"\n"
+  "                        setNames=\"{all}\"\n"
+  "                        objectPath=\"ElementRegions/region/cb\"\n"
+  "                        fieldName=\"permeability\"\n"
+  "                        scale=\"2.0e-12\"/>\n"
+  "    <FieldSpecification name=\"permy\"\n"
+  "                        component=\"1\"\n"
+  "                        initialCondition=\"1\"\n"
+  "                        setNames=\"{all}\"\n"
+  "                        objectPath=\"ElementRegions/region/cb\"\n"
+  "                        fieldName=\"permeability\"\n"
+  "                        scale=\"5.0e-13\"/>\n"
+  "    <FieldSpecification name=\"permz\"\n"
+  "                        component=\"2\"\n"
+  "                        initialCondition=\"1\"\n"
+  "                        setNames=\"{all}\"\n"
+  "                        objectPath=\"ElementRegions/region/cb\"\n"
+  "                        fieldName=\"permeability\"\n"
+  "                        scale=\"1.0e-15\"/>\n"
+  "    <FieldSpecification name=\"referencePorosity\"\n"
+  "                        initialCondition=\"1\"\n"
+  "                        setNames=\"{all}\"\n"
+  "                        objectPath=\"ElementRegions/region/cb\"\n"
+  "                        fieldName=\"referencePorosity\"\n"
+  "                        scale=\"0.1\"/>\n"
+  "  </FieldSpecifications>\n"
+  "</Problem>";
+
+class MultiPointFluxApproximationTestBase : public ::testing::Test
+{
+public:
+
+  MultiPointFluxApproximationTestBase()
+    : problemManager( std::make_unique< ProblemManager >( "Problem", nullptr ) )
+  {}
+
+protected:
+
+  void setupProblem( char const * const meshInput )
+  {
+    string const xmlInput = string( xmlInputHeader ) + meshInput + xmlInputFooter;
+    setupProblemFromXML( *problemManager, xmlInput.c_str() );
+  }
+
+  FluxApproximationBase const & getFluxApproximation( string const & name ) const
+  {
+    DomainPartition const & domain = *problemManager->getDomainPartition();
+    return domain.getNumericalMethodManager().getFiniteVolumeManager().getFluxApproximation( name );
+  }
+
+  MeshLevel const & getMesh() const
+  {
+    return *problemManager->getDomainPartition()->getMeshBody( 0 )->getMeshLevel( 0 );
+  }
+
+  std::unique_ptr< ProblemManager > problemManager;
+};
+
+class MultiPointFluxApproximationTest : public MultiPointFluxApproximationTestBase
+{
+protected:
+
+  void SetUp() override
+  {
+    setupProblem( meshInputOrthogonal );
+  }
+};
+
+class MultiPointFluxApproximationSkewedTest : public MultiPointFluxApproximationTestBase
+{
+protected:
+
+  void SetUp() override
+  {
+    setupProblem( meshInputSkewed );
+  }
+};
+
+TEST_F( MultiPointFluxApproximationTest, consistency )
+{
+  CellElementStencilMPFA const & stencil =
+    getFluxApproximation( "fluidMPFA" ).getStencil< CellElementStencilMPFA >( getMesh(),
+                                                                               FluxApproximationBase::viewKeyStruct::cellStencilString );
+
+  CellElementStencilMPFA::WeightContainerViewConstType const & weights = stencil.getWeights();
+
+  ASSERT_GT( stencil.size(), 0 );
+  for( localIndex iconn = 0; iconn < stencil.size(); ++iconn )
+  {
+    ASSERT_GE( stencil.stencilSize( iconn ), 2 );
+    ASSERT_LE( stencil.stencilSize( iconn ), CellElementStencilMPFA::MAX_STENCIL_SIZE );
+
+    // a constant pressure field must not produce any flux
+    real64 sum = 0.0;
+    for( localIndex i = 0; i < stencil.stencilSize( iconn ); ++i )
+    {
+      sum += weights[iconn][i];
+    }
+    EXPECT_NEAR( sum, 0.0, 1e-10 * std::fabs( weights[iconn][0] ) );
+    EXPECT_GT( weights[iconn][0], 0.0 );
+  }
+}
+
+TEST_F( MultiPointFluxApproximationTest, reducesToTwoPointOnKOrthogonalGrid )
+{
+  MeshLevel const & mesh = getMesh();
+  string const key = FluxApproximationBase::viewKeyStruct::cellStencilString;
+
+  CellElementStencilTPFA const & tpfaStencil =
+    getFluxApproximation( "fluidTPFA" ).getStencil< CellElementStencilTPFA >( mesh, key );
+  CellElementStencilMPFA const & mpfaStencil =
+    getFluxApproximation( "fluidMPFA" ).getStencil< CellElementStencilMPFA >( mesh, key );
+
+  ASSERT_EQ( tpfaStencil.size(), mpfaStencil.size() );
+
+  // two-point weights, keyed by the ordered pair of cells
+  std::map< std::pair< localIndex, localIndex >, real64 > tpfaWeights;
+  for( localIndex iconn = 0; iconn < tpfaStencil.size(); ++iconn )
+  {
+    localIndex const ei0 = tpfaStencil.getElementIndices()[iconn][0];
+    localIndex const ei1 = tpfaStencil.getElementIndices()[iconn][1];
+    tpfaWeights[ std::make_pair( ei0, ei1 ) ] = tpfaStencil.getWeights()[iconn][0];
+  }
+
+  for( localIndex iconn = 0; iconn < mpfaStencil.size(); ++iconn )
+  {
+    ASSERT_EQ( mpfaStencil.stencilSize( iconn ), 2 );
+
+    localIndex const ei0 = mpfaStencil.getElementIndices()[iconn][0];
+    localIndex const ei1 = mpfaStencil.getElementIndices()[iconn][1];
+
+    auto const it = tpfaWeights.find( std::make_pair( ei0, ei1 ) );
+    ASSERT_TRUE( it != tpfaWeights.end() );
+
+    checkRelativeError( mpfaStencil.getWeights()[iconn][0], it->second, 1e-10, 0.0, "w0" );
+    checkRelativeError( mpfaStencil.getWeights()[iconn][1], -it->second, 1e-10, 0.0, "w1" );
+  }
+}
+
+TEST_F( MultiPointFluxApproximationTest, twoPointFlatIndices )
+{
+  MeshLevel const & mesh = getMesh();
+  ElementRegionManager const & elemManager = *mesh.getElemManager();
+
+  CellElementStencilTPFA const & stencil =
+    getFluxApproximation( "fluidTPFA" ).getStencil< CellElementStencilTPFA >( mesh,
+                                                                               FluxApproximationBase::viewKeyStruct::cellStencilString );
+
+  FlatCellIndex const flatIndex( elemManager );
+  arrayView2d< localIndex const > const & flatIndices = stencil.getFlatElementIndices();
+
+  ASSERT_EQ( flatIndices.size( 0 ), stencil.size() );
+  for( localIndex iconn = 0; iconn < stencil.size(); ++iconn )
+  {
+    for( localIndex k = 0; k < stencil.stencilSize( iconn ); ++k )
+    {
+      localIndex const er = stencil.getElementRegionIndices()[iconn][k];
+      localIndex const esr = stencil.getElementSubRegionIndices()[iconn][k];
+      localIndex const ei = stencil.getElementIndices()[iconn][k];
+      EXPECT_EQ( flatIndices[iconn][k], flatIndex.offsets()[er][esr] + ei );
+    }
+  }
+
+  // a gathered field must be addressable through the flat indices
+  ElementRegionManager::ElementViewAccessor< arrayView1d< globalIndex const > > const elemGlobalIndex =
+    elemManager.ConstructArrayViewAccessor< globalIndex, 1 >( ObjectManagerBase::viewKeyStruct::localToGlobalMapString );
+
+  array1d< globalIndex > flatGlobalIndex;
+  flatIndex.gather( elemGlobalIndex.toNestedViewConst(), flatGlobalIndex );
+  ASSERT_EQ( flatGlobalIndex.size(), flatIndex.numElems() );
+
+  for( localIndex iconn = 0; iconn < stencil.size(); ++iconn )
+  {
+    for( localIndex k = 0; k < stencil.stencilSize( iconn ); ++k )
+    {
+      localIndex const er = stencil.getElementRegionIndices()[iconn][k];
+      localIndex const esr = stencil.getElementSubRegionIndices()[iconn][k];
+      localIndex const ei = stencil.getElementIndices()[iconn][k];
+      EXPECT_EQ( flatGlobalIndex[flatIndices[iconn][k]], elemGlobalIndex[er][esr][ei] );
+    }
+  }
+}
+
+TEST_F( MultiPointFluxApproximationSkewedTest, exactForLinearPressure )
+{
+  MeshLevel const & mesh = getMesh();
+  string const key = FluxApproximationBase::viewKeyStruct::cellStencilString;
+
+  NodeManager const & nodeManager = *mesh.getNodeManager();
+  FaceManager const & faceManager = *mesh.getFaceManager();
+  CellElementSubRegion const & subRegion =
+    *mesh.getElemManager()->GetRegion( 0 )->GetSubRegion< CellElementSubRegion >( 0 );
+
+  CellElementStencilMPFA const & mpfaStencil =
+    getFluxApproximation( "fluidMPFA" ).getStencil< CellElementStencilMPFA >( mesh, key );
+  CellElementStencilTPFA const & tpfaStencil =
+    getFluxApproximation( "fluidTPFA" ).getStencil< CellElementStencilTPFA >( mesh, key );
+
+  ArrayOfArraysView< localIndex const > const & faceToNodes = faceManager.nodeList().toViewConst();
+  ArrayOfSetsView< localIndex const > const & nodeToFaces = nodeManager.faceList().toViewConst();
+  arrayView2d< localIndex const > const & faceToElems = faceManager.elementList();
+  arrayView2d< real64 const > const & faceNormal = faceManager.faceNormal();
+  arrayView1d< real64 const > const & faceArea = faceManager.faceArea();
+
+  arrayView2d< real64 const > const & elemCenter = subRegion.getElementCenter();
+  FixedOneToManyRelation const & elemToFaces = subRegion.faceList();
+  arrayView1d< R1Tensor const > const & permeability =
+    subRegion.getReference< array1d< R1Tensor > >( "permeability" );
+
+  // the interaction regions of interior nodes carry no boundary (no-flow) conditions
+  auto const isInteriorNode = [&]( localIndex const kn )
+  {
+    for( localIndex const kf : nodeToFaces[kn] )
+    {
+      if( faceToElems[kf][0] < 0 || faceToElems[kf][1] < 0 )
+      {
+        return false;
+      }
+    }
+    return true;
+  };
+
+  auto const commonFace = [&]( localIndex const ei0, localIndex const ei1 )
+  {
+    for( localIndex a = 0; a < elemToFaces.size( 1 ); ++a )
+    {
+      for( localIndex b = 0; b < elemToFaces.size( 1 ); ++b )
+      {
+        if( elemToFaces[ei0][a] == elemToFaces[ei1][b] )
+        {
+          return elemToFaces[ei0][a];
+        }
+      }
+    }
+    return localIndex( -1 );
+  };
+
+  // linear pressure field p(x) = g.x and its exact flux -(K g).n A across a face
+  real64 const gradient[ 3 ] = { 1.0, -2.0, 0.5 };
+  auto const pressure = [&]( localIndex const ei )
+  {
+    return LvArray::tensorOps::AiBi< 3 >( gradient, elemCenter[ei] );
+  };
+
+  auto const exactFlux = [&]( localIndex const ei0, localIndex const ei1, localIndex const kf )
+  {
+    real64 normal[ 3 ], dist[ 3 ], conormal[ 3 ], cellPerm[ 3 ];
+    LvArray::tensorOps::copy< 3 >( normal, faceNormal[kf] );
+    LvArray::tensorOps::copy< 3 >( dist, elemCenter[ei1] );
+    LvArray::tensorOps::subtract< 3 >( dist, elemCenter[ei0] );
+    if( LvArray::tensorOps::AiBi< 3 >( normal, dist ) < 0.0 )
+    {
+      LvArray::tensorOps::scale< 3 >( normal, -1 );
+    }
+    LvArray::tensorOps::copy< 3 >( cellPerm, permeability[ei0] );
+    LvArray::tensorOps::hadamardProduct< 3 >( conormal, cellPerm, gradient );
+    return -LvArray::tensorOps::AiBi< 3 >( conormal, normal ) * faceArea[kf];
+  };
+
+  // two-point weights, keyed by the ordered pair of cells
+  std::map< std::pair< localIndex, localIndex >, real64 > tpfaWeights;
+  for( localIndex iconn = 0; iconn < tpfaStencil.size(); ++iconn )
+  {
+    localIndex const ei0 = tpfaStencil.getElementIndices()[iconn][0];
+    localIndex const ei1 = tpfaStencil.getElementIndices()[iconn][1];
+    tpfaWeights[ std::make_pair( ei0, ei1 ) ] = tpfaStencil.getWeights()[iconn][0];
+  }
+
+  localIndex numInteriorFaces = 0;
+  real64 maxTpfaError = 0.0;
+  for( localIndex iconn = 0; iconn < mpfaStencil.size(); ++iconn )
+  {
+    localIndex const ei0 = mpfaStencil.getElementIndices()[iconn][0];
+    localIndex const ei1 = mpfaStencil.getElementIndices()[iconn][1];
+    localIndex const kf = commonFace( ei0, ei1 );
+    ASSERT_GE( kf, 0 );
+
+    bool interior = true;
+    for( localIndex a = 0; a < faceToNodes.sizeOfArray( kf ); ++a )
+    {
+      interior = interior && isInteriorNode( faceToNodes( kf, a ) );
+    }
+    if( !interior )
+    {
+      continue;
+    }
+    ++numInteriorFaces;
+
+    real64 const expected = exactFlux( ei0, ei1, kf );
+
+    real64 mpfaFlux = 0.0;
+    for( localIndex k = 0; k < mpfaStencil.stencilSize( iconn ); ++k )
+    {
+      mpfaFlux += mpfaStencil.getWeights()[iconn][k] * pressure( mpfaStencil.getElementIndices()[iconn][k] );
+    }
+    checkRelativeError( mpfaFlux, expected, 1e-8, 1e-10 * std::fabs( mpfaStencil.getWeights()[iconn][0] ), "flux" );
+
+    auto const it = tpfaWeights.find( std::make_pair( ei0, ei1 ) );
+    ASSERT_TRUE( it != tpfaWeights.end() );
+    real64 const tpfaFlux = it->second * ( pressure( ei0 ) - pressure( ei1 ) );
+    maxTpfaError = std::max( maxTpfaError, std::fabs( tpfaFlux - expected ) / std::fabs( expected ) );
+  }
+
+  EXPECT_GT( numInteriorFaces, 0 );
+
+  // the two-point approximation is inconsistent on this grid
+  EXPECT_GT( maxTpfaError, 1e-2 );
+}
+
+TEST_F( MultiPointFluxApproximationSkewedTest, rejectsFullTensorCoefficient )
+{
+  // replace the diagonal permeability with a full symmetric tensor (xx, yy, zz, yz, xz, xy)
+  DomainPartition & domain = *problemManager->getDomainPartition();
+  CellElementSubRegion & subRegion =
+    *domain.getMeshBody( 0 )->getMeshLevel( 0 )->getElemManager()->GetRegion( 0 )->GetSubRegion< CellElementSubRegion >( 0 );
+  subRegion.deregisterWrapper( "permeability" );
+  array2d< real64 > & permeability = subRegion.registerWrapper< array2d< real64 > >( "permeability" )->reference();
+  permeability.resize( subRegion.size(), 6 );
+  permeability.setValues< serialPolicy >( 1.0e-13 );
+
+  FluxApproximationBase & fluxApprox = domain.getNumericalMethodManager().getFiniteVolumeManager().getFluxApproximation( "fluidMPFA" );
+  EXPECT_DEATH_IF_SUPPORTED( fluxApprox.InitializePostInitialConditions( problemManager.get() ), "" );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
@@ -21,12 +21,14 @@
 #include "finiteVolume/FluxApproximationBase.hpp"
 #include "linearAlgebra/interfaces/InterfaceTypes.hpp"
 #include "mpiCommunications/CommunicationTools.hpp"
+#include "mpiCommunications/MpiWrapper.hpp"
 #include "managers/DomainPartition.hpp"
 #include "managers/FieldSpecification/FieldSpecificationOps.hpp"
 #include "mesh/MeshLevel.hpp"
 
 #include "DofManagerHelpers.hpp"
 
+#include <functional>
 #include <numeric>
 
 namespace geosx
@@ -34,11 +36,31 @@ namespace geosx
 
 using namespace dataRepository;
 
+namespace
+{
+
+/**
+ * @brief Mix the hash of a value into a running hash.
+ * @tparam T type of the value
+ * @param seed the running hash
+ * @param value the value
+ */
+template< typename T >
+void hashCombine( std::size_t & seed, T const & value )
+{
+  seed ^= std::hash< T >{} ( value ) + 0x9e3779b9 + ( seed << 6 ) + ( seed >> 2 );
+}
+
+} // namespace
+
 DofManager::DofManager( string name )
   : m_name( std::move( name ) ),
   m_domain( nullptr ),
   m_mesh( nullptr ),
-  m_reordered( false )
+  m_reordered( false ),
+  m_sparsityVersion( 0 ),
+  m_layoutHash( 0 ),
+  m_patternHash( 0 )
 {
   initializeDataStructure();
 }
@@ -582,8 +604,8 @@ void DofManager::setSparsityPatternFromStencil( MATRIX & pattern,
 
     forAll< serialPolicy >( stencil.size(), [&]( localIndex iconn )
     {
-      localIndex const numFluxElems = stencil.stencilSize( iconn );
-      localIndex const stencilSize  = numFluxElems;
+      localIndex const numFluxElems = stencil.numPointsInFlux( iconn );
+      localIndex const stencilSize  = stencil.stencilSize( iconn );
 
       rowIndices.resize( numFluxElems * NC );
       for( localIndex i = 0; i < numFluxElems; ++i )
@@ -767,10 +789,8 @@ void DofManager::setSparsityPatternFromStencil( SparsityPattern< globalIndex > &
 
     forAll< serialPolicy >( stencil.size(), [&]( localIndex const iconn )
     {
-      // This weirdness is because of fracture stencils, which don't have separate
-      // getters for num flux elems vs stencil size... it won't work for MPFA though
-      localIndex const numFluxElems = stencil.stencilSize( iconn );
-      localIndex const stencilSize = numFluxElems;
+      localIndex const numFluxElems = stencil.numPointsInFlux( iconn );
+      localIndex const stencilSize = stencil.stencilSize( iconn );
 
       rowDofIndices.resize( numFluxElems );
       for( localIndex i = 0; i < numFluxElems; ++i )
@@ -1109,10 +1129,8 @@ void DofManager::countRowLengthsFromStencil( arrayView1d< localIndex > const & r
 
     forAll< serialPolicy >( stencil.size(), [&]( localIndex const iconn )
     {
-      // This weirdness is because of fracture stencils, which don't have separate
-      // getters for num flux elems vs stencil size... it won't work for MPFA though
       localIndex const stencilSize = stencil.stencilSize( iconn );
-      localIndex const numFluxElems = stencilSize;
+      localIndex const numFluxElems = stencil.numPointsInFlux( iconn );
 
       for( localIndex i = 0; i < numFluxElems; ++i )
       {
@@ -1217,7 +1235,7 @@ void DofManager::countRowLengthsOneBlock( arrayView1d< localIndex > const & rowL
 }
 
 // Create the sparsity pattern (location-location). Low level interface
-void DofManager::setSparsityPattern( SparsityPattern< globalIndex > & pattern ) const
+void DofManager::setSparsityPattern( SparsityPattern< globalIndex > & pattern )
 {
   GEOSX_ERROR_IF( !m_reordered, "Cannot set monolithic sparsity pattern before reorderByRank() has been called." );
 
@@ -1248,6 +1266,20 @@ void DofManager::setSparsityPattern( SparsityPattern< globalIndex > & pattern )
 
   // Step 4. Compress to remove unused space between rows
   pattern.compress();
+
+  // Step 5. Record whether the pattern differs from the previous one
+  std::size_t patternHash = 0;
+  for( localIndex localRow = 0; localRow < pattern.numRows(); ++localRow )
+  {
+    localIndex const numNonZeros = pattern.numNonZeros( localRow );
+    arraySlice1d< globalIndex const > const columns = pattern.getColumns( localRow );
+    hashCombine( patternHash, numNonZeros );
+    for( localIndex j = 0; j < numNonZeros; ++j )
+    {
+      hashCombine( patternHash, columns[j] );
+    }
+  }
+  updateSparsityVersion( m_patternHash, patternHash );
 }
 
 // Create the sparsity pattern (location-location). High level interface
@@ -1750,6 +1782,33 @@ void DofManager::reorderByRank()
                        m_domain->getNeighbors() );
 
   m_reordered = true;
+
+  // the numbering is only considered new if the layout of the DoFs changed on some rank,
+  // or if the mesh connectivity changed, since solvers may build their own pattern from it
+  std::size_t layoutHash = 0;
+  hashCombine( layoutHash, m_mesh->topologyVersion() );
+  hashCombine( layoutHash, numGlobalDofs() );
+  hashCombine( layoutHash, rankOffset() );
+  for( FieldDescription const & field : m_fields )
+  {
+    hashCombine( layoutHash, field.name );
+    hashCombine( layoutHash, field.numComponents );
+    hashCombine( layoutHash, field.numLocalDof );
+    hashCombine( layoutHash, field.globalOffset );
+  }
+  updateSparsityVersion( m_layoutHash, layoutHash );
+}
+
+void DofManager::updateSparsityVersion( std::size_t & storedHash,
+                                        std::size_t const newHash )
+{
+  // all ranks must agree, since the parallel matrices are created collectively
+  int const changed = MpiWrapper::Max( storedHash != newHash ? 1 : 0 );
+  storedHash = newHash;
+  if( changed != 0 )
+  {
+    ++m_sparsityVersion;
+  }
 }
 
 std::vector< DofManager::SubComponent >
@@ -381,6 +381,17 @@ public:
    */
   array1d< localIndex > numComponentsPerField() const;
 
+  /**
+   * @brief Get the version of the global DoF numbering (and hence of the sparsity pattern).
+   * @return a counter that is incremented when reorderByRank() produces a DoF layout (or is called
+   *         on a mesh whose topology was modified), or setSparsityPattern() a monolithic pattern,
+   *         that differs from the previous one on any rank
+   *
+   * @note Can be compared against a previously recorded value to detect whether
+   *       a parallel matrix created from a pattern produced by this manager can be reused.
+   */
+  integer sparsityVersion() const { return m_sparsityVersion; }
+
   /**
    * @brief Get the local number of support points on this processor.
    * @param [in] fieldName the name of the field
@@ -436,8 +447,10 @@ public:
   /**
    * @brief Populate sparsity pattern of the entire system matrix.
    * @param [out] pattern the target sparsity pattern
+   *
+   * Collective call, since the sparsity version is incremented if the pattern changed on any rank.
    */
-  void setSparsityPattern( SparsityPattern< globalIndex > & pattern ) const;
+  void setSparsityPattern( SparsityPattern< globalIndex > & pattern );
 
   /**
    * @brief Populate sparsity pattern for one block of the system matrix.
@@ -802,6 +815,22 @@ private:
 
   /// Flag indicating that DOFs have been reordered rank-wise.
   bool m_reordered;
+
+  /**
+   * @brief Increment the sparsity version if a hash changed on any rank.
+   * @param storedHash the hash recorded at the previous call, replaced by @p newHash
+   * @param newHash the current hash
+   */
+  void updateSparsityVersion( std::size_t & storedHash, std::size_t const newHash );
+
+  /// Counter of DoF layouts and patterns produced by this manager, used to detect sparsity changes
+  integer m_sparsityVersion;
+
+  /// Hash of the DoF layout at the last call to reorderByRank()
+  std::size_t m_layoutHash;
+
+  /// Hash of the monolithic sparsity pattern at the last call to setSparsityPattern()
+  std::size_t m_patternHash;
 };
 
 } /* namespace geosx */
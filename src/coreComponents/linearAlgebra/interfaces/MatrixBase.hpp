@@ -248,6 +248,38 @@ protected:
     close();
   }
 
+  /**
+   * @brief Update values of a parallel matrix previously created from a local CRS matrix.
+   * @param localMatrix The input local matrix.
+   *
+   * Unlike create(), this does not rebuild the distributed matrix structure or its
+   * communication data, and only copies values from @p localMatrix into existing entries.
+   *
+   * @return @p true if the values were updated, @p false if the sparsity pattern (or row partitioning)
+   *         of @p localMatrix differs from the one used in the last call to create() on any rank,
+   *         in which case the matrix values are left in an undefined state and the matrix must be
+   *         re-created with create(). This is a collective call.
+   *
+   * The default implementation sets the values through the generic interface and does not check the pattern.
+   */
+  virtual bool update( CRSMatrixView< real64 const, globalIndex const > const & localMatrix )
+  {
+    GEOSX_LAI_ASSERT( ready() );
+    GEOSX_LAI_ASSERT_EQ( numLocalRows(), localMatrix.numRows() );
+
+    localMatrix.move( LvArray::MemorySpace::CPU, false );
+
+    globalIndex const rankOffset = ilower();
+
+    open();
+    for( localIndex localRow = 0; localRow < localMatrix.numRows(); ++localRow )
+    {
+      set( localRow + rankOffset, localMatrix.getColumns( localRow ), localMatrix.getEntries( localRow ) );
+    }
+    close();
+    return true;
+  }
+
   ///@}
 
   /**
@@ -293,6 +293,52 @@ protected:
    */
   virtual real64 dot( Vector const & vec ) const = 0;
 
+  /**
+   * @brief Dot products with several vectors, computed with a single global reduction.
+   * @param vecs pointers to the vectors to dot-product with
+   * @param results the dot products, must be of size @p vecs.size()
+   */
+  virtual void multiDot( std::vector< Vector const * > const & vecs,
+                         arrayView1d< real64 > const & results ) const
+  {
+    GEOSX_LAI_ASSERT_EQ( results.size(), LvArray::integerConversion< localIndex >( vecs.size() ) );
+    array1d< real64 > localResults( results.size() );
+    localMultiDot( vecs, localResults );
+    MpiWrapper::allReduce( localResults.data(), results.data(), LvArray::integerConversion< int >( results.size() ), MPI_SUM, getComm() );
+  }
+
+  /**
+   * @brief Contribution of the local rows to the dot product with another vector, without any communication.
+   * @param vec vector to dot-product with
+   * @return the local contribution to the dot product
+   */
+  real64 localDot( Vector const & vec ) const
+  {
+    GEOSX_LAI_ASSERT_EQ( localSize(), vec.localSize() );
+    real64 const * const localData = extractLocalVector();
+    real64 const * const otherData = vec.extractLocalVector();
+    RAJA::ReduceSum< parallelHostReduce, real64 > sum( 0.0 );
+    forAll< parallelHostPolicy >( localSize(), [=] ( localIndex const i )
+    {
+      sum += localData[i] * otherData[i];
+    } );
+    return sum.get();
+  }
+
+  /**
+   * @brief Contributions of the local rows to the dot products with several vectors, without any communication.
+   * @param vecs pointers to the vectors to dot-product with
+   * @param results the local contributions to the dot products, must be of size @p vecs.size()
+   */
+  void localMultiDot( std::vector< Vector const * > const & vecs,
+                      arrayView1d< real64 > const & results ) const
+  {
+    for( std::size_t k = 0; k < vecs.size(); ++k )
+    {
+      results[k] = localDot( *vecs[k] );
+    }
+  }
+
   /**
    * @brief Update vector <tt>y</tt> as <tt>y</tt> = <tt>x</tt>.
    * @param x vector to copy
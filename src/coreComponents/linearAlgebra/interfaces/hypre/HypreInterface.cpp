@@ -18,6 +18,7 @@
 
 #include "HypreInterface.hpp"
 #include "linearAlgebra/interfaces/hypre/HyprePreconditioner.hpp"
+#include "linearAlgebra/solvers/CPRPreconditioner.hpp"
 
 namespace geosx
 {
@@ -35,4 +36,15 @@ geosx::HypreInterface::createPreconditioner( LinearSolverParameters params )
   return std::make_unique< HyprePreconditioner >( params );
 }
 
+std::unique_ptr< PreconditionerBase< HypreInterface > >
+geosx::HypreInterface::createPreconditioner( LinearSolverParameters params,
+                                             DofManager const & dofManager )
+{
+  if( params.preconditionerType == LinearSolverParameters::PreconditionerType::cpr )
+  {
+    return std::make_unique< CPRPreconditioner< HypreInterface > >( params );
+  }
+  return std::make_unique< HyprePreconditioner >( params, &dofManager );
+}
+
 }
@@ -56,6 +56,15 @@ struct HypreInterface
   static std::unique_ptr< PreconditionerBase< HypreInterface > >
   createPreconditioner( LinearSolverParameters params );
 
+  /**
+   * @brief Create a hypre-based preconditioner object for a system described by a DofManager.
+   * @param params the preconditioner parameters
+   * @param dofManager the Degree-of-Freedom manager associated with the matrix
+   * @return owning pointer to the newly created preconditioner
+   */
+  static std::unique_ptr< PreconditionerBase< HypreInterface > >
+  createPreconditioner( LinearSolverParameters params, DofManager const & dofManager );
+
   /// Alias for HypreMatrix
   using ParallelMatrix = HypreMatrix;
   /// Alias for HypreVector
@@ -24,6 +24,7 @@
 #include "_hypre_parcsr_mv.h"
 #include "HypreUtils.hpp"
 
+#include <algorithm>
 #include <iomanip>
 
 namespace geosx
@@ -231,6 +232,62 @@ void HypreMatrix::zero()
   close();
 }
 
+bool HypreMatrix::update( CRSMatrixView< real64 const, globalIndex const > const & localMatrix )
+{
+  GEOSX_LAI_ASSERT( ready() );
+
+  localMatrix.move( LvArray::MemorySpace::CPU, false );
+
+  // Write values directly into diagonal and off-diagonal CSR blocks of the assembled ParCSR matrix,
+  // bypassing the IJ interface so that neither the structure nor the comm package are rebuilt.
+  hypre_CSRMatrix * const prt_diag_CSR = hypre_ParCSRMatrixDiag( m_parcsr_mat );
+  HYPRE_Int const * const diag_IA      = hypre_CSRMatrixI( prt_diag_CSR );
+  HYPRE_Int const * const diag_JA      = hypre_CSRMatrixJ( prt_diag_CSR );
+  HYPRE_Real * const diag_data         = hypre_CSRMatrixData( prt_diag_CSR );
+
+  hypre_CSRMatrix * const prt_offd_CSR = hypre_ParCSRMatrixOffd( m_parcsr_mat );
+  HYPRE_Int const * const offd_IA      = hypre_CSRMatrixI( prt_offd_CSR );
+  HYPRE_Int const * const offd_JA      = hypre_CSRMatrixJ( prt_offd_CSR );
+  HYPRE_Real * const offd_data         = hypre_CSRMatrixData( prt_offd_CSR );
+
+  HYPRE_BigInt const * const colMapOffd = hypre_ParCSRMatrixColMapOffd( m_parcsr_mat );
+  HYPRE_BigInt const firstColDiag = hypre_ParCSRMatrixFirstColDiag( m_parcsr_mat );
+
+  // Columns of local CRS rows are sorted, so each entry is located with a binary search.
+  // Returns false if the entry is not in the local pattern.
+  auto const copyValue = [&]( localIndex const localRow, HYPRE_BigInt const col, HYPRE_Real & value ) -> bool
+  {
+    globalIndex const * const columns = localMatrix.getColumns( localRow );
+    globalIndex const * const columnsEnd = columns + localMatrix.numNonZeros( localRow );
+    globalIndex const * const pos = std::lower_bound( columns, columnsEnd, LvArray::integerConversion< globalIndex >( col ) );
+    if( pos == columnsEnd || *pos != col )
+    {
+      return false;
+    }
+    value = localMatrix.getEntries( localRow )[ pos - columns ];
+    return true;
+  };
+
+  bool samePattern = numLocalRows() == localMatrix.numRows();
+  for( localIndex localRow = 0; samePattern && localRow < localMatrix.numRows(); ++localRow )
+  {
+    samePattern = localMatrix.numNonZeros( localRow ) ==
+                  ( diag_IA[localRow + 1] - diag_IA[localRow] ) + ( offd_IA[localRow + 1] - offd_IA[localRow] );
+
+    for( HYPRE_Int j = diag_IA[localRow]; samePattern && j < diag_IA[localRow + 1]; ++j )
+    {
+      samePattern = copyValue( localRow, firstColDiag + diag_JA[j], diag_data[j] );
+    }
+    for( HYPRE_Int j = offd_IA[localRow]; samePattern && j < offd_IA[localRow + 1]; ++j )
+    {
+      samePattern = copyValue( localRow, colMapOffd[ offd_JA[j] ], offd_data[j] );
+    }
+  }
+
+  // All ranks must agree, since the caller re-creates the matrix collectively on a mismatch
+  return MpiWrapper::Min( samePattern ? 1 : 0, getComm() ) == 1;
+}
+
 void HypreMatrix::open()
 {
   GEOSX_LAI_ASSERT( created() && closed() );
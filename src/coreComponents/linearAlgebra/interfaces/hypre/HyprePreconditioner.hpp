@@ -85,6 +85,9 @@ public:
   /**
    * @brief Compute the preconditioner from a matrix.
    * @param mat the matrix to precondition.
+   *
+   * @note BoomerAMG has no setup that keeps the coarse grids while refreshing the values,
+   *       so recompute() falls back to this full setup.
    */
   virtual void compute( Matrix const & mat ) override;
 
@@ -268,11 +268,14 @@ void CreateHypreKrylovSolver( LinearSolverParameters const & params,
       break;
     }
     case LinearSolverParameters::SolverType::bicgstab:
+    case LinearSolverParameters::SolverType::pipebicgstab:
     {
+      // hypre has no pipelined variants, use the standard ones
       CreateHypreBiCGSTAB( params, comm, solver, solverFuncs );
       break;
     }
     case LinearSolverParameters::SolverType::cg:
+    case LinearSolverParameters::SolverType::pipecg:
     {
       CreateHypreCG( params, comm, solver, solverFuncs );
       break;
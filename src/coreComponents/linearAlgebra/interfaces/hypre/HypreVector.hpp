@@ -108,6 +108,9 @@ public:
   using VectorBase::closed;
   using VectorBase::ready;
   using VectorBase::extract;
+  using VectorBase::multiDot;
+  using VectorBase::localDot;
+  using VectorBase::localMultiDot;
 
   /**
    * @copydoc VectorBase<HypreVector>::created
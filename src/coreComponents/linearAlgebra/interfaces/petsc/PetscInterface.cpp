@@ -18,6 +18,7 @@
 
 #include "PetscInterface.hpp"
 #include "linearAlgebra/interfaces/petsc/PetscPreconditioner.hpp"
+#include "linearAlgebra/solvers/CPRPreconditioner.hpp"
 
 #include <petscsys.h>
 
@@ -43,4 +44,15 @@ PetscInterface::createPreconditioner( LinearSolverParameters params )
   return std::make_unique< PetscPreconditioner >( params );
 }
 
+std::unique_ptr< PreconditionerBase< PetscInterface > >
+PetscInterface::createPreconditioner( LinearSolverParameters params,
+                                      DofManager const & GEOSX_UNUSED_PARAM( dofManager ) )
+{
+  if( params.preconditionerType == LinearSolverParameters::PreconditionerType::cpr )
+  {
+    return std::make_unique< CPRPreconditioner< PetscInterface > >( params );
+  }
+  return std::make_unique< PetscPreconditioner >( params );
+}
+
 } //namespace geosx
@@ -60,6 +60,15 @@ struct PetscInterface
   static std::unique_ptr< PreconditionerBase< PetscInterface > >
   createPreconditioner( LinearSolverParameters params );
 
+  /**
+   * @brief Create a PETSc-based preconditioner object for a system described by a DofManager.
+   * @param params the preconditioner parameters
+   * @param dofManager the Degree-of-Freedom manager associated with the matrix
+   * @return owning pointer to the newly created preconditioner
+   */
+  static std::unique_ptr< PreconditionerBase< PetscInterface > >
+  createPreconditioner( LinearSolverParameters params, DofManager const & dofManager );
+
   /// Alias for PetscMatrix
   using ParallelMatrix = PetscMatrix;
   /// Alias for PetscVector
@@ -29,6 +29,8 @@
 #include <petscvec.h>
 #include <petscmat.h>
 
+#include <algorithm>
+
 namespace geosx
 {
 
@@ -169,6 +171,55 @@ void PetscMatrix::zero()
   GEOSX_LAI_CHECK_ERROR( MatZeroEntries( m_mat ) );
 }
 
+bool PetscMatrix::update( CRSMatrixView< real64 const, globalIndex const > const & localMatrix )
+{
+  GEOSX_LAI_ASSERT( ready() );
+
+  localMatrix.move( LvArray::MemorySpace::CPU, false );
+
+  PetscInt const rankOffset = ilower();
+
+  // Values are inserted into existing entries only, so check that no row gained or lost an entry
+  bool samePattern = numLocalRows() == localMatrix.numRows();
+  for( localIndex localRow = 0; samePattern && localRow < localMatrix.numRows(); ++localRow )
+  {
+    PetscInt const row = rankOffset + localRow;
+    PetscInt numEntries;
+    PetscInt const * columns;
+    GEOSX_LAI_CHECK_ERROR( MatGetRow( m_mat, row, &numEntries, &columns, nullptr ) );
+    globalIndex const * const localColumns = localMatrix.getColumns( localRow );
+    samePattern = numEntries == localMatrix.numNonZeros( localRow ) &&
+                  std::equal( columns, columns + numEntries, localColumns );
+    GEOSX_LAI_CHECK_ERROR( MatRestoreRow( m_mat, row, &numEntries, &columns, nullptr ) );
+  }
+
+  // All ranks must agree, since the caller re-creates the matrix collectively on a mismatch
+  if( MpiWrapper::Min( samePattern ? 1 : 0, getComm() ) == 0 )
+  {
+    return false;
+  }
+
+  // All updated rows are locally owned, so assembly can skip the off-processor stash exchange
+  GEOSX_LAI_CHECK_ERROR( MatSetOption( m_mat, MAT_NO_OFF_PROC_ENTRIES, PETSC_TRUE ) );
+
+  for( localIndex localRow = 0; localRow < localMatrix.numRows(); ++localRow )
+  {
+    PetscInt const row = rankOffset + localRow;
+    GEOSX_LAI_CHECK_ERROR( MatSetValues( m_mat,
+                                         1,
+                                         &row,
+                                         localMatrix.numNonZeros( localRow ),
+                                         toPetscInt( localMatrix.getColumns( localRow ) ),
+                                         localMatrix.getEntries( localRow ),
+                                         INSERT_VALUES ) );
+  }
+
+  GEOSX_LAI_CHECK_ERROR( MatAssemblyBegin( m_mat, MAT_FINAL_ASSEMBLY ) );
+  GEOSX_LAI_CHECK_ERROR( MatAssemblyEnd( m_mat, MAT_FINAL_ASSEMBLY ) );
+  GEOSX_LAI_CHECK_ERROR( MatSetOption( m_mat, MAT_NO_OFF_PROC_ENTRIES, PETSC_FALSE ) );
+  return true;
+}
+
 void PetscMatrix::open()
 {
   GEOSX_LAI_ASSERT( created() && closed() );
@@ -114,6 +114,8 @@ public:
 
   virtual void zero() override;
 
+  virtual bool update( CRSMatrixView< real64 const, globalIndex const > const & localMatrix ) override;
+
   virtual void open() override;
 
   virtual void close() override;
@@ -229,6 +229,12 @@ void PetscPreconditioner::compute( PetscMatrix const & mat )
     }
   }
 
+  // A full setup must redo the coarsening in case a previous recompute() enabled reuse
+  if( m_parameters.preconditionerType == LinearSolverParameters::PreconditionerType::amg )
+  {
+    GEOSX_LAI_CHECK_ERROR( PCGAMGSetReuseInterpolation( m_precond, PETSC_FALSE ) );
+  }
+
   // To be able to use PETSc solvers we need to disable floating point exceptions
   LvArray::system::FloatingPointExceptionGuard guard;
 
@@ -236,6 +242,29 @@ void PetscPreconditioner::compute( PetscMatrix const & mat )
   GEOSX_LAI_CHECK_ERROR( PCSetUpOnBlocks( m_precond ) );
 }
 
+void PetscPreconditioner::recompute( PetscMatrix const & mat,
+                                     DofManager const & dofManager )
+{
+  if( m_precond == nullptr || !ready() || &matrix() != &mat )
+  {
+    compute( mat, dofManager );
+    return;
+  }
+
+  // Keep the GAMG interpolation, only the coarse operators and smoothers are rebuilt;
+  // for the other preconditioner types PCSetUp() already reuses the symbolic setup
+  if( m_parameters.preconditionerType == LinearSolverParameters::PreconditionerType::amg )
+  {
+    GEOSX_LAI_CHECK_ERROR( PCGAMGSetReuseInterpolation( m_precond, PETSC_TRUE ) );
+  }
+  GEOSX_LAI_CHECK_ERROR( PCSetOperators( m_precond, mat.unwrapped(), mat.unwrapped() ) );
+
+  LvArray::system::FloatingPointExceptionGuard guard;
+
+  GEOSX_LAI_CHECK_ERROR( PCSetUp( m_precond ) );
+  GEOSX_LAI_CHECK_ERROR( PCSetUpOnBlocks( m_precond ) );
+}
+
 void PetscPreconditioner::apply( PetscVector const & src,
                                  PetscVector & dst ) const
 {
@@ -78,6 +78,14 @@ public:
    */
   virtual void compute( Matrix const & mat ) override;
 
+  /**
+   * @brief Refresh the preconditioner for new values of the matrix, keeping the structural setup.
+   * @param mat the matrix to precondition.
+   * @param dofManager the Degree-of-Freedom manager associated with matrix
+   */
+  virtual void recompute( Matrix const & mat,
+                          DofManager const & dofManager ) override;
+
   /**
    * @brief Apply operator to a vector
    * @param src Input vector (x).
@@ -254,6 +254,11 @@ void CreatePetscKrylovSolver( LinearSolverParameters const & params,
     {
       GEOSX_LAI_CHECK_ERROR( KSPSetType( ksp, KSPGMRES ) );
       GEOSX_LAI_CHECK_ERROR( KSPGMRESSetRestart( ksp, params.krylov.maxRestart ) );
+      if( params.krylov.orthogonalization == LinearSolverParameters::Krylov::Orthogonalization::cgs2 )
+      {
+        GEOSX_LAI_CHECK_ERROR( KSPGMRESSetOrthogonalization( ksp, KSPGMRESClassicalGramSchmidtOrthogonalization ) );
+        GEOSX_LAI_CHECK_ERROR( KSPGMRESSetCGSRefinementType( ksp, KSP_GMRES_CGS_REFINE_ALWAYS ) );
+      }
       break;
     }
     case LinearSolverParameters::SolverType::bicgstab:
@@ -266,6 +271,16 @@ void CreatePetscKrylovSolver( LinearSolverParameters const & params,
       GEOSX_LAI_CHECK_ERROR( KSPSetType( ksp, KSPCG ) );
       break;
     }
+    case LinearSolverParameters::SolverType::pipecg:
+    {
+      GEOSX_LAI_CHECK_ERROR( KSPSetType( ksp, KSPPIPECG ) );
+      break;
+    }
+    case LinearSolverParameters::SolverType::pipebicgstab:
+    {
+      GEOSX_LAI_CHECK_ERROR( KSPSetType( ksp, KSPPIPEBCGS ) );
+      break;
+    }
     default:
     {
       GEOSX_ERROR( "Solver type not supported in PETSc interface: " << params.solverType );
@@ -20,6 +20,7 @@
 
 #include "codingUtilities/Utilities.hpp"
 #include "linearAlgebra/interfaces/trilinos/EpetraUtils.hpp"
+#include "mpiCommunications/MpiWrapper.hpp"
 
 #include <Epetra_Map.h>
 #include <Epetra_FECrsGraph.h>
@@ -30,6 +31,8 @@
 #include <EpetraExt_RowMatrixOut.h>
 #include <EpetraExt_Transpose_RowMatrix.h>
 
+#include <algorithm>
+
 #ifdef GEOSX_USE_MPI
 #include <Epetra_MpiComm.h>
 #else
@@ -131,6 +134,46 @@ void EpetraMatrix::zero()
   set( 0 );
 }
 
+bool EpetraMatrix::update( CRSMatrixView< real64 const, globalIndex const > const & localMatrix )
+{
+  GEOSX_LAI_ASSERT( ready() );
+
+  localMatrix.move( LvArray::MemorySpace::CPU, false );
+
+  // Overwrite values of the filled matrix in place through row views, so that
+  // neither the graph nor the import/export objects are touched.
+  Epetra_Map const & colMap = m_matrix->ColMap();
+
+  int length;
+  int * indices_ptr;
+  double * values_ptr;
+
+  bool samePattern = numLocalRows() == localMatrix.numRows();
+  for( localIndex localRow = 0; samePattern && localRow < localMatrix.numRows(); ++localRow )
+  {
+    GEOSX_LAI_CHECK_ERROR( m_matrix->ExtractMyRowView( LvArray::integerConversion< int >( localRow ), length, values_ptr, indices_ptr ) );
+    samePattern = length == localMatrix.numNonZeros( localRow );
+
+    globalIndex const * const columns = localMatrix.getColumns( localRow );
+    globalIndex const * const columnsEnd = columns + localMatrix.numNonZeros( localRow );
+    real64 const * const entries = localMatrix.getEntries( localRow );
+
+    for( int j = 0; samePattern && j < length; ++j )
+    {
+      globalIndex const col = LvArray::integerConversion< globalIndex >( colMap.GID64( indices_ptr[j] ) );
+      globalIndex const * const pos = std::lower_bound( columns, columnsEnd, col );
+      samePattern = pos != columnsEnd && *pos == col;
+      if( samePattern )
+      {
+        values_ptr[j] = entries[pos - columns];
+      }
+    }
+  }
+
+  // All ranks must agree, since the caller re-creates the matrix collectively on a mismatch
+  return MpiWrapper::Min( samePattern ? 1 : 0, getComm() ) == 1;
+}
+
 void EpetraMatrix::open()
 {
   GEOSX_LAI_ASSERT( created() && closed() );
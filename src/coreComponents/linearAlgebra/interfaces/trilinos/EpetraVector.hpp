@@ -87,6 +87,9 @@ public:
   using VectorBase::closed;
   using VectorBase::ready;
   using VectorBase::extract;
+  using VectorBase::multiDot;
+  using VectorBase::localDot;
+  using VectorBase::localMultiDot;
 
   /**
    * @copydoc VectorBase<EpetraVector>::created
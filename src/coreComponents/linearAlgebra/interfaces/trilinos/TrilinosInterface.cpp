@@ -18,6 +18,7 @@
 
 #include "TrilinosInterface.hpp"
 #include "linearAlgebra/interfaces/trilinos/TrilinosPreconditioner.hpp"
+#include "linearAlgebra/solvers/CPRPreconditioner.hpp"
 
 namespace geosx
 {
@@ -35,4 +36,15 @@ TrilinosInterface::createPreconditioner( LinearSolverParameters params )
   return std::make_unique< TrilinosPreconditioner >( params );
 }
 
+std::unique_ptr< PreconditionerBase< TrilinosInterface > >
+TrilinosInterface::createPreconditioner( LinearSolverParameters params,
+                                         DofManager const & GEOSX_UNUSED_PARAM( dofManager ) )
+{
+  if( params.preconditionerType == LinearSolverParameters::PreconditionerType::cpr )
+  {
+    return std::make_unique< CPRPreconditioner< TrilinosInterface > >( params );
+  }
+  return std::make_unique< TrilinosPreconditioner >( params );
+}
+
 }
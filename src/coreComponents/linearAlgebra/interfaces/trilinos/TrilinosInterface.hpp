@@ -56,6 +56,15 @@ struct TrilinosInterface
   static std::unique_ptr< PreconditionerBase< TrilinosInterface > >
   createPreconditioner( LinearSolverParameters params );
 
+  /**
+   * @brief Create a Trilinos-based preconditioner object for a system described by a DofManager.
+   * @param params the preconditioner parameters
+   * @param dofManager the Degree-of-Freedom manager associated with the matrix
+   * @return owning pointer to the newly created preconditioner
+   */
+  static std::unique_ptr< PreconditionerBase< TrilinosInterface > >
+  createPreconditioner( LinearSolverParameters params, DofManager const & dofManager );
+
   /// Alias for EpetraMatrix
   using ParallelMatrix = EpetraMatrix;
   /// Alias for EpetraVector
@@ -204,6 +204,33 @@ void TrilinosPreconditioner::compute( Matrix const & mat )
   }
 }
 
+void TrilinosPreconditioner::recompute( Matrix const & mat,
+                                        DofManager const & dofManager )
+{
+  if( !m_precond || !ready() || &matrix() != &mat )
+  {
+    compute( mat, dofManager );
+    return;
+  }
+
+  LvArray::system::FloatingPointExceptionGuard guard;
+
+  if( auto * const ml = dynamic_cast< ML_Epetra::MultiLevelPreconditioner * >( m_precond.get() ) )
+  {
+    // Keeps the aggregates and prolongators, recomputes the Galerkin products and the smoothers
+    GEOSX_LAI_CHECK_ERROR( ml->ReComputePreconditioner() );
+  }
+  else if( auto * const ifpack = dynamic_cast< Ifpack_Preconditioner * >( m_precond.get() ) )
+  {
+    // Keeps the symbolic phase from Initialize(), recomputes the numerical factors
+    GEOSX_LAI_CHECK_ERROR( ifpack->Compute() );
+  }
+  else
+  {
+    compute( mat, dofManager );
+  }
+}
+
 void TrilinosPreconditioner::apply( Vector const & src,
                                     Vector & dst ) const
 {
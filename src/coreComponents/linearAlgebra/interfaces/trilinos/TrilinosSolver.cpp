@@ -128,14 +128,21 @@ void CreateTrilinosKrylovSolver( LinearSolverParameters const & params, AztecOO
     {
       GEOSX_LAI_CHECK_ERROR( solver.SetAztecOption( AZ_solver, AZ_gmres ) );
       GEOSX_LAI_CHECK_ERROR( solver.SetAztecOption( AZ_kspace, params.krylov.maxRestart ) );
+      if( params.krylov.orthogonalization == LinearSolverParameters::Krylov::Orthogonalization::cgs2 )
+      {
+        GEOSX_LAI_CHECK_ERROR( solver.SetAztecOption( AZ_orthog, AZ_classic ) );
+      }
       break;
     }
     case LinearSolverParameters::SolverType::bicgstab:
+    case LinearSolverParameters::SolverType::pipebicgstab:
     {
+      // AztecOO has no pipelined variants, use the standard ones
       GEOSX_LAI_CHECK_ERROR( solver.SetAztecOption( AZ_solver, AZ_bicgstab ) );
       break;
     }
     case LinearSolverParameters::SolverType::cg:
+    case LinearSolverParameters::SolverType::pipecg:
     {
       GEOSX_LAI_CHECK_ERROR( solver.SetAztecOption( AZ_solver, AZ_cg ) );
       break;
@@ -0,0 +1,375 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file CPRPreconditioner.cpp
+ */
+
+#include "CPRPreconditioner.hpp"
+
+#include "linearAlgebra/interfaces/BlasLapackLA.hpp"
+#include "linearAlgebra/interfaces/InterfaceTypes.hpp"
+#include "mpiCommunications/MpiWrapper.hpp"
+#include "rajaInterface/GEOS_RAJA_Interface.hpp"
+
+#include <algorithm>
+
+namespace geosx
+{
+
+template< typename LAI >
+CPRPreconditioner< LAI >::CPRPreconditioner( LinearSolverParameters params )
+  : Base(),
+  m_parameters( std::move( params ) ),
+  m_pressurePrecond{},
+  m_smoother{},
+  m_fieldLocalOffset( 0 ),
+  m_numComp( 0 ),
+  m_numPressureReuses( 0 ),
+  m_pressureStageSize( -1 )
+{
+  GEOSX_LAI_ASSERT( !m_parameters.cpr.fieldName.empty() );
+  GEOSX_LAI_ASSERT_GE( m_parameters.cpr.pressureSetupReuse, 0 );
+
+  LinearSolverParameters pressureParams = m_parameters;
+  pressureParams.preconditionerType = LinearSolverParameters::PreconditionerType::amg;
+  pressureParams.dofsPerNode = 1;
+  pressureParams.amg.separateComponents = false;
+  m_pressurePrecond = LAI::createPreconditioner( pressureParams );
+
+  if( m_parameters.cpr.smoother == LinearSolverParameters::CPR::Smoother::ilu0 )
+  {
+    LinearSolverParameters smootherParams = m_parameters;
+    smootherParams.preconditionerType = LinearSolverParameters::PreconditionerType::iluk;
+    smootherParams.ilu.fill = 0;
+    m_smoother = LAI::createPreconditioner( smootherParams );
+  }
+}
+
+template< typename LAI >
+CPRPreconditioner< LAI >::~CPRPreconditioner() = default;
+
+template< typename LAI >
+void CPRPreconditioner< LAI >::compute( Matrix const & mat )
+{
+  GEOSX_UNUSED_VAR( mat );
+  GEOSX_ERROR( "CPRPreconditioner: a DofManager is required to identify the pressure unknowns" );
+}
+
+namespace
+{
+
+/**
+ * @brief Locate the CPR field component of a global column index.
+ * @param col the global column index
+ * @param fieldOffsets global offset of the field on each rank
+ * @param fieldSizes number of field dofs on each rank
+ * @param numComp number of components of the field
+ * @return the component index, or -1 if the column does not belong to the field
+ */
+localIndex findComponent( globalIndex const col,
+                          arrayView1d< globalIndex const > const & fieldOffsets,
+                          arrayView1d< globalIndex const > const & fieldSizes,
+                          localIndex const numComp )
+{
+  // offsets are increasing with rank, find the last rank whose field block starts at or before col
+  globalIndex const * const it = std::upper_bound( fieldOffsets.begin(), fieldOffsets.end(), col );
+  if( it == fieldOffsets.begin() )
+  {
+    return -1;
+  }
+  localIndex const rank = LvArray::integerConversion< localIndex >( it - fieldOffsets.begin() ) - 1;
+  globalIndex const shift = col - fieldOffsets[rank];
+  return shift < fieldSizes[rank] ? LvArray::integerConversion< localIndex >( shift % numComp ) : -1;
+}
+
+}
+
+template< typename LAI >
+void CPRPreconditioner< LAI >::computeBlocks( Matrix const & mat,
+                                              DofManager const & dofManager,
+                                              bool const computeWeights )
+{
+  using CPR = LinearSolverParameters::CPR;
+
+  MPI_Comm const & comm = mat.getComm();
+  string const & fieldName = m_parameters.cpr.fieldName;
+
+  m_numComp = dofManager.numComponents( fieldName );
+  localIndex const numFieldDofs = dofManager.numLocalDofs( fieldName );
+  localIndex const numCells = numFieldDofs / m_numComp;
+  globalIndex const fieldStart = dofManager.globalOffset( fieldName );
+  m_fieldLocalOffset = LvArray::integerConversion< localIndex >( fieldStart - mat.ilower() );
+
+  bool const trueImpes = m_parameters.cpr.decoupling == CPR::Decoupling::trueImpes;
+  bool const blockJacobi = m_parameters.cpr.smoother == CPR::Smoother::blockJacobi;
+
+  // True-IMPES sums the blocks of each cell's block column, i.e. the block row of the transpose.
+  // Field blocks of neighboring ranks are needed to attribute off-processor equations to components.
+  Matrix matTranspose;
+  array1d< globalIndex > fieldOffsets;
+  array1d< globalIndex > fieldSizes;
+  if( computeWeights && trueImpes )
+  {
+    mat.transpose( matTranspose );
+    MpiWrapper::allGather( fieldStart, fieldOffsets, comm );
+    MpiWrapper::allGather( LvArray::integerConversion< globalIndex >( numFieldDofs ), fieldSizes, comm );
+  }
+
+  if( blockJacobi )
+  {
+    m_blockInverses.resize( numCells, m_numComp, m_numComp );
+    m_diagInverses.resize( mat.numLocalRows() );
+    for( localIndex i = 0; i < mat.numLocalRows(); ++i )
+    {
+      if( i < m_fieldLocalOffset || i >= m_fieldLocalOffset + numFieldDofs )
+      {
+        real64 const diag = mat.getDiagValue( mat.ilower() + i );
+        m_diagInverses[i] = std::fabs( diag ) > 0.0 ? 1.0 / diag : 1.0;
+      }
+    }
+  }
+
+  if( computeWeights )
+  {
+    m_restrictor.createWithLocalSize( numCells, mat.numLocalRows(), m_numComp, comm );
+    m_restrictor.open();
+  }
+
+  array2d< real64, MatrixLayout::ROW_MAJOR_PERM > diagBlock( m_numComp, m_numComp );
+  array2d< real64, MatrixLayout::ROW_MAJOR_PERM > sumBlock( m_numComp, m_numComp );
+  array2d< real64, MatrixLayout::ROW_MAJOR_PERM > blockInverse( m_numComp, m_numComp );
+  localIndex const maxRowLength = std::max( mat.maxRowLength(), matTranspose.ready() ? matTranspose.maxRowLength() : 0 );
+  array1d< globalIndex > colIndices( maxRowLength );
+  array1d< real64 > values( maxRowLength );
+  array1d< globalIndex > weightCols( m_numComp );
+
+  for( localIndex cell = 0; cell < numCells; ++cell )
+  {
+    globalIndex const cellStart = fieldStart + cell * m_numComp;
+    diagBlock.setValues< serialPolicy >( 0.0 );
+    sumBlock.setValues< serialPolicy >( 0.0 );
+
+    for( localIndex ic = 0; ic < m_numComp; ++ic )
+    {
+      globalIndex const row = cellStart + ic;
+      localIndex const rowLength = mat.globalRowLength( row );
+      mat.getRowCopy( row, colIndices.toSlice(), values.toSlice() );
+
+      for( localIndex k = 0; k < rowLength; ++k )
+      {
+        globalIndex const col = colIndices[k];
+        if( col >= cellStart && col < cellStart + m_numComp )
+        {
+          diagBlock( ic, col - cellStart ) += values[k];
+        }
+      }
+    }
+
+    if( computeWeights && trueImpes )
+    {
+      // Summed over all equations of the field, the flux terms of a conservative discretization
+      // cancel and only the derivatives of the cell's accumulation term remain
+      for( localIndex jc = 0; jc < m_numComp; ++jc )
+      {
+        globalIndex const row = cellStart + jc;
+        localIndex const rowLength = matTranspose.globalRowLength( row );
+        matTranspose.getRowCopy( row, colIndices.toSlice(), values.toSlice() );
+
+        for( localIndex k = 0; k < rowLength; ++k )
+        {
+          localIndex const ic = findComponent( colIndices[k], fieldOffsets, fieldSizes, m_numComp );
+          if( ic >= 0 )
+          {
+            sumBlock( ic, jc ) += values[k];
+          }
+        }
+      }
+    }
+
+    if( blockJacobi )
+    {
+      BlasLapackLA::matrixInverse( diagBlock.toSliceConst(), blockInverse.toSlice() );
+      for( localIndex ic = 0; ic < m_numComp; ++ic )
+      {
+        for( localIndex jc = 0; jc < m_numComp; ++jc )
+        {
+          m_blockInverses( cell, ic, jc ) = blockInverse( ic, jc );
+        }
+      }
+    }
+
+    if( computeWeights )
+    {
+      // Weights w solve D^T w = e_0, i.e. they are the first row of D^{-1}:
+      // the weighted equation then has unit pressure and zero secondary variable coefficients
+      if( trueImpes )
+      {
+        BlasLapackLA::matrixInverse( sumBlock.toSliceConst(), blockInverse.toSlice() );
+      }
+      else if( !blockJacobi )
+      {
+        BlasLapackLA::matrixInverse( diagBlock.toSliceConst(), blockInverse.toSlice() );
+      }
+      for( localIndex ic = 0; ic < m_numComp; ++ic )
+      {
+        weightCols[ic] = cellStart + ic;
+      }
+      m_restrictor.insert( m_restrictor.ilower() + cell, weightCols.data(), &blockInverse( 0, 0 ), m_numComp );
+    }
+  }
+
+  if( computeWeights )
+  {
+    m_restrictor.close();
+  }
+}
+
+template< typename LAI >
+void CPRPreconditioner< LAI >::compute( Matrix const & mat,
+                                        DofManager const & dofManager )
+{
+  bool const newSize = !this->ready() || mat.numGlobalRows() != m_pressureStageSize;
+
+  // Not forwarding the DofManager, since compute( mat ) is overridden to require it
+  Base::compute( mat );
+
+  // The pressure stage (weights, pressure matrix and AMG hierarchy) is the expensive part of the setup;
+  // it may be kept for a number of setups, while the second stage always sees the current matrix.
+  bool const rebuildPressure = newSize || m_numPressureReuses >= m_parameters.cpr.pressureSetupReuse;
+
+  computeBlocks( mat, dofManager, rebuildPressure );
+
+  if( rebuildPressure )
+  {
+    MPI_Comm const & comm = mat.getComm();
+    dofManager.makeRestrictor( { { m_parameters.cpr.fieldName, 0, 1 } }, comm, true, m_prolongator );
+    mat.multiplyRAP( m_restrictor, m_prolongator, m_pressureMat );
+    m_pressurePrecond->compute( m_pressureMat );
+
+    m_pressureRhs.createWithLocalSize( m_restrictor.numLocalRows(), comm );
+    m_pressureSol.createWithLocalSize( m_restrictor.numLocalRows(), comm );
+    m_residual.createWithLocalSize( mat.numLocalRows(), comm );
+    m_correction.createWithLocalSize( mat.numLocalRows(), comm );
+
+    m_pressureStageSize = mat.numGlobalRows();
+    m_numPressureReuses = 0;
+  }
+  else
+  {
+    ++m_numPressureReuses;
+  }
+
+  if( m_smoother )
+  {
+    m_smoother->compute( mat );
+  }
+}
+
+template< typename LAI >
+void CPRPreconditioner< LAI >::applyBlockJacobi( Vector const & src,
+                                                 Vector & dst ) const
+{
+  real64 const * const srcValues = src.extractLocalVector();
+  real64 * const dstValues = dst.extractLocalVector();
+  localIndex const numComp = m_numComp;
+  localIndex const offset = m_fieldLocalOffset;
+  localIndex const numCells = m_blockInverses.size( 0 );
+
+  arrayView3d< real64 const > const blockInverses = m_blockInverses.toViewConst();
+  arrayView1d< real64 const > const diagInverses = m_diagInverses.toViewConst();
+
+  forAll< parallelHostPolicy >( numCells, [=]( localIndex const cell )
+  {
+    localIndex const start = offset + cell * numComp;
+    for( localIndex ic = 0; ic < numComp; ++ic )
+    {
+      real64 sum = 0.0;
+      for( localIndex jc = 0; jc < numComp; ++jc )
+      {
+        sum += blockInverses( cell, ic, jc ) * srcValues[start + jc];
+      }
+      dstValues[start + ic] = sum;
+    }
+  } );
+
+  forAll< parallelHostPolicy >( diagInverses.size(), [=]( localIndex const i )
+  {
+    if( i < offset || i >= offset + numCells * numComp )
+    {
+      dstValues[i] = diagInverses[i] * srcValues[i];
+    }
+  } );
+}
+
+template< typename LAI >
+void CPRPreconditioner< LAI >::apply( Vector const & src,
+                                      Vector & dst ) const
+{
+  // First stage: solve the decoupled pressure system and prolongate
+  m_restrictor.apply( src, m_pressureRhs );
+  m_pressurePrecond->apply( m_pressureRhs, m_pressureSol );
+  m_prolongator.apply( m_pressureSol, dst );
+
+  // Second stage: correct with the full-system preconditioner applied to the updated residual
+  this->matrix().residual( dst, src, m_residual );
+  if( m_smoother )
+  {
+    m_smoother->apply( m_residual, m_correction );
+  }
+  else
+  {
+    applyBlockJacobi( m_residual, m_correction );
+  }
+  dst.axpy( 1.0, m_correction );
+}
+
+template< typename LAI >
+void CPRPreconditioner< LAI >::clear()
+{
+  Base::clear();
+  m_pressurePrecond->clear();
+  if( m_smoother )
+  {
+    m_smoother->clear();
+  }
+  m_restrictor.reset();
+  m_prolongator.reset();
+  m_pressureMat.reset();
+  m_pressureRhs.reset();
+  m_pressureSol.reset();
+  m_residual.reset();
+  m_correction.reset();
+  m_blockInverses.clear();
+  m_diagInverses.clear();
+  m_numPressureReuses = 0;
+  m_pressureStageSize = -1;
+}
+
+// -----------------------
+// Explicit Instantiations
+// -----------------------
+#ifdef GEOSX_USE_TRILINOS
+template class CPRPreconditioner< TrilinosInterface >;
+#endif
+
+#ifdef GEOSX_USE_HYPRE
+template class CPRPreconditioner< HypreInterface >;
+#endif
+
+#ifdef GEOSX_USE_PETSC
+template class CPRPreconditioner< PetscInterface >;
+#endif
+
+}
@@ -0,0 +1,196 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file CPRPreconditioner.hpp
+ */
+
+#ifndef GEOSX_LINEARALGEBRA_SOLVERS_CPRPRECONDITIONER_HPP_
+#define GEOSX_LINEARALGEBRA_SOLVERS_CPRPRECONDITIONER_HPP_
+
+#include "linearAlgebra/DofManager.hpp"
+#include "linearAlgebra/solvers/PreconditionerBase.hpp"
+#include "linearAlgebra/utilities/LinearSolverParameters.hpp"
+
+#include <memory>
+
+namespace geosx
+{
+
+/*
+ * The two-stage CPR preconditioner is defined as
+ * @f$
+ * M^{-1} = M_2^{-1} \left( I - A P M_p^{-1} Q \right) + P M_p^{-1} Q
+ * @f$
+ * where @f$ Q @f$ restricts a residual to the decoupled pressure equations (it applies
+ * the decoupling weights of each cell to its block of equations), @f$ P @f$ prolongates
+ * the cell pressures, @f$ M_p^{-1} @f$ is an AMG approximation of @f$ (Q A P)^{-1} @f$
+ * and @f$ M_2^{-1} @f$ is a preconditioner of the full system.
+ */
+
+/**
+ * @brief Backend-agnostic constrained pressure residual (CPR) preconditioner.
+ * @tparam LAI linear algebra interface providing matrix/vector types
+ *
+ * The preconditioner works on the DoF field named in LinearSolverParameters::CPR::fieldName,
+ * whose first component must be the cell pressure. Rows and columns of any other field
+ * (e.g. wells) are only handled by the second stage.
+ *
+ * Decoupling weights are computed per cell such that the weighted sum of the cell equations
+ * does not depend on the secondary variables of the cell (quasi-IMPES). The true-IMPES option
+ * recovers the accumulation block algebraically by summing all blocks of the cell's block
+ * column: each flux enters the equations of its two cells with opposite signs, so the flux
+ * derivatives cancel in the sum.
+ */
+template< typename LAI >
+class CPRPreconditioner : public PreconditionerBase< LAI >
+{
+public:
+
+  /// Alias for the base type
+  using Base = PreconditionerBase< LAI >;
+
+  /// Alias for the vector type
+  using Vector = typename Base::Vector;
+
+  /// Alias for the matrix type
+  using Matrix = typename Base::Matrix;
+
+  /**
+   * @brief Constructor.
+   * @param params the linear solver parameters (CPR and AMG parameters are used)
+   */
+  explicit CPRPreconditioner( LinearSolverParameters params );
+
+  /**
+   * @brief Destructor.
+   */
+  virtual ~CPRPreconditioner() override;
+
+  /**
+   * @name PreconditionerBase interface methods
+   */
+  ///@{
+
+  using PreconditionerBase< LAI >::compute;
+
+  /**
+   * @brief Compute the preconditioner from a matrix.
+   * @param mat the matrix to precondition
+   *
+   * @note CPR needs the DoF layout, this overload raises an error.
+   */
+  virtual void compute( Matrix const & mat ) override;
+
+  /**
+   * @brief Compute the preconditioner from a matrix
+   * @param mat the matrix to precondition
+   * @param dofManager the Degree-of-Freedom manager associated with matrix
+   */
+  virtual void compute( Matrix const & mat,
+                        DofManager const & dofManager ) override;
+
+  /**
+   * @brief Apply operator to a vector
+   * @param src Input vector (x).
+   * @param dst Output vector (b).
+   *
+   * @warning @p src and @p dst cannot alias the same vector.
+   */
+  virtual void apply( Vector const & src, Vector & dst ) const override;
+
+  virtual void clear() override;
+
+  ///@}
+
+  /**
+   * @brief Access the decoupled pressure matrix.
+   * @return reference to the pressure matrix
+   */
+  Matrix const & getPressureMatrix() const
+  {
+    return m_pressureMat;
+  }
+
+private:
+
+  /**
+   * @brief Compute the decoupling weights, the block-Jacobi inverses and the pressure restrictor.
+   * @param mat the system matrix
+   * @param dofManager the dof manager
+   * @param computeWeights whether to (re)build the pressure restrictor
+   */
+  void computeBlocks( Matrix const & mat,
+                      DofManager const & dofManager,
+                      bool const computeWeights );
+
+  /**
+   * @brief Apply the block-Jacobi second stage.
+   * @param src input vector
+   * @param dst output vector
+   */
+  void applyBlockJacobi( Vector const & src, Vector & dst ) const;
+
+  /// Parameters of the preconditioner
+  LinearSolverParameters m_parameters;
+
+  /// Restriction to decoupled pressure equations (weighted sum of each cell's equations)
+  Matrix m_restrictor;
+
+  /// Prolongation of the cell pressures
+  Matrix m_prolongator;
+
+  /// Decoupled pressure matrix
+  Matrix m_pressureMat;
+
+  /// AMG approximation of the pressure matrix inverse
+  std::unique_ptr< PreconditionerBase< LAI > > m_pressurePrecond;
+
+  /// Full-system preconditioner (when not using the native block-Jacobi)
+  std::unique_ptr< PreconditionerBase< LAI > > m_smoother;
+
+  /// Inverses of the cell diagonal blocks (block-Jacobi smoother)
+  array3d< real64 > m_blockInverses;
+
+  /// Inverses of the diagonal entries of rows outside the CPR field (block-Jacobi smoother)
+  array1d< real64 > m_diagInverses;
+
+  /// Local row offset of the CPR field
+  localIndex m_fieldLocalOffset;
+
+  /// Number of components of the CPR field
+  localIndex m_numComp;
+
+  /// Number of setups since the pressure stage was last built
+  integer m_numPressureReuses;
+
+  /// Global number of rows of the matrix used to build the pressure stage
+  globalIndex m_pressureStageSize;
+
+  /// Pressure stage residual
+  mutable Vector m_pressureRhs;
+
+  /// Pressure stage solution
+  mutable Vector m_pressureSol;
+
+  /// Residual after the pressure stage
+  mutable Vector m_residual;
+
+  /// Second stage correction
+  mutable Vector m_correction;
+};
+
+} //namespace geosx
+
+#endif //GEOSX_LINEARALGEBRA_SOLVERS_CPRPRECONDITIONER_HPP_
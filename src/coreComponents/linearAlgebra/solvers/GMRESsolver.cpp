@@ -31,9 +31,11 @@ GMRESsolver< VECTOR >::GMRESsolver( LinearOperator< Vector > const & A,
                                     real64 tolerance,
                                     localIndex maxIterations,
                                     integer verbosity,
-                                    localIndex maxRestart )
+                                    localIndex maxRestart,
+                                    LinearSolverParameters::Krylov::Orthogonalization orthogonalization )
   : KrylovSolver< VECTOR >( A, M, tolerance, maxIterations, verbosity ),
   m_maxRestart( maxRestart ),
+  m_orthogonalization( orthogonalization ),
   m_kspace( m_maxRestart + 1 ),
   m_kspaceInitialized( false )
 {
@@ -91,6 +93,48 @@ void Backsolve( localIndex const k,
 
 }
 
+template< typename VECTOR >
+real64 GMRESsolver< VECTOR >::orthogonalizeCGS2( localIndex const j,
+                                                 Vector & w,
+                                                 arraySlice2d< real64, MatrixLayout::COL_MAJOR > const & H ) const
+{
+  std::vector< Vector const * > basis( j + 1 );
+  for( localIndex i = 0; i <= j; ++i )
+  {
+    basis[i] = &m_kspace[i];
+  }
+
+  // First pass: all projections in a single reduction
+  array1d< real64 > proj( j + 1 );
+  w.multiDot( basis, proj );
+  for( localIndex i = 0; i <= j; ++i )
+  {
+    H( i, j ) = proj[i];
+    w.axpby( -proj[i], m_kspace[i], 1.0 );
+  }
+
+  // Second pass: correction projections and the squared norm of w in a single reduction
+  basis.emplace_back( &w );
+  array1d< real64 > corr( j + 2 );
+  w.multiDot( basis, corr );
+  real64 corrNorm2 = 0.0;
+  for( localIndex i = 0; i <= j; ++i )
+  {
+    H( i, j ) += corr[i];
+    w.axpby( -corr[i], m_kspace[i], 1.0 );
+    corrNorm2 += corr[i] * corr[i];
+  }
+
+  // The basis is orthonormal, hence |w - V c|^2 = |w|^2 - |c|^2.
+  // The correction is normally tiny; if it is not, avoid the cancellation and recompute the norm.
+  real64 const wNorm2 = corr[j+1];
+  if( corrNorm2 < 0.5 * wNorm2 )
+  {
+    return std::sqrt( wNorm2 - corrNorm2 );
+  }
+  return w.norm2();
+}
+
 template< typename VECTOR >
 void GMRESsolver< VECTOR >::solve( Vector const & b,
                                    Vector & x ) const
@@ -159,13 +203,20 @@ void GMRESsolver< VECTOR >::solve( Vector const & b,
       m_operator.apply( z, w );
 
       // Orthogonalization
-      for( localIndex i = 0; i <= j; ++i )
+      if( m_orthogonalization == LinearSolverParameters::Krylov::Orthogonalization::cgs2 )
+      {
+        H( j+1, j ) = orthogonalizeCGS2( j, w, H.toSlice() );
+      }
+      else
       {
-        H( i, j ) = w.dot( m_kspace[i] );
-        w.axpby( -H( i, j ), m_kspace[i], 1.0 );
+        for( localIndex i = 0; i <= j; ++i )
+        {
+          H( i, j ) = w.dot( m_kspace[i] );
+          w.axpby( -H( i, j ), m_kspace[i], 1.0 );
+        }
+        H( j+1, j ) = w.norm2();
       }
 
-      H( j+1, j ) = w.norm2();
       GEOSX_KRYLOV_BREAKDOWN_IF_ZERO( H( j + 1, j ) );
       m_kspace[j+1].axpby( 1.0 / H( j+1, j ), w, 0.0 );
 
@@ -57,13 +57,16 @@ public:
    * @param[in] maxIterations maximum number of Krylov iterations
    * @param[in] verbosity     solver verbosity level
    * @param[in] maxRestart    number of iterations until restart
+   * @param[in] orthogonalization orthogonalization scheme of the Krylov basis
    */
   GMRESsolver( LinearOperator< Vector > const & matrix,
                LinearOperator< Vector > const & precond,
                real64 const tolerance,
                localIndex const maxIterations,
                integer const verbosity = 0,
-               localIndex const maxRestart = 100 );
+               localIndex const maxRestart = 100,
+               LinearSolverParameters::Krylov::Orthogonalization const orthogonalization =
+                 LinearSolverParameters::Krylov::Orthogonalization::mgs );
 
   /**
    * @brief Virtual destructor.
@@ -107,9 +110,27 @@ protected:
   using Base::logProgress;
   using Base::logResult;
 
+  /**
+   * @brief Orthogonalize @p w against the first @p j + 1 basis vectors with CGS2.
+   * @param j index of the last basis vector
+   * @param w the vector to orthogonalize, overwritten with the orthogonalized vector
+   * @param H the Hessenberg matrix, column @p j receives the projection coefficients
+   * @return the 2-norm of the orthogonalized vector
+   *
+   * Both Gram-Schmidt passes fuse their dot products into a single global reduction.
+   * The squared norm of @p w is gathered in the second reduction, so that the norm of
+   * the result follows from Pythagoras' theorem without a third reduction.
+   */
+  real64 orthogonalizeCGS2( localIndex const j,
+                            Vector & w,
+                            arraySlice2d< real64, MatrixLayout::COL_MAJOR > const & H ) const;
+
   /// Number of iterations needed to restart GMRES
   localIndex m_maxRestart;
 
+  /// Orthogonalization scheme of the Krylov basis
+  LinearSolverParameters::Krylov::Orthogonalization m_orthogonalization;
+
   /// Storage for Krylov subspace vectors
   array1d< VectorTemp > m_kspace;
 
@@ -20,6 +20,8 @@
 #include "linearAlgebra/solvers/BiCGSTABsolver.hpp"
 #include "linearAlgebra/solvers/CGsolver.hpp"
 #include "linearAlgebra/solvers/GMRESsolver.hpp"
+#include "linearAlgebra/solvers/PipelinedBiCGSTABsolver.hpp"
+#include "linearAlgebra/solvers/PipelinedCGsolver.hpp"
 #include "linearAlgebra/interfaces/InterfaceTypes.hpp"
 
 namespace geosx
@@ -75,7 +77,25 @@ KrylovSolver< VECTOR >::Create( LinearSolverParameters const & parameters,
                                                         parameters.krylov.relTolerance,
                                                         parameters.krylov.maxIterations,
                                                         parameters.logLevel,
-                                                        parameters.krylov.maxRestart );
+                                                        parameters.krylov.maxRestart,
+                                                        parameters.krylov.orthogonalization );
+    }
+    case LinearSolverParameters::SolverType::pipecg:
+    {
+      GEOSX_ERROR_IF( !parameters.isSymmetric, "Cannot use pipelined CG solver with a non-symmetric system" );
+      return std::make_unique< PipelinedCGsolver< Vector > >( matrix,
+                                                              precond,
+                                                              parameters.krylov.relTolerance,
+                                                              parameters.krylov.maxIterations,
+                                                              parameters.logLevel );
+    }
+    case LinearSolverParameters::SolverType::pipebicgstab:
+    {
+      return std::make_unique< PipelinedBiCGSTABsolver< Vector > >( matrix,
+                                                                    precond,
+                                                                    parameters.krylov.relTolerance,
+                                                                    parameters.krylov.maxIterations,
+                                                                    parameters.logLevel );
     }
     default:
     {
@@ -19,6 +19,8 @@
 #define GEOSX_LINEARALGEBRA_SOLVERS_KRYLOVUTILS_HPP_
 
 #include "codingUtilities/Utilities.hpp"
+#include "linearAlgebra/common.hpp"
+#include "mpiCommunications/MpiWrapper.hpp"
 
 /// Tolerance for division by zero in Krylov solvers
 #define GEOSX_KRYLOV_MIN_DIV ::geosx::NumericTraits< real64 >::eps
@@ -39,4 +41,91 @@
   } while( false )
 #endif
 
+namespace geosx
+{
+
+/**
+ * @brief Non-blocking global reduction of a fixed number of dot products.
+ * @tparam VECTOR type of vectors
+ *
+ * The local contributions of all products are computed in start() and reduced with a
+ * single MPI_Iallreduce, so that the caller can overlap the reduction with other work
+ * (typically a preconditioner and operator application) before calling wait().
+ */
+template< typename VECTOR >
+class AsyncDotProducts
+{
+public:
+
+  /**
+   * @brief Constructor.
+   * @param size number of dot products reduced together
+   */
+  explicit AsyncDotProducts( localIndex const size )
+    : m_localValues( size ),
+    m_values( size ),
+    m_request( MPI_REQUEST_NULL )
+  {}
+
+  /**
+   * @brief Destructor, completes any pending reduction.
+   */
+  ~AsyncDotProducts()
+  {
+    wait();
+  }
+
+  AsyncDotProducts( AsyncDotProducts const & ) = delete;
+  AsyncDotProducts & operator=( AsyncDotProducts const & ) = delete;
+
+  /**
+   * @brief Compute the local contributions and start the global reduction.
+   * @param pairs the pairs of vectors to compute products of, as many as the size
+   */
+  void start( std::initializer_list< std::pair< VECTOR const *, VECTOR const * > > const pairs )
+  {
+    GEOSX_LAI_ASSERT_EQ( LvArray::integerConversion< localIndex >( pairs.size() ), m_localValues.size() );
+    wait();
+    localIndex k = 0;
+    for( std::pair< VECTOR const *, VECTOR const * > const & pair : pairs )
+    {
+      m_localValues[k++] = pair.first->localDot( *pair.second );
+    }
+    MpiWrapper::iAllReduce( m_localValues.data(),
+                            m_values.data(),
+                            LvArray::integerConversion< int >( m_values.size() ),
+                            MPI_SUM,
+                            pairs.begin()->first->getComm(),
+                            &m_request );
+  }
+
+  /**
+   * @brief Complete the global reduction.
+   * @return the dot products, in the order they were given to start()
+   */
+  arrayView1d< real64 const > wait()
+  {
+    if( m_request != MPI_REQUEST_NULL )
+    {
+      MPI_Status status;
+      MpiWrapper::Wait( &m_request, &status );
+      m_request = MPI_REQUEST_NULL;
+    }
+    return m_values.toViewConst();
+  }
+
+private:
+
+  /// Local contributions, must stay untouched while the reduction is in flight
+  array1d< real64 > m_localValues;
+
+  /// Reduced values
+  array1d< real64 > m_values;
+
+  /// Request of the pending reduction
+  MPI_Request m_request;
+};
+
+} // namespace geosx
+
 #endif //GEOSX_LINEARALGEBRA_SOLVERS_KRYLOVUTILS_HPP_
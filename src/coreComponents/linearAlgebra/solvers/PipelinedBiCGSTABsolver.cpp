@@ -0,0 +1,226 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file PipelinedBiCGSTABsolver.cpp
+ */
+
+#include "PipelinedBiCGSTABsolver.hpp"
+
+#include "common/Stopwatch.hpp"
+#include "linearAlgebra/interfaces/InterfaceTypes.hpp"
+#include "linearAlgebra/interfaces/LinearOperator.hpp"
+#include "linearAlgebra/utilities/BlockVectorView.hpp"
+#include "linearAlgebra/solvers/KrylovUtils.hpp"
+
+namespace geosx
+{
+
+template< typename VECTOR >
+PipelinedBiCGSTABsolver< VECTOR >::PipelinedBiCGSTABsolver( LinearOperator< Vector > const & A,
+                                                            LinearOperator< Vector > const & M,
+                                                            real64 const tolerance,
+                                                            localIndex const maxIterations,
+                                                            integer const verbosity )
+  : KrylovSolver< VECTOR >( A, M, tolerance, maxIterations, verbosity )
+{}
+
+template< typename VECTOR >
+PipelinedBiCGSTABsolver< VECTOR >::~PipelinedBiCGSTABsolver() = default;
+
+template< typename VECTOR >
+void PipelinedBiCGSTABsolver< VECTOR >::solve( Vector const & b, Vector & x ) const
+{
+  Stopwatch watch;
+
+  // Compute the target absolute tolerance
+  real64 const absTol = b.norm2() * m_tolerance;
+
+  // The method is BiCGStab applied to AM, with the variables of the preconditioned
+  // space (denoted with a "hat" suffix) carried along to avoid extra applications of M.
+
+  // Compute initial r = b - Ax, rHat = Mr, w = A rHat, wHat = Mw, t = A wHat
+  VectorTemp r = createTempVector( b );
+  m_operator.residual( x, b, r );
+
+  VectorTemp r0( r );
+
+  VectorTemp rHat = createTempVector( x );
+  m_precond.apply( r, rHat );
+
+  VectorTemp w = createTempVector( b );
+  m_operator.apply( rHat, w );
+
+  VectorTemp wHat = createTempVector( x );
+  m_precond.apply( w, wHat );
+
+  VectorTemp t = createTempVector( b );
+  m_operator.apply( wHat, t );
+
+  // Recurrence vectors
+  VectorTemp pHat = createTempVector( x );
+  VectorTemp s = createTempVector( b );
+  VectorTemp sHat = createTempVector( x );
+  VectorTemp z = createTempVector( b );
+  VectorTemp zHat = createTempVector( x );
+  VectorTemp v = createTempVector( b );
+  VectorTemp q = createTempVector( b );
+  VectorTemp qHat = createTempVector( x );
+  VectorTemp y = createTempVector( b );
+
+  pHat.zero();
+  s.zero();
+  sHat.zero();
+  z.zero();
+  zHat.zero();
+  v.zero();
+
+  // First reduction: (q,y) and (y,y)
+  AsyncDotProducts< Vector > omegaReduction( 2 );
+  // Second reduction: (r0,r), (r0,w), (r0,s), (r0,z) and (r,r)
+  AsyncDotProducts< Vector > alphaReduction( 5 );
+
+  // Initial scalars, computed with blocking reductions
+  real64 rho = r.dot( r0 );
+  real64 rnorm = std::sqrt( rho );
+  real64 alpha = 0.0;
+  real64 omega = 0.0;
+  real64 beta = 0.0;
+
+  m_result.status = LinearSolverResult::Status::NotConverged;
+  m_residualNorms.resize( m_maxIterations + 1 );
+
+  if( rnorm >= absTol )
+  {
+    real64 const r0w = w.dot( r0 );
+    GEOSX_KRYLOV_BREAKDOWN_IF_ZERO( r0w );
+    alpha = rho / r0w;
+  }
+
+  localIndex k;
+
+  for( k = 0; k <= m_maxIterations && m_result.status == LinearSolverResult::Status::NotConverged; ++k )
+  {
+    logProgress( k, rnorm );
+
+    // Convergence check on ||rk||/||b||
+    if( rnorm < absTol )
+    {
+      m_result.status = LinearSolverResult::Status::Success;
+      break;
+    }
+
+    // Update the search directions (order matters, each uses the previous iterate of the next one)
+    pHat.axpy( -omega, sHat );
+    pHat.axpby( 1.0, rHat, beta );
+    s.axpy( -omega, z );
+    s.axpby( 1.0, w, beta );
+    sHat.axpy( -omega, zHat );
+    sHat.axpby( 1.0, wHat, beta );
+    z.axpy( -omega, v );
+    z.axpby( 1.0, t, beta );
+
+    // q = r - alpha*s, qHat = rHat - alpha*sHat, y = w - alpha*z
+    q.copy( r );
+    q.axpy( -alpha, s );
+    qHat.copy( rHat );
+    qHat.axpy( -alpha, sHat );
+    y.copy( w );
+    y.axpy( -alpha, z );
+
+    // Start the first reduction and overlap it with zHat = Mz, v = A zHat
+    omegaReduction.start( { { &q, &y }, { &y, &y } } );
+    m_precond.apply( z, zHat );
+    m_operator.apply( zHat, v );
+    arrayView1d< real64 const > const omegaDots = omegaReduction.wait();
+
+    GEOSX_KRYLOV_BREAKDOWN_IF_ZERO( omegaDots[1] );
+    if( m_result.status == LinearSolverResult::Status::Breakdown )
+    {
+      break;
+    }
+    omega = omegaDots[0] / omegaDots[1];
+
+    // Update x = x + alpha*pHat + omega*qHat
+    x.axpy( alpha, pHat );
+    x.axpy( omega, qHat );
+
+    // Update r = q - omega*y, rHat = qHat - omega*(wHat - alpha*zHat), w = y - omega*(t - alpha*v)
+    r.copy( q );
+    r.axpy( -omega, y );
+    rHat.copy( qHat );
+    rHat.axpy( -omega, wHat );
+    rHat.axpy( omega * alpha, zHat );
+    w.copy( y );
+    w.axpy( -omega, t );
+    w.axpy( omega * alpha, v );
+
+    // Start the second reduction and overlap it with wHat = Mw, t = A wHat
+    alphaReduction.start( { { &r0, &r }, { &r0, &w }, { &r0, &s }, { &r0, &z }, { &r, &r } } );
+    m_precond.apply( w, wHat );
+    m_operator.apply( wHat, t );
+    arrayView1d< real64 const > const alphaDots = alphaReduction.wait();
+
+    GEOSX_KRYLOV_BREAKDOWN_IF_ZERO( rho );
+    GEOSX_KRYLOV_BREAKDOWN_IF_ZERO( omega );
+    if( m_result.status == LinearSolverResult::Status::Breakdown )
+    {
+      break;
+    }
+
+    real64 const rhoNew = alphaDots[0];
+    beta = alpha / omega * rhoNew / rho;
+    real64 const denom = alphaDots[1] + beta * alphaDots[2] - beta * omega * alphaDots[3];
+    rnorm = std::sqrt( alphaDots[4] );
+
+    // A zero denominator only matters if another iteration is needed
+    if( rnorm >= absTol )
+    {
+      GEOSX_KRYLOV_BREAKDOWN_IF_ZERO( denom );
+      if( m_result.status == LinearSolverResult::Status::Breakdown )
+      {
+        break;
+      }
+      alpha = rhoNew / denom;
+    }
+    rho = rhoNew;
+  }
+
+  m_result.numIterations = k;
+  m_result.residualReduction = rnorm / absTol * m_tolerance;
+  m_result.solveTime = watch.elapsedTime();
+
+  logResult();
+  m_residualNorms.resize( m_result.numIterations + 1 );
+}
+
+// -----------------------
+// Explicit Instantiations
+// -----------------------
+#ifdef GEOSX_USE_TRILINOS
+template class PipelinedBiCGSTABsolver< TrilinosInterface::ParallelVector >;
+template class PipelinedBiCGSTABsolver< BlockVectorView< TrilinosInterface::ParallelVector > >;
+#endif
+
+#ifdef GEOSX_USE_HYPRE
+template class PipelinedBiCGSTABsolver< HypreInterface::ParallelVector >;
+template class PipelinedBiCGSTABsolver< BlockVectorView< HypreInterface::ParallelVector > >;
+#endif
+
+#ifdef GEOSX_USE_PETSC
+template class PipelinedBiCGSTABsolver< PetscInterface::ParallelVector >;
+template class PipelinedBiCGSTABsolver< BlockVectorView< PetscInterface::ParallelVector > >;
+#endif
+
+} // namespace geosx
@@ -0,0 +1,169 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file PipelinedCGsolver.cpp
+ */
+
+#include "PipelinedCGsolver.hpp"
+
+#include "common/Stopwatch.hpp"
+#include "linearAlgebra/interfaces/InterfaceTypes.hpp"
+#include "linearAlgebra/interfaces/LinearOperator.hpp"
+#include "linearAlgebra/utilities/BlockVectorView.hpp"
+#include "linearAlgebra/solvers/KrylovUtils.hpp"
+
+namespace geosx
+{
+
+template< typename VECTOR >
+PipelinedCGsolver< VECTOR >::PipelinedCGsolver( LinearOperator< Vector > const & A,
+                                                LinearOperator< Vector > const & M,
+                                                real64 const tolerance,
+                                                localIndex const maxIterations,
+                                                integer const verbosity )
+  : KrylovSolver< VECTOR >( A, M, tolerance, maxIterations, verbosity )
+{}
+
+template< typename VECTOR >
+PipelinedCGsolver< VECTOR >::~PipelinedCGsolver() = default;
+
+template< typename VECTOR >
+void PipelinedCGsolver< VECTOR >::solve( Vector const & b, Vector & x ) const
+{
+  Stopwatch watch;
+
+  // Compute the target absolute tolerance
+  real64 const absTol = b.norm2() * m_tolerance;
+
+  // Compute initial r = b - Ax, u = Mr, w = Au
+  VectorTemp r = createTempVector( b );
+  m_operator.residual( x, b, r );
+
+  VectorTemp u = createTempVector( x );
+  m_precond.apply( r, u );
+
+  VectorTemp w = createTempVector( b );
+  m_operator.apply( u, w );
+
+  // Auxiliary vectors: m = Mw, n = Am, and the recurrences z = Aq, q = Ms, s = Ap
+  VectorTemp m = createTempVector( x );
+  VectorTemp n = createTempVector( b );
+  VectorTemp z = createTempVector( b );
+  VectorTemp q = createTempVector( x );
+  VectorTemp s = createTempVector( b );
+  VectorTemp p = createTempVector( x );
+
+  z.zero();
+  q.zero();
+  s.zero();
+  p.zero();
+
+  // gamma = (r,u), delta = (w,u) and (r,r) are reduced together
+  AsyncDotProducts< Vector > reduction( 3 );
+
+  real64 gamma_old = 0.0;
+  real64 alpha_old = 0.0;
+
+  m_result.status = LinearSolverResult::Status::NotConverged;
+  m_result.numIterations = 0;
+  m_residualNorms.resize( m_maxIterations + 1 );
+
+  localIndex k;
+  real64 rnorm = 0.0;
+
+  for( k = 0; k <= m_maxIterations && m_result.status == LinearSolverResult::Status::NotConverged; ++k )
+  {
+    // Start the reduction and overlap it with m = Mw, n = Am
+    reduction.start( { { &r, &u }, { &w, &u }, { &r, &r } } );
+    m_precond.apply( w, m );
+    m_operator.apply( m, n );
+    arrayView1d< real64 const > const dots = reduction.wait();
+
+    rnorm = std::sqrt( dots[2] );
+    logProgress( k, rnorm );
+
+    // Convergence check on ||rk||/||b||
+    if( rnorm < absTol )
+    {
+      m_result.status = LinearSolverResult::Status::Success;
+      break;
+    }
+
+    real64 const gamma = dots[0];
+    real64 const delta = dots[1];
+
+    real64 beta = 0.0;
+    real64 alpha;
+    if( k > 0 )
+    {
+      GEOSX_KRYLOV_BREAKDOWN_IF_ZERO( gamma_old );
+      beta = gamma / gamma_old;
+      real64 const denom = delta - beta * gamma / alpha_old;
+      GEOSX_KRYLOV_BREAKDOWN_IF_ZERO( denom );
+      alpha = gamma / denom;
+    }
+    else
+    {
+      GEOSX_KRYLOV_BREAKDOWN_IF_ZERO( delta );
+      alpha = gamma / delta;
+    }
+    if( m_result.status == LinearSolverResult::Status::Breakdown )
+    {
+      break;
+    }
+
+    // Update the recurrences
+    z.axpby( 1.0, n, beta );
+    q.axpby( 1.0, m, beta );
+    s.axpby( 1.0, w, beta );
+    p.axpby( 1.0, u, beta );
+
+    // Update the solution and the residual-related vectors
+    x.axpy( alpha, p );
+    r.axpy( -alpha, s );
+    u.axpy( -alpha, q );
+    w.axpy( -alpha, z );
+
+    gamma_old = gamma;
+    alpha_old = alpha;
+  }
+
+  m_result.numIterations = k;
+  m_result.residualReduction = rnorm / absTol * m_tolerance;
+  m_result.solveTime = watch.elapsedTime();
+
+  logResult();
+  m_residualNorms.resize( m_result.numIterations + 1 );
+}
+
+// -----------------------
+// Explicit Instantiations
+// -----------------------
+#ifdef GEOSX_USE_TRILINOS
+template class PipelinedCGsolver< TrilinosInterface::ParallelVector >;
+template class PipelinedCGsolver< BlockVectorView< TrilinosInterface::ParallelVector > >;
+#endif
+
+#ifdef GEOSX_USE_HYPRE
+template class PipelinedCGsolver< HypreInterface::ParallelVector >;
+template class PipelinedCGsolver< BlockVectorView< HypreInterface::ParallelVector > >;
+#endif
+
+#ifdef GEOSX_USE_PETSC
+template class PipelinedCGsolver< PetscInterface::ParallelVector >;
+template class PipelinedCGsolver< BlockVectorView< PetscInterface::ParallelVector > >;
+#endif
+
+} // namespace geosx
@@ -69,6 +69,22 @@ public:
     compute( mat );
   }
 
+  /**
+   * @brief Refresh the preconditioner for new values of the matrix it was computed from.
+   * @param mat the matrix to precondition, with the same structure as in the last call to compute()
+   * @param dofManager the Degree-of-Freedom manager associated with matrix
+   *
+   * Implementations keep the structural part of the setup (e.g. AMG aggregates and interpolation,
+   * or a symbolic factorization) when the underlying library allows it, and recompute the parts
+   * that depend on the matrix values (coarse operators, smoothers, numerical factorization).
+   * The default implementation recomputes the whole setup.
+   */
+  virtual void recompute( Matrix const & mat,
+                          DofManager const & dofManager )
+  {
+    compute( mat, dofManager );
+  }
+
   /**
    * @brief Clean up the preconditioner setup.
    *
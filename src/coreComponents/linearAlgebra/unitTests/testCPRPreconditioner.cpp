@@ -0,0 +1,256 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file testCPRPreconditioner.cpp
+ */
+
+#include "gtest/gtest.h"
+
+#include "common/DataTypes.hpp"
+#include "linearAlgebra/DofManager.hpp"
+#include "linearAlgebra/interfaces/InterfaceTypes.hpp"
+#include "linearAlgebra/solvers/CPRPreconditioner.hpp"
+#include "linearAlgebra/solvers/KrylovSolver.hpp"
+#include "managers/initialization.hpp"
+#include "managers/ProblemManager.hpp"
+#include "managers/DomainPartition.hpp"
+#include "meshUtilities/MeshManager.hpp"
+
+#include "testDofManagerUtils.hpp"
+
+#include <memory>
+
+using namespace geosx;
+using namespace geosx::testing;
+
+char const * xmlInput =
+  "<Problem>"
+  "  <Mesh>"
+  "    <InternalMesh name=\"mesh1\""
+  "                  elementTypes=\"{C3D8}\""
+  "                  xCoords=\"{0, 1}\""
+  "                  yCoords=\"{0, 1}\""
+  "                  zCoords=\"{0, 1}\""
+  "                  nx=\"{12}\""
+  "                  ny=\"{12}\""
+  "                  nz=\"{1}\""
+  "                  cellBlockNames=\"{block1}\"/>"
+  "  </Mesh>"
+  "  <ElementRegions>"
+  "    <CellElementRegion name=\"region1\" cellBlocks=\"{block1}\" materialList=\"{}\" />"
+  "  </ElementRegions>"
+  "</Problem>";
+
+/**
+ * @brief Test fixture assembling the Jacobian of a two-phase, two-component flow problem.
+ * @tparam LAI linear algebra interface type
+ *
+ * Each cell carries a pressure and a saturation. The two component equations have a compressible
+ * accumulation term, and phase-upwinded two-point fluxes whose mobilities depend on the saturation,
+ * so that the flux blocks of a cell's block row do not sum up to its accumulation block.
+ */
+template< typename LAI >
+class CPRPreconditionerTest : public ::testing::Test
+{
+protected:
+
+  using Matrix = typename LAI::ParallelMatrix;
+  using Vector = typename LAI::ParallelVector;
+
+  static constexpr localIndex numComp = 2;
+
+  CPRPreconditionerTest():
+    problemManager( std::make_unique< ProblemManager >( "Problem", nullptr ) ),
+    dofManager( "test" )
+  {}
+
+  void SetUp() override
+  {
+    setupProblemFromXML( problemManager.get(), xmlInput );
+    mesh = problemManager->getDomainPartition()->getMeshBody( 0 )->getMeshLevel( 0 );
+    dofManager.setMesh( *problemManager->getDomainPartition(), 0, 0 );
+    dofManager.addField( "primary", DofManager::Location::Elem, numComp );
+    dofManager.addCoupling( "primary", "primary", DofManager::Connector::Face );
+    dofManager.reorderByRank();
+
+    dofManager.setSparsityPattern( matrix );
+    assemble();
+  }
+
+  void assemble()
+  {
+    CellElementSubRegion const & subRegion =
+      *mesh->getElemManager()->GetRegion( 0 )->GetSubRegion< CellElementSubRegion >( 0 );
+    FaceManager const & faceManager = *mesh->getFaceManager();
+
+    arrayView1d< globalIndex const > const dofIndex =
+      subRegion.getReference< array1d< globalIndex > >( dofManager.getKey( "primary" ) );
+    arrayView1d< integer const > const ghostRank = subRegion.ghostRank();
+    arrayView1d< globalIndex const > const localToGlobal = subRegion.localToGlobalMap();
+    arrayView2d< localIndex const > const faceToElems = faceManager.elementList();
+
+    // smooth but non-uniform pressure and saturation fields
+    auto const pressure = [&]( localIndex const ei ) { return std::sin( 0.37 * localToGlobal[ei] ); };
+    auto const saturation = [&]( localIndex const ei ) { return 0.5 + 0.4 * std::cos( 0.23 * localToGlobal[ei] ); };
+
+    matrix.open();
+
+    // accumulation: d(phi rho_c S_c)/dp is small compared to d/dS
+    for( localIndex ei = 0; ei < subRegion.size(); ++ei )
+    {
+      if( ghostRank[ei] >= 0 )
+      {
+        continue;
+      }
+      real64 const s = saturation( ei );
+      globalIndex const dofs[numComp] = { dofIndex[ei], dofIndex[ei] + 1 };
+      real64 const values[numComp][numComp] = { { 1e-3 * s, 1.0 },
+                                                { 2e-3 * ( 1.0 - s ), -1.0 } };
+      matrix.add( dofs, dofs, &values[0][0], numComp, numComp );
+    }
+
+    // fluxes F_c = T lambda_c(S_upwind) (p_0 - p_1), added to the first cell and subtracted from the second
+    real64 const trans = 10.0;
+    for( localIndex kf = 0; kf < faceManager.size(); ++kf )
+    {
+      localIndex const ei[2] = { faceToElems[kf][0], faceToElems[kf][1] };
+      if( ei[0] < 0 || ei[1] < 0 )
+      {
+        continue;
+      }
+
+      real64 const dp = pressure( ei[0] ) - pressure( ei[1] );
+      localIndex const up = dp >= 0.0 ? 0 : 1;
+      real64 const s = saturation( ei[up] );
+      real64 const mob[numComp] = { s * s, ( 1.0 - s ) * ( 1.0 - s ) };
+      real64 const dMob_dS[numComp] = { 2.0 * s, -2.0 * ( 1.0 - s ) };
+
+      // derivatives of F_c with respect to (p_0, S_0, p_1, S_1)
+      real64 dFlux[numComp][2 * numComp] = { { 0.0 } };
+      for( localIndex c = 0; c < numComp; ++c )
+      {
+        dFlux[c][0] = trans * mob[c];
+        dFlux[c][numComp] = -trans * mob[c];
+        dFlux[c][up * numComp + 1] = trans * dMob_dS[c] * dp;
+      }
+
+      globalIndex const cols[2 * numComp] = { dofIndex[ei[0]], dofIndex[ei[0]] + 1,
+                                              dofIndex[ei[1]], dofIndex[ei[1]] + 1 };
+      for( localIndex ke = 0; ke < 2; ++ke )
+      {
+        if( ghostRank[ei[ke]] >= 0 )
+        {
+          continue;
+        }
+        real64 const sign = ke == 0 ? 1.0 : -1.0;
+        real64 values[numComp][2 * numComp];
+        for( localIndex c = 0; c < numComp; ++c )
+        {
+          for( localIndex j = 0; j < 2 * numComp; ++j )
+          {
+            values[c][j] = sign * dFlux[c][j];
+          }
+        }
+        globalIndex const rows[numComp] = { dofIndex[ei[ke]], dofIndex[ei[ke]] + 1 };
+        matrix.add( rows, cols, &values[0][0], numComp, 2 * numComp );
+      }
+    }
+
+    matrix.close();
+  }
+
+  void test( LinearSolverParameters::CPR::Decoupling const decoupling,
+             LinearSolverParameters::CPR::Smoother const smoother )
+  {
+    LinearSolverParameters params;
+    params.solverType = LinearSolverParameters::SolverType::gmres;
+    params.krylov.relTolerance = 1e-8;
+    params.krylov.maxIterations = 200;
+    params.preconditionerType = LinearSolverParameters::PreconditionerType::cpr;
+    params.cpr.fieldName = "primary";
+    params.cpr.decoupling = decoupling;
+    params.cpr.smoother = smoother;
+
+    CPRPreconditioner< LAI > precond( params );
+    precond.compute( matrix, dofManager );
+
+    Vector solTrue;
+    Vector solComp;
+    Vector rhs;
+    solTrue.createWithLocalSize( matrix.numLocalCols(), matrix.getComm() );
+    solComp.createWithLocalSize( matrix.numLocalCols(), matrix.getComm() );
+    rhs.createWithLocalSize( matrix.numLocalRows(), matrix.getComm() );
+
+    solTrue.rand();
+    solComp.zero();
+    matrix.apply( solTrue, rhs );
+
+    std::unique_ptr< KrylovSolver< Vector > > const solver = KrylovSolver< Vector >::Create( params, matrix, precond );
+    solver->solve( rhs, solComp );
+
+    EXPECT_TRUE( solver->result().success() );
+    EXPECT_LT( solver->result().numIterations, 50 );
+
+    Vector residual( rhs );
+    matrix.residual( solComp, rhs, residual );
+    EXPECT_LT( residual.norm2(), 1e-6 * rhs.norm2() );
+  }
+
+  std::unique_ptr< ProblemManager > const problemManager;
+  MeshLevel * mesh;
+  DofManager dofManager;
+  Matrix matrix;
+};
+
+TYPED_TEST_SUITE_P( CPRPreconditionerTest );
+
+TYPED_TEST_P( CPRPreconditionerTest, QuasiImpes )
+{
+  using CPR = LinearSolverParameters::CPR;
+  this->test( CPR::Decoupling::quasiImpes, CPR::Smoother::ilu0 );
+  this->test( CPR::Decoupling::quasiImpes, CPR::Smoother::blockJacobi );
+}
+
+TYPED_TEST_P( CPRPreconditionerTest, TrueImpes )
+{
+  using CPR = LinearSolverParameters::CPR;
+  this->test( CPR::Decoupling::trueImpes, CPR::Smoother::ilu0 );
+  this->test( CPR::Decoupling::trueImpes, CPR::Smoother::blockJacobi );
+}
+
+REGISTER_TYPED_TEST_SUITE_P( CPRPreconditionerTest,
+                             QuasiImpes,
+                             TrueImpes );
+
+#ifdef GEOSX_USE_TRILINOS
+INSTANTIATE_TYPED_TEST_SUITE_P( Trilinos, CPRPreconditionerTest, TrilinosInterface, );
+#endif
+
+#ifdef GEOSX_USE_HYPRE
+INSTANTIATE_TYPED_TEST_SUITE_P( Hypre, CPRPreconditionerTest, HypreInterface, );
+#endif
+
+#ifdef GEOSX_USE_PETSC
+INSTANTIATE_TYPED_TEST_SUITE_P( Petsc, CPRPreconditionerTest, PetscInterface, );
+#endif
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
@@ -380,6 +380,42 @@ TEST_F( DofManagerIndicesTest, Face_Elem_Partial )
   } );
 }
 
+/**
+ * @brief Check that the sparsity version only changes when the DoF layout or the mesh topology does.
+ */
+TEST_F( DofManagerTestBase, SparsityVersion )
+{
+  auto setupSystem = [&]( localIndex const numComp )
+  {
+    dofManager.setMesh( *problemManager->getDomainPartition(), 0, 0 );
+    dofManager.addField( "displacement", DofManager::Location::Node, numComp );
+    dofManager.addCoupling( "displacement", "displacement", DofManager::Connector::Elem );
+    dofManager.reorderByRank();
+
+    SparsityPattern< globalIndex > pattern;
+    dofManager.setSparsityPattern( pattern );
+    return dofManager.sparsityVersion();
+  };
+
+  integer const version = setupSystem( 3 );
+  EXPECT_EQ( setupSystem( 3 ), version );
+  EXPECT_GT( setupSystem( 2 ), version );
+
+  // Without a monolithic pattern (solvers assembling their own), a connectivity change must still be detected
+  auto setupDofs = [&]()
+  {
+    dofManager.setMesh( *problemManager->getDomainPartition(), 0, 0 );
+    dofManager.addField( "displacement", DofManager::Location::Node, 3 );
+    dofManager.reorderByRank();
+    return dofManager.sparsityVersion();
+  };
+
+  integer const layoutVersion = setupDofs();
+  EXPECT_EQ( setupDofs(), layoutVersion );
+  mesh->modifiedTopology();
+  EXPECT_GT( setupDofs(), layoutVersion );
+}
+
 /**
  * @brief Test fixture for all typed (LAI dependent) DofManager tests.
  * @tparam LAI linear algebra interface type
@@ -48,6 +48,20 @@ LinearSolverParameters params_BiCGSTAB()
   return parameters;
 }
 
+LinearSolverParameters params_PipelinedCG()
+{
+  LinearSolverParameters parameters = params_CG();
+  parameters.solverType = geosx::LinearSolverParameters::SolverType::pipecg;
+  return parameters;
+}
+
+LinearSolverParameters params_PipelinedBiCGSTAB()
+{
+  LinearSolverParameters parameters = params_BiCGSTAB();
+  parameters.solverType = geosx::LinearSolverParameters::SolverType::pipebicgstab;
+  return parameters;
+}
+
 LinearSolverParameters params_GMRES()
 {
   LinearSolverParameters parameters;
@@ -57,6 +71,13 @@ LinearSolverParameters params_GMRES()
   return parameters;
 }
 
+LinearSolverParameters params_GMRES_CGS2()
+{
+  LinearSolverParameters parameters = params_GMRES();
+  parameters.krylov.orthogonalization = geosx::LinearSolverParameters::Krylov::Orthogonalization::cgs2;
+  return parameters;
+}
+
 template< typename OPERATOR, typename PRECOND, typename VECTOR >
 class KrylovSolverTestBase : public ::testing::Test
 {
@@ -82,7 +103,7 @@ protected:
   VECTOR rhs_true;
   real64 cond_est = 1.0;
 
-  void test( LinearSolverParameters const & params )
+  integer test( LinearSolverParameters const & params )
   {
     sol_true.rand();
     sol_comp.zero();
@@ -98,6 +119,37 @@ protected:
     sol_comp.axpy( -1.0, sol_true );
     real64 const relTol = cond_est * params.krylov.relTolerance;
     EXPECT_LT( sol_comp.norm2() / sol_true.norm2(), relTol );
+
+    return solver->result().numIterations;
+  }
+
+  void testOrthogonalization()
+  {
+    // same system (fixed random seed) solved with both orthogonalization schemes
+    integer const numIterCGS2 = test( params_GMRES_CGS2() );
+    integer const numIterMGS = test( params_GMRES() );
+
+    // both schemes build the same Krylov basis up to round-off
+    EXPECT_LE( std::abs( numIterCGS2 - numIterMGS ), std::max( 2, numIterMGS / 50 ) );
+  }
+
+  void testMultiDot()
+  {
+    sol_true.rand( 1 );
+    VECTOR x( sol_true );
+    VECTOR y( sol_true );
+    x.rand( 2 );
+    y.rand( 3 );
+
+    std::vector< typename OPERATOR::Vector const * > const vecs = { &x, &y, &sol_true };
+    array1d< real64 > results( 3 );
+    sol_true.multiDot( vecs, results );
+
+    // summation order differs from the backend dot products
+    real64 const tol = 1e-12 * sol_true.dot( sol_true );
+    EXPECT_NEAR( results[0], sol_true.dot( x ), tol );
+    EXPECT_NEAR( results[1], sol_true.dot( y ), tol );
+    EXPECT_NEAR( results[2], sol_true.dot( sol_true ), tol );
   }
 };
 
@@ -155,10 +207,34 @@ TYPED_TEST_P( KrylovSolverTest, GMRES )
   this->test( params_GMRES() );
 }
 
+TYPED_TEST_P( KrylovSolverTest, GMRES_CGS2 )
+{
+  this->testOrthogonalization();
+}
+
+TYPED_TEST_P( KrylovSolverTest, PipelinedCG )
+{
+  this->test( params_PipelinedCG() );
+}
+
+TYPED_TEST_P( KrylovSolverTest, PipelinedBiCGSTAB )
+{
+  this->test( params_PipelinedBiCGSTAB() );
+}
+
+TYPED_TEST_P( KrylovSolverTest, MultiDot )
+{
+  this->testMultiDot();
+}
+
 REGISTER_TYPED_TEST_SUITE_P( KrylovSolverTest,
                              CG,
                              BiCGSTAB,
-                             GMRES );
+                             GMRES,
+                             GMRES_CGS2,
+                             PipelinedCG,
+                             PipelinedBiCGSTAB,
+                             MultiDot );
 
 #ifdef GEOSX_USE_TRILINOS
 INSTANTIATE_TYPED_TEST_SUITE_P( Trilinos, KrylovSolverTest, TrilinosInterface, );
@@ -245,10 +321,34 @@ TYPED_TEST_P( KrylovSolverBlockTest, GMRES )
   this->test( params_GMRES() );
 }
 
+TYPED_TEST_P( KrylovSolverBlockTest, GMRES_CGS2 )
+{
+  this->testOrthogonalization();
+}
+
+TYPED_TEST_P( KrylovSolverBlockTest, PipelinedCG )
+{
+  this->test( params_PipelinedCG() );
+}
+
+TYPED_TEST_P( KrylovSolverBlockTest, PipelinedBiCGSTAB )
+{
+  this->test( params_PipelinedBiCGSTAB() );
+}
+
+TYPED_TEST_P( KrylovSolverBlockTest, MultiDot )
+{
+  this->testMultiDot();
+}
+
 REGISTER_TYPED_TEST_SUITE_P( KrylovSolverBlockTest,
                              CG,
                              BiCGSTAB,
-                             GMRES );
+                             GMRES,
+                             GMRES_CGS2,
+                             PipelinedCG,
+                             PipelinedBiCGSTAB,
+                             MultiDot );
 
 #ifdef GEOSX_USE_TRILINOS
 INSTANTIATE_TYPED_TEST_SUITE_P( Trilinos, KrylovSolverBlockTest, TrilinosInterface, );
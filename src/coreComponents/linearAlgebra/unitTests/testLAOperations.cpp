@@ -485,10 +485,88 @@ TYPED_TEST_P( LAOperationsTest, RectangularMatrixOperations )
   EXPECT_DOUBLE_EQ( c, std::sqrt( static_cast< real64 >( nRows * ( nRows + 1 ) * ( 2 * nRows + 1 ) ) / 3.0 ) );
 }
 
+TYPED_TEST_P( LAOperationsTest, MatrixCreateAndUpdateFromLocal )
+{
+  using Matrix = typename TypeParam::ParallelMatrix;
+
+  // Assemble a local block of the 1D Laplace operator on each rank
+  localIndex const numLocalRows = 100;
+  globalIndex const rankOffset = MpiWrapper::PrefixSum< globalIndex >( numLocalRows );
+  globalIndex const numGlobalRows = MpiWrapper::Sum( globalIndex( numLocalRows ) );
+
+  CRSMatrix< real64, globalIndex > localMatrix;
+  localMatrix.resize( numLocalRows, numGlobalRows, 3 );
+  for( localIndex i = 0; i < numLocalRows; ++i )
+  {
+    globalIndex const row = rankOffset + i;
+    if( row > 0 )
+    {
+      localMatrix.insertNonZero( i, row - 1, -1.0 );
+    }
+    localMatrix.insertNonZero( i, row, 2.0 );
+    if( row < numGlobalRows - 1 )
+    {
+      localMatrix.insertNonZero( i, row + 1, -1.0 );
+    }
+  }
+
+  Matrix A;
+  A.create( localMatrix.toViewConst(), MPI_COMM_GEOSX );
+  EXPECT_EQ( A.numGlobalRows(), numGlobalRows );
+  EXPECT_DOUBLE_EQ( A.normInf(), 4.0 );
+
+  // Change values within the same sparsity pattern and update without re-creating
+  for( localIndex i = 0; i < numLocalRows; ++i )
+  {
+    arraySlice1d< real64 > const entries = localMatrix.getEntries( i );
+    for( localIndex k = 0; k < localMatrix.numNonZeros( i ); ++k )
+    {
+      entries[k] *= 3.0;
+    }
+  }
+  EXPECT_TRUE( A.update( localMatrix.toViewConst() ) );
+
+  Matrix B;
+  B.create( localMatrix.toViewConst(), MPI_COMM_GEOSX );
+
+  EXPECT_EQ( A.numGlobalNonzeros(), B.numGlobalNonzeros() );
+  EXPECT_DOUBLE_EQ( A.normInf(), 12.0 );
+  EXPECT_DOUBLE_EQ( A.normFrobenius(), B.normFrobenius() );
+  EXPECT_DOUBLE_EQ( A.getDiagValue( rankOffset ), 6.0 );
+
+  // A pattern that differs on a single rank (rank 0 drops its off-diagonal entries) is rejected on all ranks
+  bool const dropOffDiagonal = MpiWrapper::Comm_rank( MPI_COMM_GEOSX ) == 0;
+  CRSMatrix< real64, globalIndex > otherMatrix;
+  otherMatrix.resize( numLocalRows, numGlobalRows, 3 );
+  for( localIndex i = 0; i < numLocalRows; ++i )
+  {
+    globalIndex const row = rankOffset + i;
+    if( row > 0 && !dropOffDiagonal )
+    {
+      otherMatrix.insertNonZero( i, row - 1, -1.0 );
+    }
+    otherMatrix.insertNonZero( i, row, 2.0 );
+    if( row < numGlobalRows - 1 && !dropOffDiagonal )
+    {
+      otherMatrix.insertNonZero( i, row + 1, -1.0 );
+    }
+  }
+  EXPECT_FALSE( A.update( otherMatrix.toViewConst() ) );
+  A.create( otherMatrix.toViewConst(), MPI_COMM_GEOSX );
+
+  Matrix C;
+  C.create( otherMatrix.toViewConst(), MPI_COMM_GEOSX );
+
+  EXPECT_EQ( A.numGlobalNonzeros(), C.numGlobalNonzeros() );
+  EXPECT_DOUBLE_EQ( A.normInf(), C.normInf() );
+  EXPECT_DOUBLE_EQ( A.normFrobenius(), C.normFrobenius() );
+}
+
 REGISTER_TYPED_TEST_SUITE_P( LAOperationsTest,
                              VectorFunctions,
                              MatrixMatrixOperations,
-                             RectangularMatrixOperations );
+                             RectangularMatrixOperations,
+                             MatrixCreateAndUpdateFromLocal );
 
 #ifdef GEOSX_USE_TRILINOS
 INSTANTIATE_TYPED_TEST_SUITE_P( Trilinos, LAOperationsTest, TrilinosInterface, );
@@ -0,0 +1,268 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file testPreconditionerSetupReuse.cpp
+ */
+
+#include "gtest/gtest.h"
+
+#include "testLinearAlgebraUtils.hpp"
+
+#include "linearAlgebra/DofManager.hpp"
+#include "linearAlgebra/interfaces/InterfaceTypes.hpp"
+#include "linearAlgebra/solvers/KrylovSolver.hpp"
+#include "linearAlgebra/utilities/PreconditionerSetupReuse.hpp"
+#include "managers/initialization.hpp"
+
+using namespace geosx;
+
+using ReuseSetup = LinearSolverParameters::AMG::ReuseSetup;
+
+/**
+ * @brief Simulate the solves of SolverBase::SolveSystem with a given setup reuse policy.
+ */
+class PreconditionerSetupReuseTest : public ::testing::Test
+{
+protected:
+
+  /**
+   * @brief Perform a solve, recomputing the setup if needed.
+   * @param numIterations the number of Krylov iterations of the solve
+   * @return true if the setup was recomputed
+   */
+  bool solve( integer const numIterations )
+  {
+    bool const rebuild = reuse.setupRequired( policy, sparsityVersion );
+    if( rebuild )
+    {
+      reuse.recordRebuild( sparsityVersion, numIterations );
+    }
+    else
+    {
+      reuse.recordReuse( iterationGrowth, numIterations );
+    }
+    return rebuild;
+  }
+
+  PreconditionerSetupReuse reuse;
+  ReuseSetup policy = ReuseSetup::never;
+  integer sparsityVersion = 0;
+  real64 const iterationGrowth = 2.0;
+};
+
+TEST_F( PreconditionerSetupReuseTest, never )
+{
+  policy = ReuseSetup::never;
+  for( integer step = 0; step < 2; ++step )
+  {
+    reuse.startTimeStep();
+    EXPECT_TRUE( solve( 10 ) );
+    EXPECT_TRUE( solve( 10 ) );
+  }
+  EXPECT_EQ( reuse.numRebuilds(), 4 );
+  EXPECT_EQ( reuse.numReuses(), 0 );
+}
+
+TEST_F( PreconditionerSetupReuseTest, perTimeStep )
+{
+  policy = ReuseSetup::perTimeStep;
+  for( integer step = 0; step < 2; ++step )
+  {
+    reuse.startTimeStep();
+    EXPECT_TRUE( solve( 10 ) );
+    EXPECT_FALSE( solve( 10 ) );
+    EXPECT_FALSE( solve( 10 ) );
+  }
+
+  // a time step cut restarts the step, even if it happens before any Newton iteration converged
+  reuse.startTimeStep();
+  EXPECT_TRUE( solve( 10 ) );
+
+  EXPECT_EQ( reuse.numRebuilds(), 3 );
+  EXPECT_EQ( reuse.numReuses(), 4 );
+}
+
+TEST_F( PreconditionerSetupReuseTest, untilIterationGrowth )
+{
+  policy = ReuseSetup::untilIterationGrowth;
+
+  // the setup is carried over to the next time steps
+  reuse.startTimeStep();
+  EXPECT_TRUE( solve( 10 ) );
+  EXPECT_FALSE( solve( 15 ) );
+  reuse.startTimeStep();
+  EXPECT_FALSE( solve( 20 ) );
+  EXPECT_EQ( reuse.numRebuilds(), 1 );
+  EXPECT_EQ( reuse.numReuses(), 2 );
+
+  // iterations past the growth threshold force a rebuild at the next solve
+  EXPECT_FALSE( solve( 21 ) );
+  EXPECT_TRUE( solve( 12 ) );
+  EXPECT_FALSE( solve( 12 ) );
+  EXPECT_EQ( reuse.numRebuilds(), 2 );
+  EXPECT_EQ( reuse.numReuses(), 4 );
+
+  // a new sparsity pattern forces a rebuild
+  ++sparsityVersion;
+  EXPECT_TRUE( solve( 12 ) );
+  EXPECT_EQ( reuse.numRebuilds(), 3 );
+}
+
+TEST_F( PreconditionerSetupReuseTest, requestRebuild )
+{
+  policy = ReuseSetup::untilIterationGrowth;
+  EXPECT_TRUE( solve( 10 ) );
+  EXPECT_FALSE( solve( 10 ) );
+  reuse.requestRebuild();
+  EXPECT_TRUE( solve( 10 ) );
+  EXPECT_EQ( reuse.numRebuilds(), 2 );
+  EXPECT_EQ( reuse.numReuses(), 1 );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief Check the actual preconditioner refresh done on setup reuse, and that the native
+ *        Krylov solver used with a reused setup solves the same system as the backend solver.
+ */
+template< typename LAI >
+class PreconditionerRecomputeTest : public ::testing::Test
+{
+protected:
+
+  using Matrix = typename LAI::ParallelMatrix;
+  using Vector = typename LAI::ParallelVector;
+
+  void SetUp() override
+  {
+    params.krylov.relTolerance = 1e-8;
+    params.krylov.maxIterations = 500;
+    params.solverType = LinearSolverParameters::SolverType::cg;
+    params.preconditionerType = LinearSolverParameters::PreconditionerType::amg;
+    params.isSymmetric = true;
+
+    globalIndex constexpr n = 100;
+    compute2DLaplaceOperator( MPI_COMM_GEOSX, n, matrix );
+
+    sol_true.createWithGlobalSize( matrix.numGlobalCols(), MPI_COMM_GEOSX );
+    sol_comp.createWithGlobalSize( matrix.numGlobalCols(), MPI_COMM_GEOSX );
+    rhs.createWithGlobalSize( matrix.numGlobalRows(), MPI_COMM_GEOSX );
+
+    // Condition number for the Laplacian matrix estimate: 4 * n^2 / pi^2
+    cond_est = 1.5 * 4.0 * n * n / std::pow( M_PI, 2 );
+  }
+
+  /**
+   * @brief Solve with the native CG and a given preconditioner, check the solution.
+   * @param precond the computed preconditioner
+   * @return the number of iterations
+   */
+  integer solveNative( PreconditionerBase< LAI > & precond )
+  {
+    sol_true.rand();
+    sol_comp.zero();
+    matrix.apply( sol_true, rhs );
+
+    std::unique_ptr< KrylovSolver< Vector > > const solver = KrylovSolver< Vector >::Create( params, matrix, precond );
+    solver->solve( rhs, sol_comp );
+    EXPECT_TRUE( solver->result().success() );
+
+    sol_comp.axpy( -1.0, sol_true );
+    EXPECT_LT( sol_comp.norm2() / sol_true.norm2(), cond_est * params.krylov.relTolerance );
+
+    return solver->result().numIterations;
+  }
+
+  /// Change the matrix values in place, keeping its structure
+  void shiftDiagonal()
+  {
+    Vector shift;
+    shift.createWithLocalSize( matrix.numLocalRows(), MPI_COMM_GEOSX );
+    shift.set( 1.0 );
+    matrix.addDiagonal( shift );
+  }
+
+  LinearSolverParameters params;
+  DofManager dofManager{ "test" };
+  Matrix matrix;
+  Vector sol_true;
+  Vector sol_comp;
+  Vector rhs;
+  real64 cond_est = 1.0;
+};
+
+TYPED_TEST_SUITE_P( PreconditionerRecomputeTest );
+
+TYPED_TEST_P( PreconditionerRecomputeTest, recomputeMatchesCompute )
+{
+  std::unique_ptr< PreconditionerBase< TypeParam > > reused = TypeParam::createPreconditioner( this->params );
+  reused->compute( this->matrix, this->dofManager );
+  this->solveNative( *reused );
+
+  this->shiftDiagonal();
+
+  // Refreshing the values must give a preconditioner as good as a full setup on the new matrix
+  reused->recompute( this->matrix, this->dofManager );
+  integer const numIterRecompute = this->solveNative( *reused );
+
+  std::unique_ptr< PreconditionerBase< TypeParam > > fresh = TypeParam::createPreconditioner( this->params );
+  fresh->compute( this->matrix, this->dofManager );
+  integer const numIterCompute = this->solveNative( *fresh );
+
+  // The structural setup (e.g. interpolation) of the recomputed one comes from the old matrix
+  EXPECT_LE( numIterRecompute, numIterCompute + std::max( 2, numIterCompute / 10 ) );
+}
+
+TYPED_TEST_P( PreconditionerRecomputeTest, nativeMatchesBackend )
+{
+  std::unique_ptr< PreconditionerBase< TypeParam > > precond = TypeParam::createPreconditioner( this->params );
+  precond->compute( this->matrix, this->dofManager );
+  this->solveNative( *precond );
+
+  // Same system (including right-hand side) solved with the backend solver and identical settings
+  typename TypeParam::ParallelVector sol_backend( this->sol_true );
+  sol_backend.zero();
+  typename TypeParam::LinearSolver solver( this->params );
+  solver.solve( this->matrix, sol_backend, this->rhs );
+  EXPECT_TRUE( solver.result().success() );
+
+  sol_backend.axpy( -1.0, this->sol_true );
+  EXPECT_LT( sol_backend.norm2() / this->sol_true.norm2(), this->cond_est * this->params.krylov.relTolerance );
+}
+
+REGISTER_TYPED_TEST_SUITE_P( PreconditionerRecomputeTest,
+                             recomputeMatchesCompute,
+                             nativeMatchesBackend );
+
+#ifdef GEOSX_USE_TRILINOS
+INSTANTIATE_TYPED_TEST_SUITE_P( Trilinos, PreconditionerRecomputeTest, TrilinosInterface, );
+#endif
+
+#ifdef GEOSX_USE_HYPRE
+INSTANTIATE_TYPED_TEST_SUITE_P( Hypre, PreconditionerRecomputeTest, HypreInterface, );
+#endif
+
+#ifdef GEOSX_USE_PETSC
+INSTANTIATE_TYPED_TEST_SUITE_P( Petsc, PreconditionerRecomputeTest, PetscInterface, );
+#endif
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
@@ -20,6 +20,7 @@
 #define GEOSX_LINEARALGEBRA_UTILITIES_BLOCKVECTORVIEW_HPP_
 
 #include "linearAlgebra/common.hpp"
+#include "mpiCommunications/MpiWrapper.hpp"
 
 namespace geosx
 {
@@ -101,6 +102,21 @@ public:
    */
   real64 dot( BlockVectorView const & x ) const;
 
+  /**
+   * @brief Dot products with several block vectors, computed with a single global reduction.
+   * @param vecs pointers to the block vectors to compute products with
+   * @param results the dot products, must be of size @p vecs.size()
+   */
+  void multiDot( std::vector< BlockVectorView const * > const & vecs,
+                 arrayView1d< real64 > const & results ) const;
+
+  /**
+   * @brief Contribution of the local rows of all blocks to the dot product, without any communication.
+   * @param x block vector to compute product with
+   * @return the local contribution to the dot product
+   */
+  real64 localDot( BlockVectorView const & x ) const;
+
   /**
    * @brief 2-norm of the block vector.
    * @return 2-norm of the block vector
@@ -145,6 +161,12 @@ public:
    */
   localIndex blockSize() const;
 
+  /**
+   * @brief Get the communicator of the blocks.
+   * @return The MPI communicator (that of the first block).
+   */
+  MPI_Comm getComm() const;
+
   /**
    * @brief Get global size.
    * @return The global size.
@@ -305,6 +327,50 @@ real64 BlockVectorView< VECTOR >::dot( BlockVectorView const & src ) const
   return accum;
 }
 
+template< typename VECTOR >
+real64 BlockVectorView< VECTOR >::localDot( BlockVectorView const & src ) const
+{
+  GEOSX_LAI_ASSERT_EQ( blockSize(), src.blockSize() );
+  real64 accum = 0;
+  for( localIndex i = 0; i < blockSize(); i++ )
+  {
+    accum += block( i ).localDot( src.block( i ) );
+  }
+  return accum;
+}
+
+template< typename VECTOR >
+void BlockVectorView< VECTOR >::multiDot( std::vector< BlockVectorView const * > const & vecs,
+                                          arrayView1d< real64 > const & results ) const
+{
+  localIndex const numVecs = LvArray::integerConversion< localIndex >( vecs.size() );
+  GEOSX_LAI_ASSERT_EQ( results.size(), numVecs );
+  GEOSX_LAI_ASSERT_GT( blockSize(), 0 );
+
+  // accumulate the local contributions of all blocks, then reduce once
+  array1d< real64 > localResults( numVecs );
+  array1d< real64 > blockResults( numVecs );
+  std::vector< VECTOR const * > blockVecs( vecs.size() );
+  for( localIndex i = 0; i < blockSize(); i++ )
+  {
+    for( localIndex k = 0; k < numVecs; ++k )
+    {
+      GEOSX_LAI_ASSERT_EQ( blockSize(), vecs[k]->blockSize() );
+      blockVecs[k] = &vecs[k]->block( i );
+    }
+    block( i ).localMultiDot( blockVecs, blockResults );
+    for( localIndex k = 0; k < numVecs; ++k )
+    {
+      localResults[k] += blockResults[k];
+    }
+  }
+  MpiWrapper::allReduce( localResults.data(),
+                         results.data(),
+                         LvArray::integerConversion< int >( numVecs ),
+                         MPI_SUM,
+                         getComm() );
+}
+
 template< typename VECTOR >
 real64 BlockVectorView< VECTOR >::norm2() const
 {
@@ -357,6 +423,13 @@ localIndex BlockVectorView< VECTOR >::blockSize() const
   return m_vectors.size();
 }
 
+template< typename VECTOR >
+MPI_Comm BlockVectorView< VECTOR >::getComm() const
+{
+  GEOSX_LAI_ASSERT_GT( blockSize(), 0 );
+  return block( 0 ).getComm();
+}
+
 template< typename VECTOR >
 globalIndex BlockVectorView< VECTOR >::globalSize() const
 {
@@ -42,7 +42,9 @@ struct LinearSolverParameters
     gmres,         ///< GMRES
     fgmres,        ///< Flexible GMRES
     bicgstab,      ///< BiCGStab
-    preconditioner ///< Preconditioner only
+    preconditioner, ///< Preconditioner only
+    pipecg,        ///< Pipelined CG, overlapping reductions with the operator application
+    pipebicgstab   ///< Pipelined BiCGStab, overlapping reductions with the operator application
   };
 
   /**
@@ -60,7 +62,8 @@ struct LinearSolverParameters
     ict,    ///< Incomplete Cholesky with thresholding
     amg,    ///< Algebraic Multigrid
     mgr,    ///< Multigrid reduction (Hypre only)
-    block   ///< Block preconditioner
+    block,  ///< Block preconditioner
+    cpr     ///< Constrained pressure residual two-stage preconditioner
   };
 
   integer logLevel = 0;     ///< Output level [0=none, 1=basic, 2=everything]
@@ -109,11 +112,21 @@ struct LinearSolverParameters
   /// Krylov-method parameters
   struct Krylov
   {
+    /**
+     * @brief Orthogonalization scheme used to build the Krylov basis in GMRES
+     */
+    enum class Orthogonalization : integer
+    {
+      mgs, ///< Modified Gram-Schmidt (one global reduction per basis vector)
+      cgs2 ///< Classical Gram-Schmidt with one reorthogonalization pass (two global reductions per iteration)
+    };
+
     real64 relTolerance = 1e-6;       ///< Relative convergence tolerance for iterative solvers
     integer maxIterations = 200;      ///< Max iterations before declaring convergence failure
     integer maxRestart = 200;         ///< Max number of vectors in Krylov basis before restarting
     integer useAdaptiveTol = false;   ///< Use Eisenstat-Walker adaptive tolerance
     real64 weakestTol = 1e-3;         ///< Weakest allowed tolerance when using adaptive method
+    Orthogonalization orthogonalization = Orthogonalization::mgs; ///< GMRES orthogonalization scheme
   }
   krylov;                             ///< Krylov-method parameter struct
 
@@ -128,6 +141,16 @@ struct LinearSolverParameters
   /// Algebraic multigrid parameters
   struct AMG
   {
+    /**
+     * @brief Policy for reusing the preconditioner setup across linear solves
+     */
+    enum class ReuseSetup : integer
+    {
+      never,               ///< Recompute the setup for every linear solve
+      perTimeStep,         ///< Compute the setup once per time step, reuse it for later Newton iterations
+      untilIterationGrowth ///< Reuse the setup (across time steps) until Krylov iteration count grows too much
+    };
+
     integer maxLevels = 20;                  ///< Maximum number of coarsening levels
     string cycleType = "V";                  ///< AMG cycle type
     string smootherType = "gaussSeidel";     ///< Smoother type
@@ -138,6 +161,9 @@ struct LinearSolverParameters
                                              ///< smoothed-aggregation AMG)
     integer separateComponents = false;      ///< Apply a separate component filter before AMG construction
     string nullSpaceType = "constantModes";  ///< Null space type [constantModes,rigidBodyModes]
+    ReuseSetup reuseSetup = ReuseSetup::never; ///< Preconditioner setup reuse policy
+    real64 reuseIterationGrowth = 2.0;       ///< Force a rebuild when iterations exceed this factor times
+                                             ///< the iteration count of the first solve after the last rebuild
   }
   amg;                                       ///< Algebraic Multigrid (AMG) parameters
 
@@ -150,6 +176,34 @@ struct LinearSolverParameters
   }
   mgr;                                  ///< Multigrid reduction (MGR) parameters
 
+  /// Constrained pressure residual (CPR) parameters
+  struct CPR
+  {
+    /**
+     * @brief Algebraic decoupling of the pressure equation
+     */
+    enum class Decoupling : integer
+    {
+      quasiImpes, ///< Weights from the diagonal block of each cell
+      trueImpes   ///< Weights from the sum of the blocks of each cell's block column
+    };
+
+    /**
+     * @brief Second-stage (full system) preconditioner
+     */
+    enum class Smoother : integer
+    {
+      ilu0,       ///< ILU(0) of the full system
+      blockJacobi ///< Inverse of the cell diagonal blocks
+    };
+
+    string fieldName;                                ///< DoF field with pressure as its first component (solver specific)
+    Decoupling decoupling = Decoupling::quasiImpes;  ///< Pressure decoupling method
+    Smoother smoother = Smoother::ilu0;              ///< Second-stage preconditioner
+    integer pressureSetupReuse = 0;                  ///< Number of successive setups that reuse the pressure stage
+  }
+  cpr;                                               ///< Constrained pressure residual (CPR) parameters
+
   /// Incomplete factorization parameters
   struct ILU
   {
@@ -172,7 +226,9 @@ ENUM_STRINGS( LinearSolverParameters::SolverType,
               "gmres",
               "fgmres",
               "bicgstab",
-              "preconditioner" )
+              "preconditioner",
+              "pipecg",
+              "pipebicgstab" )
 
 ENUM_STRINGS( LinearSolverParameters::PreconditionerType,
               "none",
@@ -185,7 +241,25 @@ ENUM_STRINGS( LinearSolverParameters::PreconditionerType,
               "ict",
               "amg",
               "mgr",
-              "block" )
+              "block",
+              "cpr" )
+
+ENUM_STRINGS( LinearSolverParameters::Krylov::Orthogonalization,
+              "mgs",
+              "cgs2" )
+
+ENUM_STRINGS( LinearSolverParameters::CPR::Decoupling,
+              "quasiImpes",
+              "trueImpes" )
+
+ENUM_STRINGS( LinearSolverParameters::CPR::Smoother,
+              "ilu0",
+              "blockJacobi" )
+
+ENUM_STRINGS( LinearSolverParameters::AMG::ReuseSetup,
+              "never",
+              "perTimeStep",
+              "untilIterationGrowth" )
 
 ENUM_STRINGS( LinearSolverParameters::Direct::ColPerm,
               "none",
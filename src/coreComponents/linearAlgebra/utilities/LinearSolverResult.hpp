@@ -60,6 +60,12 @@ struct LinearSolverResult
   /// Solve time (in seconds) exclusive of setup costs
   real64 solveTime = 0.0;
 
+  /// Total number of linear solves that reused a previously computed preconditioner setup
+  integer numSetupReuses = 0;
+
+  /// Total number of full preconditioner setups performed when setup reuse is enabled
+  integer numSetupRebuilds = 0;
+
   /**
    * @brief Check whether the last solve was successful.
    * @return @p true if last solve was successful, @p false otherwise
@@ -0,0 +1,143 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file PreconditionerSetupReuse.hpp
+ */
+
+#ifndef GEOSX_LINEARALGEBRA_UTILITIES_PRECONDITIONERSETUPREUSE_HPP_
+#define GEOSX_LINEARALGEBRA_UTILITIES_PRECONDITIONERSETUPREUSE_HPP_
+
+#include "linearAlgebra/utilities/LinearSolverParameters.hpp"
+
+#include <algorithm>
+
+namespace geosx
+{
+
+/**
+ * @brief Bookkeeping of the preconditioner setup reuse across linear solves.
+ *
+ * Decides, according to a LinearSolverParameters::AMG::ReuseSetup policy, whether
+ * the setup of a persistent preconditioner must be recomputed before the next solve,
+ * and counts the reused and recomputed setups.
+ */
+class PreconditionerSetupReuse
+{
+public:
+
+  /// Alias for the reuse policy
+  using ReuseSetup = LinearSolverParameters::AMG::ReuseSetup;
+
+  /**
+   * @brief Mark the start of a time step, or of a new attempt after a time step cut.
+   */
+  void startTimeStep()
+  {
+    m_stepStarted = true;
+  }
+
+  /**
+   * @brief Force the next solve to recompute the setup.
+   */
+  void requestRebuild()
+  {
+    m_rebuildRequired = true;
+  }
+
+  /**
+   * @brief Check whether the setup must be recomputed before the next solve.
+   * @param policy the reuse policy
+   * @param sparsityVersion the sparsity version of the system matrix
+   * @return true if the setup must be recomputed
+   */
+  bool setupRequired( ReuseSetup const policy,
+                      integer const sparsityVersion ) const
+  {
+    return policy == ReuseSetup::never
+           || m_rebuildRequired
+           || m_sparsityVersion != sparsityVersion
+           || ( policy == ReuseSetup::perTimeStep && m_stepStarted );
+  }
+
+  /**
+   * @brief Record a solve performed right after the setup was recomputed.
+   * @param sparsityVersion the sparsity version of the system matrix
+   * @param numIterations the number of Krylov iterations of the solve
+   */
+  void recordRebuild( integer const sparsityVersion,
+                      integer const numIterations )
+  {
+    ++m_numRebuilds;
+    m_sparsityVersion = sparsityVersion;
+    m_baseIterations = numIterations;
+    m_rebuildRequired = false;
+    m_stepStarted = false;
+  }
+
+  /**
+   * @brief Record a successful solve performed with a reused setup.
+   * @param iterationGrowth the growth factor of the iteration count that forces a rebuild
+   * @param numIterations the number of Krylov iterations of the solve
+   */
+  void recordReuse( real64 const iterationGrowth,
+                    integer const numIterations )
+  {
+    ++m_numReuses;
+    m_rebuildRequired = numIterations > iterationGrowth * std::max( m_baseIterations, 1 );
+    m_stepStarted = false;
+  }
+
+  /**
+   * @brief Get the sparsity version of the system matrix at the last recomputed setup.
+   * @return the sparsity version, or -1 if the setup was never computed
+   */
+  integer sparsityVersion() const { return m_sparsityVersion; }
+
+  /**
+   * @brief Get the number of solves that reused the setup.
+   * @return the number of reuses
+   */
+  integer numReuses() const { return m_numReuses; }
+
+  /**
+   * @brief Get the number of recomputed setups.
+   * @return the number of rebuilds
+   */
+  integer numRebuilds() const { return m_numRebuilds; }
+
+private:
+
+  /// Sparsity version of the system matrix at the last recomputed setup
+  integer m_sparsityVersion = -1;
+
+  /// Krylov iterations of the first solve after the last recomputed setup
+  integer m_baseIterations = 0;
+
+  /// Whether the next solve must recompute the setup
+  bool m_rebuildRequired = true;
+
+  /// Whether no solve happened since the start of the current time step
+  bool m_stepStarted = true;
+
+  /// Number of solves that reused the setup
+  integer m_numReuses = 0;
+
+  /// Number of recomputed setups
+  integer m_numRebuilds = 0;
+};
+
+} // namespace geosx
+
+#endif //GEOSX_LINEARALGEBRA_UTILITIES_PRECONDITIONERSETUPREUSE_HPP_
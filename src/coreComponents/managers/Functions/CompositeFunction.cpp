@@ -109,18 +109,52 @@ void CompositeFunction::Evaluate( dataRepository::Group const * const group,
   }
 
   // Evaluate the symbolic math
-  forAll< serialPolicy >( set.size(), [&, set]( localIndex const i )
+  combine( subFunctionResults, result.toView() );
+#else
+  GEOSX_UNUSED_VAR( group, time, set, result );
+  GEOSX_ERROR( "GEOSX was not configured with mathpresso!" );
+#endif
+}
+
+
+void CompositeFunction::evaluateBatch( arrayView2d< real64 const > const & input,
+                                       arrayView1d< real64 > const & output ) const
+{
+#ifdef GEOSX_USE_MATHPRESSO
+  // Evaluate each of the subFunctions in batch and place the results into
+  // a temporary field
+  array1d< real64_array > subFunctionResults;
+  for( localIndex ii=0; ii<m_numSubFunctions; ++ii )
+  {
+    real64_array tmp( output.size());
+    m_subFunctions[ii]->evaluateBatch( input, tmp.toView() );
+    subFunctionResults.emplace_back( std::move( tmp ));
+  }
+
+  // Evaluate the symbolic math
+  combine( subFunctionResults, output );
+#else
+  GEOSX_UNUSED_VAR( input, output );
+  GEOSX_ERROR( "GEOSX was not configured with mathpresso!" );
+#endif
+}
+
+
+void CompositeFunction::combine( array1d< real64_array > const & subFunctionResults,
+                                 arrayView1d< real64 > const & output ) const
+{
+#ifdef GEOSX_USE_MATHPRESSO
+  forAll< parallelHostPolicy >( output.size(), [&]( localIndex const i )
   {
-    localIndex const ii = set[ i ];
     real64 functionResults[m_maxNumSubFunctions];
     for( localIndex jj=0; jj<m_numSubFunctions; ++jj )
     {
-      functionResults[jj] = subFunctionResults[jj][ii];
+      functionResults[jj] = subFunctionResults[jj][i];
     }
-    result[ii] = parserExpression.evaluate( reinterpret_cast< void * >( functionResults ));
+    output[i] = parserExpression.evaluate( reinterpret_cast< void * >( functionResults ));
   } );
 #else
-  GEOSX_ERROR( "GEOSX was not configured with mathpresso!" );
+  GEOSX_UNUSED_VAR( subFunctionResults, output );
 #endif
 }
 
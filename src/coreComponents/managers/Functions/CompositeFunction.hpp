@@ -75,8 +75,24 @@ public:
    */
   virtual real64 Evaluate( real64 const * const input ) const override final;
 
+  /**
+   * @brief Method to evaluate a function on a batch of points
+   * @param input the function arguments, of size number of points x number of arguments
+   * @param output the function values, of size number of points
+   */
+  virtual void evaluateBatch( arrayView2d< real64 const > const & input,
+                              arrayView1d< real64 > const & output ) const override final;
+
 private:
 
+  /**
+   * @brief Combine the sub-function values with the composite expression
+   * @param subFunctionResults the values of each sub-function, of size number of points
+   * @param output the function values, of size number of points
+   */
+  void combine( array1d< real64_array > const & subFunctionResults,
+                arrayView1d< real64 > const & output ) const;
+
   string_array m_functionNames;
   string_array m_variableNames;
   string m_expression;
@@ -71,6 +71,18 @@ integer FunctionBase::isFunctionOfTime() const
 }
 
 
+void FunctionBase::evaluateBatch( arrayView2d< real64 const > const & input,
+                                  arrayView1d< real64 > const & output ) const
+{
+  GEOSX_ERROR_IF_NE( input.size( 0 ), output.size() );
+
+  forAll< parallelHostPolicy >( output.size(), [=]( localIndex const i )
+  {
+    output[i] = Evaluate( &input[i][0] );
+  } );
+}
+
+
 real64_array FunctionBase::EvaluateStats( dataRepository::Group const * const group,
                                           real64 const time,
                                           SortedArray< localIndex > const & set ) const
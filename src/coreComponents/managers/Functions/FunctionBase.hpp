@@ -93,6 +93,14 @@ public:
    */
   virtual real64 Evaluate( real64 const * const input ) const = 0;
 
+  /**
+   * @brief Method to evaluate a function on a batch of points
+   * @param input the function arguments, of size number of points x number of arguments
+   * @param output the function values, of size number of points
+   */
+  virtual void evaluateBatch( arrayView2d< real64 const > const & input,
+                              arrayView1d< real64 > const & output ) const;
+
   /// Alias for the catalog interface
   using CatalogInterface = dataRepository::CatalogInterface< FunctionBase, std::string const &, Group * const >;
 
@@ -130,7 +138,7 @@ protected:
 
   /**
    * @brief Method to apply an function with an arbitrary type of output
-   * @tparam LEAF the return type
+   * @tparam LEAF the type of the derived function, whose evaluateBatch() is called without virtual dispatch
    * @param[in] group a pointer to the object holding the function arguments
    * @param[in] time current time
    * @param[in] set the subset of nodes to apply the function to
@@ -190,23 +198,24 @@ void FunctionBase::EvaluateT( dataRepository::Group const * const group,
   GEOSX_ERROR_IF( result.size() != set.size(), "To apply a function to a set, the size of the result and set must match" );
 
 
-  forAll< serialPolicy >( set.size(), [&, set]( localIndex const i )
+  // Gather the function arguments of all points of the set
+  array2d< real64 > input( set.size(), totalVarSize );
+  forAll< parallelHostPolicy >( set.size(), [&, set]( localIndex const i )
   {
     localIndex const index = set[ i ];
-    double input[4];
     int c = 0;
     for( int a=0; a<numVars; ++a )
     {
       for( int b=0; b<varSize[a]; ++b )
       {
-        input[c] = input_ptrs[a][(index*varSize[a]+b)*timeVar[a]];
+        input[i][c] = input_ptrs[a][(index*varSize[a]+b)*timeVar[a]];
         ++c;
       }
     }
-
-    // Note: we expect that result is the same size as the set
-    result[i] = static_cast< LEAF const * >(this)->Evaluate( input );
   } );
+
+  // Note: we expect that result is the same size as the set
+  static_cast< LEAF const * >(this)->LEAF::evaluateBatch( input.toViewConst(), result.toView() );
 }
 } /* namespace geosx */
 
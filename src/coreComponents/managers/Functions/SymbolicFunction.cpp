@@ -78,6 +78,25 @@ void SymbolicFunction::InitializeFunction()
 }
 
 
+void SymbolicFunction::evaluateBatch( arrayView2d< real64 const > const & input,
+                                      arrayView1d< real64 > const & output ) const
+{
+#ifdef GEOSX_USE_MATHPRESSO
+  GEOSX_ERROR_IF_NE( input.size( 0 ), output.size() );
+
+  // The compiled expression reads its variables from a contiguous row of the input
+  mathpresso::Expression const & expression = parserExpression;
+  forAll< parallelHostPolicy >( output.size(), [&expression, input, output]( localIndex const i )
+  {
+    output[i] = expression.evaluate( reinterpret_cast< void * >( const_cast< real64 * >( &input[i][0] ) ) );
+  } );
+#else
+  GEOSX_UNUSED_VAR( input, output );
+  GEOSX_ERROR( "GEOSX was not built with mathpresso!" );
+#endif
+}
+
+
 REGISTER_CATALOG_ENTRY( FunctionBase, SymbolicFunction, std::string const &, Group * const )
 
 } /* namespace ANST */
@@ -86,6 +86,14 @@ public:
 #endif
   }
 
+  /**
+   * @brief Method to evaluate a function on a batch of points
+   * @param input the function arguments, of size number of points x number of variables
+   * @param output the function values, of size number of points
+   */
+  virtual void evaluateBatch( arrayView2d< real64 const > const & input,
+                              arrayView1d< real64 > const & output ) const override final;
+
 
   /**
    * @brief Set the symbolic variable names
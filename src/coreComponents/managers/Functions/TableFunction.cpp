@@ -53,7 +53,10 @@ TableFunction::TableFunction( const std::string & name,
   m_size(),
   m_indexIncrement(),
   m_corners(),
-  m_numCorners( 0 )
+  m_numCorners( 0 ),
+  m_flatCoordinates(),
+  m_coordinateOffsets(),
+  m_inverseSpacing()
 {
   registerWrapper( keys::tableCoordinates, &m_tableCoordinates1D )->
     setInputFlag( InputFlags::OPTIONAL )->
@@ -177,6 +180,36 @@ void TableFunction::reInitializeFunction()
       m_corners[jj][ii] = int(ii / pow( 2, jj )) % 2;
     }
   }
+
+  // Store the axes contiguously and detect evenly spaced ones for the kernel wrappers
+  m_flatCoordinates.resize( 0 );
+  m_coordinateOffsets.resize( m_dimensions );
+  m_inverseSpacing.resize( m_dimensions );
+  for( localIndex ii=0; ii<m_dimensions; ++ii )
+  {
+    real64_array const & axis = m_coordinates[ii];
+    m_coordinateOffsets[ii] = m_flatCoordinates.size();
+    for( localIndex jj=0; jj<m_size[ii]; ++jj )
+    {
+      m_flatCoordinates.emplace_back( axis[jj] );
+    }
+
+    m_inverseSpacing[ii] = 0.0;
+    if( m_size[ii] > 1 )
+    {
+      real64 const range = axis[m_size[ii] - 1] - axis[0];
+      real64 const spacing = range / ( m_size[ii] - 1 );
+      bool isUniform = range > 0.0;
+      for( localIndex jj=1; isUniform && jj<m_size[ii]; ++jj )
+      {
+        isUniform = std::fabs( axis[jj] - ( axis[0] + jj * spacing ) ) <= 1e-10 * range;
+      }
+      if( isUniform )
+      {
+        m_inverseSpacing[ii] = 1.0 / spacing;
+      }
+    }
+  }
 }
 
 
@@ -187,8 +220,8 @@ real64 TableFunction::Evaluate( real64 const * const input ) const
   // Linear interpolation
   if( m_interpolationMethod == InterpolationType::Linear )
   {
-    localIndex bounds[m_maxDimensions][2];
-    real64 weights[m_maxDimensions][2];
+    localIndex bounds[maxDimensions][2];
+    real64 weights[maxDimensions][2];
 
     // Determine position, weights
     for( localIndex ii=0; ii<m_dimensions; ++ii )
@@ -212,9 +245,7 @@ real64 TableFunction::Evaluate( real64 const * const input ) const
       else
       {
         // Find the coordinate index
-        ///TODO make this fast
-        // Note: lower_bound uses a binary search...  If we assume coordinates are
-        // evenly spaced, we can speed things up considerably
+        // Note: lower_bound uses a binary search, see KernelWrapper for O(1) lookup on evenly spaced axes
         auto lower = std::lower_bound( m_coordinates[ii].begin(), m_coordinates[ii].end(), input[ii] );
         bounds[ii][1] = LvArray::integerConversion< localIndex >( std::distance( m_coordinates[ii].begin(), lower ));
         bounds[ii][0] = bounds[ii][1] - 1;
@@ -33,6 +33,77 @@ namespace geosx
 class TableFunction : public FunctionBase
 {
 public:
+
+  /// Enumerator of available interpolation types
+  enum class InterpolationType : integer
+  {
+    Linear,
+    Nearest,
+    Upper,
+    Lower
+  };
+
+  /// Maximum number of table dimensions
+  static localIndex constexpr maxDimensions = 4;
+
+  /**
+   * @class KernelWrapper
+   * @brief Lightweight view of a table that can be evaluated inside device kernels.
+   * @tparam DIM the number of table dimensions
+   * @tparam INTERPOLATION_TYPE the interpolation method
+   *
+   * The axes are located in O(1) when their coordinates are evenly spaced, and by bisection otherwise.
+   * The wrapper holds views on the table data, so it must not outlive the TableFunction it was created from.
+   */
+  template< localIndex DIM, InterpolationType INTERPOLATION_TYPE >
+  class KernelWrapper
+  {
+public:
+
+    /**
+     * @brief Constructor.
+     * @param table the table function to wrap
+     */
+    explicit KernelWrapper( TableFunction const & table );
+
+    /**
+     * @brief Interpolate in the table.
+     * @param input the input coordinates, of size DIM
+     * @return the interpolated value
+     */
+    GEOSX_HOST_DEVICE
+    real64 compute( real64 const * const input ) const;
+
+private:
+
+    /**
+     * @brief Find the index of the first coordinate not less than @p x along an axis.
+     * @param dim the axis
+     * @param x the coordinate, assumed to lie strictly within the axis bounds
+     * @return the index, in [1, size-1]
+     */
+    GEOSX_HOST_DEVICE
+    localIndex upperIndex( localIndex const dim, real64 const x ) const;
+
+    /// Coordinates of all the axes, stored contiguously
+    arrayView1d< real64 const > m_coordinates;
+
+    /// Table values (in fortran order)
+    arrayView1d< real64 const > m_values;
+
+    /// Offset of each axis in m_coordinates
+    localIndex m_offset[DIM];
+
+    /// Number of coordinates along each axis
+    localIndex m_size[DIM];
+
+    /// Stride of each axis in m_values
+    localIndex m_indexIncrement[DIM];
+
+    /// Inverse of the coordinate spacing of evenly spaced axes, zero otherwise
+    real64 m_inverseSpacing[DIM];
+  };
+
   /**
    * @brief The constructor
    * @param[in] name the name of this object manager
@@ -95,6 +166,48 @@ public:
    */
   virtual real64 Evaluate( real64 const * const input ) const override final;
 
+  /**
+   * @brief Method to evaluate a function on a batch of points, using the kernel wrapper
+   * @param input the function arguments, of size number of points x table dimension
+   * @param output the function values, of size number of points
+   */
+  virtual void evaluateBatch( arrayView2d< real64 const > const & input,
+                              arrayView1d< real64 > const & output ) const override final
+  {
+    evaluateBatch< parallelHostPolicy >( input, output );
+  }
+
+  /**
+   * @brief Create a kernel wrapper for the table.
+   * @tparam DIM the number of table dimensions, must match the table
+   * @tparam INTERPOLATION_TYPE the interpolation method
+   * @return the kernel wrapper
+   */
+  template< localIndex DIM, InterpolationType INTERPOLATION_TYPE = InterpolationType::Linear >
+  KernelWrapper< DIM, INTERPOLATION_TYPE > createKernelWrapper() const
+  {
+    GEOSX_ERROR_IF_NE_MSG( DIM, m_dimensions, "Table dimension mismatch in " << getName() );
+    return KernelWrapper< DIM, INTERPOLATION_TYPE >( *this );
+  }
+
+  /**
+   * @brief Call a function with the kernel wrapper matching the table dimension and interpolation method.
+   * @tparam LAMBDA the type of the function
+   * @param lambda the function, taking the kernel wrapper as its only argument
+   */
+  template< typename LAMBDA >
+  void forKernelWrapper( LAMBDA && lambda ) const;
+
+  /**
+   * @brief Evaluate the table on a batch of points in a single kernel launch.
+   * @tparam POLICY the execution policy
+   * @param input the input coordinates, of size number of points x table dimension
+   * @param output the interpolated values, of size number of points
+   */
+  template< typename POLICY >
+  void evaluateBatch( arrayView2d< real64 const > const & input,
+                      arrayView1d< real64 > const & output ) const;
+
   /**
    * @brief Get the table axes definitions
    * @return a reference to an array of arrays that define each table axis
@@ -117,15 +230,6 @@ public:
    */
   array1d< real64 > & getValues()       { return m_values; }
 
-  /// Enumerator of available interpolation types
-  enum class InterpolationType : integer
-  {
-    Linear,
-    Nearest,
-    Upper,
-    Lower
-  };
-
   /**
    * @brief Set the interpolation method
    * @param method The interpolation method
@@ -145,6 +249,16 @@ public:
   void setTableValues( real64_array values ) { m_values = values; }
 
 private:
+
+  /**
+   * @brief Call a function with the kernel wrapper matching the table interpolation method.
+   * @tparam DIM the number of table dimensions
+   * @tparam LAMBDA the type of the function
+   * @param lambda the function, taking the kernel wrapper as its only argument
+   */
+  template< localIndex DIM, typename LAMBDA >
+  void forKernelWrapperOfDim( LAMBDA && lambda ) const;
+
   /// Coordinates for 1D table
   real64_array m_tableCoordinates1D;
 
@@ -163,9 +277,6 @@ private:
   /// Table values (in fortran order)
   real64_array m_values;
 
-  /// Maximum number of table dimensions
-  static localIndex constexpr m_maxDimensions = 4;
-
   /// Number of active table dimensions
   localIndex m_dimensions;
 
@@ -177,14 +288,255 @@ private:
 
   /**
    * @brief The corners of the box that surround the value in N dimensions
-   * m_corners should be of size m_maxDimensions x (2^m_maxDimensions)
+   * m_corners should be of size maxDimensions x (2^maxDimensions)
    */
-  localIndex m_corners[m_maxDimensions][16];
+  localIndex m_corners[maxDimensions][16];
 
   /// The number of active table corners
   localIndex m_numCorners;
+
+  /// Coordinates of all the axes, stored contiguously for the kernel wrappers
+  real64_array m_flatCoordinates;
+
+  /// Offset of each axis in m_flatCoordinates
+  localIndex_array m_coordinateOffsets;
+
+  /// Inverse of the coordinate spacing of evenly spaced axes, zero otherwise
+  real64_array m_inverseSpacing;
 };
 
+template< localIndex DIM, TableFunction::InterpolationType INTERPOLATION_TYPE >
+TableFunction::KernelWrapper< DIM, INTERPOLATION_TYPE >::KernelWrapper( TableFunction const & table ):
+  m_coordinates( table.m_flatCoordinates.toViewConst() ),
+  m_values( table.m_values.toViewConst() ),
+  m_offset(),
+  m_size(),
+  m_indexIncrement(),
+  m_inverseSpacing()
+{
+  static_assert( DIM > 0 && DIM <= maxDimensions, "Unsupported table dimension" );
+  for( localIndex dim = 0; dim < DIM; ++dim )
+  {
+    m_offset[dim] = table.m_coordinateOffsets[dim];
+    m_size[dim] = table.m_size[dim];
+    m_indexIncrement[dim] = table.m_indexIncrement[dim];
+    m_inverseSpacing[dim] = table.m_inverseSpacing[dim];
+  }
+}
+
+template< localIndex DIM, TableFunction::InterpolationType INTERPOLATION_TYPE >
+GEOSX_HOST_DEVICE
+localIndex TableFunction::KernelWrapper< DIM, INTERPOLATION_TYPE >::upperIndex( localIndex const dim,
+                                                                                real64 const x ) const
+{
+  real64 const * const coords = &m_coordinates[m_offset[dim]];
+  localIndex const size = m_size[dim];
+
+  if( m_inverseSpacing[dim] > 0.0 )
+  {
+    // Evenly spaced axis: guess the index, then correct for round-off
+    localIndex index = static_cast< localIndex >( ceil( ( x - coords[0] ) * m_inverseSpacing[dim] ) );
+    index = index < 1 ? 1 : ( index > size - 1 ? size - 1 : index );
+    while( coords[index - 1] >= x )
+    {
+      --index;
+    }
+    while( coords[index] < x )
+    {
+      ++index;
+    }
+    return index;
+  }
+
+  // Bisection, keeping coords[lower] < x <= coords[upper]
+  localIndex lower = 0;
+  localIndex upper = size - 1;
+  while( upper - lower > 1 )
+  {
+    localIndex const middle = ( lower + upper ) / 2;
+    if( coords[middle] < x )
+    {
+      lower = middle;
+    }
+    else
+    {
+      upper = middle;
+    }
+  }
+  return upper;
+}
+
+template< localIndex DIM, TableFunction::InterpolationType INTERPOLATION_TYPE >
+GEOSX_HOST_DEVICE
+real64 TableFunction::KernelWrapper< DIM, INTERPOLATION_TYPE >::compute( real64 const * const input ) const
+{
+  if( INTERPOLATION_TYPE == InterpolationType::Linear )
+  {
+    localIndex bounds[DIM][2];
+    real64 weights[DIM][2];
+
+    // Determine position, weights
+    for( localIndex dim = 0; dim < DIM; ++dim )
+    {
+      real64 const * const coords = &m_coordinates[m_offset[dim]];
+      if( input[dim] <= coords[0] )
+      {
+        // Coordinate is to the left of this axis
+        bounds[dim][0] = 0;
+        bounds[dim][1] = 0;
+        weights[dim][0] = 0;
+        weights[dim][1] = 1;
+      }
+      else if( input[dim] >= coords[m_size[dim] - 1] )
+      {
+        // Coordinate is to the right of this axis
+        bounds[dim][0] = m_size[dim] - 1;
+        bounds[dim][1] = bounds[dim][0];
+        weights[dim][0] = 1;
+        weights[dim][1] = 0;
+      }
+      else
+      {
+        bounds[dim][1] = upperIndex( dim, input[dim] );
+        bounds[dim][0] = bounds[dim][1] - 1;
+
+        real64 const dx = coords[bounds[dim][1]] - coords[bounds[dim][0]];
+        weights[dim][0] = 1.0 - ( input[dim] - coords[bounds[dim][0]] ) / dx;
+        weights[dim][1] = 1.0 - weights[dim][0];
+      }
+    }
+
+    // Sum the weighted values at the corners of the surrounding box
+    real64 result = 0.0;
+    for( localIndex corner = 0; corner < ( 1 << DIM ); ++corner )
+    {
+      localIndex tableIndex = 0;
+      real64 cornerWeight = 1.0;
+      for( localIndex dim = 0; dim < DIM; ++dim )
+      {
+        localIndex const side = ( corner >> dim ) & 1;
+        tableIndex += bounds[dim][side] * m_indexIncrement[dim];
+        cornerWeight *= weights[dim][side];
+      }
+      result += m_values[tableIndex] * cornerWeight;
+    }
+    return result;
+  }
+  else
+  {
+    // Determine the index to the nearest table entry
+    localIndex tableIndex = 0;
+    for( localIndex dim = 0; dim < DIM; ++dim )
+    {
+      real64 const * const coords = &m_coordinates[m_offset[dim]];
+      localIndex subIndex;
+
+      if( input[dim] <= coords[0] )
+      {
+        subIndex = 0;
+      }
+      else if( input[dim] >= coords[m_size[dim] - 1] )
+      {
+        subIndex = m_size[dim] - 1;
+      }
+      else
+      {
+        subIndex = upperIndex( dim, input[dim] );
+        if( INTERPOLATION_TYPE == InterpolationType::Nearest )
+        {
+          if( ( input[dim] - coords[subIndex - 1] ) <= ( coords[subIndex] - input[dim] ) )
+          {
+            --subIndex;
+          }
+        }
+        else if( INTERPOLATION_TYPE == InterpolationType::Lower )
+        {
+          --subIndex;
+        }
+      }
+
+      tableIndex += subIndex * m_indexIncrement[dim];
+    }
+    return m_values[tableIndex];
+  }
+}
+
+template< localIndex DIM, typename LAMBDA >
+void TableFunction::forKernelWrapperOfDim( LAMBDA && lambda ) const
+{
+  switch( m_interpolationMethod )
+  {
+    case InterpolationType::Linear:
+    {
+      lambda( createKernelWrapper< DIM, InterpolationType::Linear >() );
+      break;
+    }
+    case InterpolationType::Nearest:
+    {
+      lambda( createKernelWrapper< DIM, InterpolationType::Nearest >() );
+      break;
+    }
+    case InterpolationType::Upper:
+    {
+      lambda( createKernelWrapper< DIM, InterpolationType::Upper >() );
+      break;
+    }
+    case InterpolationType::Lower:
+    {
+      lambda( createKernelWrapper< DIM, InterpolationType::Lower >() );
+      break;
+    }
+  }
+}
+
+template< typename LAMBDA >
+void TableFunction::forKernelWrapper( LAMBDA && lambda ) const
+{
+  switch( m_dimensions )
+  {
+    case 1:
+    {
+      forKernelWrapperOfDim< 1 >( std::forward< LAMBDA >( lambda ) );
+      break;
+    }
+    case 2:
+    {
+      forKernelWrapperOfDim< 2 >( std::forward< LAMBDA >( lambda ) );
+      break;
+    }
+    case 3:
+    {
+      forKernelWrapperOfDim< 3 >( std::forward< LAMBDA >( lambda ) );
+      break;
+    }
+    case 4:
+    {
+      forKernelWrapperOfDim< 4 >( std::forward< LAMBDA >( lambda ) );
+      break;
+    }
+    default:
+    {
+      GEOSX_ERROR( "Unsupported dimension " << m_dimensions << " for table " << getName() );
+    }
+  }
+}
+
+template< typename POLICY >
+void TableFunction::evaluateBatch( arrayView2d< real64 const > const & input,
+                                   arrayView1d< real64 > const & output ) const
+{
+  GEOSX_ERROR_IF_NE( input.size( 0 ), output.size() );
+  GEOSX_ERROR_IF_NE( input.size( 1 ), m_dimensions );
+
+  forKernelWrapper( [&]( auto const kernelWrapper )
+  {
+    forAll< POLICY >( output.size(), [=] GEOSX_HOST_DEVICE ( localIndex const i )
+    {
+      output[i] = kernelWrapper.compute( &input[i][0] );
+    } );
+  } );
+}
+
 ENUM_STRINGS( TableFunction::InterpolationType, "linear", "nearest", "upper", "lower" )
 
 
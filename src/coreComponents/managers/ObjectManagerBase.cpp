@@ -625,13 +625,15 @@ localIndex ObjectManagerBase::UnpackGlobalMaps( buffer_unit_type const * & buffe
     globalIndex_array newGlobalIndices;
     newGlobalIndices.reserve( numUnpackedIndices );
     localIndex const oldSize = this->size();
+
+    // check to see if the objects already exist by looking up their global indices in m_globalToLocalMap,
+    // the objects that don't exist on this domain get a local index of -1 and are added below
+    m_globalToLocalMap.lookup( globalIndices, unpackedLocalIndices, -1 );
+    m_globalToLocalMap.reserve( oldSize + numUnpackedIndices );
+
     for( localIndex a = 0; a < numUnpackedIndices; ++a )
     {
-      // check to see if the object already exists by checking for the global
-      // index in m_globalToLocalMap. If it doesn't, then add the object
-      unordered_map< globalIndex, localIndex >::iterator iterG2L =
-        m_globalToLocalMap.find( globalIndices[a] );
-      if( iterG2L == m_globalToLocalMap.end() )
+      if( unpackedLocalIndices( a ) < 0 )
       {
         // object does not exist on this domain
         const localIndex newLocalIndex = oldSize + numNewIndices;
@@ -653,8 +655,7 @@ localIndex ObjectManagerBase::UnpackGlobalMaps( buffer_unit_type const * & buffe
       {
         // object already exists on this domain
         // get the local index of the node
-        localIndex b = iterG2L->second;
-        unpackedLocalIndices( a ) = b;
+        localIndex const b = unpackedLocalIndices( a );
         if( ( sendingRank < rank && m_ghostRank[b] <= -1) || ( sendingRank < m_ghostRank[b] ) )
         {
           m_ghostRank[b] = sendingRank;
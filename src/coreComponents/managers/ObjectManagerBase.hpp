@@ -20,6 +20,7 @@
 #define GEOSX_MANAGERS_OBJECTMANAGERBASE_HPP_
 
 #include "dataRepository/Group.hpp"
+#include "common/IndexMap.hpp"
 #include "common/TimingMacros.hpp"
 #include "mpiCommunications/NeighborData.hpp"
 
@@ -469,7 +470,7 @@ public:
    * @param clearIfUnmapped Shall we clear the unmapped indices. Here unused.
    */
   static void FixUpDownMaps( ArrayOfSets< localIndex > & relation,
-                             unordered_map< globalIndex, localIndex > const & globalToLocal,
+                             indexMap< globalIndex, localIndex > const & globalToLocal,
                              map< localIndex, SortedArray< globalIndex > > & unmappedIndices,
                              bool const clearIfUnmapped );
 
@@ -824,7 +825,7 @@ public:
    * @brief Get global to local map.
    * @return The mapping relationship as a array.
    */
-  unordered_map< globalIndex, localIndex > const & globalToLocalMap() const
+  indexMap< globalIndex, localIndex > const & globalToLocalMap() const
   { return m_globalToLocalMap; }
 
   /**
@@ -934,7 +935,7 @@ protected:
   array1d< globalIndex > m_localToGlobalMap;
 
   /// Map from object global index to the local index.
-  unordered_map< globalIndex, localIndex > m_globalToLocalMap;
+  indexMap< globalIndex, localIndex > m_globalToLocalMap;
 
   /// Array that holds if an object is external.
   array1d< integer > m_isExternal;
@@ -973,7 +974,7 @@ void ObjectManagerBase::FixUpDownMaps( TYPE_RELATION & relation,
   GEOSX_MARK_FUNCTION;
 
   bool allValuesMapped = true;
-  unordered_map< globalIndex, localIndex > const & globalToLocal = relation.RelatedObjectGlobalToLocal();
+  indexMap< globalIndex, localIndex > const & globalToLocal = relation.RelatedObjectGlobalToLocal();
   for( map< localIndex, array1d< globalIndex > >::iterator iter = unmappedIndices.begin();
        iter != unmappedIndices.end();
        ++iter )
@@ -1008,7 +1009,7 @@ void ObjectManagerBase::FixUpDownMaps( TYPE_RELATION & relation,
 {
   GEOSX_MARK_FUNCTION;
 
-  unordered_map< globalIndex, localIndex > const & globalToLocal = relation.RelatedObjectGlobalToLocal();
+  indexMap< globalIndex, localIndex > const & globalToLocal = relation.RelatedObjectGlobalToLocal();
   for( map< localIndex, SortedArray< globalIndex > >::iterator iter = unmappedIndices.begin();
        iter != unmappedIndices.end();
        ++iter )
@@ -1039,7 +1040,7 @@ void ObjectManagerBase::FixUpDownMaps( TYPE_RELATION & relation,
 
 inline
 void ObjectManagerBase::FixUpDownMaps( ArrayOfSets< localIndex > & relation,
-                                       unordered_map< globalIndex, localIndex > const & globalToLocal,
+                                       indexMap< globalIndex, localIndex > const & globalToLocal,
                                        map< localIndex, SortedArray< globalIndex > > & unmappedIndices,
                                        bool const clearIfUnmapped )
 {
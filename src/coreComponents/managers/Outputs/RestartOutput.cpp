@@ -17,11 +17,15 @@
  */
 
 #include "RestartOutput.hpp"
+#include "dataRepository/ConduitRestart.hpp"
 #include "fileIO/silo/SiloFile.hpp"
 #include "managers/DomainPartition.hpp"
 #include "managers/Functions/FunctionManager.hpp"
 #include "managers/ProblemManager.hpp"
 #include "managers/FieldSpecification/FieldSpecificationManager.hpp"
+#include "mpiCommunications/MpiWrapper.hpp"
+
+#include <hdf5.h>
 
 
 namespace geosx
@@ -31,11 +35,55 @@ using namespace dataRepository;
 
 RestartOutput::RestartOutput( std::string const & name,
                               Group * const parent ):
-  OutputBase( name, parent )
-{}
+  OutputBase( name, parent ),
+  m_asynchronous( 0 ),
+  m_maxPendingWrites( 1 ),
+  m_ranksPerFile( 1 )
+{
+  registerWrapper( viewKeyStruct::asynchronousString, &m_asynchronous )->
+    setApplyDefaultValue( 0 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Flag to write the restart files from a background thread while the simulation proceeds. "
+                    "The data is copied into a staging tree before being written. "
+                    "Requires a thread-safe HDF5 library and MPI_THREAD_MULTIPLE support." );
+
+  registerWrapper( viewKeyStruct::maxPendingWritesString, &m_maxPendingWrites )->
+    setApplyDefaultValue( 1 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Maximum number of restart files being written in the background (asynchronous mode only). "
+                    "Each of them holds a copy of the data in memory." );
+
+  registerWrapper( viewKeyStruct::ranksPerFileString, &m_ranksPerFile )->
+    setApplyDefaultValue( 1 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Number of ranks whose data is gathered and written into each restart file by an aggregator rank. "
+                    "A value of 1 writes one file per rank. The restart must be read by as many ranks as wrote it, "
+                    "whatever the number of files." );
+}
 
 RestartOutput::~RestartOutput()
-{}
+{
+  waitForPendingWrites();
+}
+
+void RestartOutput::PostProcessInput()
+{
+  GEOSX_ERROR_IF_LT_MSG( m_ranksPerFile, 1, "Invalid value of " << viewKeyStruct::ranksPerFileString << " for " << getName() );
+  GEOSX_ERROR_IF( m_asynchronous && m_ranksPerFile > 1,
+                  "Asynchronous restart files cannot be aggregated (" << getName() << ")" );
+
+  if( m_asynchronous )
+  {
+    hbool_t threadSafe = 0;
+    H5is_library_threadsafe( &threadSafe );
+    if( !threadSafe || !MpiWrapper::Thread_multiple() )
+    {
+      GEOSX_WARNING( getName() << ": asynchronous restart output requires a thread-safe HDF5 library "
+                               << "and MPI_THREAD_MULTIPLE support, writing synchronously instead." );
+      m_asynchronous = 0;
+    }
+  }
+}
 
 void RestartOutput::Execute( real64 const GEOSX_UNUSED_PARAM( time_n ),
                              real64 const GEOSX_UNUSED_PARAM( dt ),
@@ -57,12 +105,32 @@ void RestartOutput::Execute( real64 const GEOSX_UNUSED_PARAM( time_n ),
   problemManager->prepareToWrite();
   FunctionManager::Instance().prepareToWrite();
   FieldSpecificationManager::get().prepareToWrite();
-  writeTree( fileName );
+  if( m_asynchronous )
+  {
+    writeTreeAsync( fileName, m_maxPendingWrites );
+  }
+  else
+  {
+    writeTree( fileName, m_ranksPerFile );
+  }
   problemManager->finishWriting();
   FunctionManager::Instance().finishWriting();
   FieldSpecificationManager::get().finishWriting();
 }
 
 
+void RestartOutput::Cleanup( real64 const time_n,
+                             integer const cycleNumber,
+                             integer const eventCounter,
+                             real64 const eventProgress,
+                             Group * domain )
+{
+  Execute( time_n, 0, cycleNumber, eventCounter, eventProgress, domain );
+
+  // Make sure that all restart files are complete before exiting
+  waitForPendingWrites();
+}
+
+
 REGISTER_CATALOG_ENTRY( OutputBase, RestartOutput, std::string const &, Group * const )
 } /* namespace geosx */
@@ -66,17 +66,32 @@ public:
                         integer const cycleNumber,
                         integer const eventCounter,
                         real64 const eventProgress,
-                        dataRepository::Group * domain ) override
-  {
-    Execute( time_n, 0, cycleNumber, eventCounter, eventProgress, domain );
-  }
+                        dataRepository::Group * domain ) override;
 
   /// @cond DO_NOT_DOCUMENT
   struct viewKeyStruct
   {
     dataRepository::ViewKey writeFEMFaces = { "writeFEMFaces" };
+    static constexpr auto asynchronousString = "asynchronous";
+    static constexpr auto maxPendingWritesString = "maxPendingWrites";
+    static constexpr auto ranksPerFileString = "ranksPerFile";
   } viewKeys;
   /// @endcond
+
+protected:
+
+  virtual void PostProcessInput() override;
+
+private:
+
+  /// Flag to write the restart files from a background thread
+  integer m_asynchronous;
+
+  /// Maximum number of restart files being written in the background
+  integer m_maxPendingWrites;
+
+  /// Number of ranks whose data is aggregated into each restart file
+  integer m_ranksPerFile;
 };
 
 
@@ -1,6 +1,15 @@
 #include "TimeHistoryOutput.hpp"
+
 namespace geosx
 {
+
+namespace
+{
+/// The last background flush submitted by any time history output, flushes run one after the other
+/// so that the collective HDF5 operations are issued in the same order on every rank
+std::shared_future< void > lastFlush;
+}
+
 TimeHistoryOutput::TimeHistoryOutput( string const & name,
                                       Group * const parent ):
   OutputBase( name, parent ),
@@ -8,7 +17,10 @@ TimeHistoryOutput::TimeHistoryOutput( string const & name,
   m_format( ),
   m_filename( ),
   m_recordCount( 0 ),
-  m_io( )
+  m_chunkSize( 0 ),
+  m_asynchronous( 0 ),
+  m_io( ),
+  m_pendingFlush( )
 {
   registerWrapper( viewKeys::timeHistoryOutputTarget, &m_collectorPaths )->
     setInputFlag( InputFlags::REQUIRED )->
@@ -24,6 +36,17 @@ TimeHistoryOutput::TimeHistoryOutput( string const & name,
     setInputFlag( InputFlags::OPTIONAL )->
     setDescription( "The output file format for time history output." );
 
+  registerWrapper( viewKeys::chunkSizeString, &m_chunkSize )->
+    setApplyDefaultValue( 16 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "The number of history records per chunk in the file, the collection buffers are sized to hold one chunk." );
+
+  registerWrapper( viewKeys::asynchronousString, &m_asynchronous )->
+    setApplyDefaultValue( 0 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Flag to write the buffered records from a background thread while the simulation continues. "
+                    "Requires a thread-safe HDF5 library and MPI_THREAD_MULTIPLE support." );
+
   registerWrapper( viewKeys::timeHistoryRestart, &m_recordCount )->
     setApplyDefaultValue( 0 )->
     setInputFlag( InputFlags::FALSE )->
@@ -39,7 +62,7 @@ void TimeHistoryOutput::initCollectorParallel( ProblemManager & pm, HistoryColle
   for( localIndex ii = 0; ii < collector->getCollectionCount( ); ++ii )
   {
     HistoryMetadata metadata = collector->getMetadata( pm, ii );
-    m_io.emplace_back( std::make_unique< HDFHistIO >( m_filename, metadata, m_recordCount ) );
+    m_io.emplace_back( std::make_unique< HDFHistIO >( m_filename, metadata, m_recordCount, m_chunkSize ) );
     collector->registerBufferCall( ii, [this, ii]() { return m_io[ii]->getBufferHead( ); } );
     m_io.back()->init( !freshInit );
   }
@@ -47,7 +70,7 @@ void TimeHistoryOutput::initCollectorParallel( ProblemManager & pm, HistoryColle
   if( rnk == 0 )
   {
     HistoryMetadata timeMetadata = collector->getTimeMetadata( );
-    m_io.emplace_back( std::make_unique< HDFHistIO >( m_filename, timeMetadata, m_recordCount, 2, 2, MPI_COMM_SELF ) );
+    m_io.emplace_back( std::make_unique< HDFHistIO >( m_filename, timeMetadata, m_recordCount, m_chunkSize, 2, MPI_COMM_SELF ) );
     collector->registerTimeBufferCall( [this]() { return m_io.back()->getBufferHead( ); } );
     m_io.back()->init( !freshInit );
   }
@@ -78,6 +101,23 @@ void TimeHistoryOutput::initCollectorParallel( ProblemManager & pm, HistoryColle
   MpiWrapper::Barrier( MPI_COMM_GEOSX );
 }
 
+void TimeHistoryOutput::PostProcessInput()
+{
+  GEOSX_ERROR_IF_LT_MSG( m_chunkSize, 1, "The chunk size of " << getName() << " must be at least 1" );
+
+  if( m_asynchronous )
+  {
+    hbool_t threadSafe = 0;
+    H5is_library_threadsafe( &threadSafe );
+    if( !threadSafe || !MpiWrapper::Thread_multiple() )
+    {
+      GEOSX_WARNING( getName() << ": asynchronous time history output requires a thread-safe HDF5 library "
+                               << "and MPI_THREAD_MULTIPLE support, writing synchronously instead." );
+      m_asynchronous = 0;
+    }
+  }
+}
+
 void TimeHistoryOutput::InitializePostSubGroups( Group * const group )
 {
   {
@@ -107,11 +147,49 @@ void TimeHistoryOutput::Execute( real64 const GEOSX_UNUSED_PARAM( time_n ),
   for( auto & th_io : m_io )
   {
     GEOSX_ERROR_IF( newBuffered != th_io->getBufferedCount( ), "Inconsistent buffered time history count from single collector." );
-    th_io->write( );
+  }
+
+  if( m_asynchronous )
+  {
+    // the staged records of the previous flush must be written before staging new ones
+    waitForPendingFlush();
+    for( auto & th_io : m_io )
+    {
+      th_io->stage( );
+    }
+    std::shared_future< void > const previous = lastFlush;
+    m_pendingFlush = std::async( std::launch::async, [this, previous]()
+    {
+      if( previous.valid() )
+      {
+        previous.wait();
+      }
+      for( auto & th_io : m_io )
+      {
+        th_io->flush( );
+      }
+    } ).share();
+    lastFlush = m_pendingFlush;
+  }
+  else
+  {
+    for( auto & th_io : m_io )
+    {
+      th_io->write( );
+    }
   }
   m_recordCount += newBuffered;
 }
 
+void TimeHistoryOutput::waitForPendingFlush()
+{
+  if( m_pendingFlush.valid() )
+  {
+    m_pendingFlush.get();
+    m_pendingFlush = std::shared_future< void >();
+  }
+}
+
 void TimeHistoryOutput::Cleanup( real64 const time_n,
                                  integer const cycleNumber,
                                  integer const eventCounter,
@@ -119,6 +197,7 @@ void TimeHistoryOutput::Cleanup( real64 const time_n,
                                  dataRepository::Group * domain )
 {
   Execute( time_n, 0.0, cycleNumber, eventCounter, eventProgress, domain );
+  waitForPendingFlush();
   // remove any unused trailing space reserved to write additional histories
   for( auto & th_io : m_io )
   {
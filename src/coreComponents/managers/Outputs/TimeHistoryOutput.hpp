@@ -26,6 +26,8 @@
 
 #include "LvArray/src/Array.hpp" // just for collector
 
+#include <future>
+
 namespace geosx
 {
 
@@ -41,9 +43,11 @@ public:
   TimeHistoryOutput( string const & name,
                      Group * const parent );
 
-  /// Destructor
+  /// Destructor, waits for the records still being written in the background
   virtual ~TimeHistoryOutput() override
-  { }
+  {
+    waitForPendingFlush();
+  }
 
   /**
    * @brief Catalog name interface
@@ -88,11 +92,25 @@ public:
     static constexpr auto timeHistoryOutputFilename = "filename";
     static constexpr auto timeHistoryOutputFormat = "format";
     static constexpr auto timeHistoryRestart = "restart";
+    static constexpr auto chunkSizeString = "chunkSize";
+    static constexpr auto asynchronousString = "asynchronous";
   } timeHistoryOutputViewKeys;
   /// @endcond
 
+protected:
+
+  /**
+   * @brief Check the chunk size and fall back to synchronous writes if background writes are not supported.
+   */
+  virtual void PostProcessInput() override;
+
 private:
 
+  /**
+   * @brief Wait until the records handed to the background thread are written.
+   */
+  void waitForPendingFlush();
+
   /**
    * @brief Initialize a time history collector to write to an MPI comm-specific file collectively.
    * @param group The ProblemManager cast to a Group
@@ -108,8 +126,14 @@ private:
   string m_filename;
   /// The discrete number of time history states expected to be written to the file
   integer m_recordCount;
+  /// The number of history states per chunk in the file
+  integer m_chunkSize;
+  /// Whether the buffered states are written from a background thread
+  integer m_asynchronous;
   /// The buffered time history output objects for each collector to collect data into and to use to configure/write to file.
   std::vector< std::unique_ptr< BufferedHistoryIO > > m_io;
+  /// The background write of the staged states, if any
+  std::shared_future< void > m_pendingFlush;
 };
 }
 
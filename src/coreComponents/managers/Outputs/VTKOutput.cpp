@@ -50,6 +50,11 @@ VTKOutput::VTKOutput( std::string const & name,
     setInputFlag( InputFlags::OPTIONAL )->
     setDescription( "Output the data in binary format" );
 
+  registerWrapper( viewKeysStruct::cacheGeometryString, &m_cacheGeometry )->
+    setApplyDefaultValue( 1 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Keep the mesh geometry between outputs and only rebuild it when the size of a region changes" );
+
 }
 
 VTKOutput::~VTKOutput()
@@ -74,6 +79,7 @@ void VTKOutput::Execute( real64 const time_n,
     m_writer.SetOutputMode( vtk::VTKOutputMode::ASCII );
   }
   m_writer.SetPlotLevel( m_plotLevel );
+  m_writer.SetCacheGeometry( m_cacheGeometry );
   m_writer.Write( time_n, cycleNumber, *domainPartition );
 }
 
@@ -78,6 +78,7 @@ public:
     static constexpr auto writeFEMFaces = "writeFEMFaces";
     static constexpr auto plotLevel = "plotLevel";
     static constexpr auto binaryString = "writeBinaryData";
+    static constexpr auto cacheGeometryString = "cacheGeometry";
 
   } vtkOutputViewKeys;
   /// @endcond
@@ -89,6 +90,8 @@ private:
 
   integer m_writeBinaryData;
 
+  integer m_cacheGeometry;
+
   vtk::VTKPolyDataWriterInterface m_writer;
 
 };
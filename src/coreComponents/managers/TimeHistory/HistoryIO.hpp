@@ -37,7 +37,9 @@ public:
   BufferedHistoryIO():
     m_bufferedCount( 0 ),
     m_bufferHead( nullptr ),
-    m_dataBuffer( 0 )
+    m_dataBuffer( 0 ),
+    m_stagedCount( 0 ),
+    m_stagedBuffer( 0 )
   {}
 
   /// Destructor
@@ -67,7 +69,33 @@ public:
   /**
    * @brief Write the buffered history data to the output target.
    */
-  virtual void write( ) = 0;
+  virtual void write( )
+  {
+    stage( );
+    flush( );
+  }
+
+  /**
+   * @brief Move the buffered history states aside to be written by flush(), and empty the collection buffer.
+   * @details Collection into the buffer can resume as soon as this returns, while flush() writes the staged
+   *          states, possibly on another thread. The previous flush() must have completed.
+   */
+  void stage( )
+  {
+    m_stagedBuffer.swap( m_dataBuffer );
+    m_stagedCount = m_bufferedCount;
+    if( m_dataBuffer.size() < m_stagedBuffer.size() )
+    {
+      m_dataBuffer.resize( m_stagedBuffer.size() );
+    }
+    emptyBuffer( );
+  }
+
+  /**
+   * @brief Write the staged history states to the output target.
+   * @note Does not touch the collection buffer, so it is safe to call while collection continues.
+   */
+  virtual void flush( ) = 0;
 
   /**
    * @brief Ensure the repressentation of the data in the output target is dense and terse.
@@ -97,6 +125,10 @@ protected:
   buffer_unit_type * m_bufferHead;
   /// The data buffer containing the history info
   buffer_type m_dataBuffer;
+  /// The number of records staged to be written by flush()
+  localIndex m_stagedCount;
+  /// The buffer holding the records staged to be written by flush()
+  buffer_type m_stagedBuffer;
 };
 
 }
@@ -350,6 +350,96 @@ TEST( FunctionTests, 4DTable_multipleInputs )
 
 
 
+void checkKernelWrapper( TableFunction & table,
+                         localIndex const numDims )
+{
+  localIndex const Ntest = 200;
+
+  // Setup test points, including points outside of the table and on its vertices
+  std::default_random_engine generator;
+  std::uniform_real_distribution< double > distribution( -1.5, 1.5 );
+
+  array2d< real64 > input( Ntest, numDims );
+  for( localIndex ii=0; ii<Ntest; ++ii )
+  {
+    for( localIndex jj=0; jj<numDims; ++jj )
+    {
+      real64_array const & axis = table.getCoordinates()[jj];
+      input[ii][jj] = ( ii % 4 == 0 ) ? axis[ii % axis.size()] : distribution( generator );
+    }
+  }
+
+  real64_array output( Ntest );
+
+  for( TableFunction::InterpolationType const method : { TableFunction::InterpolationType::Linear,
+                                                         TableFunction::InterpolationType::Upper,
+                                                         TableFunction::InterpolationType::Lower,
+                                                         TableFunction::InterpolationType::Nearest } )
+  {
+    table.setInterpolationMethod( method );
+    table.evaluateBatch< parallelDevicePolicy<> >( input.toViewConst(), output.toView() );
+    output.move( LvArray::MemorySpace::CPU );
+
+    for( localIndex ii=0; ii<Ntest; ++ii )
+    {
+      ASSERT_NEAR( table.Evaluate( &input[ii][0] ), output[ii], 1e-12 );
+    }
+  }
+}
+
+
+
+TEST( FunctionTests, KernelWrapper )
+{
+  FunctionManager * functionManager = &FunctionManager::FunctionManager::Instance();
+
+  // 1D table with evenly spaced coordinates
+  {
+    array1d< real64_array > coordinates( 1 );
+    real64_array values( 11 );
+    for( localIndex ii=0; ii<11; ++ii )
+    {
+      coordinates[0].emplace_back( -1.0 + 0.2 * ii );
+      values[ii] = ii * ii;
+    }
+
+    TableFunction * table = functionManager->CreateChild( "TableFunction", "table_uniform" )->group_cast< TableFunction * >();
+    table->setTableCoordinates( coordinates );
+    table->setTableValues( values );
+    table->reInitializeFunction();
+    checkKernelWrapper( *table, 1 );
+  }
+
+  // 3D table with unevenly spaced coordinates along some of the axes
+  {
+    array1d< real64_array > coordinates( 3 );
+    coordinates[0].emplace_back( -1.0 );
+    coordinates[0].emplace_back( 0.0 );
+    coordinates[0].emplace_back( 1.0 );
+    coordinates[1].emplace_back( -1.0 );
+    coordinates[1].emplace_back( -0.1 );
+    coordinates[1].emplace_back( 0.5 );
+    coordinates[1].emplace_back( 1.0 );
+    coordinates[2].emplace_back( -1.0 );
+    coordinates[2].emplace_back( 0.3 );
+    coordinates[2].emplace_back( 1.0 );
+
+    real64_array values( 3 * 4 * 3 );
+    for( localIndex ii=0; ii<values.size(); ++ii )
+    {
+      values[ii] = std::sin( 0.7 * ii );
+    }
+
+    TableFunction * table = functionManager->CreateChild( "TableFunction", "table_nonuniform" )->group_cast< TableFunction * >();
+    table->setTableCoordinates( coordinates );
+    table->setTableValues( values );
+    table->reInitializeFunction();
+    checkKernelWrapper( *table, 3 );
+  }
+}
+
+
+
 #ifdef GEOSX_USE_MATHPRESSO
 
 TEST( FunctionTests, 4DTable_symbolic )
@@ -429,6 +519,121 @@ TEST( FunctionTests, 4DTable_symbolic )
   {
     ASSERT_NEAR( expected[jj], output[jj], 1e-10 );
   }
+
+  // Evaluate the function directly on a batch of inputs
+  array2d< real64 > input( Ntest, 4 );
+  for( localIndex jj=0; jj<Ntest; ++jj )
+  {
+    input[jj][0] = inputA[jj];
+    input[jj][1] = inputB[jj];
+    input[jj][2] = inputC[jj];
+    input[jj][3] = inputD[jj];
+  }
+  output.setValues< serialPolicy >( 0.0 );
+  FunctionBase const * const function = table_d;
+  function->evaluateBatch( input.toViewConst(), output.toView() );
+
+  for( localIndex jj=0; jj<Ntest; ++jj )
+  {
+    ASSERT_NEAR( expected[jj], output[jj], 1e-10 );
+  }
+}
+
+TEST( FunctionTests, CompositeFunction_batch )
+{
+  FunctionManager * functionManager = &FunctionManager::FunctionManager::Instance();
+  localIndex Ntest = 40;
+
+  string_array inputVarNames( 2 );
+  inputVarNames[0] = "a";
+  inputVarNames[1] = "b";
+
+  // Table of the first input
+  array1d< real64_array > coordinates;
+  coordinates.resize( 1 );
+  coordinates[0].resize( 3 );
+  coordinates[0][0] = -1.0;
+  coordinates[0][1] = 0.0;
+  coordinates[0][2] = 1.0;
+  real64_array values( 3 );
+  values[0] = 2.0;
+  values[1] = -1.0;
+  values[2] = 4.0;
+
+  string_array tableVarNames( 1 );
+  tableVarNames[0] = "a";
+  TableFunction * table_e = functionManager->CreateChild( "TableFunction", "table_e" )->group_cast< TableFunction * >();
+  table_e->setTableCoordinates( coordinates );
+  table_e->setTableValues( values );
+  table_e->setInputVarNames( tableVarNames );
+  table_e->reInitializeFunction();
+
+  // Symbolic function of both inputs
+  SymbolicFunction * symbolic_e = functionManager->CreateChild( "SymbolicFunction", "symbolic_e" )->group_cast< SymbolicFunction * >();
+  symbolic_e->setSymbolicExpression( "a*b-3.0*b*b" );
+  symbolic_e->setInputVarNames( inputVarNames );
+  symbolic_e->setSymbolicVariableNames( inputVarNames );
+  symbolic_e->InitializeFunction();
+
+  // Composite of the two
+  string_array functionNames( 2 );
+  functionNames[0] = "table_e";
+  functionNames[1] = "symbolic_e";
+  string_array variableNames( 2 );
+  variableNames[0] = "f";
+  variableNames[1] = "g";
+  FunctionBase * composite = functionManager->CreateChild( "CompositeFunction", "composite_e" )->group_cast< FunctionBase * >();
+  composite->getReference< string_array >( "functionNames" ) = functionNames;
+  composite->getReference< string_array >( "variableNames" ) = variableNames;
+  composite->getReference< string >( "expression" ) = "f+2.0*g*g";
+  composite->setInputVarNames( inputVarNames );
+  composite->InitializeFunction();
+
+  // Setup a group holding the arguments
+  dataRepository::Group testGroup( "testGroup", nullptr );
+  real64_array inputA;
+  real64_array inputB;
+  testGroup.registerWrapper( inputVarNames[0], &inputA )->setSizedFromParent( 1 );
+  testGroup.registerWrapper( inputVarNames[1], &inputB )->setSizedFromParent( 1 );
+  testGroup.resize( Ntest );
+
+  std::default_random_engine generator;
+  std::uniform_real_distribution< double > distribution( -1.0, 1.0 );
+  for( localIndex ii=0; ii<Ntest; ++ii )
+  {
+    inputA[ii] = distribution( generator );
+    inputB[ii] = distribution( generator );
+  }
+
+  // Every third object, so that results are indexed by set position rather than object index
+  SortedArray< localIndex > set;
+  for( localIndex ii=0; ii<Ntest; ii+=3 )
+  {
+    set.insert( ii );
+  }
+
+  real64_array output( set.size() );
+  composite->Evaluate( &testGroup, 0.0, set.toView(), output );
+
+  array2d< real64 > input( set.size(), 2 );
+  for( localIndex jj=0; jj<set.size(); ++jj )
+  {
+    real64 const point[2] = { inputA[set[jj]], inputB[set[jj]] };
+    real64 const expected = composite->Evaluate( point );
+    ASSERT_NEAR( expected, output[jj], 1e-12 );
+
+    input[jj][0] = point[0];
+    input[jj][1] = point[1];
+  }
+
+  // Evaluate the function directly on a batch of inputs
+  real64_array batchOutput( set.size() );
+  composite->evaluateBatch( input.toViewConst(), batchOutput.toView() );
+
+  for( localIndex jj=0; jj<set.size(); ++jj )
+  {
+    ASSERT_NEAR( output[jj], batchOutput[jj], 1e-12 );
+  }
 }
 
 #endif
@@ -23,6 +23,13 @@
 #include "mesh/FaceManager.hpp"
 #include "mesh/CellElementSubRegion.hpp"
 
+#if defined( GEOSX_USE_OPENMP )
+#include <omp.h>
+#endif
+
+#include <chrono>
+#include <set>
+
 
 using namespace geosx;
 
@@ -539,6 +546,115 @@ TEST_F( MeshGenerationTest, edgeFaceMaps )
   }
 }
 
+TEST_F( MeshGenerationTest, elemToEdgeMap )
+{
+  arrayView2d< localIndex const, cells::NODE_MAP_USD > const & elemToNodeMap = m_subRegion->nodeList();
+  arrayView2d< localIndex const > const & elemToEdgeMap = m_subRegion->edgeList();
+  arrayView2d< localIndex const > const & edgeToNodeMap = m_edgeManager->nodeList();
+  ASSERT_EQ( elemToEdgeMap.size( 1 ), 12 );
+
+  for( localIndex elemID = 0; elemID < m_subRegion->size(); ++elemID )
+  {
+    std::set< localIndex > const elemNodes( &elemToNodeMap( elemID, 0 ), &elemToNodeMap( elemID, 0 ) + 8 );
+    std::set< localIndex > elemEdges;
+
+    for( localIndex a = 0; a < 12; ++a )
+    {
+      localIndex const edgeID = elemToEdgeMap( elemID, a );
+      elemEdges.insert( edgeID );
+      EXPECT_EQ( elemNodes.count( edgeToNodeMap( edgeID, 0 ) ), 1 );
+      EXPECT_EQ( elemNodes.count( edgeToNodeMap( edgeID, 1 ) ), 1 );
+    }
+
+    EXPECT_EQ( elemEdges.size(), 12 );
+  }
+}
+
+TEST_F( MeshGenerationTest, threadIndependentMaps )
+{
+  ElementRegionManager * const elemManager = problemManager->getDomainPartition()->getMeshBody( 0 )->getMeshLevel( 0 )->getElemManager();
+
+  // Flatten all the maps built from the element to node map into a single list.
+  auto flattenMaps = [&]()
+  {
+    std::vector< localIndex > maps;
+    auto appendArrayOfArrays = [&maps]( auto const & map )
+    {
+      for( localIndex i = 0; i < map.size(); ++i )
+      {
+        maps.push_back( map.sizeOfArray( i ) );
+        for( localIndex j = 0; j < map.sizeOfArray( i ); ++j )
+        {
+          maps.push_back( map[ i ][ j ] );
+        }
+      }
+    };
+    auto appendArray2d = [&maps]( arrayView2d< localIndex const > const & map )
+    {
+      maps.insert( maps.end(), map.data(), map.data() + map.size() );
+    };
+
+    NodeManager const & nodeManager = *m_nodeManager;
+    FaceManager const & faceManager = *m_faceManager;
+    EdgeManager const & edgeManager = *m_edgeManager;
+
+    appendArrayOfArrays( nodeManager.elementRegionList() );
+    appendArrayOfArrays( nodeManager.elementSubRegionList() );
+    appendArrayOfArrays( nodeManager.elementList() );
+    appendArrayOfArrays( nodeManager.faceList().toViewConst() );
+    appendArrayOfArrays( nodeManager.edgeList().toViewConst() );
+    appendArrayOfArrays( faceManager.nodeList().toViewConst() );
+    appendArrayOfArrays( faceManager.edgeList().toViewConst() );
+    appendArray2d( faceManager.elementRegionList() );
+    appendArray2d( faceManager.elementSubRegionList() );
+    appendArray2d( faceManager.elementList() );
+    appendArray2d( edgeManager.nodeList() );
+    appendArrayOfArrays( edgeManager.faceList().toViewConst() );
+    appendArray2d( m_subRegion->faceList() );
+    appendArray2d( m_subRegion->edgeList() );
+    return maps;
+  };
+
+  // Time a single map builder.
+  auto timeBuilder = [&]( string const & name, auto && builder )
+  {
+    auto const start = std::chrono::steady_clock::now();
+    builder();
+    std::chrono::duration< double > const elapsed = std::chrono::steady_clock::now() - start;
+    GEOSX_LOG_RANK_0( "  " << name << ": " << elapsed.count() << " s" );
+  };
+
+  std::vector< localIndex > const referenceMaps = flattenMaps();
+
+#if defined( GEOSX_USE_OPENMP )
+  int const maxThreads = omp_get_max_threads();
+  std::vector< int > const threadCounts{ 1, maxThreads };
+#else
+  std::vector< int > const threadCounts{ 1 };
+#endif
+
+  // Rebuild the maps with a varying number of threads, the result must not change.
+  for( int const numThreads : threadCounts )
+  {
+#if defined( GEOSX_USE_OPENMP )
+    omp_set_num_threads( numThreads );
+#endif
+    GEOSX_LOG_RANK_0( "Building the mesh maps with " << numThreads << " thread(s):" );
+    timeBuilder( "SetElementMaps", [&]() { m_nodeManager->SetElementMaps( elemManager ); } );
+    timeBuilder( "BuildFaces", [&]() { m_faceManager->BuildFaces( m_nodeManager, elemManager ); } );
+    timeBuilder( "SetFaceMaps", [&]() { m_nodeManager->SetFaceMaps( m_faceManager ); } );
+    timeBuilder( "BuildEdges", [&]() { m_edgeManager->BuildEdges( m_faceManager, m_nodeManager ); } );
+    timeBuilder( "SetEdgeMaps", [&]() { m_nodeManager->SetEdgeMaps( m_edgeManager ); } );
+    timeBuilder( "GenerateCellToEdgeMaps", [&]() { elemManager->GenerateCellToEdgeMaps( m_faceManager ); } );
+
+    EXPECT_TRUE( flattenMaps() == referenceMaps );
+  }
+
+#if defined( GEOSX_USE_OPENMP )
+  omp_set_num_threads( maxThreads );
+#endif
+}
+
 int main( int argc, char * * argv )
 {
   ::testing::InitGoogleTest( &argc, argv );
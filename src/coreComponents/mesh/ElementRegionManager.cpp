@@ -141,37 +141,38 @@ void ElementRegionManager::GenerateMesh( Group * const cellBlockManager )
 
 void ElementRegionManager::GenerateCellToEdgeMaps( FaceManager const * const faceManager )
 {
+  GEOSX_MARK_FUNCTION;
+
   /*
    * Create cell to edges map
    * I use the existing maps from cells to faces and from faces to edges.
+   * Each cell only writes its own row, so the cells are processed in parallel.
    */
-  localIndex faceIndex, edgeIndex;
-  int count = 0;
-  bool isUnique = true;
+  ArrayOfArraysView< localIndex const > const & faceToEdges = faceManager->edgeList().toViewConst();
 
   this->forElementSubRegions< CellElementSubRegion >( [&]( CellElementSubRegion & subRegion )
   {
-    FixedOneToManyRelation & cellToEdges = subRegion.edgeList();
-    FixedOneToManyRelation const & cellToFaces = subRegion.faceList();
-    InterObjectRelation< ArrayOfArrays< localIndex > > const & faceToEdges = faceManager->edgeList();
+    arrayView2d< localIndex > const & cellToEdges = subRegion.edgeList();
+    arrayView2d< localIndex const > const & cellToFaces = subRegion.faceList();
+    localIndex const numFacesPerElement = subRegion.numFacesPerElement();
 
     //loop over the cells
-    for( localIndex kc = 0; kc < subRegion.size(); kc++ )
+    forAll< parallelHostPolicy >( subRegion.size(), [&, numFacesPerElement]( localIndex const kc )
     {
+      localIndex count = 0;
+
       // loop over the faces
-      // std::cout << "Element: " << kc << std::endl;
-      count = 0;
-      for( localIndex kf = 0; kf < subRegion.numFacesPerElement(); kf++ )
+      for( localIndex kf = 0; kf < numFacesPerElement; kf++ )
       {
         // loop over edges of each face
-        faceIndex = cellToFaces[kc][kf];
+        localIndex const faceIndex = cellToFaces[kc][kf];
         for( localIndex ke = 0; ke < faceToEdges.sizeOfArray( faceIndex ); ke++ )
         {
-          isUnique = true;
-          edgeIndex = faceToEdges[faceIndex][ke];
+          bool isUnique = true;
+          localIndex const edgeIndex = faceToEdges[faceIndex][ke];
 
           //loop over edges that have already been added to the element.
-          for( localIndex kec = 0; kec < count+1; kec++ )
+          for( localIndex kec = 0; kec < count; kec++ )
           {
             // make sure that the edge has not been counted yet
             if( cellToEdges( kc, kec ) == edgeIndex )
@@ -182,14 +183,13 @@ void ElementRegionManager::GenerateCellToEdgeMaps( FaceManager const * const fac
           }
           if( isUnique )
           {
-            // std::cout << edgeIndex << std::endl;
             cellToEdges( kc, count ) = edgeIndex;
             count++;
           }
 
         } // end edge loop
       } // end face loop
-    } // end cell loop
+    } ); // end cell loop
   } );
 }
 
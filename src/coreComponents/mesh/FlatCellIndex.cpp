@@ -0,0 +1,57 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file FlatCellIndex.cpp
+ */
+
+#include "FlatCellIndex.hpp"
+
+namespace geosx
+{
+
+FlatCellIndex::FlatCellIndex():
+  m_offsets(),
+  m_numElems( 0 )
+{}
+
+FlatCellIndex::FlatCellIndex( ElementRegionManager const & elemManager ):
+  FlatCellIndex()
+{
+  compute( elemManager );
+}
+
+void FlatCellIndex::compute( ElementRegionManager const & elemManager )
+{
+  localIndex maxNumSubRegions = 0;
+  for( localIndex er = 0; er < elemManager.numRegions(); ++er )
+  {
+    maxNumSubRegions = std::max( maxNumSubRegions, elemManager.GetRegion( er )->numSubRegions() );
+  }
+
+  m_offsets.resize( elemManager.numRegions(), maxNumSubRegions );
+  m_offsets.setValues< serialPolicy >( -1 );
+
+  m_numElems = 0;
+  elemManager.forElementSubRegionsComplete< ElementSubRegionBase >( [&]( localIndex const er,
+                                                                         localIndex const esr,
+                                                                         ElementRegionBase const &,
+                                                                         ElementSubRegionBase const & subRegion )
+  {
+    m_offsets( er, esr ) = m_numElems;
+    m_numElems += subRegion.size();
+  } );
+}
+
+} /* namespace geosx */
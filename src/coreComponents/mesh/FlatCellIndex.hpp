@@ -0,0 +1,185 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file FlatCellIndex.hpp
+ */
+
+#ifndef GEOSX_MESH_FLATCELLINDEX_HPP_
+#define GEOSX_MESH_FLATCELLINDEX_HPP_
+
+#include "mesh/ElementRegionManager.hpp"
+#include "rajaInterface/GEOS_RAJA_Interface.hpp"
+
+namespace geosx
+{
+
+/**
+ * @class FlatCellIndex
+ * @brief Contiguous ("flat") numbering of the elements of all element subregions of a mesh level.
+ *
+ * Elements are numbered subregion by subregion, in region/subregion order, and include ghost elements.
+ * Surface subregions are numbered as well, since the cell stencils of flux approximations also connect
+ * cells to fracture and embedded surface elements.
+ * The numbering only depends on the element regions, so any two instances built from the same
+ * ElementRegionManager agree. Field data addressed through ElementViewAccessor can be gathered
+ * into flat arrays, which lets kernels address elements with a single index instead of the
+ * region/subregion/element triple.
+ */
+class FlatCellIndex
+{
+public:
+
+  /**
+   * @brief Default constructor, creates an empty numbering.
+   */
+  FlatCellIndex();
+
+  /**
+   * @brief Constructor.
+   * @param elemManager the element region manager whose elements are numbered
+   */
+  explicit FlatCellIndex( ElementRegionManager const & elemManager );
+
+  /**
+   * @brief (Re)compute the numbering.
+   * @param elemManager the element region manager whose elements are numbered
+   */
+  void compute( ElementRegionManager const & elemManager );
+
+  /**
+   * @brief Get the number of elements in the numbering.
+   * @return the number of elements
+   */
+  localIndex numElems() const
+  { return m_numElems; }
+
+  /**
+   * @brief Get the offsets of the subregions in the numbering.
+   * @return a view of the offsets, indexed by [er][esr] (-1 past the last subregion of a region)
+   */
+  arrayView2d< localIndex const > offsets() const
+  { return m_offsets.toViewConst(); }
+
+  /**
+   * @brief Get the flat index of an element.
+   * @param er the region index
+   * @param esr the subregion index
+   * @param ei the element index in the subregion
+   * @return the flat index
+   */
+  localIndex operator()( localIndex const er, localIndex const esr, localIndex const ei ) const
+  {
+    GEOSX_ASSERT_GE( m_offsets( er, esr ), 0 );
+    return m_offsets( er, esr ) + ei;
+  }
+
+  /**
+   * @brief Gather an element-based field into a flat array.
+   * @tparam T the value type
+   * @param src the field, as accessed through an ElementViewAccessor
+   * @param dst the flat array, resized to the number of elements
+   *
+   * Entries of subregions on which the field is not registered are left untouched.
+   * The copy runs with the device policy, so @p dst ends up where the field data lives and
+   * can be read by device kernels without a round trip to the host.
+   */
+  template< typename T >
+  void gather( ElementRegionManager::ElementViewConst< arrayView1d< T const > > const & src,
+               array1d< T > & dst ) const;
+
+  /**
+   * @brief Gather an element-based two-dimensional field into a flat array.
+   * @tparam T the value type
+   * @param src the field, as accessed through an ElementViewAccessor
+   * @param dst the flat array, resized to the number of elements along the first dimension
+   */
+  template< typename T >
+  void gather( ElementRegionManager::ElementViewConst< arrayView2d< T const > > const & src,
+               array2d< T > & dst ) const;
+
+private:
+
+  /// Offset of each subregion, indexed by [er][esr]
+  array2d< localIndex > m_offsets;
+
+  /// Total number of elements
+  localIndex m_numElems;
+};
+
+template< typename T >
+void FlatCellIndex::gather( ElementRegionManager::ElementViewConst< arrayView1d< T const > > const & src,
+                            array1d< T > & dst ) const
+{
+  dst.resize( m_numElems );
+  arrayView1d< T > const dstView = dst.toView();
+
+  for( localIndex er = 0; er < m_offsets.size( 0 ); ++er )
+  {
+    for( localIndex esr = 0; esr < m_offsets.size( 1 ); ++esr )
+    {
+      localIndex const offset = m_offsets( er, esr );
+      if( offset < 0 || esr >= src[er].size() || src[er][esr].size() == 0 )
+      {
+        continue;
+      }
+      arrayView1d< T const > const srcView = src[er][esr];
+      forAll< parallelDevicePolicy<> >( srcView.size(), [=] GEOSX_HOST_DEVICE ( localIndex const ei )
+      {
+        dstView[offset + ei] = srcView[ei];
+      } );
+    }
+  }
+}
+
+template< typename T >
+void FlatCellIndex::gather( ElementRegionManager::ElementViewConst< arrayView2d< T const > > const & src,
+                            array2d< T > & dst ) const
+{
+  localIndex numComp = 0;
+  for( localIndex er = 0; er < src.size(); ++er )
+  {
+    for( localIndex esr = 0; esr < src[er].size(); ++esr )
+    {
+      numComp = std::max( numComp, src[er][esr].size( 1 ) );
+    }
+  }
+
+  dst.resize( m_numElems, numComp );
+  arrayView2d< T > const dstView = dst.toView();
+
+  for( localIndex er = 0; er < m_offsets.size( 0 ); ++er )
+  {
+    for( localIndex esr = 0; esr < m_offsets.size( 1 ); ++esr )
+    {
+      localIndex const offset = m_offsets( er, esr );
+      if( offset < 0 || esr >= src[er].size() || src[er][esr].size() == 0 )
+      {
+        continue;
+      }
+      arrayView2d< T const > const srcView = src[er][esr];
+      forAll< parallelDevicePolicy<> >( srcView.size( 0 ), [=] GEOSX_HOST_DEVICE ( localIndex const ei )
+      {
+        for( localIndex ic = 0; ic < srcView.size( 1 ); ++ic )
+        {
+          dstView( offset + ei, ic ) = srcView( ei, ic );
+        }
+      } );
+    }
+  }
+}
+
+} /* namespace geosx */
+
+#endif /* GEOSX_MESH_FLATCELLINDEX_HPP_ */
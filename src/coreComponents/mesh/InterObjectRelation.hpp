@@ -85,7 +85,7 @@ public:
    * @brief Get the GlobalToLocal mapping from the related object.
    * @return The GlobalToLocal mapping from the related object.
    */
-  unordered_map< globalIndex, localIndex > const & RelatedObjectGlobalToLocal() const
+  indexMap< globalIndex, localIndex > const & RelatedObjectGlobalToLocal() const
   { return this->m_relatedObject->globalToLocalMap(); }
 
 private:
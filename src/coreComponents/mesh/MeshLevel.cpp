@@ -22,6 +22,7 @@
 #include "NodeManager.hpp"
 //#include "EdgeManager.hpp"
 #include "FaceManager.hpp"
+#include "mpiCommunications/SyncPlan.hpp"
 
 namespace geosx
 {
@@ -34,7 +35,9 @@ MeshLevel::MeshLevel( string const & name,
   m_edgeManager( groupStructKeys::edgeManagerString, this ),
   m_faceManager( groupStructKeys::faceManagerString, this ),
   m_elementManager( groupStructKeys::elemManagerString, this ),
-  m_embSurfEdgeManager( groupStructKeys::embSurfEdgeManagerString, this )
+  m_embSurfEdgeManager( groupStructKeys::embSurfEdgeManagerString, this ),
+  m_syncPlans(),
+  m_topologyVersion( 0 )
 
 {
 
@@ -24,9 +24,13 @@
 #include "ElementRegionManager.hpp"
 #include "FaceManager.hpp"
 
+#include <map>
+#include <memory>
+
 namespace geosx
 {
 class ElementRegionManager;
+class SyncPlan;
 
 /**
  * @class MeshLevel
@@ -153,6 +157,24 @@ public:
    */
   EdgeManager & getEmbdSurfEdgeManager()             { return m_embSurfEdgeManager; }
 
+  /**
+   * @brief Get the communication plans used to synchronize fields on this mesh level.
+   * @return a map from plan key (see SyncPlan::key()) to the cached plan
+   */
+  std::map< string, std::unique_ptr< SyncPlan > > & getSyncPlans() { return m_syncPlans; }
+
+  /**
+   * @brief Get the version of the parallel topology (mesh objects and ghost lists) of this mesh level.
+   * @return a counter incremented by modifiedTopology()
+   */
+  integer topologyVersion() const { return m_topologyVersion; }
+
+  /**
+   * @brief Mark the parallel topology of this mesh level as modified, invalidating the cached plans.
+   * @note Must be called collectively, since the plans of neighboring ranks are rebuilt together.
+   */
+  void modifiedTopology() { ++m_topologyVersion; }
+
   ///@}
 
 private:
@@ -167,6 +189,10 @@ private:
   ElementRegionManager m_elementManager;
   /// Manager for embedded surfaces edge data
   EdgeManager m_embSurfEdgeManager;
+  /// Cached communication plans for repeated field synchronizations
+  std::map< string, std::unique_ptr< SyncPlan > > m_syncPlans;
+  /// Version of the parallel topology, used to invalidate the cached communication plans
+  integer m_topologyVersion;
 
 };
 
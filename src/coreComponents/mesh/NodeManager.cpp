@@ -23,12 +23,35 @@
 #include "BufferOps.hpp"
 #include "common/TimingMacros.hpp"
 #include "ElementRegionManager.hpp"
+#include "rajaInterface/GEOS_RAJA_Interface.hpp"
+
+#include <algorithm>
 
 namespace geosx
 {
 
 using namespace dataRepository;
 
+namespace
+{
+
+/// An element attached to a node, ordered by region, subregion and index.
+struct NodeElement
+{
+  localIndex er;
+  localIndex esr;
+  localIndex k;
+
+  bool operator<( NodeElement const & rhs ) const
+  {
+    if( er != rhs.er ) return er < rhs.er;
+    if( esr != rhs.esr ) return esr < rhs.esr;
+    return k < rhs.k;
+  }
+};
+
+}
+
 // *********************************************************************************************************************
 /**
  * @return
@@ -228,24 +251,51 @@ void NodeManager::SetElementMaps( ElementRegionManager const * const elementRegi
     toElementList.setCapacityOfArray( nodeID, elemsPerNode[ nodeID ] + getElemMapOverAllocation() );
   }
 
-  // Populate the element maps.
-  // Note that this can't be done in parallel because the three element lists must be in the same order.
-  // If this becomes a bottleneck create a temporary ArrayOfArrays of tuples and insert into that first then copy over.
+  // Offsets of each node in a flat list of the attached elements.
+  array1d< localIndex > nodeElemOffsets( numNodes + 1 );
+  nodeElemOffsets[ 0 ] = 0;
+  forAll< parallelHostPolicy >( numNodes, [&nodeElemOffsets, &elemsPerNode]( localIndex const nodeID )
+  {
+    nodeElemOffsets[ nodeID + 1 ] = elemsPerNode[ nodeID ];
+  } );
+  RAJA::inclusive_scan_inplace< parallelHostPolicy >( nodeElemOffsets.begin(), nodeElemOffsets.end() );
+
+  // Scatter the elements into the flat list, the slot of an element within a node is given by an atomic counter
+  // so the list of each node is in an arbitrary order at this point.
+  array1d< NodeElement > nodeElems( nodeElemOffsets[ numNodes ] );
+  elemsPerNode.setValues< serialPolicy >( 0 );
+
   elementRegionManager->
-    forElementSubRegionsComplete< CellElementSubRegion >( [&toElementRegionList, &toElementSubRegionList, &toElementList]
+    forElementSubRegionsComplete< CellElementSubRegion >( [&nodeElems, &nodeElemOffsets, &elemsPerNode]
                                                             ( localIndex const er, localIndex const esr, ElementRegionBase const &,
                                                             CellElementSubRegion const & subRegion )
   {
     arrayView2d< localIndex const, cells::NODE_MAP_USD > const elemToNodeMap = subRegion.nodeList();
-    for( localIndex k = 0; k < subRegion.size(); ++k )
+    localIndex const numIndependentNodes = subRegion.numIndependentNodesPerElement();
+    forAll< parallelHostPolicy >( subRegion.size(), [&, er, esr, numIndependentNodes]( localIndex const k )
     {
-      for( localIndex a=0; a<subRegion.numIndependentNodesPerElement(); ++a )
+      for( localIndex a = 0; a < numIndependentNodes; ++a )
       {
         localIndex const nodeIndex = elemToNodeMap( k, a );
-        toElementRegionList.emplaceBack( nodeIndex, er );
-        toElementSubRegionList.emplaceBack( nodeIndex, esr );
-        toElementList.emplaceBack( nodeIndex, k );
+        localIndex const slot = RAJA::atomicInc< parallelHostAtomic >( &elemsPerNode[ nodeIndex ] );
+        nodeElems[ nodeElemOffsets[ nodeIndex ] + slot ] = { er, esr, k };
       }
+    } );
+  } );
+
+  // Sort the elements of each node and populate the element maps. Sorting by (region, subregion, element)
+  // gives the order of a serial traversal of the subregions, so the maps don't depend on the number of threads.
+  forAll< parallelHostPolicy >( numNodes, [&]( localIndex const nodeID )
+  {
+    NodeElement * const first = nodeElems.data() + nodeElemOffsets[ nodeID ];
+    NodeElement * const last = nodeElems.data() + nodeElemOffsets[ nodeID + 1 ];
+    std::sort( first, last );
+
+    for( NodeElement const * elem = first; elem != last; ++elem )
+    {
+      toElementRegionList.emplaceBack( nodeID, elem->er );
+      toElementSubRegionList.emplaceBack( nodeID, elem->esr );
+      toElementList.emplaceBack( nodeID, elem->k );
     }
   } );
 
@@ -0,0 +1,933 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+/**
+ * @file DistributedGmshReader.cpp
+ */
+
+#include "DistributedGmshReader.hpp"
+
+#include "common/IndexMap.hpp"
+#include "common/TimingMacros.hpp"
+#include "mesh/CellBlockManager.hpp"
+#include "mesh/NodeManager.hpp"
+#include "mpiCommunications/MpiWrapper.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <sstream>
+
+namespace geosx
+{
+
+using namespace dataRepository;
+
+namespace
+{
+
+/// Kinds of the records sent by the readers to the ranks owning them
+enum RecordKind : globalIndex
+{
+  nodeRecord,    ///< node number, followed by the coordinates
+  cellRecord,    ///< element number, physical tag, element type and node numbers
+  surfaceRecord, ///< node set index and node number
+  dataRecord     ///< imported field index and element number, followed by the values
+};
+
+/// Kinds of the sections made of one record per line
+enum class SectionKind : integer
+{
+  nodes,
+  elements,
+  elementData
+};
+
+/// A range of record lines in the file
+struct Section
+{
+  SectionKind kind;
+  std::streamoff begin;
+  std::streamoff end;
+  integer field;         ///< index of the imported field, for element data
+  integer numComponents; ///< number of values per element, for element data
+};
+
+/// What every rank needs to know about the file before the records are read
+struct FileLayout
+{
+  globalIndex numNodes = 0;
+  globalIndex numElements = 0;
+  std::vector< Section > sections;
+  std::map< integer, string > regionNames;
+  std::map< integer, string > surfaceNames;
+  std::vector< integer > fieldComponents;
+};
+
+/// A GMSH element type handled by the reader
+struct ElementType
+{
+  integer gmshType;
+  integer numNodes;
+  integer dimension;
+  char const * label;             ///< label used in the cell block names, as in the PAMELA import
+  char const * geosxType;         ///< GEOSX element type of the cells
+  std::array< integer, 8 > order; ///< GMSH node of each GEOSX node
+};
+
+ElementType const elementTypes[] =
+{
+  { 2, 3, 2, "TRIANGLE", "", { } },
+  { 3, 4, 2, "QUAD", "", { } },
+  { 4, 4, 3, "TETRA", "C3D4", { 0, 1, 2, 3 } },
+  { 5, 8, 3, "HEX", "C3D8", { 0, 1, 3, 2, 4, 5, 7, 6 } },
+  { 6, 6, 3, "WEDGE", "C3D6", { 0, 1, 2, 3, 4, 5 } },
+  { 7, 5, 3, "PYRAMID", "C3D5", { 0, 1, 2, 3, 4 } }
+};
+
+integer constexpr numElementTypes = sizeof( elementTypes ) / sizeof( elementTypes[0] );
+
+/// Region name of the cells without physical name, as in the PAMELA import
+char const * const defaultRegionName = "DEFAULT";
+
+integer findElementType( integer const gmshType )
+{
+  for( integer t = 0; t < numElementTypes; ++t )
+  {
+    if( elementTypes[t].gmshType == gmshType )
+    {
+      return t;
+    }
+  }
+  return -1;
+}
+
+/**
+ * @brief Rank owning an entity, the entities being distributed by blocks of consecutive numbers.
+ * @param number the GMSH number of the entity, starting at 1
+ * @param count the number of entities in the file
+ * @param numRanks the number of ranks
+ * @return the owning rank
+ */
+int ownerRank( globalIndex const number, globalIndex const count, int const numRanks )
+{
+  if( count <= 0 )
+  {
+    return 0;
+  }
+  globalIndex const rank = ( number - 1 ) * numRanks / count;
+  return LvArray::integerConversion< int >( std::max( globalIndex( 0 ), std::min( rank, globalIndex( numRanks - 1 ) ) ) );
+}
+
+globalIndex readInteger( char const * & cursor )
+{
+  char * end;
+  globalIndex const value = std::strtoll( cursor, &end, 10 );
+  cursor = end;
+  return value;
+}
+
+real64 readReal( char const * & cursor )
+{
+  char * end;
+  real64 const value = std::strtod( cursor, &end );
+  cursor = end;
+  return value;
+}
+
+string unquote( string const & text )
+{
+  std::size_t const first = text.find_first_not_of( " \t\"" );
+  std::size_t const last = text.find_last_not_of( " \t\"\r" );
+  return first == string::npos ? string() : text.substr( first, last - first + 1 );
+}
+
+/**
+ * @class LineReader
+ * @brief Sequential reading of the lines starting within a list of byte ranges of the file.
+ *
+ * A line belongs to the range in which it starts, so that consecutive ranges split between readers
+ * see every line exactly once.
+ */
+class LineReader
+{
+public:
+
+  /// A byte range and the section it belongs to
+  struct Range
+  {
+    std::streamoff begin;
+    std::streamoff end;
+    integer section;
+  };
+
+  LineReader( string const & filePath, std::vector< Range > ranges ):
+    m_file(),
+    m_ranges( std::move( ranges ) ),
+    m_current( 0 ),
+    m_started( false ),
+    m_offset( 0 ),
+    m_lineOffset( 0 )
+  {
+    if( !m_ranges.empty() )
+    {
+      m_file.open( filePath, std::ios::binary );
+      GEOSX_ERROR_IF( !m_file, "Could not open mesh file " << filePath );
+    }
+  }
+
+  bool done() const
+  {
+    return m_current >= m_ranges.size();
+  }
+
+  /**
+   * @brief Read the next line.
+   * @param line the line, without end of line characters
+   * @param section the section of the range the line belongs to
+   * @return false if all the ranges have been read
+   */
+  bool next( string & line, integer & section )
+  {
+    while( !done() )
+    {
+      Range const & range = m_ranges[m_current];
+      if( !m_started )
+      {
+        start( range.begin );
+      }
+      if( m_offset < range.end && std::getline( m_file, line ) )
+      {
+        m_lineOffset = m_offset;
+        m_offset += line.size() + 1;
+        if( !line.empty() && line.back() == '\r' )
+        {
+          line.pop_back();
+        }
+        section = range.section;
+        return true;
+      }
+      ++m_current;
+      m_started = false;
+    }
+    return false;
+  }
+
+  /// @return the offset of the last line read
+  std::streamoff lineOffset() const
+  {
+    return m_lineOffset;
+  }
+
+private:
+
+  void start( std::streamoff const begin )
+  {
+    m_file.clear();
+    m_offset = begin;
+    if( begin > 0 )
+    {
+      // the line crossing the beginning of the range belongs to the previous range
+      string partial;
+      m_file.seekg( begin - 1 );
+      std::getline( m_file, partial );
+      m_offset = begin + partial.size();
+    }
+    else
+    {
+      m_file.seekg( 0 );
+    }
+    m_started = true;
+  }
+
+  std::ifstream m_file;
+  std::vector< Range > m_ranges;
+  std::size_t m_current;
+  bool m_started;
+  std::streamoff m_offset;
+  std::streamoff m_lineOffset;
+};
+
+/**
+ * @brief Read the headers of the sections found by the readers.
+ * @param filePath path to the mesh file
+ * @param fileSize size of the file
+ * @param markers offset and text of the section markers (lines starting with '$'), sorted by offset
+ * @param fieldsToImport names of the element data fields to import
+ * @return the layout of the file
+ */
+FileLayout readLayout( string const & filePath,
+                       std::streamoff const fileSize,
+                       std::vector< std::pair< std::streamoff, string > > const & markers,
+                       string_array const & fieldsToImport )
+{
+  FileLayout layout;
+  layout.fieldComponents.resize( fieldsToImport.size(), 0 );
+
+  std::ifstream file( filePath, std::ios::binary );
+  GEOSX_ERROR_IF( !file, "Could not open mesh file " << filePath );
+
+  for( std::size_t m = 0; m < markers.size(); ++m )
+  {
+    string const & marker = markers[m].second;
+    std::streamoff const end = m + 1 < markers.size() ? markers[m + 1].first : fileSize;
+
+    file.clear();
+    file.seekg( markers[m].first );
+    string line;
+    std::getline( file, line );
+    std::streamoff begin = markers[m].first + line.size() + 1;
+
+    auto nextLine = [&]() -> string
+    {
+      std::getline( file, line );
+      begin += line.size() + 1;
+      return line;
+    };
+
+    if( marker == "$MeshFormat" )
+    {
+      std::istringstream format( nextLine() );
+      string version;
+      integer fileType = -1;
+      format >> version >> fileType;
+      GEOSX_ERROR_IF( version.compare( 0, 2, "2." ) != 0 || fileType != 0,
+                      "Only ASCII files in GMSH format 2 can be read in parallel, " << filePath << " has format " << version );
+    }
+    else if( marker == "$PhysicalNames" )
+    {
+      integer const numNames = std::stoi( nextLine() );
+      for( integer n = 0; n < numNames; ++n )
+      {
+        std::istringstream entry( nextLine() );
+        integer dimension, tag;
+        entry >> dimension >> tag;
+        string name;
+        std::getline( entry, name );
+        if( dimension == 3 )
+        {
+          layout.regionNames[tag] = unquote( name );
+        }
+        else if( dimension == 2 )
+        {
+          layout.surfaceNames[tag] = unquote( name );
+        }
+      }
+    }
+    else if( marker == "$Nodes" )
+    {
+      layout.numNodes = std::stoll( nextLine() );
+      layout.sections.push_back( { SectionKind::nodes, begin, end, -1, 0 } );
+    }
+    else if( marker == "$Elements" )
+    {
+      layout.numElements = std::stoll( nextLine() );
+      layout.sections.push_back( { SectionKind::elements, begin, end, -1, 0 } );
+    }
+    else if( marker == "$ElementData" )
+    {
+      std::vector< string > stringTags( std::stoi( nextLine() ) );
+      for( string & tag : stringTags )
+      {
+        tag = unquote( nextLine() );
+      }
+      integer const numRealTags = std::stoi( nextLine() );
+      for( integer n = 0; n < numRealTags; ++n )
+      {
+        nextLine();
+      }
+      std::vector< integer > integerTags( std::stoi( nextLine() ) );
+      for( integer & tag : integerTags )
+      {
+        tag = std::stoi( nextLine() );
+      }
+      GEOSX_ERROR_IF( stringTags.empty() || integerTags.size() < 2, "Invalid $ElementData header in " << filePath );
+
+      auto const it = std::find( fieldsToImport.begin(), fieldsToImport.end(), stringTags[0] );
+      if( it != fieldsToImport.end() )
+      {
+        integer const field = LvArray::integerConversion< integer >( std::distance( fieldsToImport.begin(), it ) );
+        layout.fieldComponents[field] = integerTags[1];
+        layout.sections.push_back( { SectionKind::elementData, begin, end, field, integerTags[1] } );
+      }
+    }
+  }
+
+  GEOSX_ERROR_IF( layout.numNodes == 0 || layout.numElements == 0, "No $Nodes or $Elements section in " << filePath );
+  for( localIndex f = 0; f < fieldsToImport.size(); ++f )
+  {
+    GEOSX_ERROR_IF( layout.fieldComponents[f] == 0, "Field " << fieldsToImport[f] << " not found in " << filePath );
+  }
+
+  return layout;
+}
+
+string packLayout( FileLayout const & layout )
+{
+  std::ostringstream stream;
+  stream << layout.numNodes << ' ' << layout.numElements << ' ' << layout.sections.size() << '\n';
+  for( Section const & section : layout.sections )
+  {
+    stream << static_cast< integer >( section.kind ) << ' ' << section.begin << ' ' << section.end << ' '
+           << section.field << ' ' << section.numComponents << '\n';
+  }
+  for( std::map< integer, string > const * const names : { &layout.regionNames, &layout.surfaceNames } )
+  {
+    stream << names->size() << '\n';
+    for( auto const & name : *names )
+    {
+      stream << name.first << ' ' << name.second << '\n';
+    }
+  }
+  stream << layout.fieldComponents.size();
+  for( integer const numComponents : layout.fieldComponents )
+  {
+    stream << ' ' << numComponents;
+  }
+  stream << '\n';
+  return stream.str();
+}
+
+FileLayout unpackLayout( string const & packed )
+{
+  FileLayout layout;
+  std::istringstream stream( packed );
+  std::size_t numSections;
+  stream >> layout.numNodes >> layout.numElements >> numSections;
+  layout.sections.resize( numSections );
+  for( Section & section : layout.sections )
+  {
+    integer kind;
+    stream >> kind >> section.begin >> section.end >> section.field >> section.numComponents;
+    section.kind = static_cast< SectionKind >( kind );
+  }
+  for( std::map< integer, string > * const names : { &layout.regionNames, &layout.surfaceNames } )
+  {
+    std::size_t numNames;
+    stream >> numNames;
+    for( std::size_t n = 0; n < numNames; ++n )
+    {
+      integer tag;
+      string name;
+      stream >> tag;
+      std::getline( stream, name );
+      ( *names )[tag] = name.empty() ? name : name.substr( 1 );
+    }
+  }
+  std::size_t numFields;
+  stream >> numFields;
+  layout.fieldComponents.resize( numFields );
+  for( integer & numComponents : layout.fieldComponents )
+  {
+    stream >> numComponents;
+  }
+  return layout;
+}
+
+} // namespace
+
+DistributedGmshReader::DistributedGmshReader( string const & filePath,
+                                              integer const numReaders,
+                                              localIndex const chunkSize ):
+  m_filePath( filePath ),
+  m_numReaders( numReaders ),
+  m_chunkSize( chunkSize )
+{}
+
+void DistributedGmshReader::read( string_array const & fieldsToImport,
+                                  string_array const & fieldNamesInGEOSX,
+                                  real64 const scale,
+                                  bool const reverseZ,
+                                  CellBlockManager & cellBlockManager,
+                                  NodeManager & nodeManager ) const
+{
+  GEOSX_MARK_FUNCTION;
+
+  int const rank = MpiWrapper::Comm_rank();
+  int const numRanks = MpiWrapper::Comm_size();
+
+  // the readers are spread over the ranks, to use the bandwidth of several compute nodes
+  integer const numReaders = std::max( 1, std::min( m_numReaders, numRanks ) );
+  integer readerIndex = -1;
+  for( integer r = 0; r < numReaders; ++r )
+  {
+    if( LvArray::integerConversion< int >( globalIndex( r ) * numRanks / numReaders ) == rank )
+    {
+      readerIndex = r;
+    }
+  }
+
+  GEOSX_LOG_RANK_0( "Reading " << m_filePath << " on " << numReaders << " of " << numRanks << " ranks" );
+
+  globalIndex fileSize = 0;
+  if( rank == 0 )
+  {
+    std::ifstream file( m_filePath, std::ios::binary | std::ios::ate );
+    GEOSX_ERROR_IF( !file, "Could not open mesh file " << m_filePath );
+    fileSize = file.tellg();
+  }
+  MpiWrapper::Broadcast( fileSize );
+
+  std::streamoff readerBegin = 0;
+  std::streamoff readerEnd = 0;
+  if( readerIndex >= 0 )
+  {
+    readerBegin = fileSize * readerIndex / numReaders;
+    readerEnd = fileSize * ( readerIndex + 1 ) / numReaders;
+  }
+
+  // 1. Locate the sections: each reader scans its byte range for the section markers, the headers are read on rank 0
+  FileLayout layout;
+  {
+    std::vector< std::vector< char > > markerBuffers( numRanks );
+    if( readerIndex >= 0 )
+    {
+      LineReader lines( m_filePath, { { readerBegin, readerEnd, -1 } } );
+      std::ostringstream markers;
+      string line;
+      integer section;
+      while( lines.next( line, section ) )
+      {
+        if( !line.empty() && line[0] == '$' )
+        {
+          markers << lines.lineOffset() << ' ' << line << '\n';
+        }
+      }
+      string const text = markers.str();
+      markerBuffers[0].assign( text.begin(), text.end() );
+    }
+
+    array1d< char > recvMarkers;
+    array1d< int > recvOffsets;
+    MpiWrapper::allToAllv( markerBuffers, recvMarkers, recvOffsets );
+
+    string packedLayout;
+    if( rank == 0 )
+    {
+      std::vector< std::pair< std::streamoff, string > > markers;
+      std::istringstream stream( string( recvMarkers.data(), recvMarkers.size() ) );
+      std::streamoff offset;
+      string marker;
+      while( stream >> offset >> marker )
+      {
+        markers.emplace_back( offset, marker );
+      }
+      std::sort( markers.begin(), markers.end() );
+      packedLayout = packLayout( readLayout( m_filePath, fileSize, markers, fieldsToImport ) );
+    }
+    MpiWrapper::Broadcast( packedLayout );
+    layout = unpackLayout( packedLayout );
+  }
+
+  integer const numFields = LvArray::integerConversion< integer >( layout.fieldComponents.size() );
+
+  // surfaces with the same name form a single node set
+  std::vector< string > setNames;
+  for( auto const & surface : layout.surfaceNames )
+  {
+    setNames.emplace_back( surface.second );
+  }
+  std::sort( setNames.begin(), setNames.end() );
+  setNames.erase( std::unique( setNames.begin(), setNames.end() ), setNames.end() );
+
+  std::map< integer, integer > setIndexOfTag;
+  for( auto const & surface : layout.surfaceNames )
+  {
+    setIndexOfTag[surface.first] =
+      LvArray::integerConversion< integer >( std::lower_bound( setNames.begin(), setNames.end(), surface.second ) - setNames.begin() );
+  }
+
+  // 2. Read the records chunk by chunk and send them to their owners
+  indexMap< globalIndex, localIndex > ownedNodeIndex;
+  std::vector< real64 > ownedNodeCoords;
+  std::vector< std::pair< globalIndex, integer > > ownedNodeSets;
+
+  std::vector< globalIndex > cellNumbers;
+  std::vector< integer > cellTags;
+  std::vector< integer > cellTypes;
+  std::vector< globalIndex > cellNodes;
+
+  std::vector< indexMap< globalIndex, localIndex > > dataIndex( numFields );
+  std::vector< std::vector< real64 > > dataValues( numFields );
+
+  {
+    std::vector< LineReader::Range > ranges;
+    if( readerIndex >= 0 )
+    {
+      for( std::size_t s = 0; s < layout.sections.size(); ++s )
+      {
+        std::streamoff const begin = std::max( readerBegin, layout.sections[s].begin );
+        std::streamoff const end = std::min( readerEnd, layout.sections[s].end );
+        if( begin < end )
+        {
+          ranges.push_back( { begin, end, LvArray::integerConversion< integer >( s ) } );
+        }
+      }
+      std::sort( ranges.begin(), ranges.end(), []( LineReader::Range const & a, LineReader::Range const & b )
+      {
+        return a.begin < b.begin;
+      } );
+    }
+    LineReader lines( m_filePath, std::move( ranges ) );
+
+    while( MpiWrapper::Max( integer( !lines.done() ) ) > 0 )
+    {
+      std::vector< std::vector< globalIndex > > indexBuffers( numRanks );
+      std::vector< std::vector< real64 > > valueBuffers( numRanks );
+
+      string line;
+      integer s;
+      for( localIndex n = 0; n < m_chunkSize && lines.next( line, s ); ++n )
+      {
+        Section const & section = layout.sections[s];
+        char const * cursor = line.c_str();
+        globalIndex const number = readInteger( cursor );
+        if( cursor == line.c_str() )
+        {
+          continue;
+        }
+
+        if( section.kind == SectionKind::nodes )
+        {
+          int const owner = ownerRank( number, layout.numNodes, numRanks );
+          indexBuffers[owner].insert( indexBuffers[owner].end(), { nodeRecord, number } );
+          for( integer d = 0; d < 3; ++d )
+          {
+            valueBuffers[owner].emplace_back( readReal( cursor ) );
+          }
+        }
+        else if( section.kind == SectionKind::elements )
+        {
+          integer const gmshType = LvArray::integerConversion< integer >( readInteger( cursor ) );
+          integer const numTags = LvArray::integerConversion< integer >( readInteger( cursor ) );
+          integer tag = 0;
+          for( integer t = 0; t < numTags; ++t )
+          {
+            integer const value = LvArray::integerConversion< integer >( readInteger( cursor ) );
+            tag = t == 0 ? value : tag;
+          }
+
+          integer const type = findElementType( gmshType );
+          if( type < 0 )
+          {
+            continue;
+          }
+
+          if( elementTypes[type].dimension == 3 )
+          {
+            int const owner = ownerRank( number, layout.numElements, numRanks );
+            indexBuffers[owner].insert( indexBuffers[owner].end(), { cellRecord, number, tag, type } );
+            for( integer a = 0; a < elementTypes[type].numNodes; ++a )
+            {
+              indexBuffers[owner].emplace_back( readInteger( cursor ) );
+            }
+          }
+          else if( setIndexOfTag.count( tag ) > 0 )
+          {
+            for( integer a = 0; a < elementTypes[type].numNodes; ++a )
+            {
+              globalIndex const node = readInteger( cursor );
+              int const owner = ownerRank( node, layout.numNodes, numRanks );
+              indexBuffers[owner].insert( indexBuffers[owner].end(), { surfaceRecord, setIndexOfTag.at( tag ), node } );
+            }
+          }
+        }
+        else
+        {
+          int const owner = ownerRank( number, layout.numElements, numRanks );
+          indexBuffers[owner].insert( indexBuffers[owner].end(), { dataRecord, section.field, number } );
+          for( integer c = 0; c < section.numComponents; ++c )
+          {
+            valueBuffers[owner].emplace_back( readReal( cursor ) );
+          }
+        }
+      }
+
+      array1d< globalIndex > recvIndices;
+      array1d< int > recvIndexOffsets;
+      array1d< real64 > recvValues;
+      array1d< int > recvValueOffsets;
+      MpiWrapper::allToAllv( indexBuffers, recvIndices, recvIndexOffsets );
+      MpiWrapper::allToAllv( valueBuffers, recvValues, recvValueOffsets );
+
+      // the index and value streams of a source rank hold the same records, in the same order
+      for( int r = 0; r < numRanks; ++r )
+      {
+        localIndex i = recvIndexOffsets[r];
+        localIndex v = recvValueOffsets[r];
+        while( i < recvIndexOffsets[r + 1] )
+        {
+          globalIndex const kind = recvIndices[i++];
+          if( kind == nodeRecord )
+          {
+            ownedNodeIndex[recvIndices[i++]] = LvArray::integerConversion< localIndex >( ownedNodeCoords.size() / 3 );
+            ownedNodeCoords.insert( ownedNodeCoords.end(), recvValues.data() + v, recvValues.data() + v + 3 );
+            v += 3;
+          }
+          else if( kind == cellRecord )
+          {
+            cellNumbers.emplace_back( recvIndices[i] );
+            cellTags.emplace_back( LvArray::integerConversion< integer >( recvIndices[i + 1] ) );
+            cellTypes.emplace_back( LvArray::integerConversion< integer >( recvIndices[i + 2] ) );
+            integer const numNodes = elementTypes[cellTypes.back()].numNodes;
+            cellNodes.insert( cellNodes.end(), recvIndices.data() + i + 3, recvIndices.data() + i + 3 + numNodes );
+            i += 3 + numNodes;
+          }
+          else if( kind == surfaceRecord )
+          {
+            ownedNodeSets.emplace_back( recvIndices[i + 1], LvArray::integerConversion< integer >( recvIndices[i] ) );
+            i += 2;
+          }
+          else
+          {
+            integer const field = LvArray::integerConversion< integer >( recvIndices[i] );
+            dataIndex[field][recvIndices[i + 1]] = LvArray::integerConversion< localIndex >( dataValues[field].size() );
+            dataValues[field].insert( dataValues[field].end(), recvValues.data() + v, recvValues.data() + v + layout.fieldComponents[field] );
+            v += layout.fieldComponents[field];
+            i += 2;
+          }
+        }
+      }
+    }
+  }
+
+  // 3. Fetch the coordinates and node sets of the nodes of the local cells from their owners
+  std::vector< globalIndex > localNodes( cellNodes.begin(), cellNodes.end() );
+  std::sort( localNodes.begin(), localNodes.end() );
+  localNodes.erase( std::unique( localNodes.begin(), localNodes.end() ), localNodes.end() );
+  localIndex const numLocalNodes = LvArray::integerConversion< localIndex >( localNodes.size() );
+
+  array1d< globalIndex > recvRequests;
+  array1d< int > recvRequestOffsets;
+  {
+    std::vector< std::vector< globalIndex > > requestBuffers( numRanks );
+    for( globalIndex const node : localNodes )
+    {
+      requestBuffers[ownerRank( node, layout.numNodes, numRanks )].emplace_back( node );
+    }
+    MpiWrapper::allToAllv( requestBuffers, recvRequests, recvRequestOffsets );
+  }
+
+  std::sort( ownedNodeSets.begin(), ownedNodeSets.end() );
+
+  // node numbers may have gaps: the owned nodes are numbered contiguously in the order of their numbers,
+  // after the nodes of the previous ranks, since each rank owns a contiguous range of node numbers
+  std::vector< globalIndex > ownedNodeNumbers;
+  ownedNodeNumbers.reserve( ownedNodeIndex.size() );
+  for( auto const & entry : ownedNodeIndex )
+  {
+    ownedNodeNumbers.emplace_back( entry.first );
+  }
+  std::sort( ownedNodeNumbers.begin(), ownedNodeNumbers.end() );
+  globalIndex const nodeOffset = MpiWrapper::PrefixSum< globalIndex >( ownedNodeNumbers.size() );
+
+  array1d< globalIndex > recvReplies;
+  array1d< int > recvReplyOffsets;
+  array1d< real64 > recvCoords;
+  array1d< int > recvCoordOffsets;
+  {
+    std::vector< std::vector< globalIndex > > replyBuffers( numRanks );
+    std::vector< std::vector< real64 > > coordBuffers( numRanks );
+    for( int r = 0; r < numRanks; ++r )
+    {
+      for( localIndex k = recvRequestOffsets[r]; k < recvRequestOffsets[r + 1]; ++k )
+      {
+        globalIndex const node = recvRequests[k];
+        auto const it = ownedNodeIndex.find( node );
+        GEOSX_ERROR_IF( it == ownedNodeIndex.end(), "Node " << node << " used by an element is missing from " << m_filePath );
+        coordBuffers[r].insert( coordBuffers[r].end(), ownedNodeCoords.data() + 3 * it->second, ownedNodeCoords.data() + 3 * it->second + 3 );
+        replyBuffers[r].emplace_back( nodeOffset + std::lower_bound( ownedNodeNumbers.begin(), ownedNodeNumbers.end(), node ) - ownedNodeNumbers.begin() );
+
+        auto const first = std::lower_bound( ownedNodeSets.begin(), ownedNodeSets.end(), std::make_pair( node, integer( 0 ) ) );
+        auto last = first;
+        while( last != ownedNodeSets.end() && last->first == node )
+        {
+          ++last;
+        }
+        replyBuffers[r].emplace_back( std::distance( first, last ) );
+        for( auto entry = first; entry != last; ++entry )
+        {
+          replyBuffers[r].emplace_back( entry->second );
+        }
+      }
+    }
+    MpiWrapper::allToAllv( replyBuffers, recvReplies, recvReplyOffsets );
+    MpiWrapper::allToAllv( coordBuffers, recvCoords, recvCoordOffsets );
+  }
+
+  // the owners' data is no longer needed
+  ownedNodeIndex.clear();
+  ownedNodeCoords.clear();
+  ownedNodeSets.clear();
+  ownedNodeNumbers.clear();
+
+  // 4. Fill the nodes
+  nodeManager.resize( numLocalNodes );
+  arrayView2d< real64, nodes::REFERENCE_POSITION_USD > const & X = nodeManager.referencePosition();
+  arrayView1d< globalIndex > const & nodeLocalToGlobal = nodeManager.localToGlobalMap();
+
+  Group & nodeSets = nodeManager.sets();
+  SortedArray< localIndex > & allNodes = nodeSets.registerWrapper< SortedArray< localIndex > >( string( "all" ) )->reference();
+  std::vector< SortedArray< localIndex > * > surfaceNodes;
+  for( string const & setName : setNames )
+  {
+    surfaceNodes.emplace_back( &nodeSets.registerWrapper< SortedArray< localIndex > >( setName )->reference() );
+  }
+
+  {
+    real64 const zFactor = reverseZ ? -1.0 : 1.0;
+    std::vector< localIndex > replyCursor( recvReplyOffsets.begin(), recvReplyOffsets.end() );
+    std::vector< localIndex > coordCursor( recvCoordOffsets.begin(), recvCoordOffsets.end() );
+    for( localIndex a = 0; a < numLocalNodes; ++a )
+    {
+      int const owner = ownerRank( localNodes[a], layout.numNodes, numRanks );
+      localIndex & c = coordCursor[owner];
+      X( a, 0 ) = recvCoords[c] * scale;
+      X( a, 1 ) = recvCoords[c + 1] * scale;
+      X( a, 2 ) = recvCoords[c + 2] * scale * zFactor;
+      c += 3;
+
+      localIndex & r = replyCursor[owner];
+      nodeLocalToGlobal[a] = recvReplies[r++];
+      globalIndex const numSets = recvReplies[r++];
+      for( globalIndex s = 0; s < numSets; ++s )
+      {
+        surfaceNodes[recvReplies[r++]]->insert( a );
+      }
+
+      allNodes.insert( a );
+    }
+  }
+
+  // 5. Fill the cell blocks, registered on all ranks: one per region name and cell type found in the file
+  std::vector< string > regionNames;
+  for( auto const & region : layout.regionNames )
+  {
+    regionNames.emplace_back( region.second );
+  }
+  regionNames.emplace_back( defaultRegionName );
+  std::sort( regionNames.begin(), regionNames.end() );
+  regionNames.erase( std::unique( regionNames.begin(), regionNames.end() ), regionNames.end() );
+  integer const numRegions = LvArray::integerConversion< integer >( regionNames.size() );
+
+  localIndex const numLocalCells = LvArray::integerConversion< localIndex >( cellNumbers.size() );
+  std::vector< integer > cellBlockIndex( numLocalCells );
+  std::vector< localIndex > localBlockSizes( numRegions * numElementTypes, 0 );
+  for( localIndex k = 0; k < numLocalCells; ++k )
+  {
+    auto const region = layout.regionNames.find( cellTags[k] );
+    string const & regionName = region != layout.regionNames.end() ? region->second : string( defaultRegionName );
+    integer const r = LvArray::integerConversion< integer >( std::lower_bound( regionNames.begin(), regionNames.end(), regionName ) - regionNames.begin() );
+    cellBlockIndex[k] = r * numElementTypes + cellTypes[k];
+    ++localBlockSizes[cellBlockIndex[k]];
+  }
+
+  // a block exists if it is not empty on at least one rank
+  std::vector< localIndex > maxBlockSizes( localBlockSizes.size() );
+  MpiWrapper::allReduce( localBlockSizes.data(),
+                         maxBlockSizes.data(),
+                         LvArray::integerConversion< int >( localBlockSizes.size() ),
+                         MPI_MAX,
+                         MPI_COMM_GEOSX );
+
+  // surface elements share the numbering of the cells, so the cells are numbered contiguously in the order of
+  // their element numbers, after the cells of the previous ranks, each rank holding a contiguous range of numbers
+  std::vector< globalIndex > sortedCellNumbers( cellNumbers );
+  std::sort( sortedCellNumbers.begin(), sortedCellNumbers.end() );
+  globalIndex const cellOffset = MpiWrapper::PrefixSum< globalIndex >( numLocalCells );
+
+  std::vector< localIndex > cellNodeOffsets( numLocalCells + 1, 0 );
+  for( localIndex k = 0; k < numLocalCells; ++k )
+  {
+    cellNodeOffsets[k + 1] = cellNodeOffsets[k] + elementTypes[cellTypes[k]].numNodes;
+  }
+
+  Group * const cellBlocks = cellBlockManager.GetGroup( keys::cellBlocks );
+  for( integer b = 0; b < numRegions * numElementTypes; ++b )
+  {
+    if( maxBlockSizes[b] == 0 )
+    {
+      continue;
+    }
+
+    ElementType const & type = elementTypes[b % numElementTypes];
+    CellBlock * const cellBlock = cellBlocks->RegisterGroup< CellBlock >( regionNames[b / numElementTypes] + "_" + type.label );
+    cellBlock->SetElementType( type.geosxType );
+    cellBlock->resize( localBlockSizes[b] );
+
+    CellBlock::NodeMapType & cellToVertex = cellBlock->nodeList();
+    cellToVertex.resize( localBlockSizes[b], type.numNodes );
+    arrayView1d< globalIndex > const & localToGlobal = cellBlock->localToGlobalMap();
+
+    std::vector< real64 * > scalarProperties( numFields, nullptr );
+    std::vector< array1d< R1Tensor > * > vectorProperties( numFields, nullptr );
+    for( integer f = 0; f < numFields; ++f )
+    {
+      if( layout.fieldComponents[f] == 1 )
+      {
+        scalarProperties[f] = cellBlock->AddProperty< real64_array >( fieldNamesInGEOSX[f] ).data();
+      }
+      else if( layout.fieldComponents[f] == 3 )
+      {
+        vectorProperties[f] = &cellBlock->AddProperty< array1d< R1Tensor > >( fieldNamesInGEOSX[f] );
+      }
+      else
+      {
+        GEOSX_ERROR( "Dimension of " << fieldNamesInGEOSX[f] << " is not supported for import in GEOSX" );
+      }
+    }
+
+    localIndex cellIndex = 0;
+    for( localIndex k = 0; k < numLocalCells; ++k )
+    {
+      if( cellBlockIndex[k] != b )
+      {
+        continue;
+      }
+
+      for( integer a = 0; a < type.numNodes; ++a )
+      {
+        globalIndex const node = cellNodes[cellNodeOffsets[k] + type.order[a]];
+        cellToVertex( cellIndex, a ) = std::lower_bound( localNodes.begin(), localNodes.end(), node ) - localNodes.begin();
+      }
+      localToGlobal[cellIndex] = cellOffset + std::lower_bound( sortedCellNumbers.begin(), sortedCellNumbers.end(), cellNumbers[k] ) - sortedCellNumbers.begin();
+
+      for( integer f = 0; f < numFields; ++f )
+      {
+        auto const it = dataIndex[f].find( cellNumbers[k] );
+        GEOSX_ERROR_IF( it == dataIndex[f].end(), "No value of " << fieldsToImport[f] << " for element " << cellNumbers[k] );
+        real64 const * const values = dataValues[f].data() + it->second;
+        if( scalarProperties[f] != nullptr )
+        {
+          scalarProperties[f][cellIndex] = values[0];
+        }
+        else
+        {
+          for( int d = 0; d < 3; ++d )
+          {
+            ( *vectorProperties[f] )[cellIndex][d] = values[d];
+          }
+        }
+      }
+      ++cellIndex;
+    }
+  }
+
+  GEOSX_LOG_RANK_0( "Read " << layout.numNodes << " nodes and " << MpiWrapper::Sum( numLocalCells ) << " cells from " << m_filePath );
+}
+
+} /* namespace geosx */
@@ -0,0 +1,96 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+/**
+ * @file DistributedGmshReader.hpp
+ */
+
+#ifndef GEOSX_MESHUTILITIES_DISTRIBUTEDGMSHREADER_HPP_
+#define GEOSX_MESHUTILITIES_DISTRIBUTEDGMSHREADER_HPP_
+
+#include "common/DataTypes.hpp"
+
+namespace geosx
+{
+
+class CellBlockManager;
+class NodeManager;
+
+/**
+ * @class DistributedGmshReader
+ * @brief Parallel import of a GMSH (format 2.2, ASCII) mesh without loading the full mesh on any rank.
+ *
+ * A few reader ranks each parse a contiguous byte range of the file, a chunk of lines at a time, and send
+ * every record to the rank that owns it: nodes and node set memberships to a rendezvous rank given by the
+ * node number, cells and their imported values to a rank given by the element number. Each rank then
+ * fetches the coordinates of the nodes of its cells from their rendezvous ranks, so that memory per rank
+ * is proportional to the local part of the mesh and to the chunk size.
+ *
+ * Cell blocks, node sets and imported properties are named as with the PAMELA import: one cell block
+ * per region and cell type (e.g. Reservoir_TETRA), one node set per named surface plus the "all" set,
+ * and one property per imported element data field (scalar or 3-component vector).
+ * The resulting distribution follows the file numbering and is meant to be redistributed with the
+ * GraphPartitioner.
+ *
+ * GMSH numbers the surface elements and the cells in a single sequence, and node and element numbers
+ * may have gaps. Global indices are therefore compacted: the cells, and the nodes, are numbered from 0
+ * contiguously in the order of their numbers in the file.
+ */
+class DistributedGmshReader
+{
+public:
+
+  /**
+   * @brief Constructor.
+   * @param filePath path to the mesh file
+   * @param numReaders number of ranks reading the file, capped by the number of ranks
+   * @param chunkSize number of lines parsed by each reader between two exchanges
+   */
+  DistributedGmshReader( string const & filePath,
+                         integer const numReaders,
+                         localIndex const chunkSize );
+
+  /**
+   * @brief Read the mesh and fill the cell blocks and the nodes of this rank.
+   * @param[in] fieldsToImport names of the element data fields to import
+   * @param[in] fieldNamesInGEOSX names of the imported fields within GEOSX
+   * @param[in] scale scale factor applied to the coordinates
+   * @param[in] reverseZ whether the z coordinate points downward in the file
+   * @param[out] cellBlockManager the cell blocks, identical on all ranks even if empty
+   * @param[out] nodeManager the nodes of the local cells
+   */
+  void read( string_array const & fieldsToImport,
+             string_array const & fieldNamesInGEOSX,
+             real64 const scale,
+             bool const reverseZ,
+             CellBlockManager & cellBlockManager,
+             NodeManager & nodeManager ) const;
+
+private:
+
+  /// Path to the mesh file
+  string const m_filePath;
+
+  /// Number of ranks reading the file
+  integer const m_numReaders;
+
+  /// Number of lines parsed by each reader between two exchanges
+  localIndex const m_chunkSize;
+
+};
+
+} /* namespace geosx */
+
+#endif /* GEOSX_MESHUTILITIES_DISTRIBUTEDGMSHREADER_HPP_ */
@@ -0,0 +1,767 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+/**
+ * @file GraphPartitioner.cpp
+ */
+
+#include "GraphPartitioner.hpp"
+
+#include "common/IndexMap.hpp"
+#include "common/TimingMacros.hpp"
+#include "mesh/CellBlockManager.hpp"
+#include "mesh/NodeManager.hpp"
+#include "mpiCommunications/MpiWrapper.hpp"
+
+#ifdef GEOSX_USE_PARMETIS
+#include "parmetis.h"
+#else
+#include "metis.h"
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <unordered_map>
+
+namespace geosx
+{
+
+using namespace dataRepository;
+
+namespace
+{
+
+/// Integer weight given to the heaviest vertex
+real64 constexpr weightScale = 1000.0;
+
+/**
+ * @brief Compute the weight of each local cell, in the order of the cell blocks.
+ * @param blocks the cell blocks
+ * @param weightFieldName name of the cell block field holding the weights, unit weights if empty or absent
+ * @param cellWeights the weight of each cell
+ */
+void computeCellWeights( std::vector< CellBlock * > const & blocks,
+                         string const & weightFieldName,
+                         array1d< real64 > & cellWeights )
+{
+  cellWeights.clear();
+  for( CellBlock const * const block : blocks )
+  {
+    if( !weightFieldName.empty() && block->hasWrapper( weightFieldName ) )
+    {
+      arrayView1d< real64 const > const & weight = block->getReference< array1d< real64 > >( weightFieldName );
+      for( localIndex k = 0; k < block->size(); ++k )
+      {
+        cellWeights.emplace_back( weight[k] );
+      }
+    }
+    else
+    {
+      for( localIndex k = 0; k < block->size(); ++k )
+      {
+        cellWeights.emplace_back( 1.0 );
+      }
+    }
+  }
+}
+
+/**
+ * @brief Log the distribution of cells and weights over the ranks.
+ * @param label the stage of the partitioning
+ * @param cellWeights the weight of each local cell
+ */
+void reportImbalance( string const & label,
+                      arrayView1d< real64 const > const & cellWeights )
+{
+  localIndex const numCells = cellWeights.size();
+  real64 weight = 0.0;
+  for( real64 const cellWeight : cellWeights )
+  {
+    weight += cellWeight;
+  }
+
+  int const numRanks = MpiWrapper::Comm_size();
+  localIndex const minCells = MpiWrapper::Min( numCells );
+  localIndex const maxCells = MpiWrapper::Max( numCells );
+  real64 const maxWeight = MpiWrapper::Max( weight );
+  real64 const averageWeight = MpiWrapper::Sum( weight ) / numRanks;
+
+  GEOSX_LOG_RANK_0( "Graph partitioning, " << label << ": " << minCells << " to " << maxCells << " cells per rank, "
+                                           << "load imbalance (max / average weight) = "
+                                           << ( averageWeight > 0.0 ? maxWeight / averageWeight : 1.0 ) );
+}
+
+/// Array fields of a cell block moved with its cells, sorted by name within each type
+struct BlockFields
+{
+  std::vector< array1d< real64 > * > real1d;
+  std::vector< array1d< integer > * > integer1d;
+  std::vector< array1d< R1Tensor > * > tensor1d;
+  std::vector< array2d< real64 > * > real2d;
+
+  localIndex valuesPerCell() const
+  {
+    localIndex numValues = real1d.size() + integer1d.size() + 3 * tensor1d.size();
+    for( array2d< real64 > const * const field : real2d )
+    {
+      numValues += field->size( 1 );
+    }
+    return numValues;
+  }
+
+  void pack( localIndex const k, std::vector< real64 > & values ) const
+  {
+    for( array1d< real64 > const * const field : real1d )
+    {
+      values.emplace_back( ( *field )[k] );
+    }
+    for( array1d< integer > const * const field : integer1d )
+    {
+      values.emplace_back( ( *field )[k] );
+    }
+    for( array1d< R1Tensor > const * const field : tensor1d )
+    {
+      for( int d = 0; d < 3; ++d )
+      {
+        values.emplace_back( ( *field )[k][d] );
+      }
+    }
+    for( array2d< real64 > const * const field : real2d )
+    {
+      for( localIndex j = 0; j < field->size( 1 ); ++j )
+      {
+        values.emplace_back( ( *field )( k, j ) );
+      }
+    }
+  }
+
+  void unpack( localIndex const k, real64 const * values ) const
+  {
+    for( array1d< real64 > * const field : real1d )
+    {
+      ( *field )[k] = *values++;
+    }
+    for( array1d< integer > * const field : integer1d )
+    {
+      ( *field )[k] = static_cast< integer >( *values++ );
+    }
+    for( array1d< R1Tensor > * const field : tensor1d )
+    {
+      for( int d = 0; d < 3; ++d )
+      {
+        ( *field )[k][d] = *values++;
+      }
+    }
+    for( array2d< real64 > * const field : real2d )
+    {
+      for( localIndex j = 0; j < field->size( 1 ); ++j )
+      {
+        ( *field )( k, j ) = *values++;
+      }
+    }
+  }
+};
+
+template< typename T >
+void addFieldNames( CellBlock & block, char const tag, std::vector< string > & names )
+{
+  block.forWrappers< T >( [&]( auto & wrapper )
+  {
+    if( wrapper.sizedFromParent() == 1 )
+    {
+      names.emplace_back( string( 1, tag ) + wrapper.getName() );
+    }
+  } );
+}
+
+template< typename T >
+void collectFields( CellBlock & block, char const tag, std::vector< string > const & names, std::vector< T * > & fields )
+{
+  for( string const & name : names )
+  {
+    if( name[0] == tag )
+    {
+      string const fieldName = name.substr( 1 );
+      if( !block.hasWrapper( fieldName ) )
+      {
+        block.registerWrapper< T >( fieldName );
+      }
+      fields.emplace_back( &block.getReference< T >( fieldName ) );
+    }
+  }
+}
+
+/**
+ * @brief Agree on the fields of a cell block on all ranks and collect them.
+ * @param block the cell block
+ * @param fields the fields moved with the cells
+ *
+ * The mesh generators only add imported properties to non-empty blocks, so the fields of the largest block
+ * are taken as reference and registered where they are missing.
+ */
+void synchronizeFields( CellBlock & block, BlockFields & fields )
+{
+  int const rank = MpiWrapper::Comm_rank();
+  localIndex const maxSize = MpiWrapper::Max( block.size() );
+  int const root = MpiWrapper::Min( block.size() == maxSize ? rank : MpiWrapper::Comm_size() );
+
+  std::vector< string > names;
+  addFieldNames< array1d< real64 > >( block, 'r', names );
+  addFieldNames< array1d< integer > >( block, 'i', names );
+  addFieldNames< array1d< R1Tensor > >( block, 't', names );
+  addFieldNames< array2d< real64 > >( block, 'm', names );
+
+  string joinedNames;
+  for( string const & name : names )
+  {
+    joinedNames += name + '\n';
+  }
+  int length = LvArray::integerConversion< int >( joinedNames.size() );
+  MpiWrapper::bcast( &length, 1, root, MPI_COMM_GEOSX );
+  joinedNames.resize( length );
+  MpiWrapper::bcast( &joinedNames[0], length, root, MPI_COMM_GEOSX );
+
+  names.clear();
+  std::istringstream stream( joinedNames );
+  for( string name; std::getline( stream, name ); )
+  {
+    names.emplace_back( name );
+  }
+  std::sort( names.begin(), names.end() );
+
+  collectFields( block, 'r', names, fields.real1d );
+  collectFields( block, 'i', names, fields.integer1d );
+  collectFields( block, 't', names, fields.tensor1d );
+  collectFields( block, 'm', names, fields.real2d );
+
+  for( array2d< real64 > * const field : fields.real2d )
+  {
+    localIndex const numComponents = MpiWrapper::Max( field->size( 1 ) );
+    if( field->size( 1 ) != numComponents )
+    {
+      field->resize( field->size( 0 ), numComponents );
+    }
+  }
+}
+
+void GraphPartitioner::partition( CellBlockManager & cellBlockManager,
+                                  NodeManager & nodeManager,
+                                  string const & weightFieldName,
+                                  std::set< int > & neighborRanks )
+{
+  GEOSX_MARK_FUNCTION;
+
+  int const numRanks = MpiWrapper::Comm_size();
+  int const rank = MpiWrapper::Comm_rank();
+
+  // cell blocks, in the same order on all ranks
+  std::vector< CellBlock * > blocks;
+  cellBlockManager.forElementSubRegions( [&]( CellBlock & block )
+  {
+    blocks.emplace_back( &block );
+  } );
+  std::sort( blocks.begin(), blocks.end(), []( CellBlock const * const b0, CellBlock const * const b1 )
+  {
+    return b0->getName() < b1->getName();
+  } );
+  localIndex const numBlocks = LvArray::integerConversion< localIndex >( blocks.size() );
+  GEOSX_ERROR_IF_NE_MSG( MpiWrapper::Min( numBlocks ), MpiWrapper::Max( numBlocks ),
+                         "Graph partitioning requires the same cell blocks on all ranks" );
+
+  // flat numbering of the local cells
+  std::vector< localIndex > blockOffsets( 1, 0 );
+  for( CellBlock const * const block : blocks )
+  {
+    blockOffsets.emplace_back( blockOffsets.back() + block->size() );
+  }
+  localIndex const numCells = blockOffsets.back();
+
+  arrayView1d< globalIndex const > const & nodeLocalToGlobal = nodeManager.localToGlobalMap();
+
+  array1d< real64 > cellWeights;
+  computeCellWeights( blocks, weightFieldName, cellWeights );
+  reportImbalance( "mesh generator distribution", cellWeights.toViewConst() );
+
+  if( numRanks == 1 )
+  {
+    neighborRanks.clear();
+    return;
+  }
+
+  // dual graph: each node is sent to a rendezvous rank, which returns the pairs of cells sharing it
+  globalIndex const cellOffset = MpiWrapper::PrefixSum< globalIndex >( numCells );
+
+  std::vector< std::vector< globalIndex > > sendBuffers( numRanks );
+  array1d< globalIndex > recvValues;
+  array1d< int > recvOffsets;
+
+  for( localIndex b = 0; b < numBlocks; ++b )
+  {
+    arrayView2d< localIndex const, cells::NODE_MAP_USD > const & elemToNodes = blocks[b]->nodeList();
+    for( localIndex k = 0; k < elemToNodes.size( 0 ); ++k )
+    {
+      for( localIndex a = 0; a < elemToNodes.size( 1 ); ++a )
+      {
+        globalIndex const nodeGlobalIndex = nodeLocalToGlobal[elemToNodes( k, a )];
+        std::vector< globalIndex > & buffer = sendBuffers[nodeGlobalIndex % numRanks];
+        buffer.emplace_back( nodeGlobalIndex );
+        buffer.emplace_back( cellOffset + blockOffsets[b] + k );
+      }
+    }
+  }
+  MpiWrapper::allToAllv( sendBuffers, recvValues, recvOffsets );
+
+  {
+    std::unordered_map< globalIndex, std::vector< std::pair< globalIndex, int > > > nodeToCells;
+    for( int r = 0; r < numRanks; ++r )
+    {
+      for( int i = recvOffsets[r]; i < recvOffsets[r + 1]; i += 2 )
+      {
+        nodeToCells[recvValues[i]].emplace_back( recvValues[i + 1], r );
+      }
+    }
+
+    for( std::vector< globalIndex > & buffer : sendBuffers )
+    {
+      buffer.clear();
+    }
+    for( auto const & entry : nodeToCells )
+    {
+      for( auto const & cell : entry.second )
+      {
+        for( auto const & otherCell : entry.second )
+        {
+          if( otherCell.first != cell.first )
+          {
+            sendBuffers[cell.second].emplace_back( cell.first );
+            sendBuffers[cell.second].emplace_back( otherCell.first );
+          }
+        }
+      }
+    }
+  }
+  MpiWrapper::allToAllv( sendBuffers, recvValues, recvOffsets );
+
+  array1d< localIndex > adjacencyOffsets( numCells + 1 );
+  array1d< globalIndex > adjacency;
+  {
+    std::vector< std::vector< globalIndex > > cellNeighbors( numCells );
+    for( localIndex i = 0; i < recvValues.size(); i += 2 )
+    {
+      cellNeighbors[recvValues[i] - cellOffset].emplace_back( recvValues[i + 1] );
+    }
+    for( localIndex c = 0; c < numCells; ++c )
+    {
+      std::vector< globalIndex > & neighbors = cellNeighbors[c];
+      std::sort( neighbors.begin(), neighbors.end() );
+      neighbors.erase( std::unique( neighbors.begin(), neighbors.end() ), neighbors.end() );
+      for( globalIndex const neighbor : neighbors )
+      {
+        adjacency.emplace_back( neighbor );
+      }
+      adjacencyOffsets[c + 1] = adjacency.size();
+    }
+  }
+
+  array1d< integer > const cellRanks = partitionGraph( adjacencyOffsets.toViewConst(),
+                                                       adjacency.toViewConst(),
+                                                       cellWeights.toViewConst(),
+                                                       numRanks );
+
+  // fields moved with the cells, with the same number of components on all ranks
+  std::vector< BlockFields > blockFields( numBlocks );
+  for( localIndex b = 0; b < numBlocks; ++b )
+  {
+    synchronizeFields( *blocks[b], blockFields[b] );
+  }
+
+  // node sets, in the same order on all ranks
+  std::vector< std::pair< string, SortedArray< localIndex > * > > nodeSets;
+  nodeManager.sets().forWrappers< SortedArray< localIndex > >( [&]( auto & wrapper )
+  {
+    nodeSets.emplace_back( wrapper.getName(), &wrapper.reference() );
+  } );
+  std::sort( nodeSets.begin(), nodeSets.end() );
+  localIndex const numNodeSets = LvArray::integerConversion< localIndex >( nodeSets.size() );
+  GEOSX_ERROR_IF_NE_MSG( MpiWrapper::Min( numNodeSets ), MpiWrapper::Max( numNodeSets ),
+                         "Graph partitioning requires the same node sets on all ranks" );
+
+  array2d< integer > nodeInSet( nodeManager.size(), numNodeSets );
+  for( localIndex s = 0; s < numNodeSets; ++s )
+  {
+    for( localIndex const node : *nodeSets[s].second )
+    {
+      nodeInSet( node, s ) = 1;
+    }
+  }
+
+  // pack the cells and their nodes for their new rank:
+  // - index stream: number of cells, then (block, global index, node global indices) per cell,
+  //                 number of nodes, then the global index of each node
+  // - value stream: the field values of each cell, then the coordinates and set flags of each node
+  std::vector< std::vector< localIndex > > cellsToSend( numRanks );
+  for( localIndex c = 0; c < numCells; ++c )
+  {
+    cellsToSend[cellRanks[c]].emplace_back( c );
+  }
+
+  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & X = nodeManager.referencePosition();
+
+  std::vector< std::vector< real64 > > sendValueBuffers( numRanks );
+  array1d< integer > nodeStamp( nodeManager.size() );
+  nodeStamp.setValues< serialPolicy >( -1 );
+  std::vector< localIndex > nodesToSend;
+  for( int r = 0; r < numRanks; ++r )
+  {
+    std::vector< globalIndex > & indexBuffer = sendBuffers[r];
+    std::vector< real64 > & valueBuffer = sendValueBuffers[r];
+    indexBuffer.clear();
+    nodesToSend.clear();
+
+    indexBuffer.emplace_back( LvArray::integerConversion< globalIndex >( cellsToSend[r].size() ) );
+    for( localIndex const c : cellsToSend[r] )
+    {
+      localIndex const b = std::upper_bound( blockOffsets.begin(), blockOffsets.end(), c ) - blockOffsets.begin() - 1;
+      localIndex const k = c - blockOffsets[b];
+      CellBlock const & block = *blocks[b];
+      arrayView2d< localIndex const, cells::NODE_MAP_USD > const & elemToNodes = block.nodeList();
+
+      indexBuffer.emplace_back( b );
+      indexBuffer.emplace_back( block.localToGlobalMap()[k] );
+      for( localIndex a = 0; a < elemToNodes.size( 1 ); ++a )
+      {
+        localIndex const node = elemToNodes( k, a );
+        indexBuffer.emplace_back( nodeLocalToGlobal[node] );
+        if( nodeStamp[node] != r )
+        {
+          nodeStamp[node] = r;
+          nodesToSend.emplace_back( node );
+        }
+      }
+
+      blockFields[b].pack( k, valueBuffer );
+    }
+
+    indexBuffer.emplace_back( LvArray::integerConversion< globalIndex >( nodesToSend.size() ) );
+    for( localIndex const node : nodesToSend )
+    {
+      indexBuffer.emplace_back( nodeLocalToGlobal[node] );
+      for( int d = 0; d < 3; ++d )
+      {
+        valueBuffer.emplace_back( X( node, d ) );
+      }
+      for( localIndex s = 0; s < numNodeSets; ++s )
+      {
+        valueBuffer.emplace_back( nodeInSet( node, s ) );
+      }
+    }
+  }
+
+  array1d< real64 > recvFieldValues;
+  array1d< int > recvFieldOffsets;
+  MpiWrapper::allToAllv( sendBuffers, recvValues, recvOffsets );
+  MpiWrapper::allToAllv( sendValueBuffers, recvFieldValues, recvFieldOffsets );
+
+  // unpack, numbering the received nodes in order of arrival
+  std::vector< std::vector< globalIndex > > newCellGlobalIndices( numBlocks );
+  std::vector< std::vector< globalIndex > > newCellNodes( numBlocks );
+  std::vector< std::vector< real64 > > newCellValues( numBlocks );
+
+  indexMap< globalIndex, localIndex > newNodeGlobalToLocal;
+  std::vector< globalIndex > newNodeGlobalIndices;
+  std::vector< real64 > newNodeValues;
+  localIndex const valuesPerNode = 3 + numNodeSets;
+
+  for( int r = 0; r < numRanks; ++r )
+  {
+    localIndex i = recvOffsets[r];
+    localIndex v = recvFieldOffsets[r];
+
+    globalIndex const numIncomingCells = recvValues[i++];
+    for( globalIndex c = 0; c < numIncomingCells; ++c )
+    {
+      localIndex const b = LvArray::integerConversion< localIndex >( recvValues[i++] );
+      newCellGlobalIndices[b].emplace_back( recvValues[i++] );
+      for( localIndex a = 0; a < blocks[b]->numNodesPerElement(); ++a )
+      {
+        newCellNodes[b].emplace_back( recvValues[i++] );
+      }
+      localIndex const valuesPerCell = blockFields[b].valuesPerCell();
+      newCellValues[b].insert( newCellValues[b].end(), recvFieldValues.data() + v, recvFieldValues.data() + v + valuesPerCell );
+      v += valuesPerCell;
+    }
+
+    globalIndex const numIncomingNodes = recvValues[i++];
+    for( globalIndex n = 0; n < numIncomingNodes; ++n )
+    {
+      globalIndex const nodeGlobalIndex = recvValues[i++];
+      if( newNodeGlobalToLocal.count( nodeGlobalIndex ) == 0 )
+      {
+        newNodeGlobalToLocal[nodeGlobalIndex] = newNodeGlobalIndices.size();
+        newNodeGlobalIndices.emplace_back( nodeGlobalIndex );
+        newNodeValues.insert( newNodeValues.end(), recvFieldValues.data() + v, recvFieldValues.data() + v + valuesPerNode );
+      }
+      v += valuesPerNode;
+    }
+
+    GEOSX_ERROR_IF_NE( i, recvOffsets[r + 1] );
+    GEOSX_ERROR_IF_NE( v, recvFieldOffsets[r + 1] );
+  }
+
+  // rebuild the cell blocks
+  for( localIndex b = 0; b < numBlocks; ++b )
+  {
+    CellBlock & block = *blocks[b];
+    BlockFields const & fields = blockFields[b];
+    localIndex const numNewCells = LvArray::integerConversion< localIndex >( newCellGlobalIndices[b].size() );
+    localIndex const numNodesPerElement = block.numNodesPerElement();
+    localIndex const valuesPerCell = fields.valuesPerCell();
+
+    block.resize( numNewCells );
+    CellBlock::NodeMapType & elemToNodes = block.nodeList();
+    elemToNodes.resize( numNewCells, numNodesPerElement );
+
+    arrayView1d< globalIndex > const & localToGlobal = block.localToGlobalMap();
+    for( localIndex k = 0; k < numNewCells; ++k )
+    {
+      localToGlobal[k] = newCellGlobalIndices[b][k];
+      for( localIndex a = 0; a < numNodesPerElement; ++a )
+      {
+        elemToNodes( k, a ) = newNodeGlobalToLocal.at( newCellNodes[b][k * numNodesPerElement + a] );
+      }
+
+      fields.unpack( k, newCellValues[b].data() + k * valuesPerCell );
+    }
+
+    // the mesh generators do not produce cell sets, only the (empty) default ones exist at this stage
+    block.sets().forWrappers< SortedArray< localIndex > >( [&]( auto & wrapper )
+    {
+      wrapper.reference().clear();
+    } );
+
+    block.ConstructGlobalToLocalMap();
+  }
+
+  // rebuild the nodes
+  localIndex const numNewNodes = LvArray::integerConversion< localIndex >( newNodeGlobalIndices.size() );
+  nodeManager.resize( numNewNodes );
+  {
+    arrayView2d< real64, nodes::REFERENCE_POSITION_USD > const & newX = nodeManager.referencePosition();
+    arrayView1d< globalIndex > const & newNodeLocalToGlobal = nodeManager.localToGlobalMap();
+    for( localIndex s = 0; s < numNodeSets; ++s )
+    {
+      nodeSets[s].second->clear();
+    }
+    for( localIndex node = 0; node < numNewNodes; ++node )
+    {
+      newNodeLocalToGlobal[node] = newNodeGlobalIndices[node];
+      real64 const * const values = newNodeValues.data() + node * valuesPerNode;
+      for( int d = 0; d < 3; ++d )
+      {
+        newX( node, d ) = values[d];
+      }
+      for( localIndex s = 0; s < numNodeSets; ++s )
+      {
+        if( values[3 + s] > 0.0 )
+        {
+          nodeSets[s].second->insert( node );
+        }
+      }
+    }
+  }
+  nodeManager.ConstructGlobalToLocalMap();
+
+  // neighbors: each node is sent to a rendezvous rank, which returns the other ranks holding it
+  for( std::vector< globalIndex > & buffer : sendBuffers )
+  {
+    buffer.clear();
+  }
+  for( globalIndex const nodeGlobalIndex : newNodeGlobalIndices )
+  {
+    sendBuffers[nodeGlobalIndex % numRanks].emplace_back( nodeGlobalIndex );
+  }
+  MpiWrapper::allToAllv( sendBuffers, recvValues, recvOffsets );
+
+  {
+    std::unordered_map< globalIndex, std::vector< int > > nodeToRanks;
+    for( int r = 0; r < numRanks; ++r )
+    {
+      for( int i = recvOffsets[r]; i < recvOffsets[r + 1]; ++i )
+      {
+        nodeToRanks[recvValues[i]].emplace_back( r );
+      }
+    }
+
+    std::vector< std::set< int > > sharingRanks( numRanks );
+    for( auto const & entry : nodeToRanks )
+    {
+      for( int const r : entry.second )
+      {
+        sharingRanks[r].insert( entry.second.begin(), entry.second.end() );
+      }
+    }
+
+    for( int r = 0; r < numRanks; ++r )
+    {
+      sendBuffers[r].assign( sharingRanks[r].begin(), sharingRanks[r].end() );
+    }
+  }
+  MpiWrapper::allToAllv( sendBuffers, recvValues, recvOffsets );
+
+  neighborRanks.clear();
+  neighborRanks.insert( recvValues.begin(), recvValues.end() );
+  neighborRanks.erase( rank );
+
+  computeCellWeights( blocks, weightFieldName, cellWeights );
+  reportImbalance( "graph partition", cellWeights.toViewConst() );
+}
+
+array1d< integer > GraphPartitioner::partitionGraph( arrayView1d< localIndex const > const & offsets,
+                                                     arrayView1d< globalIndex const > const & adjacency,
+                                                     arrayView1d< real64 const > const & weights,
+                                                     integer const numParts )
+{
+  GEOSX_MARK_FUNCTION;
+
+  localIndex const numVertices = offsets.size() - 1;
+  array1d< integer > parts( numVertices );
+  if( numParts == 1 )
+  {
+    return parts;
+  }
+
+  // METIS only takes integer weights
+  real64 localMaxWeight = 0.0;
+  for( real64 const weight : weights )
+  {
+    localMaxWeight = std::max( localMaxWeight, weight );
+  }
+  real64 const maxWeight = MpiWrapper::Max( localMaxWeight );
+
+  array1d< idx_t > vertexWeights( numVertices );
+  for( localIndex v = 0; v < numVertices; ++v )
+  {
+    vertexWeights[v] = maxWeight > 0.0 ? static_cast< idx_t >( std::lround( weightScale * weights[v] / maxWeight ) ) : 1;
+  }
+
+  array1d< idx_t > xadj( numVertices + 1 );
+  for( localIndex v = 0; v <= numVertices; ++v )
+  {
+    xadj[v] = LvArray::integerConversion< idx_t >( offsets[v] );
+  }
+  array1d< idx_t > adjncy( adjacency.size() );
+  for( localIndex k = 0; k < adjacency.size(); ++k )
+  {
+    adjncy[k] = LvArray::integerConversion< idx_t >( adjacency[k] );
+  }
+
+  idx_t nparts = numParts;
+  idx_t ncon = 1;
+  idx_t edgecut = 0;
+  array1d< idx_t > vertexParts( numVertices );
+
+#ifdef GEOSX_USE_PARMETIS
+  // ParMETIS requires at least one vertex on each rank
+  if( MpiWrapper::Min( numVertices ) > 0 )
+  {
+    array1d< idx_t > vertexCounts;
+    MpiWrapper::allGather( LvArray::integerConversion< idx_t >( numVertices ), vertexCounts );
+    array1d< idx_t > vtxdist( vertexCounts.size() + 1 );
+    for( localIndex r = 0; r < vertexCounts.size(); ++r )
+    {
+      vtxdist[r + 1] = vtxdist[r] + vertexCounts[r];
+    }
+
+    idx_t wgtflag = 2;
+    idx_t numflag = 0;
+    array1d< real_t > tpwgts( numParts );
+    tpwgts.setValues< serialPolicy >( 1.0 / numParts );
+    real_t ubvec = 1.05;
+    idx_t options[3] = { 0, 0, 0 };
+    MPI_Comm comm = MPI_COMM_GEOSX;
+
+    int const result = ParMETIS_V3_PartKway( vtxdist.data(), xadj.data(), adjncy.data(), vertexWeights.data(), nullptr,
+                                             &wgtflag, &numflag, &ncon, &nparts, tpwgts.data(), &ubvec, options,
+                                             &edgecut, vertexParts.data(), &comm );
+    GEOSX_ERROR_IF_NE_MSG( result, METIS_OK, "ParMETIS_V3_PartKway failed" );
+
+    for( localIndex v = 0; v < numVertices; ++v )
+    {
+      parts[v] = LvArray::integerConversion< integer >( vertexParts[v] );
+    }
+    return parts;
+  }
+#endif
+
+  // gather the graph on rank 0 and partition it with METIS
+  int const numRanks = MpiWrapper::Comm_size();
+  int const rank = MpiWrapper::Comm_rank();
+
+  array1d< idx_t > degrees( numVertices );
+  for( localIndex v = 0; v < numVertices; ++v )
+  {
+    degrees[v] = xadj[v + 1] - xadj[v];
+  }
+
+  array1d< int > vertexCounts;
+  array1d< int > edgeCounts;
+  MpiWrapper::allGather( LvArray::integerConversion< int >( numVertices ), vertexCounts );
+  MpiWrapper::allGather( LvArray::integerConversion< int >( adjncy.size() ), edgeCounts );
+
+  array1d< int > vertexDispls( numRanks + 1 );
+  array1d< int > edgeDispls( numRanks + 1 );
+  for( int r = 0; r < numRanks; ++r )
+  {
+    vertexDispls[r + 1] = vertexDispls[r] + vertexCounts[r];
+    edgeDispls[r + 1] = edgeDispls[r] + edgeCounts[r];
+  }
+
+  idx_t numGlobalVertices = vertexDispls[numRanks];
+  array1d< idx_t > globalDegrees( rank == 0 ? numGlobalVertices : 0 );
+  array1d< idx_t > globalWeights( rank == 0 ? numGlobalVertices : 0 );
+  array1d< idx_t > globalAdjncy( rank == 0 ? edgeDispls[numRanks] : 0 );
+  MpiWrapper::gatherv( degrees.data(), LvArray::integerConversion< int >( numVertices ), globalDegrees.data(),
+                       vertexCounts.data(), vertexDispls.data(), 0, MPI_COMM_GEOSX );
+  MpiWrapper::gatherv( vertexWeights.data(), LvArray::integerConversion< int >( numVertices ), globalWeights.data(),
+                       vertexCounts.data(), vertexDispls.data(), 0, MPI_COMM_GEOSX );
+  MpiWrapper::gatherv( adjncy.data(), LvArray::integerConversion< int >( adjncy.size() ), globalAdjncy.data(),
+                       edgeCounts.data(), edgeDispls.data(), 0, MPI_COMM_GEOSX );
+
+  array1d< idx_t > globalParts( numGlobalVertices );
+  if( rank == 0 && numGlobalVertices > 0 )
+  {
+    array1d< idx_t > globalXadj( numGlobalVertices + 1 );
+    for( idx_t v = 0; v < numGlobalVertices; ++v )
+    {
+      globalXadj[v + 1] = globalXadj[v] + globalDegrees[v];
+    }
+
+    real_t ubvec = 1.05;
+    int const result = METIS_PartGraphKway( &numGlobalVertices, &ncon, globalXadj.data(), globalAdjncy.data(),
+                                            globalWeights.data(), nullptr, nullptr, &nparts, nullptr, &ubvec,
+                                            nullptr, &edgecut, globalParts.data() );
+    GEOSX_ERROR_IF_NE_MSG( result, METIS_OK, "METIS_PartGraphKway failed" );
+  }
+  MpiWrapper::bcast( globalParts.data(), LvArray::integerConversion< int >( numGlobalVertices ), 0, MPI_COMM_GEOSX );
+
+  for( localIndex v = 0; v < numVertices; ++v )
+  {
+    parts[v] = LvArray::integerConversion< integer >( globalParts[vertexDispls[rank] + v] );
+  }
+  return parts;
+}
+
+} /* namespace geosx */
@@ -0,0 +1,104 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+/**
+ * @file GraphPartitioner.hpp
+ */
+
+#ifndef GEOSX_MESHUTILITIES_GRAPHPARTITIONER_HPP_
+#define GEOSX_MESHUTILITIES_GRAPHPARTITIONER_HPP_
+
+#include "common/DataTypes.hpp"
+#include "common/EnumStrings.hpp"
+
+#include <set>
+
+namespace geosx
+{
+
+class CellBlockManager;
+class NodeManager;
+
+/**
+ * @class GraphPartitioner
+ * @brief Redistribution of the generated cells following a partition of the cell graph.
+ *
+ * The mesh generators distribute the cells geometrically (Cartesian boxes of the SpatialPartition for
+ * internal meshes). The graph partitioner builds the distributed dual graph of these cells, in which two
+ * cells are neighbors if they share a node (the same adjacency used for ghosting), partitions it with
+ * ParMETIS (or METIS on rank 0 when ParMETIS is not available) using optional cell weights, and moves
+ * the cells, their nodes and the node sets to their new rank. The ranks sharing nodes are returned as the
+ * neighbors to communicate with. Global indices are not modified.
+ *
+ * Array fields sized with the cell blocks (imported properties) are moved with the cells; node fields other
+ * than the coordinates and cell sets are not carried over, as the generators do not produce any.
+ *
+ * The implementation is only compiled when GEOSX is built with METIS (GEOSX_USE_METIS); the Method
+ * enumeration is always available so that input files can be parsed, and MeshManager rejects the
+ * graph method otherwise.
+ */
+class GraphPartitioner
+{
+public:
+
+  /**
+   * @brief Partitioning methods.
+   */
+  enum class Method : integer
+  {
+    generator, ///< keep the distribution produced by the mesh generator
+    graph      ///< redistribute the cells following a partition of the cell graph
+  };
+
+  /**
+   * @brief Partition the cells of all cell blocks and redistribute them with their nodes.
+   * @param[in,out] cellBlockManager the cell blocks filled by the mesh generators
+   * @param[in,out] nodeManager the nodes filled by the mesh generators
+   * @param[in] weightFieldName name of the cell block field used as cell weights, unit weights if empty
+   * @param[out] neighborRanks the ranks sharing nodes with this rank after redistribution
+   *
+   * All ranks must hold the same cell blocks, even if empty. The load imbalance before and after
+   * redistribution is reported on rank 0.
+   */
+  static void partition( CellBlockManager & cellBlockManager,
+                         NodeManager & nodeManager,
+                         string const & weightFieldName,
+                         std::set< int > & neighborRanks );
+
+  /**
+   * @brief Partition a distributed graph.
+   * @param[in] offsets the offsets of the adjacency lists of the local vertices (size numLocalVertices + 1)
+   * @param[in] adjacency the concatenated adjacency lists, in global vertex indices
+   * @param[in] weights the weights of the local vertices
+   * @param[in] numParts the number of parts
+   * @return the part of each local vertex
+   *
+   * Global vertex indices are numbered contiguously by rank. The weights are scaled to integers, the
+   * heaviest vertex getting a weight of 1000.
+   */
+  static array1d< integer > partitionGraph( arrayView1d< localIndex const > const & offsets,
+                                            arrayView1d< globalIndex const > const & adjacency,
+                                            arrayView1d< real64 const > const & weights,
+                                            integer const numParts );
+
+};
+
+ENUM_STRINGS( GraphPartitioner::Method,
+              "generator",
+              "graph" )
+
+} /* namespace geosx */
+
+#endif /* GEOSX_MESHUTILITIES_GRAPHPARTITIONER_HPP_ */
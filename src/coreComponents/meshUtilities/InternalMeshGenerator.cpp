@@ -123,6 +123,11 @@ InternalMeshGenerator::InternalMeshGenerator( string const & name, Group * const
     setInputFlag( InputFlags::OPTIONAL )->
     setDescription( "pattern by which to decompose the hex mesh into prisms (more explanation required)" );
 
+  registerWrapper( keys::skewAngle, &m_skewAngle )->
+    setApplyDefaultValue( 0.0 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "angle (in radians) by which the mesh is sheared in the x-direction along the y-axis" );
+
 }
 
 InternalMeshGenerator::~InternalMeshGenerator()
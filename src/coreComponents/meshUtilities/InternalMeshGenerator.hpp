@@ -62,6 +62,8 @@ string const cellBlockNames = "cellBlockNames";
 string const elementTypes = "elementTypes";
 /// key for triangle pattern identifier
 string const trianglePattern = "trianglePattern";
+/// key for skew angle
+string const skewAngle = "skewAngle";
 }
 ///@}
 
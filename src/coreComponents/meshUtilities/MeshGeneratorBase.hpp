@@ -97,6 +97,12 @@ public:
  */
   virtual void RemapMesh ( dataRepository::Group * const domain ) = 0;
 
+  /**
+   * @brief Whether GenerateMesh() already distributes the cells with the graph partitioner.
+   * @return true if the cells must not be partitioned again by the MeshManager
+   */
+  virtual bool isGraphPartitioned() const { return false; }
+
   /// Integer to trigger or not mesh re-mapping at the end of GenerateMesh call
   int m_delayMeshDeformation = 0;
 
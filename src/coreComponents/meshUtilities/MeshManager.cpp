@@ -18,6 +18,7 @@
 #include "mpiCommunications/SpatialPartition.hpp"
 #include "MeshGeneratorBase.hpp"
 #include "common/TimingMacros.hpp"
+#include "mesh/CellBlockManager.hpp"
 
 namespace geosx
 {
@@ -26,14 +27,44 @@ using namespace dataRepository;
 
 MeshManager::MeshManager( std::string const & name,
                           Group * const parent ):
-  Group( name, parent )
+  Group( name, parent ),
+  m_partitioning( GraphPartitioner::Method::generator ),
+  m_partitionWeightField(),
+  m_reordering( MeshReordering::Method::none )
 {
   setInputFlags( InputFlags::REQUIRED );
+
+  registerWrapper( viewKeyStruct::partitioningString, &m_partitioning )->
+    setApplyDefaultValue( m_partitioning )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Distribution of the generated cells over the ranks. With \"graph\", the cell graph is partitioned "
+                    "with (Par)METIS and the cells are redistributed before faces and edges are built. "
+                    "A mesh read in parallel (numReaders > 0) is always graph partitioned by its reader.\n"
+                    "Available options are:\n* " + EnumStrings< GraphPartitioner::Method >::concat( "\n* " ) );
+
+  registerWrapper( viewKeyStruct::partitionWeightFieldString, &m_partitionWeightField )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Name of the cell block field used as cell weights by the graph partitioner "
+                    "(e.g. an imported active cell flag). Cells of blocks without this field have a unit weight." );
+
+  registerWrapper( viewKeyStruct::reorderingString, &m_reordering )->
+    setApplyDefaultValue( m_reordering )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Renumbering of the generated cells and nodes, applied before faces and edges are built. "
+                    "Available options are:\n* " + EnumStrings< MeshReordering::Method >::concat( "\n* " ) );
 }
 
 MeshManager::~MeshManager()
 {}
 
+void MeshManager::PostProcessInput()
+{
+#ifndef GEOSX_USE_METIS
+  GEOSX_ERROR_IF( m_partitioning == GraphPartitioner::Method::graph,
+                  "Mesh partitioning \"graph\" requires GEOSX to be built with METIS (ENABLE_METIS)" );
+#endif
+}
+
 Group * MeshManager::CreateChild( string const & childKey, string const & childName )
 {
   GEOSX_LOG_RANK_0( "Adding Mesh: " << childKey << ", " << childName );
@@ -54,10 +85,46 @@ void MeshManager::ExpandObjectCatalogs()
 
 void MeshManager::GenerateMeshes( DomainPartition * const domain )
 {
+  bool isGraphPartitioned = false;
   forSubGroups< MeshGeneratorBase >( [&]( MeshGeneratorBase & meshGen )
   {
     meshGen.GenerateMesh( domain );
+    isGraphPartitioned = isGraphPartitioned || meshGen.isGraphPartitioned();
   } );
+
+  CellBlockManager & cellBlockManager = *domain->GetGroup< CellBlockManager >( keys::cellManager );
+
+  // a mesh read in parallel is already balanced by the graph partitioner, do not partition it twice
+  bool const partition = m_partitioning == GraphPartitioner::Method::graph && !isGraphPartitioned;
+  GEOSX_LOG_RANK_0_IF( m_partitioning == GraphPartitioner::Method::graph && isGraphPartitioned,
+                       "Mesh read in parallel is already graph partitioned, skipping the partitioning of " << getName() );
+  GEOSX_ERROR_IF( isGraphPartitioned && !m_partitionWeightField.empty(),
+                  "Partition weights (" << m_partitionWeightField << ") are not supported for a mesh read in parallel" );
+
+  if( !partition && m_reordering == MeshReordering::Method::none )
+  {
+    return;
+  }
+
+  // the cell blocks are shared by all mesh bodies, but their connectivity refers to the nodes of a single one
+  GEOSX_ERROR_IF_NE_MSG( domain->getMeshBodies()->numSubGroups(), 1,
+                         "Mesh partitioning and reordering require a single mesh body" );
+  NodeManager & nodeManager = *domain->getMeshBody( 0 )->getMeshLevel( 0 )->getNodeManager();
+
+#ifdef GEOSX_USE_METIS
+  if( partition )
+  {
+    GraphPartitioner::partition( cellBlockManager,
+                                 nodeManager,
+                                 m_partitionWeightField,
+                                 domain->getMetisNeighborList() );
+  }
+#endif
+
+  if( m_reordering != MeshReordering::Method::none )
+  {
+    MeshReordering::reorder( m_reordering, cellBlockManager, nodeManager );
+  }
 }
 
 
@@ -21,6 +21,8 @@
 
 #include "dataRepository/Group.hpp"
 #include "managers/DomainPartition.hpp"
+#include "meshUtilities/GraphPartitioner.hpp"
+#include "meshUtilities/MeshReordering.hpp"
 
 namespace geosx
 {
@@ -68,6 +70,24 @@ public:
    */
   void GenerateMeshLevels( DomainPartition * const domain );
 
+  /**
+   * @brief Struct containing the keys to all MeshManager wrappers.
+   */
+  struct viewKeyStruct
+  {
+    /// Key for the partitioning method
+    static constexpr auto partitioningString = "partitioning";
+    /// Key for the name of the cell weight field used by the graph partitioner
+    static constexpr auto partitionWeightFieldString = "partitionWeightField";
+    /// Key for the reordering method
+    static constexpr auto reorderingString = "reordering";
+  };
+
+protected:
+
+  /// Check that the selected partitioning method is available in this build
+  virtual void PostProcessInput() override;
+
 private:
 
   /**
@@ -75,6 +95,15 @@ private:
    */
   MeshManager() = delete;
 
+  /// Method used to distribute the generated cells over the ranks
+  GraphPartitioner::Method m_partitioning;
+
+  /// Name of the cell block field used as cell weights by the graph partitioner
+  string m_partitionWeightField;
+
+  /// Method used to renumber the generated cells and nodes
+  MeshReordering::Method m_reordering;
+
 };
 
 } /* namespace geosx */
@@ -0,0 +1,418 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file MeshReordering.cpp
+ */
+
+#include "MeshReordering.hpp"
+
+#include "common/TimingMacros.hpp"
+#include "mesh/CellBlockManager.hpp"
+#include "mesh/NodeManager.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <set>
+
+namespace geosx
+{
+
+using namespace dataRepository;
+
+namespace
+{
+
+template< typename T >
+void permuteRows( array1d< T > & array,
+                  arrayView1d< localIndex const > const & newToOld )
+{
+  array1d< T > const copy( array );
+  for( localIndex i = 0; i < newToOld.size(); ++i )
+  {
+    array[i] = copy[newToOld[i]];
+  }
+}
+
+template< typename T, typename PERMUTATION >
+void permuteRows( Array< T, 2, PERMUTATION > & array,
+                  arrayView1d< localIndex const > const & newToOld )
+{
+  Array< T, 2, PERMUTATION > const copy( array );
+  for( localIndex i = 0; i < newToOld.size(); ++i )
+  {
+    for( localIndex j = 0; j < array.size( 1 ); ++j )
+    {
+      array( i, j ) = copy( newToOld[i], j );
+    }
+  }
+}
+
+/**
+ * @brief Permute the array fields sized with an object and renumber its sets.
+ * @param object the object to renumber
+ * @param newToOld the new-to-old permutation
+ * @param oldToNew the old-to-new permutation
+ * @param relations names of the relation maps that are renumbered by the caller or built after the reordering
+ *
+ * Any other field sized with the object that has a type not handled here is rejected, since it would
+ * otherwise be left in the old order.
+ */
+void permuteObject( ObjectManagerBase & object,
+                    arrayView1d< localIndex const > const & newToOld,
+                    arrayView1d< localIndex const > const & oldToNew,
+                    std::set< string > const & relations )
+{
+  localIndex const numRows = newToOld.size();
+
+  std::set< string > permuted;
+  object.forWrappers< array1d< real64 >,
+                      array1d< R1Tensor >,
+                      array1d< integer >,
+                      array1d< localIndex >,
+                      array1d< globalIndex >,
+                      array2d< real64 >,
+                      array2d< real64, nodes::REFERENCE_POSITION_PERM > >( [&]( auto & wrapper )
+  {
+    if( wrapper.sizedFromParent() == 1 && wrapper.reference().size( 0 ) == numRows )
+    {
+      permuteRows( wrapper.reference(), newToOld );
+      permuted.insert( wrapper.getName() );
+    }
+  } );
+
+  // a field with one or more entries per row has a size that is a multiple of the number of rows
+  object.forWrappers( [&]( WrapperBase const & wrapper )
+  {
+    string const & name = wrapper.getName();
+    bool const perRow = wrapper.sizedFromParent() == 1 && numRows > 1 &&
+                        wrapper.size() > 0 && wrapper.size() % numRows == 0;
+    GEOSX_ERROR_IF( perRow &&
+                    permuted.count( name ) == 0 &&
+                    relations.count( name ) == 0 &&
+                    name != ObjectManagerBase::viewKeyStruct::globalToLocalMapString,
+                    "Mesh reordering does not support field " << name << " of " << object.getName() <<
+                    " (type " << LvArray::system::demangle( wrapper.get_typeid().name() ) << ")" );
+  } );
+
+  object.sets().forWrappers< SortedArray< localIndex > >( [&]( auto & wrapper )
+  {
+    SortedArray< localIndex > & set = wrapper.reference();
+    std::vector< localIndex > renumbered;
+    renumbered.reserve( set.size() );
+    for( localIndex const i : set )
+    {
+      renumbered.emplace_back( oldToNew[i] );
+    }
+    set.clear();
+    set.insert( renumbered.begin(), renumbered.end() );
+  } );
+
+  object.ConstructGlobalToLocalMap();
+}
+
+/// Spread the lowest 21 bits of a coordinate so that they occupy every third bit
+std::uint64_t spreadBits( std::uint64_t x )
+{
+  x &= 0x1fffff;
+  x = ( x | x << 32 ) & 0x1f00000000ffff;
+  x = ( x | x << 16 ) & 0x1f0000ff0000ff;
+  x = ( x | x << 8 ) & 0x100f00f00f00f00f;
+  x = ( x | x << 4 ) & 0x10c30c30c30c30c3;
+  x = ( x | x << 2 ) & 0x1249249249249249;
+  return x;
+}
+
+}
+
+void MeshReordering::reorder( Method const method,
+                              CellBlockManager & cellBlockManager,
+                              NodeManager & nodeManager )
+{
+  GEOSX_MARK_FUNCTION;
+
+  if( method == Method::none )
+  {
+    return;
+  }
+
+  // flat numbering of the cells of all blocks, and flat cell-to-node map
+  std::vector< CellBlock * > blocks;
+  std::vector< localIndex > blockOffsets( 1, 0 );
+  cellBlockManager.forElementSubRegions( [&]( CellBlock & block )
+  {
+    blocks.emplace_back( &block );
+    blockOffsets.emplace_back( blockOffsets.back() + block.size() );
+  } );
+
+  localIndex const numCells = blockOffsets.back();
+  localIndex const numNodes = nodeManager.size();
+
+  array1d< localIndex > cellToNodeOffsets( numCells + 1 );
+  array1d< localIndex > cellToNodes;
+  for( std::size_t b = 0; b < blocks.size(); ++b )
+  {
+    arrayView2d< localIndex const, cells::NODE_MAP_USD > const & elemToNodes = blocks[b]->nodeList();
+    for( localIndex k = 0; k < elemToNodes.size( 0 ); ++k )
+    {
+      for( localIndex a = 0; a < elemToNodes.size( 1 ); ++a )
+      {
+        cellToNodes.emplace_back( elemToNodes( k, a ) );
+      }
+      cellToNodeOffsets[blockOffsets[b] + k + 1] = cellToNodes.size();
+    }
+  }
+
+  // new-to-old cell ordering
+  array1d< localIndex > cellNewToOld;
+  if( method == Method::rcm )
+  {
+    // node-to-cell map
+    array1d< localIndex > nodeToCellOffsets( numNodes + 1 );
+    for( localIndex const node : cellToNodes )
+    {
+      ++nodeToCellOffsets[node + 1];
+    }
+    std::partial_sum( nodeToCellOffsets.begin(), nodeToCellOffsets.end(), nodeToCellOffsets.begin() );
+
+    array1d< localIndex > nodeToCells( cellToNodes.size() );
+    array1d< localIndex > fill( numNodes );
+    for( localIndex c = 0; c < numCells; ++c )
+    {
+      for( localIndex k = cellToNodeOffsets[c]; k < cellToNodeOffsets[c + 1]; ++k )
+      {
+        localIndex const node = cellToNodes[k];
+        nodeToCells[nodeToCellOffsets[node] + fill[node]++] = c;
+      }
+    }
+
+    // cell graph: two cells are neighbors if they share a node
+    array1d< localIndex > adjacencyOffsets( numCells + 1 );
+    array1d< localIndex > adjacency;
+    std::vector< localIndex > neighbors;
+    for( localIndex c = 0; c < numCells; ++c )
+    {
+      neighbors.clear();
+      for( localIndex k = cellToNodeOffsets[c]; k < cellToNodeOffsets[c + 1]; ++k )
+      {
+        localIndex const node = cellToNodes[k];
+        for( localIndex j = nodeToCellOffsets[node]; j < nodeToCellOffsets[node + 1]; ++j )
+        {
+          if( nodeToCells[j] != c )
+          {
+            neighbors.emplace_back( nodeToCells[j] );
+          }
+        }
+      }
+      std::sort( neighbors.begin(), neighbors.end() );
+      neighbors.erase( std::unique( neighbors.begin(), neighbors.end() ), neighbors.end() );
+      for( localIndex const n : neighbors )
+      {
+        adjacency.emplace_back( n );
+      }
+      adjacencyOffsets[c + 1] = adjacency.size();
+    }
+
+    cellNewToOld = computeReverseCuthillMcKee( adjacencyOffsets.toViewConst(), adjacency.toViewConst() );
+  }
+  else
+  {
+    arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & X = nodeManager.referencePosition();
+
+    array2d< real64 > cellCenters( numCells, 3 );
+    for( localIndex c = 0; c < numCells; ++c )
+    {
+      localIndex const numCellNodes = cellToNodeOffsets[c + 1] - cellToNodeOffsets[c];
+      for( localIndex k = cellToNodeOffsets[c]; k < cellToNodeOffsets[c + 1]; ++k )
+      {
+        for( int d = 0; d < 3; ++d )
+        {
+          cellCenters( c, d ) += X( cellToNodes[k], d ) / numCellNodes;
+        }
+      }
+    }
+
+    cellNewToOld = computeMortonOrder( cellCenters.toViewConst() );
+  }
+
+  // nodes are numbered in the order they are first touched by the reordered cells
+  array1d< localIndex > nodeOldToNew( numNodes );
+  nodeOldToNew.setValues< serialPolicy >( -1 );
+  array1d< localIndex > nodeNewToOld;
+  nodeNewToOld.reserve( numNodes );
+  for( localIndex const c : cellNewToOld )
+  {
+    for( localIndex k = cellToNodeOffsets[c]; k < cellToNodeOffsets[c + 1]; ++k )
+    {
+      localIndex const node = cellToNodes[k];
+      if( nodeOldToNew[node] < 0 )
+      {
+        nodeOldToNew[node] = nodeNewToOld.size();
+        nodeNewToOld.emplace_back( node );
+      }
+    }
+  }
+  for( localIndex node = 0; node < numNodes; ++node )
+  {
+    if( nodeOldToNew[node] < 0 )
+    {
+      nodeOldToNew[node] = nodeNewToOld.size();
+      nodeNewToOld.emplace_back( node );
+    }
+  }
+
+  // split the cell ordering into the blocks
+  std::vector< array1d< localIndex > > blockNewToOld( blocks.size() );
+  for( localIndex const c : cellNewToOld )
+  {
+    std::size_t const b = std::upper_bound( blockOffsets.begin(), blockOffsets.end(), c ) - blockOffsets.begin() - 1;
+    blockNewToOld[b].emplace_back( c - blockOffsets[b] );
+  }
+
+  for( std::size_t b = 0; b < blocks.size(); ++b )
+  {
+    CellBlock & block = *blocks[b];
+
+    array1d< localIndex > oldToNew( block.size() );
+    for( localIndex k = 0; k < block.size(); ++k )
+    {
+      oldToNew[blockNewToOld[b][k]] = k;
+    }
+
+    CellBlock::NodeMapType & elemToNodes = block.nodeList();
+    for( localIndex k = 0; k < elemToNodes.size( 0 ); ++k )
+    {
+      for( localIndex a = 0; a < elemToNodes.size( 1 ); ++a )
+      {
+        elemToNodes( k, a ) = nodeOldToNew[elemToNodes( k, a )];
+      }
+    }
+    permuteRows( elemToNodes, blockNewToOld[b].toViewConst() );
+
+    // the cell-to-node map is renumbered above, the cell-to-edge and cell-to-face maps are built later
+    permuteObject( block, blockNewToOld[b].toViewConst(), oldToNew.toViewConst(),
+                   { CellBlock::viewKeyStruct::nodeListString,
+                     CellBlock::viewKeyStruct::edgeListString,
+                     CellBlock::viewKeyStruct::faceListString } );
+  }
+
+  // the node-to-edge, node-to-face and node-to-element maps are built after the reordering
+  permuteObject( nodeManager, nodeNewToOld.toViewConst(), nodeOldToNew.toViewConst(),
+                 { NodeManager::viewKeyStruct::edgeListString,
+                   NodeManager::viewKeyStruct::faceListString,
+                   NodeManager::viewKeyStruct::elementRegionListString,
+                   NodeManager::viewKeyStruct::elementSubRegionListString,
+                   NodeManager::viewKeyStruct::elementListString } );
+}
+
+array1d< localIndex > MeshReordering::computeReverseCuthillMcKee( arrayView1d< localIndex const > const & offsets,
+                                                                  arrayView1d< localIndex const > const & adjacency )
+{
+  localIndex const numVertices = offsets.size() - 1;
+
+  auto const degreeLess = [&]( localIndex const u, localIndex const v )
+  {
+    return offsets[u + 1] - offsets[u] < offsets[v + 1] - offsets[v];
+  };
+
+  std::vector< localIndex > seeds( numVertices );
+  std::iota( seeds.begin(), seeds.end(), 0 );
+  std::stable_sort( seeds.begin(), seeds.end(), degreeLess );
+
+  array1d< localIndex > order;
+  order.reserve( numVertices );
+  array1d< integer > visited( numVertices );
+  std::vector< localIndex > neighbors;
+
+  // each connected component is traversed breadth-first from its vertex of minimum degree,
+  // visiting the neighbors of a vertex by increasing degree
+  for( localIndex const seed : seeds )
+  {
+    if( visited[seed] )
+    {
+      continue;
+    }
+    visited[seed] = 1;
+    order.emplace_back( seed );
+
+    for( localIndex head = order.size() - 1; head < order.size(); ++head )
+    {
+      localIndex const v = order[head];
+      neighbors.clear();
+      for( localIndex k = offsets[v]; k < offsets[v + 1]; ++k )
+      {
+        localIndex const u = adjacency[k];
+        if( !visited[u] )
+        {
+          visited[u] = 1;
+          neighbors.emplace_back( u );
+        }
+      }
+      std::stable_sort( neighbors.begin(), neighbors.end(), degreeLess );
+      for( localIndex const u : neighbors )
+      {
+        order.emplace_back( u );
+      }
+    }
+  }
+
+  std::reverse( order.begin(), order.end() );
+  return order;
+}
+
+array1d< localIndex > MeshReordering::computeMortonOrder( arrayView2d< real64 const > const & points )
+{
+  localIndex const numPoints = points.size( 0 );
+
+  real64 xMin[3] = { std::numeric_limits< real64 >::max(),
+                     std::numeric_limits< real64 >::max(),
+                     std::numeric_limits< real64 >::max() };
+  real64 xMax[3] = { std::numeric_limits< real64 >::lowest(),
+                     std::numeric_limits< real64 >::lowest(),
+                     std::numeric_limits< real64 >::lowest() };
+  for( localIndex i = 0; i < numPoints; ++i )
+  {
+    for( int d = 0; d < 3; ++d )
+    {
+      xMin[d] = std::min( xMin[d], points( i, d ) );
+      xMax[d] = std::max( xMax[d], points( i, d ) );
+    }
+  }
+
+  // 21 bits per dimension fill a 64-bit key
+  real64 constexpr maxCoord = ( 1 << 21 ) - 1;
+  std::vector< std::pair< std::uint64_t, localIndex > > keys( numPoints );
+  for( localIndex i = 0; i < numPoints; ++i )
+  {
+    std::uint64_t key = 0;
+    for( int d = 0; d < 3; ++d )
+    {
+      real64 const extent = xMax[d] - xMin[d];
+      real64 const scaled = extent > 0.0 ? ( points( i, d ) - xMin[d] ) / extent * maxCoord : 0.0;
+      key |= spreadBits( static_cast< std::uint64_t >( scaled ) ) << d;
+    }
+    keys[i] = std::make_pair( key, i );
+  }
+  std::sort( keys.begin(), keys.end() );
+
+  array1d< localIndex > order( numPoints );
+  for( localIndex i = 0; i < numPoints; ++i )
+  {
+    order[i] = keys[i].second;
+  }
+  return order;
+}
+
+} /* namespace geosx */
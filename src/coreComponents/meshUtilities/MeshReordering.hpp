@@ -0,0 +1,92 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file MeshReordering.hpp
+ */
+
+#ifndef GEOSX_MESHUTILITIES_MESHREORDERING_HPP_
+#define GEOSX_MESHUTILITIES_MESHREORDERING_HPP_
+
+#include "common/DataTypes.hpp"
+#include "common/EnumStrings.hpp"
+
+namespace geosx
+{
+
+class CellBlockManager;
+class NodeManager;
+
+/**
+ * @class MeshReordering
+ * @brief Bandwidth-reducing renumbering of the locally generated cells and nodes.
+ *
+ * The reordering is applied right after mesh generation, before faces and edges are built, so that all
+ * maps derived from the cell-to-node connectivity inherit the new order. Cells are permuted within each
+ * CellBlock following a single ordering of all local cells, and nodes are renumbered in the order in which
+ * they are first touched by the reordered cells. Global indices are not modified.
+ */
+class MeshReordering
+{
+public:
+
+  /**
+   * @brief Reordering methods.
+   */
+  enum class Method : integer
+  {
+    none,   ///< keep the generator order
+    rcm,    ///< reverse Cuthill-McKee ordering of the cell graph (cells sharing a node are neighbors)
+    morton  ///< Morton (Z-order) space-filling curve over the cell centers
+  };
+
+  /**
+   * @brief Renumber the cells of all cell blocks and the nodes.
+   * @param[in] method the reordering method
+   * @param[in,out] cellBlockManager the cell blocks filled by the mesh generators
+   * @param[in,out] nodeManager the nodes filled by the mesh generators
+   *
+   * Array fields sized with the objects (coordinates, local-to-global maps, imported properties) are
+   * permuted accordingly, and node and element sets are renumbered.
+   */
+  static void reorder( Method const method,
+                       CellBlockManager & cellBlockManager,
+                       NodeManager & nodeManager );
+
+  /**
+   * @brief Compute the reverse Cuthill-McKee ordering of a graph.
+   * @param[in] offsets the offsets of the adjacency lists of each vertex (size numVertices + 1)
+   * @param[in] adjacency the concatenated adjacency lists
+   * @return the new-to-old vertex permutation
+   */
+  static array1d< localIndex > computeReverseCuthillMcKee( arrayView1d< localIndex const > const & offsets,
+                                                           arrayView1d< localIndex const > const & adjacency );
+
+  /**
+   * @brief Compute the Morton (Z-order) ordering of a set of points.
+   * @param[in] points the point coordinates
+   * @return the new-to-old point permutation
+   */
+  static array1d< localIndex > computeMortonOrder( arrayView2d< real64 const > const & points );
+
+};
+
+ENUM_STRINGS( MeshReordering::Method,
+              "none",
+              "rcm",
+              "morton" )
+
+} /* namespace geosx */
+
+#endif /* GEOSX_MESHUTILITIES_MESHREORDERING_HPP_ */
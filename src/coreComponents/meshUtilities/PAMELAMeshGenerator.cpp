@@ -18,12 +18,15 @@
 
 #include "PAMELAMeshGenerator.hpp"
 
+#include "DistributedGmshReader.hpp"
+#include "GraphPartitioner.hpp"
 #include "Elements/Element.hpp"
 #include "MeshDataWriters/Variable.hpp"
 #include "managers/DomainPartition.hpp"
 
 #include <math.h>
 
+#include "mpiCommunications/MpiWrapper.hpp"
 #include "mpiCommunications/PartitionBase.hpp"
 #include "mpiCommunications/SpatialPartition.hpp"
 #include "Mesh/MeshFactory.hpp"
@@ -59,6 +62,15 @@ PAMELAMeshGenerator::PAMELAMeshGenerator( string const & name, Group * const par
   registerWrapper( viewKeyStruct::reverseZString, &m_isZReverse )->
     setInputFlag( InputFlags::OPTIONAL )->
     setDefaultValue( 0 )->setDescription( "0 : Z coordinate is upward, 1 : Z coordinate is downward" );
+  registerWrapper( viewKeyStruct::numReadersString, &m_numReaders )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setApplyDefaultValue( 0 )->
+    setDescription( "Number of ranks reading the file in parallel and distributing the mesh (GMSH format 2 ASCII files only). "
+                    "If 0, the full mesh is loaded by PAMELA on every rank." );
+  registerWrapper( viewKeyStruct::readChunkSizeString, &m_readChunkSize )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setApplyDefaultValue( 100000 )->
+    setDescription( "Number of lines parsed by each reader between two exchanges, when reading in parallel" );
 }
 
 PAMELAMeshGenerator::~PAMELAMeshGenerator()
@@ -69,6 +81,21 @@ void PAMELAMeshGenerator::GenerateElementRegions( DomainPartition & GEOSX_UNUSED
 
 void PAMELAMeshGenerator::PostProcessInput()
 {
+  GEOSX_ERROR_IF_LT_MSG( m_numReaders, 0, "Invalid number of readers for " << getName() );
+  GEOSX_ERROR_IF_LE_MSG( m_readChunkSize, 0, "Invalid read chunk size for " << getName() );
+  GEOSX_ERROR_IF_NE_MSG( m_fieldsToImport.size(), m_fieldNamesInGEOSX.size(),
+                         "The fields to import and their names in GEOSX must have the same size in " << getName() );
+
+  if( m_numReaders > 0 )
+  {
+    string const extension = m_filePath.substr( m_filePath.find_last_of( '.' ) + 1 );
+    GEOSX_ERROR_IF( extension != "msh", "Only GMSH files can be read in parallel, " << m_filePath << " is not" );
+#ifndef GEOSX_USE_METIS
+    GEOSX_ERROR( "The parallel import of " << m_filePath << " requires GEOSX to be built with METIS (ENABLE_METIS)" );
+#endif
+    return;
+  }
+
   m_pamelaMesh =
     std::unique_ptr< PAMELA::Mesh >
       ( PAMELA::MeshFactory::makeMesh( m_filePath ) );
@@ -93,6 +120,12 @@ Group * PAMELAMeshGenerator::CreateChild( string const & GEOSX_UNUSED_PARAM( chi
 
 void PAMELAMeshGenerator::GenerateMesh( DomainPartition * const domain )
 {
+  if( m_numReaders > 0 )
+  {
+    GenerateMeshInParallel( *domain );
+    return;
+  }
+
   GEOSX_LOG_RANK_0( "Writing into the GEOSX mesh data structure" );
   domain->getMetisNeighborList() = m_pamelaMesh->getNeighborList();
   Group * const meshBodies = domain->GetGroup( std::string( "MeshBodies" ));
@@ -387,6 +420,45 @@ void PAMELAMeshGenerator::GenerateMesh( DomainPartition * const domain )
 
 }
 
+void PAMELAMeshGenerator::GenerateMeshInParallel( DomainPartition & domain )
+{
+  MeshBody * const meshBody = domain.GetGroup( std::string( "MeshBodies" ) )->RegisterGroup< MeshBody >( this->getName() );
+  MeshLevel * const meshLevel0 = meshBody->RegisterGroup< MeshLevel >( std::string( "Level0" ) );
+  NodeManager & nodeManager = *meshLevel0->getNodeManager();
+  CellBlockManager & cellBlockManager = *domain.GetGroup< CellBlockManager >( keys::cellManager );
+
+  DistributedGmshReader const reader( m_filePath, m_numReaders, m_readChunkSize );
+  reader.read( m_fieldsToImport, m_fieldNamesInGEOSX, m_scale, m_isZReverse != 0, cellBlockManager, nodeManager );
+
+#ifdef GEOSX_USE_METIS
+  // the cells are distributed following the numbering of the file, balance them and find the neighbors
+  GraphPartitioner::partition( cellBlockManager, nodeManager, "", domain.getMetisNeighborList() );
+#endif
+
+  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & X = nodeManager.referencePosition();
+  R1Tensor xMin( std::numeric_limits< real64 >::max(),
+                 std::numeric_limits< real64 >::max(),
+                 std::numeric_limits< real64 >::max() );
+  R1Tensor xMax( std::numeric_limits< real64 >::lowest(),
+                 std::numeric_limits< real64 >::lowest(),
+                 std::numeric_limits< real64 >::lowest() );
+  for( localIndex a = 0; a < nodeManager.size(); ++a )
+  {
+    for( int i = 0; i < 3; ++i )
+    {
+      xMin[i] = std::min( xMin[i], X( a, i ) );
+      xMax[i] = std::max( xMax[i], X( a, i ) );
+    }
+  }
+  for( int i = 0; i < 3; ++i )
+  {
+    xMin[i] = MpiWrapper::Min( xMin[i] );
+    xMax[i] = MpiWrapper::Max( xMax[i] );
+  }
+  xMax -= xMin;
+  meshBody->setGlobalLengthScale( std::fabs( xMax.L2_Norm() ) );
+}
+
 void PAMELAMeshGenerator::GetElemToNodesRelationInBox( const std::string & GEOSX_UNUSED_PARAM( elementType ),
                                                        const int GEOSX_UNUSED_PARAM( index )[],
                                                        const int & GEOSX_UNUSED_PARAM( iEle ),
@@ -64,6 +64,8 @@ public:
     constexpr static auto fieldsToImportString = "fieldsToImport";
     constexpr static auto fieldNamesInGEOSXString = "fieldNamesInGEOSX";
     constexpr static auto reverseZString = "reverseZ";
+    constexpr static auto numReadersString = "numReaders";
+    constexpr static auto readChunkSizeString = "readChunkSize";
   };
 /// @endcond
 
@@ -79,6 +81,13 @@ public:
 
   virtual void GenerateMesh( DomainPartition * const domain ) override;
 
+  /**
+   * @copydoc MeshGeneratorBase::isGraphPartitioned()
+   *
+   * The cells read in parallel follow the numbering of the file and are always balanced by the graph partitioner.
+   */
+  virtual bool isGraphPartitioned() const override { return m_numReaders > 0; }
+
   virtual void GetElemToNodesRelationInBox ( const std::string & elementType,
                                              const int index[],
                                              const int & iEle,
@@ -98,6 +107,12 @@ protected:
 
 private:
 
+  /**
+   * @brief Read a GMSH file on a few ranks and distribute it, instead of loading it on every rank with PAMELA.
+   * @param domain the domain in which the mesh is generated
+   */
+  void GenerateMeshInParallel( DomainPartition & domain );
+
   /// Unique Pointer to the Mesh in the data structure of PAMELA.
   std::unique_ptr< PAMELA::Mesh >  m_pamelaMesh;
 
@@ -116,6 +131,12 @@ private:
   /// z pointing direction flag, 0 (default) is upward, 1 is downward
   int m_isZReverse;
 
+  /// Number of ranks reading the file in parallel, 0 to load the full mesh on every rank with PAMELA
+  integer m_numReaders;
+
+  /// Number of lines parsed by each reader between two exchanges, in parallel reading
+  integer m_readChunkSize;
+
   /// Map from PAMELA enumeration element type to string
   const std::unordered_map< PAMELA::ELEMENTS::TYPE, string, PAMELA::ELEMENTS::EnumClassHash > ElementToLabel
     =
@@ -279,7 +279,7 @@ void PerforationData::ConnectToMeshElements( MeshLevel const & mesh,
 
 
 void PerforationData::ConnectToWellElements( InternalWellGenerator const & wellGeometry,
-                                             unordered_map< globalIndex, localIndex > const & globalToLocalWellElemMap,
+                                             indexMap< globalIndex, localIndex > const & globalToLocalWellElemMap,
                                              globalIndex elemOffsetGlobal )
 {
   arrayView1d< globalIndex const > const & perfElemIndexGlobal = wellGeometry.GetPerfElemIndex();
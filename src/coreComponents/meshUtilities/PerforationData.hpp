@@ -218,7 +218,7 @@ public:
    * @param[in] elemOffsetGlobal the offset of the first global well element ( = offset of last global mesh elem + 1 )
    */
   void ConnectToWellElements( InternalWellGenerator const & wellGeometry,
-                              unordered_map< globalIndex, localIndex > const & globalToLocalWellElementMap,
+                              indexMap< globalIndex, localIndex > const & globalToLocalWellElementMap,
                               globalIndex elemOffsetGlobal );
 
   ///@}
@@ -0,0 +1,235 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// Source includes
+#include "managers/initialization.hpp"
+#include "managers/DomainPartition.hpp"
+#include "mesh/CellBlockManager.hpp"
+#include "mesh/MeshBody.hpp"
+#include "meshUtilities/DistributedGmshReader.hpp"
+#include "mpiCommunications/MpiWrapper.hpp"
+#include "tests/meshFileNames.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+
+// System includes
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <sstream>
+
+using namespace geosx;
+using namespace geosx::dataRepository;
+
+namespace
+{
+
+/// Serial parse of the nodes and of the tetrahedra of a GMSH 2.2 file, listed in increasing number order in the file
+struct GmshFile
+{
+  std::vector< globalIndex > nodeNumbers;
+  std::vector< std::array< real64, 3 > > nodeCoords;
+  std::vector< globalIndex > cellNumbers;
+  std::vector< std::array< globalIndex, 4 > > cellNodes;
+
+  explicit GmshFile( string const & filePath )
+  {
+    std::ifstream file( filePath );
+    string line;
+    while( std::getline( file, line ) )
+    {
+      if( line.compare( 0, 6, "$Nodes" ) == 0 )
+      {
+        std::getline( file, line );
+        localIndex const numNodes = std::stol( line );
+        for( localIndex n = 0; n < numNodes; ++n )
+        {
+          std::getline( file, line );
+          std::istringstream record( line );
+          globalIndex number;
+          std::array< real64, 3 > x;
+          record >> number >> x[0] >> x[1] >> x[2];
+          nodeNumbers.emplace_back( number );
+          nodeCoords.emplace_back( x );
+        }
+      }
+      else if( line.compare( 0, 9, "$Elements" ) == 0 )
+      {
+        std::getline( file, line );
+        localIndex const numElements = std::stol( line );
+        for( localIndex e = 0; e < numElements; ++e )
+        {
+          std::getline( file, line );
+          std::istringstream record( line );
+          globalIndex number;
+          integer type, numTags, tag;
+          record >> number >> type >> numTags;
+          for( integer t = 0; t < numTags; ++t )
+          {
+            record >> tag;
+          }
+          if( type == 4 )
+          {
+            std::array< globalIndex, 4 > nodes;
+            record >> nodes[0] >> nodes[1] >> nodes[2] >> nodes[3];
+            cellNumbers.emplace_back( number );
+            cellNodes.emplace_back( nodes );
+          }
+        }
+      }
+    }
+  }
+
+  std::array< real64, 3 > const & coordinates( globalIndex const nodeNumber ) const
+  {
+    auto const it = std::lower_bound( nodeNumbers.begin(), nodeNumbers.end(), nodeNumber );
+    return nodeCoords[it - nodeNumbers.begin()];
+  }
+};
+
+/// Count the ranks holding each global index
+array1d< integer > countHolders( std::vector< globalIndex > const & localIndices, globalIndex const numGlobal )
+{
+  array1d< integer > localCount( numGlobal );
+  for( globalIndex const i : localIndices )
+  {
+    EXPECT_GE( i, 0 );
+    EXPECT_LT( i, numGlobal );
+    if( i >= 0 && i < numGlobal )
+    {
+      ++localCount[i];
+    }
+  }
+  array1d< integer > globalCount( numGlobal );
+  MpiWrapper::allReduce( localCount.data(), globalCount.data(), LvArray::integerConversion< int >( numGlobal ),
+                         MPI_SUM, MPI_COMM_GEOSX );
+  return globalCount;
+}
+
+void testParallelRead( integer const numReaders, localIndex const chunkSize )
+{
+  GmshFile const reference( gmshFilePath );
+  globalIndex const numCells = LvArray::integerConversion< globalIndex >( reference.cellNumbers.size() );
+  globalIndex const numNodes = LvArray::integerConversion< globalIndex >( reference.nodeNumbers.size() );
+  ASSERT_GT( numCells, 0 );
+
+  // the surface elements are numbered before the cells, leaving a gap in the element numbers
+  ASSERT_GT( reference.cellNumbers.front(), 1 );
+
+  std::unique_ptr< DomainPartition > domain = std::make_unique< DomainPartition >( "domain", nullptr );
+  MeshLevel & meshLevel = *domain->getMeshBodies()->RegisterGroup< MeshBody >( "body" )->RegisterGroup< MeshLevel >( "Level0" );
+  NodeManager & nodeManager = *meshLevel.getNodeManager();
+  CellBlockManager & cellBlockManager = *domain->GetGroup< CellBlockManager >( keys::cellManager );
+
+  string_array fieldsToImport;
+  fieldsToImport.emplace_back( "barycenter" );
+  DistributedGmshReader const reader( gmshFilePath, numReaders, chunkSize );
+  reader.read( fieldsToImport, fieldsToImport, 1.0, false, cellBlockManager, nodeManager );
+
+  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const X = nodeManager.referencePosition();
+  arrayView1d< globalIndex const > const nodeLocalToGlobal = nodeManager.localToGlobalMap();
+
+  // node global indices are compact, and the coordinates are those of the node with this rank in the file
+  std::vector< globalIndex > localNodeIndices( nodeLocalToGlobal.begin(), nodeLocalToGlobal.end() );
+  for( localIndex a = 0; a < nodeManager.size(); ++a )
+  {
+    ASSERT_GE( nodeLocalToGlobal[a], 0 );
+    ASSERT_LT( nodeLocalToGlobal[a], numNodes );
+    std::array< real64, 3 > const & x = reference.nodeCoords[nodeLocalToGlobal[a]];
+    for( int d = 0; d < 3; ++d )
+    {
+      EXPECT_EQ( X( a, d ), x[d] );
+    }
+  }
+
+  // all ranks hold the same cell blocks
+  localIndex const numBlocks = cellBlockManager.GetGroup( keys::cellBlocks )->numSubGroups();
+  EXPECT_EQ( MpiWrapper::Min( numBlocks ), MpiWrapper::Max( numBlocks ) );
+
+  // cell global indices are compact: global index i is the i-th cell of the file
+  std::vector< globalIndex > localCellIndices;
+  cellBlockManager.forElementSubRegions( [&]( CellBlock & block )
+  {
+    arrayView2d< localIndex const, cells::NODE_MAP_USD > const elemToNodes = block.nodeList();
+    arrayView1d< R1Tensor const > const barycenter = block.getReference< array1d< R1Tensor > >( "barycenter" );
+    for( localIndex k = 0; k < block.size(); ++k )
+    {
+      globalIndex const cell = block.localToGlobalMap()[k];
+      localCellIndices.emplace_back( cell );
+      ASSERT_GE( cell, 0 );
+      ASSERT_LT( cell, numCells );
+
+      real64 center[3] = { 0.0, 0.0, 0.0 };
+      for( localIndex a = 0; a < elemToNodes.size( 1 ); ++a )
+      {
+        std::array< real64, 3 > const & x = reference.coordinates( reference.cellNodes[cell][a] );
+        for( int d = 0; d < 3; ++d )
+        {
+          EXPECT_EQ( X( elemToNodes( k, a ), d ), x[d] );
+          center[d] += x[d] / elemToNodes.size( 1 );
+        }
+      }
+
+      // the imported values follow their cells
+      for( int d = 0; d < 3; ++d )
+      {
+        EXPECT_NEAR( barycenter[k][d], center[d], 1e-3 );
+      }
+    }
+  } );
+
+  // each cell is held by exactly one rank, and each node by at least one
+  array1d< integer > const cellCount = countHolders( localCellIndices, numCells );
+  for( globalIndex c = 0; c < numCells; ++c )
+  {
+    EXPECT_EQ( cellCount[c], 1 ) << "cell " << c;
+  }
+  EXPECT_EQ( MpiWrapper::Sum( LvArray::integerConversion< globalIndex >( localCellIndices.size() ) ), numCells );
+
+  array1d< integer > const nodeCount = countHolders( localNodeIndices, numNodes );
+  std::vector< integer > usedNodes( numNodes, 0 );
+  for( std::array< globalIndex, 4 > const & nodes : reference.cellNodes )
+  {
+    for( globalIndex const node : nodes )
+    {
+      usedNodes[std::lower_bound( reference.nodeNumbers.begin(), reference.nodeNumbers.end(), node ) - reference.nodeNumbers.begin()] = 1;
+    }
+  }
+  for( globalIndex n = 0; n < numNodes; ++n )
+  {
+    EXPECT_EQ( nodeCount[n] > 0, usedNodes[n] > 0 ) << "node " << n;
+  }
+}
+
+}
+
+TEST( DistributedGmshReader, twoReaders )
+{
+  testParallelRead( 2, 1000 );
+}
+
+TEST( DistributedGmshReader, allRanksRead )
+{
+  testParallelRead( MpiWrapper::Comm_size( MPI_COMM_GEOSX ), 500 );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
@@ -0,0 +1,127 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// Source includes
+#include "managers/initialization.hpp"
+#include "meshUtilities/GraphPartitioner.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+
+using namespace geosx;
+
+namespace
+{
+
+/// 5-point graph of a nx * ny grid
+void gridGraph( localIndex const nx,
+                localIndex const ny,
+                array1d< localIndex > & offsets,
+                array1d< globalIndex > & adjacency )
+{
+  offsets.resize( nx * ny + 1 );
+  adjacency.clear();
+  for( localIndex i = 0; i < nx; ++i )
+  {
+    for( localIndex j = 0; j < ny; ++j )
+    {
+      if( i > 0 ) { adjacency.emplace_back( ( i - 1 ) * ny + j ); }
+      if( i < nx - 1 ) { adjacency.emplace_back( ( i + 1 ) * ny + j ); }
+      if( j > 0 ) { adjacency.emplace_back( i * ny + j - 1 ); }
+      if( j < ny - 1 ) { adjacency.emplace_back( i * ny + j + 1 ); }
+      offsets[i * ny + j + 1] = adjacency.size();
+    }
+  }
+}
+
+void checkBalance( arrayView1d< integer const > const & parts,
+                   arrayView1d< real64 const > const & weights,
+                   integer const numParts )
+{
+  array1d< real64 > partWeights( numParts );
+  real64 totalWeight = 0.0;
+  for( localIndex v = 0; v < parts.size(); ++v )
+  {
+    ASSERT_GE( parts[v], 0 );
+    ASSERT_LT( parts[v], numParts );
+    partWeights[parts[v]] += weights[v];
+    totalWeight += weights[v];
+  }
+
+  for( integer p = 0; p < numParts; ++p )
+  {
+    EXPECT_GT( partWeights[p], 0.0 );
+    EXPECT_LE( partWeights[p], 1.1 * totalWeight / numParts );
+  }
+}
+
+}
+
+TEST( GraphPartitioner, balancesUnitWeights )
+{
+  localIndex constexpr nx = 40;
+  localIndex constexpr ny = 20;
+  integer constexpr numParts = 4;
+
+  array1d< localIndex > offsets;
+  array1d< globalIndex > adjacency;
+  gridGraph( nx, ny, offsets, adjacency );
+
+  array1d< real64 > weights( nx * ny );
+  weights.setValues< serialPolicy >( 1.0 );
+
+  array1d< integer > const parts = GraphPartitioner::partitionGraph( offsets.toViewConst(),
+                                                                     adjacency.toViewConst(),
+                                                                     weights.toViewConst(),
+                                                                     numParts );
+  ASSERT_EQ( parts.size(), nx * ny );
+  checkBalance( parts.toViewConst(), weights.toViewConst(), numParts );
+}
+
+TEST( GraphPartitioner, balancesCellWeights )
+{
+  // only the first quarter of the rows is active, a Cartesian split along x would leave 3 parts idle
+  localIndex constexpr nx = 40;
+  localIndex constexpr ny = 20;
+  integer constexpr numParts = 4;
+
+  array1d< localIndex > offsets;
+  array1d< globalIndex > adjacency;
+  gridGraph( nx, ny, offsets, adjacency );
+
+  array1d< real64 > weights( nx * ny );
+  for( localIndex i = 0; i < nx / 4; ++i )
+  {
+    for( localIndex j = 0; j < ny; ++j )
+    {
+      weights[i * ny + j] = 1.0;
+    }
+  }
+
+  array1d< integer > const parts = GraphPartitioner::partitionGraph( offsets.toViewConst(),
+                                                                     adjacency.toViewConst(),
+                                                                     weights.toViewConst(),
+                                                                     numParts );
+  ASSERT_EQ( parts.size(), nx * ny );
+  checkBalance( parts.toViewConst(), weights.toViewConst(), numParts );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
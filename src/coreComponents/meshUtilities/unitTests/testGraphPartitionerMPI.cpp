@@ -0,0 +1,190 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// Source includes
+#include "managers/initialization.hpp"
+#include "managers/DomainPartition.hpp"
+#include "managers/ProblemManager.hpp"
+#include "mesh/CellElementSubRegion.hpp"
+#include "meshUtilities/MeshManager.hpp"
+#include "mpiCommunications/CommunicationTools.hpp"
+#include "mpiCommunications/NeighborCommunicator.hpp"
+#include "linearAlgebra/unitTests/testDofManagerUtils.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+
+using namespace geosx;
+using namespace geosx::testing;
+
+// Most cells are in the first quarter of the domain, which the Cartesian partition gives to a single rank
+char const * xmlInput =
+  "<Problem>"
+  "  <Mesh partitioning=\"graph\">"
+  "    <InternalMesh name=\"mesh1\""
+  "                  elementTypes=\"{C3D8, C3D8}\""
+  "                  xCoords=\"{0, 1, 10}\""
+  "                  yCoords=\"{0, 1}\""
+  "                  zCoords=\"{0, 1}\""
+  "                  nx=\"{12, 4}\""
+  "                  ny=\"{4}\""
+  "                  nz=\"{2}\""
+  "                  cellBlockNames=\"{block1, block2}\"/>"
+  "  </Mesh>"
+  "  <ElementRegions>"
+  "    <CellElementRegion name=\"region1\" cellBlocks=\"{block1, block2}\" materialList=\"{}\" />"
+  "  </ElementRegions>"
+  "</Problem>";
+
+globalIndex constexpr numGlobalCells = ( 12 + 4 ) * 4 * 2;
+globalIndex constexpr numGlobalNodes = ( 12 + 4 + 1 ) * ( 4 + 1 ) * ( 2 + 1 );
+
+char const * const fieldName = "graphPartitionerTestField";
+
+class GraphPartitionerMPITest : public ::testing::Test
+{
+public:
+
+  GraphPartitionerMPITest():
+    problemManager( std::make_unique< ProblemManager >( "Problem", nullptr ) )
+  {}
+
+protected:
+
+  void SetUp() override
+  {
+    setupProblemFromXML( problemManager.get(), xmlInput );
+    domain = problemManager->getDomainPartition();
+    mesh = domain->getMeshBody( 0 )->getMeshLevel( 0 );
+  }
+
+  /// Count the ranks owning each global index, checking that ghosts are never counted
+  static array1d< integer > countOwners( arrayView1d< globalIndex const > const & localToGlobal,
+                                         arrayView1d< integer const > const & ghostRank,
+                                         globalIndex const numGlobal )
+  {
+    array1d< integer > localCount( numGlobal );
+    for( localIndex i = 0; i < localToGlobal.size(); ++i )
+    {
+      EXPECT_GE( localToGlobal[i], 0 );
+      EXPECT_LT( localToGlobal[i], numGlobal );
+      if( ghostRank[i] < 0 )
+      {
+        ++localCount[localToGlobal[i]];
+      }
+    }
+    array1d< integer > globalCount( numGlobal );
+    MpiWrapper::allReduce( localCount.data(), globalCount.data(), LvArray::integerConversion< int >( numGlobal ),
+                           MPI_SUM, MPI_COMM_GEOSX );
+    return globalCount;
+  }
+
+  std::unique_ptr< ProblemManager > const problemManager;
+  DomainPartition * domain;
+  MeshLevel * mesh;
+};
+
+TEST_F( GraphPartitionerMPITest, cellsAreOwnedOnceAndBalanced )
+{
+  ElementRegionManager & elemManager = *mesh->getElemManager();
+
+  array1d< integer > localCellCount( numGlobalCells );
+  localIndex numOwnedCells = 0;
+  elemManager.forElementSubRegions< CellElementSubRegion >( [&]( CellElementSubRegion const & subRegion )
+  {
+    array1d< integer > const count = countOwners( subRegion.localToGlobalMap(),
+                                                  subRegion.ghostRank(),
+                                                  numGlobalCells );
+    for( globalIndex c = 0; c < numGlobalCells; ++c )
+    {
+      localCellCount[c] += count[c];
+    }
+    for( localIndex k = 0; k < subRegion.size(); ++k )
+    {
+      numOwnedCells += subRegion.ghostRank()[k] < 0;
+    }
+  } );
+
+  // each cell is owned by exactly one rank, in exactly one block
+  for( globalIndex c = 0; c < numGlobalCells; ++c )
+  {
+    EXPECT_EQ( localCellCount[c], 1 ) << "cell " << c;
+  }
+
+  // the cells are redistributed evenly, although the Cartesian partition is heavily unbalanced
+  int const numRanks = MpiWrapper::Comm_size( MPI_COMM_GEOSX );
+  EXPECT_GT( numOwnedCells, 0 );
+  EXPECT_EQ( MpiWrapper::Sum( numOwnedCells ), numGlobalCells );
+  EXPECT_LE( MpiWrapper::Max( numOwnedCells ), 1.1 * numGlobalCells / numRanks );
+}
+
+TEST_F( GraphPartitionerMPITest, nodesAreOwnedOnce )
+{
+  NodeManager const & nodeManager = *mesh->getNodeManager();
+  array1d< integer > const count = countOwners( nodeManager.localToGlobalMap(),
+                                                nodeManager.ghostRank(),
+                                                numGlobalNodes );
+  for( globalIndex n = 0; n < numGlobalNodes; ++n )
+  {
+    EXPECT_EQ( count[n], 1 ) << "node " << n;
+  }
+}
+
+TEST_F( GraphPartitionerMPITest, ghostExchange )
+{
+  if( MpiWrapper::Comm_size( MPI_COMM_GEOSX ) == 1 )
+  {
+    return;
+  }
+
+  // the neighbors found by the partitioner are used to build the ghosts
+  EXPECT_FALSE( domain->getNeighbors().empty() );
+
+  ElementRegionManager & elemManager = *mesh->getElemManager();
+  localIndex numGhostCells = 0;
+  elemManager.forElementSubRegions< CellElementSubRegion >( [&]( CellElementSubRegion & subRegion )
+  {
+    array1d< real64 > & field = subRegion.registerWrapper< array1d< real64 > >( fieldName )->reference();
+    field.resize( subRegion.size() );
+    for( localIndex k = 0; k < subRegion.size(); ++k )
+    {
+      field[k] = subRegion.ghostRank()[k] < 0 ? subRegion.localToGlobalMap()[k] : -1.0;
+      numGhostCells += subRegion.ghostRank()[k] >= 0;
+    }
+  } );
+  EXPECT_GT( numGhostCells, 0 );
+
+  std::map< string, string_array > fieldNames;
+  fieldNames["elems"].emplace_back( fieldName );
+  CommunicationTools::SynchronizeFields( fieldNames, mesh, domain->getNeighbors() );
+
+  // every ghost cell received the value of its owner
+  elemManager.forElementSubRegions< CellElementSubRegion >( [&]( CellElementSubRegion const & subRegion )
+  {
+    arrayView1d< real64 const > const values = subRegion.getReference< array1d< real64 > >( fieldName );
+    for( localIndex k = 0; k < subRegion.size(); ++k )
+    {
+      EXPECT_EQ( values[k], subRegion.localToGlobalMap()[k] );
+    }
+  } );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
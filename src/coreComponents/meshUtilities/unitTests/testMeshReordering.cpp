@@ -0,0 +1,338 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+// Source includes
+#include "managers/initialization.hpp"
+#include "managers/DomainPartition.hpp"
+#include "managers/ProblemManager.hpp"
+#include "mesh/CellBlockManager.hpp"
+#include "meshUtilities/MeshManager.hpp"
+#include "meshUtilities/MeshReordering.hpp"
+#include "linearAlgebra/unitTests/testDofManagerUtils.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+
+// System includes
+#include <algorithm>
+#include <array>
+#include <map>
+#include <numeric>
+#include <random>
+#include <set>
+
+using namespace geosx;
+using namespace geosx::testing;
+
+namespace
+{
+
+void checkPermutation( arrayView1d< localIndex const > const & newToOld, localIndex const size )
+{
+  ASSERT_EQ( newToOld.size(), size );
+  std::vector< localIndex > sorted( newToOld.begin(), newToOld.end() );
+  std::sort( sorted.begin(), sorted.end() );
+  for( localIndex i = 0; i < size; ++i )
+  {
+    ASSERT_EQ( sorted[i], i );
+  }
+}
+
+localIndex bandwidth( arrayView1d< localIndex const > const & offsets,
+                      arrayView1d< localIndex const > const & adjacency,
+                      arrayView1d< localIndex const > const & oldToNew )
+{
+  localIndex result = 0;
+  for( localIndex v = 0; v < offsets.size() - 1; ++v )
+  {
+    for( localIndex k = offsets[v]; k < offsets[v + 1]; ++k )
+    {
+      result = std::max( result, std::abs( oldToNew[v] - oldToNew[adjacency[k]] ) );
+    }
+  }
+  return result;
+}
+
+}
+
+TEST( MeshReordering, reverseCuthillMcKeeReducesBandwidth )
+{
+  // 5-point graph of a nx * ny grid, with randomly shuffled vertex labels
+  localIndex constexpr nx = 20;
+  localIndex constexpr ny = 10;
+  localIndex constexpr numVertices = nx * ny;
+
+  std::vector< localIndex > label( numVertices );
+  std::iota( label.begin(), label.end(), 0 );
+  std::shuffle( label.begin(), label.end(), std::mt19937( 2020 ) );
+
+  std::vector< std::vector< localIndex > > neighbors( numVertices );
+  for( localIndex i = 0; i < nx; ++i )
+  {
+    for( localIndex j = 0; j < ny; ++j )
+    {
+      localIndex const v = label[i * ny + j];
+      if( i > 0 ) { neighbors[v].emplace_back( label[( i - 1 ) * ny + j] ); }
+      if( i < nx - 1 ) { neighbors[v].emplace_back( label[( i + 1 ) * ny + j] ); }
+      if( j > 0 ) { neighbors[v].emplace_back( label[i * ny + j - 1] ); }
+      if( j < ny - 1 ) { neighbors[v].emplace_back( label[i * ny + j + 1] ); }
+    }
+  }
+
+  array1d< localIndex > offsets( numVertices + 1 );
+  array1d< localIndex > adjacency;
+  for( localIndex v = 0; v < numVertices; ++v )
+  {
+    for( localIndex const u : neighbors[v] )
+    {
+      adjacency.emplace_back( u );
+    }
+    offsets[v + 1] = adjacency.size();
+  }
+
+  array1d< localIndex > const newToOld = MeshReordering::computeReverseCuthillMcKee( offsets.toViewConst(),
+                                                                                   adjacency.toViewConst() );
+  checkPermutation( newToOld.toViewConst(), numVertices );
+
+  array1d< localIndex > identity( numVertices );
+  array1d< localIndex > oldToNew( numVertices );
+  for( localIndex v = 0; v < numVertices; ++v )
+  {
+    identity[v] = v;
+    oldToNew[newToOld[v]] = v;
+  }
+
+  // the natural ordering of the grid has a bandwidth of ny, the ordering found must be of the same order
+  EXPECT_LE( bandwidth( offsets.toViewConst(), adjacency.toViewConst(), oldToNew.toViewConst() ), 2 * ny );
+  EXPECT_GT( bandwidth( offsets.toViewConst(), adjacency.toViewConst(), identity.toViewConst() ), 2 * ny );
+}
+
+TEST( MeshReordering, mortonOrderVisitsOctantsInTurn )
+{
+  // points of a 4 x 4 x 4 lattice, listed in reverse lexicographic order
+  localIndex constexpr n = 4;
+  array2d< real64 > points( n * n * n, 3 );
+  for( localIndex p = 0; p < n * n * n; ++p )
+  {
+    localIndex const q = n * n * n - 1 - p;
+    points( p, 0 ) = q / ( n * n );
+    points( p, 1 ) = ( q / n ) % n;
+    points( p, 2 ) = q % n;
+  }
+
+  array1d< localIndex > const newToOld = MeshReordering::computeMortonOrder( points.toViewConst() );
+  checkPermutation( newToOld.toViewConst(), n * n * n );
+
+  // each consecutive group of 8 points fills one octant of the lattice
+  for( localIndex octant = 0; octant < 8; ++octant )
+  {
+    real64 lower[3] = { 1e9, 1e9, 1e9 };
+    real64 upper[3] = { -1e9, -1e9, -1e9 };
+    for( localIndex k = 0; k < 8; ++k )
+    {
+      localIndex const p = newToOld[8 * octant + k];
+      for( int d = 0; d < 3; ++d )
+      {
+        lower[d] = std::min( lower[d], points( p, d ) );
+        upper[d] = std::max( upper[d], points( p, d ) );
+      }
+    }
+    for( int d = 0; d < 3; ++d )
+    {
+      EXPECT_EQ( upper[d] - lower[d], 1.0 );
+    }
+  }
+
+  // the first point is the lattice origin
+  localIndex const first = newToOld[0];
+  EXPECT_EQ( points( first, 0 ), 0.0 );
+  EXPECT_EQ( points( first, 1 ), 0.0 );
+  EXPECT_EQ( points( first, 2 ), 0.0 );
+}
+
+char const * xmlInput =
+  "<Problem>"
+  "  <Mesh>"
+  "    <InternalMesh name=\"mesh1\""
+  "                  elementTypes=\"{C3D8, C3D8}\""
+  "                  xCoords=\"{0, 2, 5}\""
+  "                  yCoords=\"{0, 1}\""
+  "                  zCoords=\"{0, 1}\""
+  "                  nx=\"{3, 4}\""
+  "                  ny=\"{3}\""
+  "                  nz=\"{2}\""
+  "                  cellBlockNames=\"{block1, block2}\"/>"
+  "  </Mesh>"
+  "  <ElementRegions>"
+  "    <CellElementRegion name=\"region1\" cellBlocks=\"{block1, block2}\" materialList=\"{}\" />"
+  "  </ElementRegions>"
+  "</Problem>";
+
+char const * const cellFieldName = "reorderingTestField";
+
+/**
+ * Generates a two-block mesh without reordering, then reorders the generated cell blocks and nodes directly.
+ * All checks are done through global indices, which the reordering leaves untouched.
+ */
+class MeshReorderingTest : public ::testing::Test
+{
+public:
+
+  MeshReorderingTest():
+    problemManager( std::make_unique< ProblemManager >( "Problem", nullptr ) )
+  {}
+
+protected:
+
+  using CellNodes = std::map< globalIndex, std::vector< globalIndex > >;
+
+  void SetUp() override
+  {
+    setupProblemFromXML( problemManager.get(), xmlInput );
+    DomainPartition & domain = *problemManager->getDomainPartition();
+    cellBlockManager = domain.GetGroup< CellBlockManager >( dataRepository::keys::cellManager );
+    nodeManager = domain.getMeshBody( 0 )->getMeshLevel( 0 )->getNodeManager();
+
+    // a cell field holding a function of the global index, as an imported property would
+    cellBlockManager->forElementSubRegions( [&]( CellBlock & block )
+    {
+      array1d< real64 > & field = block.registerWrapper< array1d< real64 > >( cellFieldName )->reference();
+      field.resize( block.size() );
+      for( localIndex k = 0; k < block.size(); ++k )
+      {
+        field[k] = 0.5 * block.localToGlobalMap()[k];
+      }
+    } );
+  }
+
+  /// Cell-to-node connectivity of each block, in global indices
+  std::map< string, CellNodes > cellNodes() const
+  {
+    arrayView1d< globalIndex const > const nodeLocalToGlobal = nodeManager->localToGlobalMap();
+    std::map< string, CellNodes > result;
+    cellBlockManager->forElementSubRegions( [&]( CellBlock const & block )
+    {
+      arrayView2d< localIndex const, cells::NODE_MAP_USD > const elemToNodes = block.nodeList();
+      CellNodes & blockCellNodes = result[block.getName()];
+      for( localIndex k = 0; k < block.size(); ++k )
+      {
+        std::vector< globalIndex > & nodes = blockCellNodes[block.localToGlobalMap()[k]];
+        for( localIndex a = 0; a < elemToNodes.size( 1 ); ++a )
+        {
+          nodes.emplace_back( nodeLocalToGlobal[elemToNodes( k, a )] );
+        }
+      }
+    } );
+    return result;
+  }
+
+  /// Node coordinates, by global index
+  std::map< globalIndex, std::array< real64, 3 > > nodeCoordinates() const
+  {
+    arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const X = nodeManager->referencePosition();
+    std::map< globalIndex, std::array< real64, 3 > > result;
+    for( localIndex a = 0; a < nodeManager->size(); ++a )
+    {
+      result[nodeManager->localToGlobalMap()[a]] = { X( a, 0 ), X( a, 1 ), X( a, 2 ) };
+    }
+    return result;
+  }
+
+  /// Global indices of the nodes of a node set
+  std::set< globalIndex > nodeSet( string const & setName ) const
+  {
+    std::set< globalIndex > result;
+    for( localIndex const a : nodeManager->sets().getReference< SortedArray< localIndex > >( setName ) )
+    {
+      result.insert( nodeManager->localToGlobalMap()[a] );
+    }
+    return result;
+  }
+
+  /// Reorder the mesh and check that connectivity, coordinates, sets and fields are preserved
+  void testReorder( MeshReordering::Method const method )
+  {
+    std::map< string, CellNodes > const cellNodesBefore = cellNodes();
+    std::map< globalIndex, std::array< real64, 3 > > const coordinatesBefore = nodeCoordinates();
+    std::set< globalIndex > const xnegBefore = nodeSet( "xneg" );
+    std::set< globalIndex > const xposBefore = nodeSet( "xpos" );
+    std::vector< globalIndex > const nodeLocalToGlobalBefore( nodeManager->localToGlobalMap().begin(),
+                                                              nodeManager->localToGlobalMap().end() );
+
+    MeshReordering::reorder( method, *cellBlockManager, *nodeManager );
+
+    // the nodes have actually been renumbered
+    std::vector< globalIndex > const nodeLocalToGlobalAfter( nodeManager->localToGlobalMap().begin(),
+                                                             nodeManager->localToGlobalMap().end() );
+    ASSERT_EQ( nodeLocalToGlobalAfter.size(), nodeLocalToGlobalBefore.size() );
+    EXPECT_NE( nodeLocalToGlobalAfter, nodeLocalToGlobalBefore );
+
+    // connectivity, with the local node order of each cell, and coordinates are unchanged in global terms
+    EXPECT_EQ( cellNodes(), cellNodesBefore );
+    EXPECT_EQ( nodeCoordinates(), coordinatesBefore );
+    EXPECT_EQ( nodeSet( "xneg" ), xnegBefore );
+    EXPECT_EQ( nodeSet( "xpos" ), xposBefore );
+
+    // cell fields follow their cells, and global-to-local maps agree with the new local order
+    cellBlockManager->forElementSubRegions( [&]( CellBlock const & block )
+    {
+      arrayView1d< real64 const > const field = block.getReference< array1d< real64 > >( cellFieldName );
+      for( localIndex k = 0; k < block.size(); ++k )
+      {
+        globalIndex const gid = block.localToGlobalMap()[k];
+        EXPECT_EQ( field[k], 0.5 * gid );
+        EXPECT_EQ( block.globalToLocalMap().at( gid ), k );
+      }
+    } );
+    for( localIndex a = 0; a < nodeManager->size(); ++a )
+    {
+      EXPECT_EQ( nodeManager->globalToLocalMap().at( nodeManager->localToGlobalMap()[a] ), a );
+    }
+  }
+
+  std::unique_ptr< ProblemManager > problemManager;
+  CellBlockManager * cellBlockManager;
+  NodeManager * nodeManager;
+};
+
+TEST_F( MeshReorderingTest, reverseCuthillMcKee )
+{
+  testReorder( MeshReordering::Method::rcm );
+}
+
+TEST_F( MeshReorderingTest, morton )
+{
+  testReorder( MeshReordering::Method::morton );
+}
+
+TEST_F( MeshReorderingTest, unsupportedFieldIsRejected )
+{
+  // a cell field of a type the reordering does not permute must not be left silently in the old order
+  cellBlockManager->forElementSubRegions( [&]( CellBlock & block )
+  {
+    block.registerWrapper< array2d< integer > >( "unsupportedField" )->reference().resize( block.size(), 2 );
+  } );
+
+  EXPECT_DEATH_IF_SUPPORTED( MeshReordering::reorder( MeshReordering::Method::rcm, *cellBlockManager, *nodeManager ), "" );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
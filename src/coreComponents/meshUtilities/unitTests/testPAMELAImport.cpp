@@ -113,6 +113,37 @@ TEST( PAMELAImport, testGMSH )
   TestMeshImport( inputStringMesh, inputStringRegion, "barycenter" );
 }
 
+#ifdef GEOSX_USE_METIS
+TEST( PAMELAImport, testGMSHParallelRead )
+{
+  // small chunks, so that the file is read in several exchanges
+  std::stringstream inputStreamMesh;
+  inputStreamMesh <<
+    "<?xml version=\"1.0\" ?>" <<
+    "  <Mesh xmlns:xsi=\"http://www.w3.org/2001/XMLSchema-instance\" xsi:noNamespaceSchemaLocation=\"geos_v0.0.xsd\">" <<
+    "  <PAMELAMeshGenerator name=\"ToyModel\" " <<
+    "  fieldsToImport=\"{barycenter}\""<<
+    "  fieldNamesInGEOSX=\"{barycenter}\""<<
+    "  numReaders=\"1\""<<
+    "  readChunkSize=\"1000\""<<
+    "  file=\"" <<gmshFilePath.c_str()<< "\"/>"<<
+    "</Mesh>";
+  const string inputStringMesh = inputStreamMesh.str();
+
+  std::stringstream inputStreamRegion;
+  inputStreamRegion <<
+    "<ElementRegions>" <<
+    "  <CellElementRegion name=\"0\" cellBlocks=\"{Overburden1_TETRA}\" materialList=\"{water, rock}\"/>" <<
+    "  <CellElementRegion name=\"1\" cellBlocks=\"{Overburden2_TETRA}\" materialList=\"{water, rock}\"/>" <<
+    "  <CellElementRegion name=\"2\" cellBlocks=\"{Reservoir_TETRA}\" materialList=\"{water, rock}\"/>" <<
+    "  <CellElementRegion name=\"3\" cellBlocks=\"{Underburden_TETRA}\" materialList=\"{water, rock}\"/>" <<
+    "</ElementRegions>";
+  string inputStringRegion = inputStreamRegion.str();
+
+  TestMeshImport( inputStringMesh, inputStringRegion, "barycenter" );
+}
+#endif
+
 TEST( PAMELAImport, testECLIPSE )
 {
   MeshManager meshManager( "mesh", nullptr );
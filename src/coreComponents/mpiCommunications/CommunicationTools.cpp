@@ -22,6 +22,7 @@
 
 #include "common/TimingMacros.hpp"
 #include "mpiCommunications/NeighborCommunicator.hpp"
+#include "mpiCommunications/SyncPlan.hpp"
 #include "managers/DomainPartition.hpp"
 #include "managers/ObjectManagerBase.hpp"
 
@@ -761,6 +762,8 @@ void CommunicationTools::FindGhosts( MeshLevel & meshLevel,
   edgeManager.compressRelationMaps();
   faceManager.compressRelationMaps();
 
+  meshLevel.modifiedTopology();
+
   CommunicationTools::releaseCommID( commID );
 }
 
@@ -857,10 +860,15 @@ void CommunicationTools::SynchronizeFields( const std::map< string, string_array
                                             std::vector< NeighborCommunicator > & neighbors,
                                             bool on_device )
 {
-  MPI_iCommData icomm;
-  SynchronizePackSendRecvSizes( fieldNames, mesh, neighbors, icomm, on_device );
-  SynchronizePackSendRecv( fieldNames, mesh, neighbors, icomm, on_device );
-  SynchronizeUnpack( mesh, neighbors, icomm, on_device );
+  GEOSX_MARK_FUNCTION;
+
+  // reuse the plan built for this set of fields by a previous call, if any
+  std::unique_ptr< SyncPlan > & plan = mesh->getSyncPlans()[ SyncPlan::key( fieldNames, on_device ) ];
+  if( plan == nullptr || !plan->isCompatible( *mesh, neighbors ) )
+  {
+    plan = std::make_unique< SyncPlan >( fieldNames, *mesh, neighbors, on_device );
+  }
+  plan->execute();
 }
 
 
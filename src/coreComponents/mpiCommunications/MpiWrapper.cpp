@@ -132,6 +132,16 @@ void MpiWrapper::Finalize()
 #endif
 }
 
+bool MpiWrapper::Thread_multiple()
+{
+#ifdef GEOSX_USE_MPI
+  int provided = MPI_THREAD_SINGLE;
+  MPI_CHECK_ERROR( MPI_Query_thread( &provided ) );
+  return provided == MPI_THREAD_MULTIPLE;
+#else
+  return true;
+#endif
+}
 
 MPI_Comm MpiWrapper::Comm_dup( MPI_Comm const comm )
 {
@@ -197,6 +207,22 @@ int MpiWrapper::Waitall( int count, MPI_Request array_of_requests[], MPI_Status
   return 0;
 }
 
+int MpiWrapper::Startall( int count, MPI_Request array_of_requests[] )
+{
+#ifdef GEOSX_USE_MPI
+  return MPI_Startall( count, array_of_requests );
+#endif
+  return 0;
+}
+
+int MpiWrapper::Request_free( MPI_Request * request )
+{
+#ifdef GEOSX_USE_MPI
+  return MPI_Request_free( request );
+#endif
+  return 0;
+}
+
 double MpiWrapper::Wtime( void )
 {
 #ifdef GEOSX_USE_MPI
@@ -182,6 +182,8 @@ public:
 
   static void Finalize();
 
+  static bool Thread_multiple();
+
   static MPI_Comm Comm_dup( MPI_Comm const comm );
 
   static MPI_Comm Comm_split( MPI_Comm const comm, int color, int key );
@@ -196,6 +198,10 @@ public:
 
   static int Waitall( int count, MPI_Request array_of_requests[], MPI_Status array_of_statuses[] );
 
+  static int Startall( int count, MPI_Request array_of_requests[] );
+
+  static int Request_free( MPI_Request * request );
+
   static double Wtime( void );
 
 
@@ -320,6 +326,19 @@ public:
   template< typename T >
   static int allReduce( T const * sendbuf, T * recvbuf, int count, MPI_Op op, MPI_Comm comm );
 
+  /**
+   * @brief Strongly typed wrapper around MPI_Iallreduce.
+   * @param[in] sendbuf The pointer to the sending buffer, must not be modified until completion.
+   * @param[out] recvbuf The pointer to the receive buffer, valid after completion.
+   * @param[in] count The number of values to send/receive.
+   * @param[in] op The MPI_Op to perform.
+   * @param[in] comm The MPI_Comm over which the reduction operates.
+   * @param[out] request The MPI_Request to wait on for completion.
+   * @return The return value of the underlying call to MPI_Iallreduce().
+   */
+  template< typename T >
+  static int iAllReduce( T const * sendbuf, T * recvbuf, int count, MPI_Op op, MPI_Comm comm, MPI_Request * request );
+
 
   template< typename T >
   static int scan( T const * sendbuf, T * recvbuf, int count, MPI_Op op, MPI_Comm comm );
@@ -392,6 +411,39 @@ public:
                       MPI_Comm comm );
 
 
+  /**
+   * @brief Convenience function for MPI_Alltoallv, exchanging the counts first.
+   * @tparam T The type to send/recieve. This must have a valid conversion to MPI_Datatype in getMpiType();
+   * @param[in] sendValues The values to send, grouped by destination rank.
+   * @param[in] sendCounts The number of values to send to each rank.
+   * @param[out] recvValues The values received, grouped by source rank.
+   * @param[out] recvCounts The number of values received from each rank.
+   * @param[in] comm The MPI_Comm over which the exchange operates.
+   * @return The return value of the underlying call to MPI_Alltoallv().
+   */
+  template< typename T >
+  static int allToAllv( arrayView1d< T const > const & sendValues,
+                        arrayView1d< int const > const & sendCounts,
+                        array1d< T > & recvValues,
+                        array1d< int > & recvCounts,
+                        MPI_Comm comm = MPI_COMM_GEOSX );
+
+  /**
+   * @brief Convenience function for MPI_Alltoallv on per-rank buffers.
+   * @tparam T The type to send/recieve. This must have a valid conversion to MPI_Datatype in getMpiType();
+   * @param[in] sendBuffers The values to send to each rank (size of the communicator).
+   * @param[out] recvValues The values received, grouped by source rank.
+   * @param[out] recvOffsets The offsets of the values received from each rank (size of the communicator + 1).
+   * @param[in] comm The MPI_Comm over which the exchange operates.
+   * @return The return value of the underlying call to MPI_Alltoallv().
+   */
+  template< typename T >
+  static int allToAllv( std::vector< std::vector< T > > const & sendBuffers,
+                        array1d< T > & recvValues,
+                        array1d< int > & recvOffsets,
+                        MPI_Comm comm = MPI_COMM_GEOSX );
+
+
   /**
    * @brief Returns an MPI_Datatype from a c type.
    * @tparam T The type for which we want an MPI_Datatype
@@ -459,6 +511,42 @@ public:
                     MPI_Comm comm,
                     MPI_Request * request );
 
+  /**
+   * @brief Strongly typed wrapper around MPI_Send_init()
+   * @param[in] buf The pointer to the buffer that contains the data to be sent.
+   * @param[in] count The number of elements in \p buf.
+   * @param[in] dest The rank of the destination process within \p comm.
+   * @param[in] tag The message tag that is be used to distinguish different types of messages.
+   * @param[in] comm The handle to the MPI_Comm.
+   * @param[out] request Pointer to the persistent MPI_Request, to be activated with Start/Startall.
+   * @return The return code from MPI_Send_init.
+   */
+  template< typename T >
+  static int sendInit( T const * const buf,
+                       int count,
+                       int dest,
+                       int tag,
+                       MPI_Comm comm,
+                       MPI_Request * request );
+
+  /**
+   * @brief Strongly typed wrapper around MPI_Recv_init()
+   * @param[out] buf The pointer to the buffer that contains the data to be received.
+   * @param[in] count The number of elements in \p buf
+   * @param[in] source The rank of the source process within \p comm.
+   * @param[in] tag The message tag that is be used to distinguish different types of messages
+   * @param[in] comm The handle to the MPI_Comm
+   * @param[out] request Pointer to the persistent MPI_Request, to be activated with Start/Startall.
+   * @return The return code from MPI_Recv_init.
+   */
+  template< typename T >
+  static int recvInit( T * const buf,
+                       int count,
+                       int source,
+                       int tag,
+                       MPI_Comm comm,
+                       MPI_Request * request );
+
   /**
    * @brief Convenience function for a MPI_Reduce using a MPI_MIN operation.
    * @param value the value to send into the reduction.
@@ -626,6 +714,24 @@ int MpiWrapper::allReduce( T const * const sendbuf,
 #endif
 }
 
+template< typename T >
+int MpiWrapper::iAllReduce( T const * const sendbuf,
+                            T * const recvbuf,
+                            int count,
+                            MPI_Op MPI_PARAM( op ),
+                            MPI_Comm MPI_PARAM( comm ),
+                            MPI_Request * const request )
+{
+#ifdef GEOSX_USE_MPI
+  MPI_Datatype const MPI_TYPE = getMpiType< T >();
+  return MPI_Iallreduce( sendbuf, recvbuf, count, MPI_TYPE, op, comm, request );
+#else
+  memcpy( recvbuf, sendbuf, count*sizeof(T) );
+  *request = MPI_REQUEST_NULL;
+  return 0;
+#endif
+}
+
 template< typename T >
 int MpiWrapper::scan( T const * const sendbuf,
                       T * const recvbuf,
@@ -740,6 +846,75 @@ int MpiWrapper::gatherv( TS const * const sendbuf,
 #endif
 }
 
+template< typename T >
+int MpiWrapper::allToAllv( arrayView1d< T const > const & sendValues,
+                           arrayView1d< int const > const & sendCounts,
+                           array1d< T > & recvValues,
+                           array1d< int > & recvCounts,
+                           MPI_Comm MPI_PARAM( comm ) )
+{
+#ifdef GEOSX_USE_MPI
+  int const mpiSize = Comm_size( comm );
+  GEOSX_ERROR_IF_NE( sendCounts.size(), mpiSize );
+
+  recvCounts.resize( mpiSize );
+  MPI_Alltoall( sendCounts.data(), 1, MPI_INT, recvCounts.data(), 1, MPI_INT, comm );
+
+  array1d< int > sendDispls( mpiSize );
+  array1d< int > recvDispls( mpiSize );
+  for( int r = 1; r < mpiSize; ++r )
+  {
+    sendDispls[r] = sendDispls[r - 1] + sendCounts[r - 1];
+    recvDispls[r] = recvDispls[r - 1] + recvCounts[r - 1];
+  }
+  recvValues.resize( recvDispls[mpiSize - 1] + recvCounts[mpiSize - 1] );
+
+  MPI_Datatype const MPI_TYPE = getMpiType< T >();
+  return MPI_Alltoallv( sendValues.data(), sendCounts.data(), sendDispls.data(), MPI_TYPE,
+                        recvValues.data(), recvCounts.data(), recvDispls.data(), MPI_TYPE, comm );
+#else
+  recvCounts.resize( 1 );
+  recvCounts[0] = sendCounts[0];
+  recvValues.resize( sendValues.size() );
+  for( localIndex a = 0; a < sendValues.size(); ++a )
+  {
+    recvValues[a] = sendValues[a];
+  }
+  return 0;
+#endif
+}
+
+template< typename T >
+int MpiWrapper::allToAllv( std::vector< std::vector< T > > const & sendBuffers,
+                           array1d< T > & recvValues,
+                           array1d< int > & recvOffsets,
+                           MPI_Comm comm )
+{
+  int const numRanks = LvArray::integerConversion< int >( sendBuffers.size() );
+
+  array1d< int > sendCounts( numRanks );
+  array1d< T > sendValues;
+  for( int r = 0; r < numRanks; ++r )
+  {
+    sendCounts[r] = LvArray::integerConversion< int >( sendBuffers[r].size() );
+    for( T const & value : sendBuffers[r] )
+    {
+      sendValues.emplace_back( value );
+    }
+  }
+
+  array1d< int > recvCounts;
+  int const err = allToAllv( sendValues.toViewConst(), sendCounts.toViewConst(), recvValues, recvCounts, comm );
+
+  recvOffsets.resize( numRanks + 1 );
+  recvOffsets[0] = 0;
+  for( int r = 0; r < numRanks; ++r )
+  {
+    recvOffsets[r + 1] = recvOffsets[r] + recvCounts[r];
+  }
+  return err;
+}
+
 template< typename T >
 int MpiWrapper::iRecv( T * const buf,
                        int count,
@@ -850,6 +1025,38 @@ int MpiWrapper::iSend( T const * const buf,
 #endif
 }
 
+template< typename T >
+int MpiWrapper::sendInit( T const * const MPI_PARAM( buf ),
+                          int MPI_PARAM( count ),
+                          int MPI_PARAM( dest ),
+                          int MPI_PARAM( tag ),
+                          MPI_Comm MPI_PARAM( comm ),
+                          MPI_Request * MPI_PARAM( request ) )
+{
+#ifdef GEOSX_USE_MPI
+  return MPI_Send_init( buf, count, getMpiType< T >(), dest, tag, comm, request );
+#else
+  GEOSX_ERROR( "Not implemented." );
+  return MPI_SUCCESS;
+#endif
+}
+
+template< typename T >
+int MpiWrapper::recvInit( T * const MPI_PARAM( buf ),
+                          int MPI_PARAM( count ),
+                          int MPI_PARAM( source ),
+                          int MPI_PARAM( tag ),
+                          MPI_Comm MPI_PARAM( comm ),
+                          MPI_Request * MPI_PARAM( request ) )
+{
+#ifdef GEOSX_USE_MPI
+  return MPI_Recv_init( buf, count, getMpiType< T >(), source, tag, comm, request );
+#else
+  GEOSX_ERROR( "Not implemented." );
+  return MPI_SUCCESS;
+#endif
+}
+
 template< typename U, typename T >
 U MpiWrapper::PrefixSum( T const value )
 {
@@ -0,0 +1,328 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file SyncPlan.cpp
+ */
+
+#include "SyncPlan.hpp"
+
+#include "common/TimingMacros.hpp"
+#include "managers/ObjectManagerBase.hpp"
+#include "mesh/MeshLevel.hpp"
+#include "mpiCommunications/NeighborCommunicator.hpp"
+
+namespace geosx
+{
+
+using namespace dataRepository;
+
+namespace
+{
+
+/// Tags used by the plans, outside of the range of the commIDs used by NeighborCommunicator
+int constexpr sizeTag = NeighborCommunicator::maxComm;
+int constexpr dataTag = NeighborCommunicator::maxComm + 1;
+
+}
+
+SyncPlan::SyncPlan( std::map< string, string_array > const & fieldNames,
+                    MeshLevel & mesh,
+                    std::vector< NeighborCommunicator > const & neighbors,
+                    bool const onDevice ):
+  m_entries(),
+  m_neighbors(),
+  m_sendRequests(),
+  m_receiveRequests(),
+  m_sendStatuses(),
+  m_receiveStatuses(),
+  m_requestsAllocated( false ),
+  m_onDevice( onDevice ),
+  m_topologyVersion( mesh.topologyVersion() )
+{
+  auto addEntry = [&]( ObjectManagerBase & object, string_array const & names )
+  {
+    Entry entry{ &object, {} };
+    for( string const & name : names )
+    {
+      // fields that are not registered on this object are skipped on all ranks
+      WrapperBase * const wrapper = object.getWrapperBase( name );
+      if( wrapper != nullptr )
+      {
+        entry.wrappers.emplace_back( wrapper );
+      }
+    }
+    if( !entry.wrappers.empty() )
+    {
+      m_entries.emplace_back( std::move( entry ) );
+    }
+  };
+
+  if( fieldNames.count( "node" ) > 0 )
+  {
+    addEntry( *mesh.getNodeManager(), fieldNames.at( "node" ) );
+  }
+
+  if( fieldNames.count( "edge" ) > 0 )
+  {
+    addEntry( *mesh.getEdgeManager(), fieldNames.at( "edge" ) );
+  }
+
+  if( fieldNames.count( "face" ) > 0 )
+  {
+    addEntry( *mesh.getFaceManager(), fieldNames.at( "face" ) );
+  }
+
+  if( fieldNames.count( "elems" ) > 0 )
+  {
+    mesh.getElemManager()->forElementSubRegions< ElementSubRegionBase >( [&]( ElementSubRegionBase & subRegion )
+    {
+      addEntry( subRegion, fieldNames.at( "elems" ) );
+    } );
+  }
+
+  m_neighbors.resize( neighbors.size() );
+  for( std::size_t i = 0; i < neighbors.size(); ++i )
+  {
+    m_neighbors[i].rank = neighbors[i].NeighborRank();
+    m_neighbors[i].sendSize = 0;
+    m_neighbors[i].receiveSize = 0;
+  }
+
+  localIndex const numNeighbors = LvArray::integerConversion< localIndex >( m_neighbors.size() );
+  m_sendRequests.resize( numNeighbors );
+  m_receiveRequests.resize( numNeighbors );
+  m_sendStatuses.resize( numNeighbors );
+  m_receiveStatuses.resize( numNeighbors );
+}
+
+SyncPlan::~SyncPlan()
+{
+  freeRequests();
+}
+
+bool SyncPlan::isCompatible( MeshLevel const & mesh,
+                             std::vector< NeighborCommunicator > const & neighbors ) const
+{
+  if( mesh.topologyVersion() != m_topologyVersion || neighbors.size() != m_neighbors.size() )
+  {
+    return false;
+  }
+  for( std::size_t i = 0; i < neighbors.size(); ++i )
+  {
+    if( neighbors[i].NeighborRank() != m_neighbors[i].rank )
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+string SyncPlan::key( std::map< string, string_array > const & fieldNames, bool const onDevice )
+{
+  string result = onDevice ? "device" : "host";
+  for( auto const & entry : fieldNames )
+  {
+    result += ";" + entry.first + ":";
+    for( string const & name : entry.second )
+    {
+      result += name + ",";
+    }
+  }
+  return result;
+}
+
+void SyncPlan::freeRequests()
+{
+  if( !m_requestsAllocated )
+  {
+    return;
+  }
+  for( localIndex i = 0; i < m_sendRequests.size(); ++i )
+  {
+    MpiWrapper::Request_free( &m_sendRequests[i] );
+    MpiWrapper::Request_free( &m_receiveRequests[i] );
+  }
+  m_requestsAllocated = false;
+}
+
+void SyncPlan::setupRequests()
+{
+  for( std::size_t i = 0; i < m_neighbors.size(); ++i )
+  {
+    NeighborPlan & neighbor = m_neighbors[i];
+    MpiWrapper::sendInit( neighbor.sendBuffer.data(),
+                          neighbor.sendSize,
+                          neighbor.rank,
+                          dataTag,
+                          MPI_COMM_GEOSX,
+                          &m_sendRequests[i] );
+    MpiWrapper::recvInit( neighbor.receiveBuffer.data(),
+                          neighbor.receiveSize,
+                          neighbor.rank,
+                          dataTag,
+                          MPI_COMM_GEOSX,
+                          &m_receiveRequests[i] );
+  }
+  m_requestsAllocated = true;
+}
+
+void SyncPlan::updateBufferSizes()
+{
+  GEOSX_MARK_FUNCTION;
+
+  std::vector< std::size_t > changed;
+  std::vector< localIndex > ghostListSizes( 2 * m_entries.size() );
+
+  for( std::size_t i = 0; i < m_neighbors.size(); ++i )
+  {
+    NeighborPlan & neighbor = m_neighbors[i];
+    for( std::size_t e = 0; e < m_entries.size(); ++e )
+    {
+      NeighborData const & neighborData = m_entries[e].object->getNeighborData( neighbor.rank );
+      ghostListSizes[2*e] = neighborData.ghostsToSend().size();
+      ghostListSizes[2*e+1] = neighborData.ghostsToReceive().size();
+    }
+
+    if( m_requestsAllocated && ghostListSizes == neighbor.ghostListSizes )
+    {
+      continue;
+    }
+
+    neighbor.ghostListSizes = ghostListSizes;
+
+    localIndex sendSize = 0;
+    for( Entry const & entry : m_entries )
+    {
+      arrayView1d< localIndex const > const ghostsToSend = entry.object->getNeighborData( neighbor.rank ).ghostsToSend();
+      if( ghostsToSend.empty() )
+      {
+        continue;
+      }
+      for( WrapperBase const * const wrapper : entry.wrappers )
+      {
+        sendSize += wrapper->PackByIndexSize( ghostsToSend, true, m_onDevice );
+      }
+    }
+    neighbor.sendSize = LvArray::integerConversion< int >( sendSize );
+    changed.emplace_back( i );
+  }
+
+  if( changed.empty() )
+  {
+    return;
+  }
+
+  // exchange the new sizes with the neighbors whose ghost lists changed (the decision is symmetric)
+  array1d< MPI_Request > sizeRequests( 2 * changed.size() );
+  array1d< MPI_Status > sizeStatuses( 2 * changed.size() );
+  for( std::size_t k = 0; k < changed.size(); ++k )
+  {
+    NeighborPlan & neighbor = m_neighbors[changed[k]];
+    MpiWrapper::iSend( &neighbor.sendSize, 1, neighbor.rank, sizeTag, MPI_COMM_GEOSX, &sizeRequests[2*k] );
+    MpiWrapper::iRecv( &neighbor.receiveSize, 1, neighbor.rank, sizeTag, MPI_COMM_GEOSX, &sizeRequests[2*k+1] );
+  }
+  MpiWrapper::Waitall( sizeRequests.size(), sizeRequests.data(), sizeStatuses.data() );
+
+  for( std::size_t const i : changed )
+  {
+    NeighborPlan & neighbor = m_neighbors[i];
+    neighbor.sendBuffer.resize( neighbor.sendSize );
+    neighbor.receiveBuffer.resize( neighbor.receiveSize );
+  }
+
+  // buffers may have moved, bind the persistent requests again
+  freeRequests();
+  setupRequests();
+}
+
+int SyncPlan::pack( NeighborPlan & neighbor )
+{
+  buffer_unit_type * sendBufferPtr = neighbor.sendBuffer.data();
+
+  localIndex packedSize = 0;
+  for( Entry const & entry : m_entries )
+  {
+    arrayView1d< localIndex const > const ghostsToSend = entry.object->getNeighborData( neighbor.rank ).ghostsToSend();
+    if( ghostsToSend.empty() )
+    {
+      continue;
+    }
+    for( WrapperBase const * const wrapper : entry.wrappers )
+    {
+      GEOSX_ASSERT_GE( neighbor.sendSize, packedSize + wrapper->PackByIndexSize( ghostsToSend, true, m_onDevice ) );
+      packedSize += wrapper->PackByIndex( sendBufferPtr, ghostsToSend, true, m_onDevice );
+    }
+  }
+
+  return LvArray::integerConversion< int >( packedSize );
+}
+
+void SyncPlan::unpack( NeighborPlan & neighbor )
+{
+  buffer_unit_type const * receiveBufferPtr = neighbor.receiveBuffer.data();
+
+  for( Entry const & entry : m_entries )
+  {
+    arrayView1d< localIndex const > const ghostsToReceive =
+      static_cast< ObjectManagerBase const * >( entry.object )->getNeighborData( neighbor.rank ).ghostsToReceive();
+    if( ghostsToReceive.empty() )
+    {
+      continue;
+    }
+    for( WrapperBase * const wrapper : entry.wrappers )
+    {
+      wrapper->UnpackByIndex( receiveBufferPtr, ghostsToReceive, true, m_onDevice );
+    }
+  }
+}
+
+void SyncPlan::execute()
+{
+  GEOSX_MARK_FUNCTION;
+
+  if( m_neighbors.empty() )
+  {
+    return;
+  }
+
+  updateBufferSizes();
+
+  int const numNeighbors = LvArray::integerConversion< int >( m_neighbors.size() );
+
+  MpiWrapper::Startall( numNeighbors, m_receiveRequests.data() );
+
+  for( NeighborPlan & neighbor : m_neighbors )
+  {
+    int const packedSize = pack( neighbor );
+    GEOSX_ERROR_IF_NE( packedSize, neighbor.sendSize );
+  }
+
+  MpiWrapper::Startall( numNeighbors, m_sendRequests.data() );
+
+  for( int count = 0; count < numNeighbors; ++count )
+  {
+    int neighborIndex;
+    MpiWrapper::Waitany( numNeighbors,
+                         m_receiveRequests.data(),
+                         &neighborIndex,
+                         m_receiveStatuses.data() );
+
+    unpack( m_neighbors[neighborIndex] );
+  }
+
+  MpiWrapper::Waitall( numNeighbors, m_sendRequests.data(), m_sendStatuses.data() );
+}
+
+} /* namespace geosx */
@@ -0,0 +1,160 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file SyncPlan.hpp
+ */
+
+#ifndef GEOSX_MPICOMMUNICATIONS_SYNCPLAN_HPP_
+#define GEOSX_MPICOMMUNICATIONS_SYNCPLAN_HPP_
+
+#include "MpiWrapper.hpp"
+
+#include "common/DataTypes.hpp"
+
+namespace geosx
+{
+
+namespace dataRepository
+{
+class WrapperBase;
+}
+
+class MeshLevel;
+class NeighborCommunicator;
+class ObjectManagerBase;
+
+/**
+ * @class SyncPlan
+ * @brief Persistent communication plan used to repeatedly synchronize a fixed set of fields on a MeshLevel.
+ *
+ * The plan resolves the objects and wrappers to communicate once, caches the buffer sizes exchanged with
+ * each neighbor and binds persistent MPI requests to its own send/receive buffers. A synchronization then
+ * amounts to packing, starting the persistent requests and unpacking, without any size exchange.
+ *
+ * A plan is only valid for the topology version of the MeshLevel it was built on (see
+ * MeshLevel::modifiedTopology()) and for a fixed set of neighbors; see isCompatible().
+ *
+ * Within a topology version, the buffer sizes of a neighbor are recomputed (and the sizes exchanged again) whenever the ghost lists
+ * shared with that neighbor change size, e.g. after the SurfaceGenerator splits faces. Since ghost lists are
+ * symmetric, both sides of a neighbor pair always take that decision together. The set of fields is
+ * assumed to have a fixed pack size per object, which holds for all array-based fields.
+ */
+class SyncPlan
+{
+public:
+
+  /**
+   * @brief Constructor.
+   * @param fieldNames map from object type ("node", "edge", "face" or "elems") to the names of the fields to sync
+   * @param mesh the mesh level on which the fields live
+   * @param neighbors the neighbors to communicate with
+   * @param onDevice whether to pack/unpack the fields on device
+   */
+  SyncPlan( std::map< string, string_array > const & fieldNames,
+            MeshLevel & mesh,
+            std::vector< NeighborCommunicator > const & neighbors,
+            bool const onDevice );
+
+  /**
+   * @brief Destructor, releases the persistent requests.
+   */
+  ~SyncPlan();
+
+  SyncPlan( SyncPlan const & ) = delete;
+  SyncPlan & operator=( SyncPlan const & ) = delete;
+
+  /**
+   * @brief Check that the plan was built for the current topology of the mesh and the given set of neighbors.
+   * @param mesh the mesh level on which the fields live
+   * @param neighbors the neighbors to communicate with
+   * @return true if the topology version and the neighbor ranks match the ones the plan was built for
+   */
+  bool isCompatible( MeshLevel const & mesh,
+                     std::vector< NeighborCommunicator > const & neighbors ) const;
+
+  /**
+   * @brief Synchronize the fields with all neighbors.
+   */
+  void execute();
+
+  /**
+   * @brief Build the key under which a plan is cached on a MeshLevel.
+   * @param fieldNames map from object type to the names of the fields to sync
+   * @param onDevice whether to pack/unpack the fields on device
+   * @return the key
+   */
+  static string key( std::map< string, string_array > const & fieldNames, bool const onDevice );
+
+private:
+
+  /// An object manager and the wrappers of the fields to synchronize on it
+  struct Entry
+  {
+    ObjectManagerBase * object;
+    std::vector< dataRepository::WrapperBase * > wrappers;
+  };
+
+  /// Communication state with a single neighbor
+  struct NeighborPlan
+  {
+    int rank;
+    std::vector< localIndex > ghostListSizes;
+    buffer_type sendBuffer;
+    buffer_type receiveBuffer;
+    int sendSize;
+    int receiveSize;
+  };
+
+  void freeRequests();
+
+  void setupRequests();
+
+  void updateBufferSizes();
+
+  int pack( NeighborPlan & neighbor );
+
+  void unpack( NeighborPlan & neighbor );
+
+  /// Objects and wrappers to communicate, in packing order
+  std::vector< Entry > m_entries;
+
+  /// Per-neighbor communication state
+  std::vector< NeighborPlan > m_neighbors;
+
+  /// Persistent send requests, one per neighbor
+  array1d< MPI_Request > m_sendRequests;
+
+  /// Persistent receive requests, one per neighbor
+  array1d< MPI_Request > m_receiveRequests;
+
+  /// Statuses of the send requests
+  array1d< MPI_Status > m_sendStatuses;
+
+  /// Statuses of the receive requests
+  array1d< MPI_Status > m_receiveStatuses;
+
+  /// Whether the persistent requests are currently allocated
+  bool m_requestsAllocated;
+
+  /// Whether to pack/unpack on device
+  bool const m_onDevice;
+
+  /// Topology version of the mesh level the plan was built for
+  integer const m_topologyVersion;
+};
+
+} /* namespace geosx */
+
+#endif /* GEOSX_MPICOMMUNICATIONS_SYNCPLAN_HPP_ */
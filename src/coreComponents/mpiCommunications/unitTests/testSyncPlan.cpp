@@ -0,0 +1,194 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+
+#include "managers/initialization.hpp"
+#include "managers/DomainPartition.hpp"
+#include "managers/ProblemManager.hpp"
+#include "meshUtilities/MeshManager.hpp"
+#include "mpiCommunications/CommunicationTools.hpp"
+#include "mpiCommunications/NeighborCommunicator.hpp"
+#include "linearAlgebra/unitTests/testDofManagerUtils.hpp"
+
+using namespace geosx;
+using namespace geosx::testing;
+
+char const * xmlInput =
+  "<Problem>"
+  "  <Mesh>"
+  "    <InternalMesh name=\"mesh1\""
+  "                  elementTypes=\"{C3D8}\""
+  "                  xCoords=\"{0, 4}\""
+  "                  yCoords=\"{0, 1}\""
+  "                  zCoords=\"{0, 1}\""
+  "                  nx=\"{8}\""
+  "                  ny=\"{2}\""
+  "                  nz=\"{2}\""
+  "                  cellBlockNames=\"{block1}\"/>"
+  "  </Mesh>"
+  "  <ElementRegions>"
+  "    <CellElementRegion name=\"region1\" cellBlocks=\"{block1}\" materialList=\"{}\" />"
+  "  </ElementRegions>"
+  "</Problem>";
+
+char const * const fieldName = "syncPlanTestField";
+
+class SyncPlanTest : public ::testing::Test
+{
+public:
+
+  SyncPlanTest():
+    problemManager( std::make_unique< ProblemManager >( "Problem", nullptr ) )
+  {}
+
+protected:
+
+  void SetUp() override
+  {
+    setupProblemFromXML( problemManager.get(), xmlInput );
+    domain = problemManager->getDomainPartition();
+    mesh = domain->getMeshBody( 0 )->getMeshLevel( 0 );
+    registerField();
+  }
+
+  void registerField()
+  {
+    NodeManager & nodeManager = *mesh->getNodeManager();
+    nodeManager.registerWrapper< array1d< real64 > >( fieldName )->reference().resize( nodeManager.size() );
+  }
+
+  /// Owned nodes hold their global index, ghosts a sentinel value
+  void resetField()
+  {
+    NodeManager & nodeManager = *mesh->getNodeManager();
+    arrayView1d< real64 > const field = nodeManager.getReference< array1d< real64 > >( fieldName );
+    arrayView1d< integer const > const ghostRank = nodeManager.ghostRank();
+    arrayView1d< globalIndex const > const localToGlobal = nodeManager.localToGlobalMap();
+    for( localIndex a = 0; a < nodeManager.size(); ++a )
+    {
+      field[a] = ghostRank[a] < 0 ? localToGlobal[a] : -1.0;
+    }
+  }
+
+  void sync( std::vector< NeighborCommunicator > & neighbors )
+  {
+    std::map< string, string_array > fieldNames;
+    fieldNames["node"].emplace_back( fieldName );
+    CommunicationTools::SynchronizeFields( fieldNames, mesh, neighbors );
+  }
+
+  /// Count the ghost nodes that do (or do not) hold the value of their owner
+  localIndex countSyncedGhosts( bool const synced ) const
+  {
+    NodeManager const & nodeManager = *mesh->getNodeManager();
+    arrayView1d< real64 const > const field = nodeManager.getReference< array1d< real64 > >( fieldName );
+    arrayView1d< integer const > const ghostRank = nodeManager.ghostRank();
+    arrayView1d< globalIndex const > const localToGlobal = nodeManager.localToGlobalMap();
+    localIndex count = 0;
+    for( localIndex a = 0; a < nodeManager.size(); ++a )
+    {
+      if( ghostRank[a] >= 0 && ( field[a] == localToGlobal[a] ) == synced )
+      {
+        ++count;
+      }
+    }
+    return count;
+  }
+
+  localIndex numGhosts() const
+  {
+    NodeManager const & nodeManager = *mesh->getNodeManager();
+    arrayView1d< integer const > const ghostRank = nodeManager.ghostRank();
+    localIndex count = 0;
+    for( localIndex a = 0; a < nodeManager.size(); ++a )
+    {
+      count += ghostRank[a] >= 0;
+    }
+    return count;
+  }
+
+  std::unique_ptr< ProblemManager > const problemManager;
+  DomainPartition * domain;
+  MeshLevel * mesh;
+};
+
+TEST_F( SyncPlanTest, neighborListChange )
+{
+  if( MpiWrapper::Comm_size( MPI_COMM_GEOSX ) == 1 )
+  {
+    return;
+  }
+
+  // ghosting has been set up, which counts as a topology change
+  EXPECT_GT( mesh->topologyVersion(), 0 );
+  ASSERT_GT( numGhosts(), 0 );
+
+  std::vector< NeighborCommunicator > & neighbors = domain->getNeighbors();
+
+  resetField();
+  sync( neighbors );
+  EXPECT_EQ( countSyncedGhosts( false ), 0 );
+
+  // without neighbors the plan is rebuilt and nothing is exchanged
+  std::vector< NeighborCommunicator > noNeighbors;
+  resetField();
+  sync( noNeighbors );
+  EXPECT_EQ( countSyncedGhosts( true ), 0 );
+
+  // back to the original neighbors: the plan is rebuilt again and the ghosts are updated
+  sync( neighbors );
+  EXPECT_EQ( countSyncedGhosts( false ), 0 );
+}
+
+TEST_F( SyncPlanTest, topologyVersionChange )
+{
+  if( MpiWrapper::Comm_size( MPI_COMM_GEOSX ) == 1 )
+  {
+    return;
+  }
+
+  std::vector< NeighborCommunicator > & neighbors = domain->getNeighbors();
+
+  resetField();
+  sync( neighbors );
+  EXPECT_EQ( countSyncedGhosts( false ), 0 );
+
+  // re-registering the field leaves the cached plan with a dangling wrapper, unless the topology is marked modified
+  NodeManager & nodeManager = *mesh->getNodeManager();
+  nodeManager.deregisterWrapper( fieldName );
+  registerField();
+
+  integer const version = mesh->topologyVersion();
+  mesh->modifiedTopology();
+  EXPECT_EQ( mesh->topologyVersion(), version + 1 );
+
+  resetField();
+  sync( neighbors );
+  EXPECT_EQ( countSyncedGhosts( false ), 0 );
+
+  // repeated syncs reuse the rebuilt plan
+  resetField();
+  sync( neighbors );
+  EXPECT_EQ( countSyncedGhosts( false ), 0 );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
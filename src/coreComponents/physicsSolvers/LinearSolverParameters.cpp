@@ -109,6 +109,13 @@ LinearSolverParametersInput::LinearSolverParametersInput( std::string const & na
     setInputFlag( InputFlags::OPTIONAL )->
     setDescription( "Weakest-allowed tolerance for adaptive method" );
 
+  registerWrapper( viewKeyStruct::krylovOrthogString, &m_parameters.krylov.orthogonalization )->
+    setApplyDefaultValue( m_parameters.krylov.orthogonalization )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Orthogonalization scheme of GMRES: modified Gram-Schmidt (one global reduction per basis vector) "
+                    "or classical Gram-Schmidt with reorthogonalization (two global reductions per iteration).\n"
+                    "Available options are:\n* " + EnumStrings< LinearSolverParameters::Krylov::Orthogonalization >::concat( "\n* " ) );
+
   registerWrapper( viewKeyStruct::amgNumSweepsString, &m_parameters.amg.numSweeps )->
     setApplyDefaultValue( m_parameters.amg.numSweeps )->
     setInputFlag( InputFlags::OPTIONAL )->
@@ -131,6 +138,21 @@ LinearSolverParametersInput::LinearSolverParametersInput( std::string const & na
     setInputFlag( InputFlags::OPTIONAL )->
     setDescription( "AMG strength-of-connection threshold" );
 
+  registerWrapper( viewKeyStruct::amgReuseSetupString, &m_parameters.amg.reuseSetup )->
+    setApplyDefaultValue( m_parameters.amg.reuseSetup )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Preconditioner setup reuse policy across linear solves. On reuse the structural setup (e.g. AMG coarsening) is kept "
+                    "and the values of the matrix are refreshed.\n"
+                    "Any option other than never solves with the native Krylov solvers instead of the solver of the linear algebra package.\n"
+                    "Available options are:\n* " +
+                    EnumStrings< LinearSolverParameters::AMG::ReuseSetup >::concat( "\n* " ) );
+
+  registerWrapper( viewKeyStruct::amgReuseIterGrowthString, &m_parameters.amg.reuseIterationGrowth )->
+    setApplyDefaultValue( m_parameters.amg.reuseIterationGrowth )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "When reusing the preconditioner setup, force a full rebuild once the Krylov iteration count exceeds "
+                    "this factor times the iteration count of the first solve after the last rebuild" );
+
   registerWrapper( viewKeyStruct::iluFillString, &m_parameters.ilu.fill )->
     setApplyDefaultValue( m_parameters.ilu.fill )->
     setInputFlag( InputFlags::OPTIONAL )->
@@ -140,6 +162,24 @@ LinearSolverParametersInput::LinearSolverParametersInput( std::string const & na
     setApplyDefaultValue( m_parameters.ilu.threshold )->
     setInputFlag( InputFlags::OPTIONAL )->
     setDescription( "ILU(T) threshold factor" );
+
+  registerWrapper( viewKeyStruct::cprDecouplingString, &m_parameters.cpr.decoupling )->
+    setApplyDefaultValue( m_parameters.cpr.decoupling )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "CPR pressure decoupling method. Available options are:\n* " +
+                    EnumStrings< LinearSolverParameters::CPR::Decoupling >::concat( "\n* " ) );
+
+  registerWrapper( viewKeyStruct::cprSmootherString, &m_parameters.cpr.smoother )->
+    setApplyDefaultValue( m_parameters.cpr.smoother )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "CPR second-stage preconditioner on the full system. Available options are:\n* " +
+                    EnumStrings< LinearSolverParameters::CPR::Smoother >::concat( "\n* " ) );
+
+  registerWrapper( viewKeyStruct::cprPressureReuseString, &m_parameters.cpr.pressureSetupReuse )->
+    setApplyDefaultValue( m_parameters.cpr.pressureSetupReuse )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Number of successive CPR setups that reuse the pressure stage (decoupling, pressure matrix and AMG), "
+                    "only recomputing the second stage. 0 rebuilds the pressure stage at every setup" );
 }
 
 void LinearSolverParametersInput::PostProcessInput()
@@ -169,6 +209,9 @@ void LinearSolverParametersInput::PostProcessInput()
   GEOSX_ERROR_IF_LT_MSG( m_parameters.amg.numSweeps, 0, "Invalid value of " << viewKeyStruct::amgNumSweepsString );
   GEOSX_ERROR_IF_LT_MSG( m_parameters.amg.threshold, 0.0, "Invalid value of " << viewKeyStruct::amgThresholdString );
   GEOSX_ERROR_IF_GT_MSG( m_parameters.amg.threshold, 1.0, "Invalid value of " << viewKeyStruct::amgThresholdString );
+  GEOSX_ERROR_IF_LT_MSG( m_parameters.amg.reuseIterationGrowth, 1.0, "Invalid value of " << viewKeyStruct::amgReuseIterGrowthString );
+
+  GEOSX_ERROR_IF_LT_MSG( m_parameters.cpr.pressureSetupReuse, 0, "Invalid value of " << viewKeyStruct::cprPressureReuseString );
 
   // TODO input validation for other AMG parameters ?
 }
@@ -85,14 +85,21 @@ public:
     static constexpr auto krylovTolString         = "krylovTol";         ///< Krylov tolerance key
     static constexpr auto krylovAdaptiveTolString = "krylovAdaptiveTol"; ///< Krylov adaptive tolerance key
     static constexpr auto krylovWeakTolString     = "krylovWeakestTol";  ///< Krylov weakest tolerance key
+    static constexpr auto krylovOrthogString      = "krylovOrthogonalization"; ///< GMRES orthogonalization key
 
     static constexpr auto amgNumSweepsString = "amgNumSweeps";             ///< AMG number of sweeps key
     static constexpr auto amgSmootherString  = "amgSmootherType";          ///< AMG smoother type key
     static constexpr auto amgCoarseString    = "amgCoarseSolver";          ///< AMG coarse solver key
     static constexpr auto amgThresholdString = "amgThreshold";             ///< AMG threshold key
+    static constexpr auto amgReuseSetupString = "amgReuseSetup";           ///< AMG setup reuse policy key
+    static constexpr auto amgReuseIterGrowthString = "amgReuseIterGrowth"; ///< AMG setup reuse iteration growth key
 
     static constexpr auto iluFillString      = "iluFill";       ///< ILU fill key
     static constexpr auto iluThresholdString = "iluThreshold";  ///< ILU threshold key
+
+    static constexpr auto cprDecouplingString    = "cprDecoupling";    ///< CPR decoupling key
+    static constexpr auto cprSmootherString      = "cprSmoother";      ///< CPR second-stage key
+    static constexpr auto cprPressureReuseString = "cprPressureReuse"; ///< CPR pressure stage reuse key
   } viewKeys;
 
 private:
@@ -33,6 +33,8 @@ SolverBase::SolverBase( std::string const & name,
   m_maxStableDt{ 1e99 },
   m_nextDt( 1e99 ),
   m_dofManager( name ),
+  m_matrixSparsityVersion( -1 ),
+  m_precondCreatedBySolver( false ),
   m_linearSolverParameters( groupKeyStruct::linearSolverParametersString, this ),
   m_nonlinearSolverParameters( groupKeyStruct::nonlinearSolverParametersString, this )
 {
@@ -218,6 +220,7 @@ real64 SolverBase::LinearImplicitStep( real64 const & time_n,
   // call setup for physics solver. Pre step allocations etc.
   // TODO: Nonlinear step does not call its own setup, need to decide on consistent behavior
   ImplicitStepSetup( time_n, dt, domain );
+  m_precondReuse.startTimeStep();
 
   // zero out matrix/rhs before assembly
   m_localMatrix.setValues< parallelDevicePolicy<> >( 0.0 );
@@ -240,9 +243,7 @@ real64 SolverBase::LinearImplicitStep( real64 const & time_n,
                            m_localRhs.toView() );
 
   // Compose parallel LA matrix/rhs out of local LA matrix/rhs
-  m_matrix.create( m_localMatrix.toViewConst(), MPI_COMM_GEOSX );
-  m_rhs.create( m_localRhs.toViewConst(), MPI_COMM_GEOSX );
-  m_solution.createWithLocalSize( m_matrix.numLocalCols(), MPI_COMM_GEOSX );
+  ComposeParallelSystem();
 
   // Output the linear system matrix/rhs for debugging purposes
   DebugOutputSystem( 0.0, 0, 0, m_matrix, m_rhs );
@@ -425,6 +426,7 @@ real64 SolverBase::NonlinearImplicitStep( real64 const & time_n,
     {
       ResetStateToBeginningOfStep( domain );
     }
+    m_precondReuse.startTimeStep();
 
     // keep residual from previous iteration in case we need to do a line search
     real64 lastResidual = 1e99;
@@ -535,9 +537,7 @@ real64 SolverBase::NonlinearImplicitStep( real64 const & time_n,
       }
 
       // Compose parallel LA matrix/rhs out of local LA matrix/rhs
-      m_matrix.create( m_localMatrix.toViewConst(), MPI_COMM_GEOSX );
-      m_rhs.create( m_localRhs.toViewConst(), MPI_COMM_GEOSX );
-      m_solution.createWithLocalSize( m_matrix.numLocalCols(), MPI_COMM_GEOSX );
+      ComposeParallelSystem();
 
       // Output the linear system matrix/rhs for debugging purposes
       DebugOutputSystem( time_n, cycleNumber, newtonIter, m_matrix, m_rhs );
@@ -670,6 +670,28 @@ void SolverBase::ApplyBoundaryConditions( real64 const GEOSX_UNUSED_PARAM( time
   GEOSX_ERROR( "SolverBase::ApplyBoundaryConditions called!. Should be overridden." );
 }
 
+void SolverBase::ComposeParallelSystem()
+{
+  GEOSX_MARK_FUNCTION;
+
+  bool const sameVersion = m_matrix.ready() && m_matrixSparsityVersion == m_dofManager.sparsityVersion();
+  if( !sameVersion || !m_matrix.update( m_localMatrix.toViewConst() ) )
+  {
+    GEOSX_LOG_RANK_0_IF( sameVersion && getLogLevel() >= 1,
+                         "    Sparsity pattern changed without a new sparsity version, re-creating the system matrix" );
+
+    // The preconditioner may refer to the old matrix structure, which must outlive it
+    if( m_precond )
+    {
+      m_precond->clear();
+    }
+    m_matrix.create( m_localMatrix.toViewConst(), MPI_COMM_GEOSX );
+    m_matrixSparsityVersion = m_dofManager.sparsityVersion();
+  }
+  m_rhs.create( m_localRhs.toViewConst(), MPI_COMM_GEOSX );
+  m_solution.createWithLocalSize( m_matrix.numLocalCols(), MPI_COMM_GEOSX );
+}
+
 namespace
 {
 
@@ -780,6 +802,25 @@ void SolverBase::SolveSystem( DofManager const & dofManager,
 
   LinearSolverParameters const & params = m_linearSolverParameters.get();
 
+  // Setup reuse relies on the system matrix being updated in place (see ComposeParallelSystem)
+  bool const reuseSetup = params.amg.reuseSetup != LinearSolverParameters::AMG::ReuseSetup::never
+                          && params.solverType != LinearSolverParameters::SolverType::direct
+                          && &matrix == &m_matrix;
+
+  // The backend solvers cannot build CPR, which needs the DofManager: like for setup reuse,
+  // the preconditioner is created here and used with the native Krylov solvers
+  bool const cpr = params.preconditionerType == LinearSolverParameters::PreconditionerType::cpr
+                   && params.solverType != LinearSolverParameters::SolverType::direct;
+
+  // A persistent preconditioner is needed to carry the setup over to the next solve
+  if( ( reuseSetup || cpr ) &&
+      ( !m_precond || ( m_precondCreatedBySolver && m_precondReuse.sparsityVersion() != m_matrixSparsityVersion ) ) )
+  {
+    m_precond = LAInterface::createPreconditioner( params, dofManager );
+    m_precondCreatedBySolver = true;
+    m_precondReuse.requestRebuild();
+  }
+
   // TODO: We probably want to keep an instance of linear solver as a member of physics solver
   //       so we can have constant access to last solve statistics, convergence history, etc.
   //       This requires unifying "LAI interface" solvers with "native" Krylov solvers somehow.
@@ -792,10 +833,55 @@ void SolverBase::SolveSystem( DofManager const & dofManager,
   }
   else
   {
-    m_precond->compute( matrix, dofManager );
+    // On reuse the structural setup is kept, but the values of the matrix are always refreshed
+    bool const rebuild = !reuseSetup || PreconditionerSetupRequired( matrix );
+    if( rebuild )
+    {
+      m_precond->compute( matrix, dofManager );
+    }
+    else
+    {
+      m_precond->recompute( matrix, dofManager );
+    }
+
     std::unique_ptr< KrylovSolver< ParallelVector > > solver = KrylovSolver< ParallelVector >::Create( params, matrix, *m_precond );
     solver->solve( rhs, solution );
     m_linearSolverResult = solver->result();
+
+    if( reuseSetup )
+    {
+      if( rebuild )
+      {
+        m_precondReuse.recordRebuild( m_matrixSparsityVersion, m_linearSolverResult.numIterations );
+      }
+      else if( !m_linearSolverResult.success() )
+      {
+        // The lagged setup was not good enough: recompute it and solve again
+        GEOSX_LOG_LEVEL_RANK_0( 1, "        Linear solve with reused preconditioner setup failed, recomputing setup." );
+        m_precond->compute( matrix, dofManager );
+        solution.zero();
+        solver->solve( rhs, solution );
+        m_linearSolverResult = solver->result();
+
+        m_precondReuse.recordRebuild( m_matrixSparsityVersion, m_linearSolverResult.numIterations );
+      }
+      else
+      {
+        m_precondReuse.recordReuse( params.amg.reuseIterationGrowth, m_linearSolverResult.numIterations );
+      }
+
+      m_linearSolverResult.numSetupReuses = m_precondReuse.numReuses();
+      m_linearSolverResult.numSetupRebuilds = m_precondReuse.numRebuilds();
+
+      GEOSX_LOG_LEVEL_RANK_0( 2, "        Preconditioner setup " << ( rebuild ? "rebuilt" : "reused" ) <<
+                              " (total reuses: " << m_precondReuse.numReuses() <<
+                              ", rebuilds: " << m_precondReuse.numRebuilds() << ")" );
+    }
+    else if( m_precondCreatedBySolver )
+    {
+      // Keep track of the sparsity version the preconditioner was created for
+      m_precondReuse.recordRebuild( m_matrixSparsityVersion, m_linearSolverResult.numIterations );
+    }
   }
 
   //  Keep for debugging comparisons
@@ -817,6 +903,14 @@ void SolverBase::SolveSystem( DofManager const & dofManager,
   }
 }
 
+bool SolverBase::PreconditionerSetupRequired( ParallelMatrix const & matrix ) const
+{
+  LinearSolverParameters const & params = m_linearSolverParameters.get();
+  return !m_precond->ready()
+         || &m_precond->matrix() != &matrix
+         || m_precondReuse.setupRequired( params.amg.reuseSetup, m_matrixSparsityVersion );
+}
+
 bool SolverBase::CheckSystemSolution( DomainPartition const & GEOSX_UNUSED_PARAM( domain ),
                                       DofManager const & GEOSX_UNUSED_PARAM( dofManager ),
                                       arrayView1d< real64 const > const & GEOSX_UNUSED_PARAM( localSolution ),
@@ -20,6 +20,7 @@
 #include "dataRepository/ExecutableGroup.hpp"
 #include "linearAlgebra/interfaces/InterfaceTypes.hpp"
 #include "linearAlgebra/utilities/LinearSolverResult.hpp"
+#include "linearAlgebra/utilities/PreconditionerSetupReuse.hpp"
 #include "linearAlgebra/DofManager.hpp"
 #include "managers/DomainPartition.hpp"
 #include "mesh/MeshBody.hpp"
@@ -346,6 +347,17 @@ public:
                            CRSMatrixView< real64, globalIndex const > const & localMatrix,
                            arrayView1d< real64 > const & localRhs );
 
+  /**
+   * @brief Compose parallel LA matrix/rhs/solution out of local LA matrix/rhs.
+   *
+   * The distributed matrix structure (and its communication data) is built from the local
+   * matrix only when the sparsity version of the DofManager has changed since the last call,
+   * or when the local pattern turns out to differ from the existing structure;
+   * otherwise values are copied into the existing parallel matrix.
+   */
+  void
+  ComposeParallelSystem();
+
   /**
    * @brief Output the assembled linear system for debug purposes.
    * @param time beginning-of-step time
@@ -716,6 +728,9 @@ protected:
   ParallelVector m_rhs;
   ParallelVector m_solution;
 
+  /// Sparsity version of the DofManager that was used to create the structure of the system matrix
+  integer m_matrixSparsityVersion;
+
   /// Local system matrix and rhs
   CRSMatrix< real64, globalIndex > m_localMatrix;
   array1d< real64 > m_localRhs;
@@ -724,6 +739,12 @@ protected:
   /// Custom preconditioner for the "native" iterative solver
   std::unique_ptr< PreconditionerBase< LAInterface > > m_precond;
 
+  /// State of preconditioner setup reuse across linear solves
+  PreconditionerSetupReuse m_precondReuse;
+
+  /// Whether m_precond was created by SolverBase, for setup reuse or CPR
+  bool m_precondCreatedBySolver;
+
   /// Linear solver parameters
   LinearSolverParametersInput m_linearSolverParameters;
 
@@ -735,6 +756,13 @@ protected:
 
 private:
 
+  /**
+   * @brief Decide whether the preconditioner must be fully recomputed before the next solve.
+   * @param matrix the system matrix
+   * @return @p true if the existing setup cannot or should not be reused
+   */
+  bool PreconditionerSetupRequired( ParallelMatrix const & matrix ) const;
+
   /// List of names of regions the solver will be applied to
   array1d< string > m_targetRegionNames;
 
@@ -91,6 +91,7 @@ CompositionalMultiphaseFlow::CompositionalMultiphaseFlow( const string & name,
     setDescription( "Flag indicating whether local (cell-wise) chopping of negative compositions is allowed" );
 
   m_linearSolverParameters.get().mgr.strategy = "CompositionalMultiphaseFlow";
+  m_linearSolverParameters.get().cpr.fieldName = viewKeyStruct::dofFieldString;
 
 }
 
@@ -1451,6 +1452,14 @@ void CompositionalMultiphaseFlow::ResetStateToBeginningOfStep( DomainPartition &
     dPres.setValues< parallelDevicePolicy<> >( 0.0 );
     dCompDens.setValues< parallelDevicePolicy<> >( 0.0 );
 
+    // the state at the beginning of the step is always flashed, whatever the flash cache tolerance
+    MultiFluidBase & fluid = GetConstitutiveModel< MultiFluidBase >( subRegion, m_fluidModelNames[targetIndex] );
+    MultiFluidPVTPackageWrapper * const pvtFluid = dynamic_cast< MultiFluidPVTPackageWrapper * >( &fluid );
+    if( pvtFluid != nullptr )
+    {
+      pvtFluid->invalidateFlashCache();
+    }
+
     UpdateState( subRegion, targetIndex );
   } );
 }
@@ -1484,6 +1493,27 @@ void CompositionalMultiphaseFlow::ImplicitStepComplete( real64 const & GEOSX_UNU
       }
     } );
   } );
+
+  // report how many fluid updates of the step reused the cached phase equilibrium
+  globalIndex numFlashHits = 0;
+  globalIndex numFlashMisses = 0;
+  forTargetSubRegions( mesh, [&]( localIndex const targetIndex, ElementSubRegionBase & subRegion )
+  {
+    MultiFluidBase & fluid = GetConstitutiveModel< MultiFluidBase >( subRegion, m_fluidModelNames[targetIndex] );
+    MultiFluidPVTPackageWrapper * const pvtFluid = dynamic_cast< MultiFluidPVTPackageWrapper * >( &fluid );
+    if( pvtFluid != nullptr )
+    {
+      pvtFluid->collectFlashCacheStatistics( numFlashHits, numFlashMisses );
+    }
+  } );
+
+  numFlashHits = MpiWrapper::Sum( numFlashHits );
+  numFlashMisses = MpiWrapper::Sum( numFlashMisses );
+  if( numFlashHits + numFlashMisses > 0 )
+  {
+    GEOSX_LOG_LEVEL_RANK_0( 1, getName() << ": flash cache hits = " << numFlashHits
+                                         << ", misses = " << numFlashMisses );
+  }
 }
 
 void CompositionalMultiphaseFlow::ResetViews( MeshLevel & mesh )
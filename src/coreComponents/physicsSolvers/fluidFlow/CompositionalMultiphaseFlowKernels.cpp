@@ -18,6 +18,7 @@
 
 #include "CompositionalMultiphaseFlowKernels.hpp"
 
+#include "finiteVolume/CellElementStencilMPFA.hpp"
 #include "finiteVolume/CellElementStencilTPFA.hpp"
 #include "finiteVolume/FaceElementStencil.hpp"
 
@@ -1044,8 +1045,7 @@ FluxKernel::
 
   forAll< parallelDevicePolicy<> >( stencil.size(), [=] GEOSX_HOST_DEVICE ( localIndex const iconn )
   {
-    // TODO: hack! for MPFA, etc. must obtain proper size from e.g. seri
-    localIndex const stencilSize = MAX_STENCIL;
+    localIndex const stencilSize = sei[iconn].size();
     localIndex constexpr NDOF = NC + 1;
 
     stackArray1d< real64, NUM_ELEMS * NC >                      localFlux( NUM_ELEMS * NC );
@@ -1152,6 +1152,12 @@ INST_FluxKernel( 3, CellElementStencilTPFA );
 INST_FluxKernel( 4, CellElementStencilTPFA );
 INST_FluxKernel( 5, CellElementStencilTPFA );
 
+INST_FluxKernel( 1, CellElementStencilMPFA );
+INST_FluxKernel( 2, CellElementStencilMPFA );
+INST_FluxKernel( 3, CellElementStencilMPFA );
+INST_FluxKernel( 4, CellElementStencilMPFA );
+INST_FluxKernel( 5, CellElementStencilMPFA );
+
 INST_FluxKernel( 1, FaceElementStencil );
 INST_FluxKernel( 2, FaceElementStencil );
 INST_FluxKernel( 3, FaceElementStencil );
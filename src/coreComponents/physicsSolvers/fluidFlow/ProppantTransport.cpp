@@ -1237,7 +1237,7 @@ void ProppantTransport::UpdateCellBasedFlux( real64 const GEOSX_UNUSED_PARAM( ti
 
   FluxKernel::ElementView< arrayView1d< R1Tensor > > const & cellBasedFlux = cellBasedFluxAccessor.toNestedView();
 
-  fluxApprox.forAllStencils( mesh, [&]( auto const & stencil )
+  fluxApprox.forStencils< CellElementStencilTPFA, FaceElementStencil >( mesh, [&]( auto const & stencil )
   {
     FluxKernel::LaunchCellBasedFluxCalculation( stencil,
                                                 transTMultiplier,
@@ -1287,7 +1287,7 @@ void ProppantTransport::UpdateProppantPackVolume( real64 const GEOSX_UNUSED_PARA
   ElementRegionManager::ElementViewAccessor< arrayView1d< real64 > > const proppantLiftFlux =
     elemManager.ConstructViewAccessor< array1d< real64 >, arrayView1d< real64 > >( viewKeyStruct::proppantLiftFluxString );
 
-  fluxApprox.forAllStencils( mesh, [&]( auto const & stencil )
+  fluxApprox.forStencils< CellElementStencilTPFA, FaceElementStencil >( mesh, [&]( auto const & stencil )
   {
     ProppantPackVolumeKernel::LaunchProppantPackVolumeCalculation( stencil,
                                                                    dt,
@@ -1330,7 +1330,7 @@ void ProppantTransport::UpdateProppantPackVolume( real64 const GEOSX_UNUSED_PARA
   } );
 
 
-  fluxApprox.forAllStencils( mesh, [&]( auto const & stencil )
+  fluxApprox.forStencils< CellElementStencilTPFA, FaceElementStencil >( mesh, [&]( auto const & stencil )
   {
     ProppantPackVolumeKernel::LaunchProppantPackVolumeUpdate( stencil,
                                                               downVector,
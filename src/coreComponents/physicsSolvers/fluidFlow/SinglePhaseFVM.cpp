@@ -43,9 +43,20 @@ using namespace SinglePhaseFVMKernels;
 template< typename BASE >
 SinglePhaseFVM< BASE >::SinglePhaseFVM( const std::string & name,
                                         Group * const parent ):
-  BASE( name, parent )
+  BASE( name, parent ),
+  m_useFlatCellIndex( 0 ),
+  m_flatCellIndexVersion( -1 ),
+  m_flatDofManager( nullptr ),
+  m_flatDofVersion( -1 ),
+  m_flatPressureTime( std::numeric_limits< real64 >::lowest() )
 {
   m_numDofPerCell = 1;
+
+  this->registerWrapper( viewKeyStruct::useFlatCellIndexString, &m_useFlatCellIndex )->
+    setApplyDefaultValue( 0 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Flag indicating whether the fluxes of two-point cell stencils are assembled from contiguous copies "
+                    "of the element fields, addressed with a single index per cell" );
 }
 
 
@@ -154,7 +165,7 @@ void SinglePhaseFVM< BASE >::ApplySystemSolution( DofManager const & dofManager,
 }
 
 template< typename BASE >
-void SinglePhaseFVM< BASE >::AssembleFluxTerms( real64 const GEOSX_UNUSED_PARAM( time_n ),
+void SinglePhaseFVM< BASE >::AssembleFluxTerms( real64 const time_n,
                                                 real64 const dt,
                                                 DomainPartition const & domain,
                                                 DofManager const & dofManager,
@@ -184,7 +195,7 @@ void SinglePhaseFVM< BASE >::AssembleFluxTerms( real64 const GEOSX_UNUSED_PARAM(
   elemDofNumber = mesh.getElemManager()->ConstructArrayViewAccessor< globalIndex, 1 >( dofKey );
   elemDofNumber.setName( this->getName() + "/accessors/" + dofKey );
 
-  fluxApprox.forAllStencils( mesh, [&]( auto const & stencil )
+  auto launch = [&]( auto const & stencil )
   {
     FluxKernel::Launch( stencil,
                         dt,
@@ -210,7 +221,69 @@ void SinglePhaseFVM< BASE >::AssembleFluxTerms( real64 const GEOSX_UNUSED_PARAM(
                         localMatrix,
                         localRhs,
                         m_derivativeFluxResidual_dAperture->toViewConstSizes() );
+  };
+
+  if( !m_useFlatCellIndex )
+  {
+    fluxApprox.forAllStencils( mesh, launch );
+    return;
+  }
+
+  // two-point cell stencils read the fields through flat mirrors, using a single index per cell
+  fluxApprox.forStencils< CellElementStencilTPFA >( mesh, [&]( CellElementStencilTPFA const & stencil )
+  {
+    // the numbering and the fields that only change with the mesh are refreshed on topology changes
+    ElementRegionManager const & elemManager = *mesh.getElemManager();
+    if( mesh.topologyVersion() != m_flatCellIndexVersion ||
+        elemManager.getNumberOfElements() != m_flatCellIndex.numElems() )
+    {
+      m_flatCellIndex.compute( elemManager );
+      m_flatCellIndex.gather( m_elemGhostRank.toNestedViewConst(), m_flatGhostRank );
+      m_flatCellIndex.gather( m_gravCoef.toNestedViewConst(), m_flatGravCoef );
+      m_flatCellIndexVersion = mesh.topologyVersion();
+      m_flatDofManager = nullptr;
+      m_flatPressureTime = std::numeric_limits< real64 >::lowest();
+    }
+
+    // the DoF numbers only change with the DoF layout
+    if( m_flatDofManager != &dofManager || m_flatDofVersion != dofManager.sparsityVersion() )
+    {
+      m_flatCellIndex.gather( elemDofNumber.toNestedViewConst(), m_flatDofNumber );
+      m_flatDofManager = &dofManager;
+      m_flatDofVersion = dofManager.sparsityVersion();
+    }
+
+    // the pressure is only updated when a time step completes
+    if( time_n != m_flatPressureTime )
+    {
+      m_flatCellIndex.gather( m_pressure.toNestedViewConst(), m_flatPressure );
+      m_flatPressureTime = time_n;
+    }
+
+    // the remaining fields change every Newton iteration and are gathered on the device
+    m_flatCellIndex.gather( m_deltaPressure.toNestedViewConst(), m_flatDeltaPressure );
+    m_flatCellIndex.gather( m_density.toNestedViewConst(), m_flatDensity );
+    m_flatCellIndex.gather( m_dDens_dPres.toNestedViewConst(), m_flatDDens_dPres );
+    m_flatCellIndex.gather( m_mobility.toNestedViewConst(), m_flatMobility );
+    m_flatCellIndex.gather( m_dMobility_dPres.toNestedViewConst(), m_flatDMobility_dPres );
+
+    FluxKernel::LaunchFlat( stencil,
+                            dt,
+                            dofManager.rankOffset(),
+                            m_flatDofNumber.toViewConst(),
+                            m_flatGhostRank.toViewConst(),
+                            m_flatPressure.toViewConst(),
+                            m_flatDeltaPressure.toViewConst(),
+                            m_flatGravCoef.toViewConst(),
+                            m_flatDensity.toViewConst(),
+                            m_flatDDens_dPres.toViewConst(),
+                            m_flatMobility.toViewConst(),
+                            m_flatDMobility_dPres.toViewConst(),
+                            localMatrix,
+                            localRhs );
   } );
+
+  fluxApprox.forStencils< CellElementStencilMPFA, FaceElementStencil >( mesh, launch );
 }
 
 template< typename BASE >
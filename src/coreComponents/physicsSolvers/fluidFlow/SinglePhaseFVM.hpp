@@ -19,6 +19,7 @@
 #ifndef GEOSX_PHYSICSSOLVERS_FLUIDFLOW_SINGLEPHASEFVM_HPP_
 #define GEOSX_PHYSICSSOLVERS_FLUIDFLOW_SINGLEPHASEFVM_HPP_
 
+#include "mesh/FlatCellIndex.hpp"
 #include "physicsSolvers/fluidFlow/SinglePhaseBase.hpp"
 #include "physicsSolvers/fluidFlow/SinglePhaseProppantBase.hpp"
 
@@ -208,7 +209,9 @@ public:
   /**@}*/
 
   struct viewKeyStruct : SinglePhaseBase::viewKeyStruct
-  {} viewKeysSinglePhaseFVM;
+  {
+    static constexpr auto useFlatCellIndexString = "useFlatCellIndex";
+  } viewKeysSinglePhaseFVM;
 
   viewKeyStruct & viewKeys()
   { return viewKeysSinglePhaseFVM; }
@@ -243,7 +246,32 @@ private:
                              CRSMatrixView< real64, globalIndex const > const & localMatrix,
                              arrayView1d< real64 > const & localRhs );
 
-  // no data needed here, see SinglePhaseBase
+  /// Flag to assemble the two-point cell fluxes through the flat element numbering
+  integer m_useFlatCellIndex;
+
+  /// Flat element numbering of the mesh, used by the two-point flux kernel
+  FlatCellIndex m_flatCellIndex;
+
+  /// Topology version of the mesh level for which m_flatCellIndex was last computed
+  integer m_flatCellIndexVersion;
+
+  /// DoF manager and sparsity version for which m_flatDofNumber was last gathered
+  DofManager const * m_flatDofManager;
+  integer m_flatDofVersion;
+
+  /// Beginning of the time step for which m_flatPressure was last gathered
+  real64 m_flatPressureTime;
+
+  /// Flat mirrors of the element fields read by the two-point flux kernel
+  array1d< globalIndex > m_flatDofNumber;
+  array1d< integer > m_flatGhostRank;
+  array1d< real64 > m_flatPressure;
+  array1d< real64 > m_flatDeltaPressure;
+  array1d< real64 > m_flatGravCoef;
+  array2d< real64 > m_flatDensity;
+  array2d< real64 > m_flatDDens_dPres;
+  array1d< real64 > m_flatMobility;
+  array1d< real64 > m_flatDMobility_dPres;
 
 };
 
@@ -24,6 +24,7 @@ namespace geosx
 namespace SinglePhaseFVMKernels
 {
 
+template< localIndex MAX_STENCIL_SIZE >
 GEOSX_HOST_DEVICE
 void
 FluxKernel::Compute( localIndex const stencilSize,
@@ -42,11 +43,10 @@ FluxKernel::Compute( localIndex const stencilSize,
                      arraySlice1d< real64 > const & flux,
                      arraySlice2d< real64 > const & fluxJacobian )
 {
-  localIndex constexpr maxStencil = CellElementStencilTPFA::MAX_STENCIL_SIZE;
-  stackArray1d< real64, maxStencil > dDensMean_dP( stencilSize );
-  stackArray1d< real64, maxStencil > dFlux_dP( stencilSize );
+  real64 dDensMean_dP[MAX_STENCIL_SIZE]{};
+  real64 dFlux_dP[MAX_STENCIL_SIZE]{};
 
-  // average density
+  // average density (only the two cells sharing the face contribute)
   real64 densMean = 0.0;
   for( localIndex ke = 0; ke < 2; ++ke )
   {
@@ -83,7 +83,7 @@ FluxKernel::Compute( localIndex const stencilSize,
   real64 const alpha = ( potDif + upwAbsTol ) / ( 2 * upwAbsTol );
 
   real64 mobility{};
-  real64 dMobility_dP[2]{};
+  real64 dMobility_dP[MAX_STENCIL_SIZE]{};
   if( alpha <= 0.0 || alpha >= 1.0 )
   {
     // happy path: single upwind direction
@@ -357,54 +357,116 @@ FluxKernel::ComputeJunction( localIndex const numFluxElems,
   }
 }
 
-template<>
+template< typename STENCIL_TYPE >
 void FluxKernel::
-  Launch< CellElementStencilTPFA >( CellElementStencilTPFA const & stencil,
-                                    real64 const dt,
-                                    globalIndex const rankOffset,
-                                    ElementViewConst< arrayView1d< globalIndex > > const & dofNumber,
-                                    ElementViewConst< arrayView1d< integer const > > const & ghostRank,
-                                    ElementViewConst< arrayView1d< real64 const > > const & pres,
-                                    ElementViewConst< arrayView1d< real64 const > > const & dPres,
-                                    ElementViewConst< arrayView1d< real64 const > > const & gravCoef,
-                                    ElementViewConst< arrayView2d< real64 const > > const & dens,
-                                    ElementViewConst< arrayView2d< real64 const > > const & dDens_dPres,
-                                    ElementViewConst< arrayView1d< real64 const > > const & mob,
-                                    ElementViewConst< arrayView1d< real64 const > > const & dMob_dPres,
-                                    ElementViewConst< arrayView1d< real64 const > > const & GEOSX_UNUSED_PARAM( aperture0 ),
-                                    ElementViewConst< arrayView1d< real64 const > > const & GEOSX_UNUSED_PARAM( aperture ),
-                                    ElementViewConst< arrayView1d< R1Tensor const > > const & GEOSX_UNUSED_PARAM( transTMultiplier ),
-                                    R1Tensor const,
-                                    real64 const,
-#ifdef GEOSX_USE_SEPARATION_COEFFICIENT
-                                    ElementViewConst< arrayView1d< real64 const > > const & GEOSX_UNUSED_PARAM( s ),
-                                    ElementViewConst< arrayView1d< real64 const > > const & GEOSX_UNUSED_PARAM( dSdAper ),
-#endif
-                                    CRSMatrixView< real64, globalIndex const > const & localMatrix,
-                                    arrayView1d< real64 > const & localRhs,
-                                    CRSMatrixView< real64, localIndex const > const & GEOSX_UNUSED_PARAM( dR_dAper ) )
+  LaunchCellBased( STENCIL_TYPE const & stencil,
+                   real64 const dt,
+                   globalIndex const rankOffset,
+                   ElementViewConst< arrayView1d< globalIndex const > > const & dofNumber,
+                   ElementViewConst< arrayView1d< integer const > > const & ghostRank,
+                   ElementViewConst< arrayView1d< real64 const > > const & pres,
+                   ElementViewConst< arrayView1d< real64 const > > const & dPres,
+                   ElementViewConst< arrayView1d< real64 const > > const & gravCoef,
+                   ElementViewConst< arrayView2d< real64 const > > const & dens,
+                   ElementViewConst< arrayView2d< real64 const > > const & dDens_dPres,
+                   ElementViewConst< arrayView1d< real64 const > > const & mob,
+                   ElementViewConst< arrayView1d< real64 const > > const & dMob_dPres,
+                   CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                   arrayView1d< real64 > const & localRhs )
+{
+  constexpr localIndex numFluxElems = STENCIL_TYPE::NUM_POINT_IN_FLUX;
+  constexpr localIndex maxStencilSize = STENCIL_TYPE::MAX_STENCIL_SIZE;
+
+  typename STENCIL_TYPE::IndexContainerViewConstType const & seri = stencil.getElementRegionIndices();
+  typename STENCIL_TYPE::IndexContainerViewConstType const & sesri = stencil.getElementSubRegionIndices();
+  typename STENCIL_TYPE::IndexContainerViewConstType const & sei = stencil.getElementIndices();
+  typename STENCIL_TYPE::WeightContainerViewConstType const & weights = stencil.getWeights();
+
+  forAll< parallelDevicePolicy<> >( stencil.size(), [=] GEOSX_HOST_DEVICE ( localIndex const iconn )
+  {
+    localIndex const stencilSize = sei[iconn].size();
+
+    // working arrays
+    stackArray1d< globalIndex, maxStencilSize > dofColIndices( stencilSize );
+    stackArray1d< real64, numFluxElems > localFlux( numFluxElems );
+    stackArray2d< real64, numFluxElems *maxStencilSize > localFluxJacobian( numFluxElems, stencilSize );
+
+    Compute< maxStencilSize >( stencilSize,
+                               seri[iconn],
+                               sesri[iconn],
+                               sei[iconn],
+                               weights[iconn],
+                               pres,
+                               dPres,
+                               gravCoef,
+                               dens,
+                               dDens_dPres,
+                               mob,
+                               dMob_dPres,
+                               dt,
+                               localFlux,
+                               localFluxJacobian );
+
+    // extract DOF numbers
+    for( localIndex i = 0; i < stencilSize; ++i )
+    {
+      dofColIndices[i] = dofNumber[seri( iconn, i )][sesri( iconn, i )][sei( iconn, i )];
+    }
+
+    for( localIndex i = 0; i < numFluxElems; ++i )
+    {
+      if( ghostRank[seri( iconn, i )][sesri( iconn, i )][sei( iconn, i )] < 0 )
+      {
+        globalIndex const globalRow = dofNumber[seri( iconn, i )][sesri( iconn, i )][sei( iconn, i )];
+        localIndex const localRow = LvArray::integerConversion< localIndex >( globalRow - rankOffset );
+        GEOSX_ASSERT_GE( localRow, 0 );
+        GEOSX_ASSERT_GT( localMatrix.numRows(), localRow );
+
+        RAJA::atomicAdd( parallelDeviceAtomic{}, &localRhs[localRow], localFlux[i] );
+        localMatrix.addToRowBinarySearchUnsorted< parallelDeviceAtomic >( localRow,
+                                                                          dofColIndices.data(),
+                                                                          localFluxJacobian[i].dataIfContiguous(),
+                                                                          stencilSize );
+      }
+    }
+  } );
+}
+
+void FluxKernel::
+  LaunchFlat( CellElementStencilTPFA const & stencil,
+              real64 const dt,
+              globalIndex const rankOffset,
+              arrayView1d< globalIndex const > const & dofNumber,
+              arrayView1d< integer const > const & ghostRank,
+              arrayView1d< real64 const > const & pres,
+              arrayView1d< real64 const > const & dPres,
+              arrayView1d< real64 const > const & gravCoef,
+              arrayView2d< real64 const > const & dens,
+              arrayView2d< real64 const > const & dDens_dPres,
+              arrayView1d< real64 const > const & mob,
+              arrayView1d< real64 const > const & dMob_dPres,
+              CRSMatrixView< real64, globalIndex const > const & localMatrix,
+              arrayView1d< real64 > const & localRhs )
 {
-  constexpr localIndex maxNumFluxElems = CellElementStencilTPFA::NUM_POINT_IN_FLUX;
   constexpr localIndex numFluxElems = CellElementStencilTPFA::NUM_POINT_IN_FLUX;
-  constexpr localIndex maxStencilSize = CellElementStencilTPFA::MAX_STENCIL_SIZE;
-  constexpr localIndex stencilSize  = CellElementStencilTPFA::MAX_STENCIL_SIZE;
+  constexpr localIndex stencilSize = CellElementStencilTPFA::MAX_STENCIL_SIZE;
+
+  arrayView2d< localIndex const > const & flatIndices = stencil.getFlatElementIndices();
+  CellElementStencilTPFA::WeightContainerViewConstType const & weights = stencil.getWeights();
 
-  typename CellElementStencilTPFA::IndexContainerViewConstType const & seri = stencil.getElementRegionIndices();
-  typename CellElementStencilTPFA::IndexContainerViewConstType const & sesri = stencil.getElementSubRegionIndices();
-  typename CellElementStencilTPFA::IndexContainerViewConstType const & sei = stencil.getElementIndices();
-  typename CellElementStencilTPFA::WeightContainerViewConstType const & weights = stencil.getWeights();
+  GEOSX_ASSERT_EQ( flatIndices.size( 0 ), stencil.size() );
 
   forAll< parallelDevicePolicy<> >( stencil.size(), [=] GEOSX_HOST_DEVICE ( localIndex const iconn )
   {
     // working arrays
-    stackArray1d< globalIndex, maxNumFluxElems > dofColIndices( stencilSize );
-    stackArray1d< real64, maxNumFluxElems > localFlux( numFluxElems );
-    stackArray2d< real64, maxNumFluxElems *maxStencilSize > localFluxJacobian( numFluxElems, stencilSize );
+    globalIndex dofColIndices[stencilSize];
+    stackArray1d< real64, numFluxElems > localFlux( numFluxElems );
+    stackArray2d< real64, numFluxElems *stencilSize > localFluxJacobian( numFluxElems, stencilSize );
 
     Compute( stencilSize,
-             seri[iconn],
-             sesri[iconn],
-             sei[iconn],
+             flatIndices[iconn],
+             flatIndices[iconn],
+             flatIndices[iconn],
              weights[iconn],
              pres,
              dPres,
@@ -420,21 +482,21 @@ void FluxKernel::
     // extract DOF numbers
     for( localIndex i = 0; i < stencilSize; ++i )
     {
-      dofColIndices[i] = dofNumber[seri( iconn, i )][sesri( iconn, i )][sei( iconn, i )];
+      dofColIndices[i] = dofNumber[flatIndices( iconn, i )];
     }
 
     for( localIndex i = 0; i < numFluxElems; ++i )
     {
-      if( ghostRank[seri( iconn, i )][sesri( iconn, i )][sei( iconn, i )] < 0 )
+      localIndex const ei = flatIndices( iconn, i );
+      if( ghostRank[ei] < 0 )
       {
-        globalIndex const globalRow = dofNumber[seri( iconn, i )][sesri( iconn, i )][sei( iconn, i )];
-        localIndex const localRow = LvArray::integerConversion< localIndex >( globalRow - rankOffset );
+        localIndex const localRow = LvArray::integerConversion< localIndex >( dofNumber[ei] - rankOffset );
         GEOSX_ASSERT_GE( localRow, 0 );
         GEOSX_ASSERT_GT( localMatrix.numRows(), localRow );
 
         RAJA::atomicAdd( parallelDeviceAtomic{}, &localRhs[localRow], localFlux[i] );
         localMatrix.addToRowBinarySearchUnsorted< parallelDeviceAtomic >( localRow,
-                                                                          dofColIndices.data(),
+                                                                          dofColIndices,
                                                                           localFluxJacobian[i].dataIfContiguous(),
                                                                           stencilSize );
       }
@@ -442,6 +504,92 @@ void FluxKernel::
   } );
 }
 
+template<>
+void FluxKernel::
+  Launch< CellElementStencilTPFA >( CellElementStencilTPFA const & stencil,
+                                    real64 const dt,
+                                    globalIndex const rankOffset,
+                                    ElementViewConst< arrayView1d< globalIndex const > > const & dofNumber,
+                                    ElementViewConst< arrayView1d< integer const > > const & ghostRank,
+                                    ElementViewConst< arrayView1d< real64 const > > const & pres,
+                                    ElementViewConst< arrayView1d< real64 const > > const & dPres,
+                                    ElementViewConst< arrayView1d< real64 const > > const & gravCoef,
+                                    ElementViewConst< arrayView2d< real64 const > > const & dens,
+                                    ElementViewConst< arrayView2d< real64 const > > const & dDens_dPres,
+                                    ElementViewConst< arrayView1d< real64 const > > const & mob,
+                                    ElementViewConst< arrayView1d< real64 const > > const & dMob_dPres,
+                                    ElementViewConst< arrayView1d< real64 const > > const & GEOSX_UNUSED_PARAM( aperture0 ),
+                                    ElementViewConst< arrayView1d< real64 const > > const & GEOSX_UNUSED_PARAM( aperture ),
+                                    ElementViewConst< arrayView1d< R1Tensor const > > const & GEOSX_UNUSED_PARAM( transTMultiplier ),
+                                    R1Tensor const,
+                                    real64 const,
+#ifdef GEOSX_USE_SEPARATION_COEFFICIENT
+                                    ElementViewConst< arrayView1d< real64 const > > const & GEOSX_UNUSED_PARAM( s ),
+                                    ElementViewConst< arrayView1d< real64 const > > const & GEOSX_UNUSED_PARAM( dSdAper ),
+#endif
+                                    CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                                    arrayView1d< real64 > const & localRhs,
+                                    CRSMatrixView< real64, localIndex const > const & GEOSX_UNUSED_PARAM( dR_dAper ) )
+{
+  LaunchCellBased( stencil,
+                   dt,
+                   rankOffset,
+                   dofNumber,
+                   ghostRank,
+                   pres,
+                   dPres,
+                   gravCoef,
+                   dens,
+                   dDens_dPres,
+                   mob,
+                   dMob_dPres,
+                   localMatrix,
+                   localRhs );
+}
+
+template<>
+void FluxKernel::
+  Launch< CellElementStencilMPFA >( CellElementStencilMPFA const & stencil,
+                                    real64 const dt,
+                                    globalIndex const rankOffset,
+                                    ElementViewConst< arrayView1d< globalIndex const > > const & dofNumber,
+                                    ElementViewConst< arrayView1d< integer const > > const & ghostRank,
+                                    ElementViewConst< arrayView1d< real64 const > > const & pres,
+                                    ElementViewConst< arrayView1d< real64 const > > const & dPres,
+                                    ElementViewConst< arrayView1d< real64 const > > const & gravCoef,
+                                    ElementViewConst< arrayView2d< real64 const > > const & dens,
+                                    ElementViewConst< arrayView2d< real64 const > > const & dDens_dPres,
+                                    ElementViewConst< arrayView1d< real64 const > > const & mob,
+                                    ElementViewConst< arrayView1d< real64 const > > const & dMob_dPres,
+                                    ElementViewConst< arrayView1d< real64 const > > const & GEOSX_UNUSED_PARAM( aperture0 ),
+                                    ElementViewConst< arrayView1d< real64 const > > const & GEOSX_UNUSED_PARAM( aperture ),
+                                    ElementViewConst< arrayView1d< R1Tensor const > > const & GEOSX_UNUSED_PARAM( transTMultiplier ),
+                                    R1Tensor const,
+                                    real64 const,
+#ifdef GEOSX_USE_SEPARATION_COEFFICIENT
+                                    ElementViewConst< arrayView1d< real64 const > > const & GEOSX_UNUSED_PARAM( s ),
+                                    ElementViewConst< arrayView1d< real64 const > > const & GEOSX_UNUSED_PARAM( dSdAper ),
+#endif
+                                    CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                                    arrayView1d< real64 > const & localRhs,
+                                    CRSMatrixView< real64, localIndex const > const & GEOSX_UNUSED_PARAM( dR_dAper ) )
+{
+  LaunchCellBased( stencil,
+                   dt,
+                   rankOffset,
+                   dofNumber,
+                   ghostRank,
+                   pres,
+                   dPres,
+                   gravCoef,
+                   dens,
+                   dDens_dPres,
+                   mob,
+                   dMob_dPres,
+                   localMatrix,
+                   localRhs );
+}
+
 template<>
 void FluxKernel::
   Launch< FaceElementStencil >( FaceElementStencil const & stencil,
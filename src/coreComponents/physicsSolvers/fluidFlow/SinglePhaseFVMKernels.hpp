@@ -178,12 +178,63 @@ struct FluxKernel
             CRSMatrixView< real64, localIndex const > const & dR_dAper );
 
 
+  /**
+   * @brief launches the kernel to assemble the flux contributions of a cell-based stencil.
+   * @tparam STENCIL_TYPE The type of the cell stencil (two-point or multi-point).
+   *
+   * The flux of each stencil entry is between its first two points, while all the points
+   * of the entry contribute to the flux through the stencil weights.
+   * See Launch() for the description of the parameters.
+   */
+  template< typename STENCIL_TYPE >
+  static void
+  LaunchCellBased( STENCIL_TYPE const & stencil,
+                   real64 const dt,
+                   globalIndex const rankOffset,
+                   ElementViewConst< arrayView1d< globalIndex const > > const & dofNumber,
+                   ElementViewConst< arrayView1d< integer const > > const & ghostRank,
+                   ElementViewConst< arrayView1d< real64 const > > const & pres,
+                   ElementViewConst< arrayView1d< real64 const > > const & dPres,
+                   ElementViewConst< arrayView1d< real64 const > > const & gravCoef,
+                   ElementViewConst< arrayView2d< real64 const > > const & dens,
+                   ElementViewConst< arrayView2d< real64 const > > const & dDens_dPres,
+                   ElementViewConst< arrayView1d< real64 const > > const & mob,
+                   ElementViewConst< arrayView1d< real64 const > > const & dMob_dPres,
+                   CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                   arrayView1d< real64 > const & localRhs );
+
+  /**
+   * @brief launches the kernel to assemble the flux contributions of a two-point stencil
+   *        using the flat element numbering of the stencil.
+   *
+   * All element fields are flat mirrors indexed according to FlatCellIndex, which replaces
+   * the region/subregion/element indirection of LaunchCellBased() with a single gather.
+   * See Launch() for the description of the parameters.
+   */
+  static void
+  LaunchFlat( CellElementStencilTPFA const & stencil,
+              real64 const dt,
+              globalIndex const rankOffset,
+              arrayView1d< globalIndex const > const & dofNumber,
+              arrayView1d< integer const > const & ghostRank,
+              arrayView1d< real64 const > const & pres,
+              arrayView1d< real64 const > const & dPres,
+              arrayView1d< real64 const > const & gravCoef,
+              arrayView2d< real64 const > const & dens,
+              arrayView2d< real64 const > const & dDens_dPres,
+              arrayView1d< real64 const > const & mob,
+              arrayView1d< real64 const > const & dMob_dPres,
+              CRSMatrixView< real64, globalIndex const > const & localMatrix,
+              arrayView1d< real64 > const & localRhs );
+
   /**
    * @brief Compute flux and its derivatives for a given connection
+   * @tparam MAX_STENCIL_SIZE maximum number of points in the stencil entry
    *
    * This is a general version that assumes different element regions.
    * See below for a specialized version for fluxes within a region.
    */
+  template< localIndex MAX_STENCIL_SIZE >
   GEOSX_HOST_DEVICE
   static void
   Compute( localIndex const stencilSize,
@@ -66,6 +66,13 @@ void SinglePhaseHybridFVM::RegisterDataOnMesh( Group * const MeshBodies )
       setRegisteringObjects( this->getName())->
       setDescription( "An array that holds the accumulated pressure updates at the faces." );
 
+    // per-element transmissibility matrices, precomputed for the flux assembly
+    meshLevel->getElemManager()->forElementSubRegions< CellElementSubRegion >( [&]( CellElementSubRegion & subRegion )
+    {
+      subRegion.registerWrapper< array3d< real64 > >( viewKeyStruct::transMatrixString )->
+        setRestartFlags( RestartFlags::NO_WRITE )->
+        setDescription( "An array that holds the transmissibility matrix of each element." );
+    } );
   }
 }
 
@@ -106,6 +113,48 @@ void SinglePhaseHybridFVM::InitializePostInitialConditions_PreSubGroups( Group *
   GEOSX_ERROR_IF_LE_MSG( minVal.get(), 0.0,
                          "The transmissibility multipliers used in SinglePhaseHybridFVM must strictly larger than 0.0" );
 
+  ComputeTransMatrices( domain );
+}
+
+void SinglePhaseHybridFVM::ComputeTransMatrices( DomainPartition & domain )
+{
+  GEOSX_MARK_FUNCTION;
+
+  MeshLevel & mesh = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
+  NodeManager const & nodeManager = *mesh.getNodeManager();
+  FaceManager const & faceManager = *mesh.getFaceManager();
+
+  NumericalMethodsManager const & numericalMethodManager = domain.getNumericalMethodManager();
+  FiniteVolumeManager const & fvManager = numericalMethodManager.getFiniteVolumeManager();
+  FluxApproximationBase const & fluxApprox = fvManager.getFluxApproximation( m_discretizationName );
+
+  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & nodePosition = nodeManager.referencePosition();
+
+  // TODO: implement some kind of HybridFVMApprox that inherits from FluxApproximationBase
+  string const & coeffName = fluxApprox.getReference< string >( FluxApproximationBase::viewKeyStruct::coeffNameString );
+  arrayView1d< real64 const > const & transMultiplier =
+    faceManager.getReference< array1d< real64 > >( coeffName + FluxApproximationBase::viewKeyStruct::transMultiplierString );
+
+  ArrayOfArraysView< localIndex const > const & faceToNodes = faceManager.nodeList().toViewConst();
+
+  // tolerance for transmissibility calculation
+  real64 const lengthTolerance = domain.getMeshBody( 0 )->getGlobalLengthScale() * m_areaRelTol;
+
+  forTargetSubRegions< CellElementSubRegion >( mesh, [&]( localIndex const,
+                                                          CellElementSubRegion & subRegion )
+  {
+    localIndex const numFaces = subRegion.numFacesPerElement();
+    array3d< real64 > & transMatrix = subRegion.getReference< array3d< real64 > >( viewKeyStruct::transMatrixString );
+    transMatrix.resizeDimension< 1, 2 >( numFaces, numFaces );
+
+    KernelLaunchSelector< TransMatrixKernel >( numFaces,
+                                               subRegion,
+                                               nodePosition,
+                                               transMultiplier,
+                                               faceToNodes,
+                                               lengthTolerance,
+                                               transMatrix.toView() );
+  } );
 }
 
 void SinglePhaseHybridFVM::ImplicitStepSetup( real64 const & time_n,
@@ -196,17 +245,8 @@ void SinglePhaseHybridFVM::AssembleFluxTerms( real64 const GEOSX_UNUSED_PARAM( t
   GEOSX_MARK_FUNCTION;
 
   MeshLevel const & mesh          = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
-  NodeManager const & nodeManager = *mesh.getNodeManager();
   FaceManager const & faceManager = *mesh.getFaceManager();
 
-  NumericalMethodsManager const & numericalMethodManager = domain.getNumericalMethodManager();
-  FiniteVolumeManager const & fvManager = numericalMethodManager.getFiniteVolumeManager();
-  FluxApproximationBase const & fluxApprox = fvManager.getFluxApproximation( m_discretizationName );
-
-  // node data (for transmissibility computation)
-
-  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & nodePosition = nodeManager.referencePosition();
-
   // face data
 
   // get the face-based DOF numbers for the assembly
@@ -231,22 +271,10 @@ void SinglePhaseHybridFVM::AssembleFluxTerms( real64 const GEOSX_UNUSED_PARAM( t
   arrayView1d< real64 const > const & faceGravCoef =
     faceManager.getReference< array1d< real64 > >( viewKeyStruct::gravityCoefString );
 
-  // get the face-centered transMultiplier
-  // TODO: implement some kind of HybridFVMApprox that inherits from FluxApproximationBase
-  string const & coeffName = fluxApprox.getReference< string >( FluxApproximationBase::viewKeyStruct::coeffNameString );
-  arrayView1d< real64 const > const & transMultiplier =
-    faceManager.getReference< array1d< real64 > >( coeffName + FluxApproximationBase::viewKeyStruct::transMultiplierString );
-
-  // get the face-to-nodes connectivity for the transmissibility calculation
-  ArrayOfArraysView< localIndex const > const & faceToNodes = faceManager.nodeList().toViewConst();
-
   arrayView2d< localIndex const > const & elemRegionList    = faceManager.elementRegionList();
   arrayView2d< localIndex const > const & elemSubRegionList = faceManager.elementSubRegionList();
   arrayView2d< localIndex const > const & elemList          = faceManager.elementList();
 
-  // tolerance for transmissibility calculation
-  real64 const lengthTolerance = domain.getMeshBody( 0 )->getGlobalLengthScale() * m_areaRelTol;
-
   forTargetSubRegionsComplete< CellElementSubRegion >( mesh,
                                                        [&]( localIndex const targetIndex,
                                                             localIndex const er,
@@ -263,22 +291,19 @@ void SinglePhaseHybridFVM::AssembleFluxTerms( real64 const GEOSX_UNUSED_PARAM( t
                                         subRegion,
                                         fluid,
                                         m_regionFilter.toViewConst(),
-                                        nodePosition,
                                         elemRegionList,
                                         elemSubRegionList,
                                         elemList,
-                                        faceToNodes,
                                         faceDofNumber,
                                         faceGhostRank,
                                         facePres,
                                         dFacePres,
                                         faceGravCoef,
-                                        transMultiplier,
                                         m_mobility.toNestedViewConst(),
                                         m_dMobility_dPres.toNestedViewConst(),
                                         elemDofNumber.toNestedViewConst(),
                                         dofManager.rankOffset(),
-                                        lengthTolerance,
+                                        subRegion.template getReference< array3d< real64 > >( viewKeyStruct::transMatrixString ).toViewConst(),
                                         dt,
                                         localMatrix,
                                         localRhs );
@@ -149,6 +149,9 @@ public:
     // primary face-based field
     static constexpr auto deltaFacePressureString = "deltaFacePressure";
 
+    // per-element transmissibility (inner product) matrices
+    static constexpr auto transMatrixString = "transMatrix";
+
   } viewKeysSinglePhaseHybridFVM;
 
   viewKeyStruct & viewKeys()
@@ -170,6 +173,16 @@ public:
 
 private:
 
+  /**
+   * @brief Compute the transmissibility matrices of the elements in the target regions
+   * @param domain the domain partition
+   *
+   * The matrices only depend on the geometry, the permeability and the transmissibility multipliers.
+   * They are computed once after the initial conditions are applied. Like the two-point stencil weights,
+   * they use the reference node positions, which do not move with the solid, so they are not recomputed.
+   */
+  void ComputeTransMatrices( DomainPartition & domain );
+
   /// Dof key for the member functions that do not have access to the coupled Dof manager
   string m_faceDofKey;
 
@@ -402,6 +402,45 @@ AssemblerKernel::Compute( localIndex const er,
 }
 
 
+/******************************** TransMatrixKernel ********************************/
+
+template< localIndex NF >
+void
+TransMatrixKernel::Launch( CellElementSubRegion const & subRegion,
+                           arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & nodePosition,
+                           arrayView1d< real64 const > const & transMultiplier,
+                           ArrayOfArraysView< localIndex const > const & faceToNodes,
+                           real64 const lengthTolerance,
+                           arrayView3d< real64 > const & transMatrix )
+{
+  // get the map from elem to faces
+  arrayView2d< localIndex const > const elemToFaces = subRegion.faceList().toViewConst();
+
+  // get the element data needed for transmissibility computation
+  arrayView2d< real64 const > const elemCenter =
+    subRegion.getReference< array2d< real64 > >( CellBlock::viewKeyStruct::elementCenterString );
+  arrayView1d< real64 const > const elemVolume =
+    subRegion.getReference< array1d< real64 > >( CellBlock::viewKeyStruct::elementVolumeString );
+  arrayView1d< R1Tensor const > const elemPerm =
+    subRegion.getReference< array1d< R1Tensor > >( SinglePhaseBase::viewKeyStruct::permeabilityString );
+
+  forAll< parallelHostPolicy >( subRegion.size(), [=] ( localIndex const ei )
+  {
+    real64 const perm[ 3 ] = { elemPerm[ei][0], elemPerm[ei][1], elemPerm[ei][2] };
+
+    HybridFVMInnerProduct::QTPFACellInnerProductKernel::Compute< NF >( nodePosition,
+                                                                       transMultiplier,
+                                                                       faceToNodes,
+                                                                       elemToFaces[ei],
+                                                                       elemCenter[ei],
+                                                                       elemVolume[ei],
+                                                                       perm,
+                                                                       2,
+                                                                       lengthTolerance,
+                                                                       transMatrix[ei] );
+  } );
+}
+
 /******************************** FluxKernel ********************************/
 
 template< localIndex NF >
@@ -411,22 +450,19 @@ FluxKernel::Launch( localIndex er,
                     CellElementSubRegion const & subRegion,
                     constitutive::SingleFluidBase const & fluid,
                     SortedArrayView< localIndex const > const & regionFilter,
-                    arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & nodePosition,
                     arrayView2d< localIndex const > const & elemRegionList,
                     arrayView2d< localIndex const > const & elemSubRegionList,
                     arrayView2d< localIndex const > const & elemList,
-                    ArrayOfArraysView< localIndex const > const & faceToNodes,
                     arrayView1d< globalIndex const > const & faceDofNumber,
                     arrayView1d< integer const > const & faceGhostRank,
                     arrayView1d< real64 const > const & facePres,
                     arrayView1d< real64 const > const & dFacePres,
                     arrayView1d< real64 const > const & faceGravCoef,
-                    arrayView1d< real64 const > const & transMultiplier,
                     ElementViewConst< arrayView1d< real64 const > > const & mobility,
                     ElementViewConst< arrayView1d< real64 const > > const & dMobility_dp,
                     ElementViewConst< arrayView1d< globalIndex const > > const & elemDofNumber,
                     localIndex const rankOffset,
-                    real64 const lengthTolerance,
+                    arrayView3d< real64 const > const & transMatrix,
                     real64 const dt,
                     CRSMatrixView< real64, globalIndex const > const & localMatrix,
                     arrayView1d< real64 > const & localRhs )
@@ -443,14 +479,6 @@ FluxKernel::Launch( localIndex er,
   arrayView1d< real64 const > const dElemPres =
     subRegion.getReference< array1d< real64 > >( SinglePhaseBase::viewKeyStruct::deltaPressureString );
 
-  // get the element data needed for transmissibility computation
-  arrayView2d< real64 const > const elemCenter =
-    subRegion.getReference< array2d< real64 > >( CellBlock::viewKeyStruct::elementCenterString );
-  arrayView1d< real64 const > const elemVolume =
-    subRegion.getReference< array1d< real64 > >( CellBlock::viewKeyStruct::elementVolumeString );
-  arrayView1d< R1Tensor const > const elemPerm =
-    subRegion.getReference< array1d< R1Tensor > >( SinglePhaseBase::viewKeyStruct::permeabilityString );
-
   // get the cell-centered depth
   arrayView1d< real64 const > const elemGravCoef =
     subRegion.getReference< array1d< real64 > >( SinglePhaseBase::viewKeyStruct::gravityCoefString );
@@ -464,25 +492,7 @@ FluxKernel::Launch( localIndex er,
   using KERNEL_POLICY = parallelDevicePolicy< 32 >;
   forAll< KERNEL_POLICY >( subRegion.size(), [=] GEOSX_DEVICE ( localIndex const ei )
   {
-    // transmissibility matrix
-    stackArray2d< real64, NF *NF > transMatrix( NF, NF );
-
-    real64 const perm[ 3 ] = { elemPerm[ei][0], elemPerm[ei][1], elemPerm[ei][2] };
-
-    // recompute the local transmissibility matrix at each iteration
-    // we can decide later to precompute transMatrix if needed
-    HybridFVMInnerProduct::QTPFACellInnerProductKernel::Compute< NF >( nodePosition,
-                                                                       transMultiplier,
-                                                                       faceToNodes,
-                                                                       elemToFaces[ei],
-                                                                       elemCenter[ei],
-                                                                       elemVolume[ei],
-                                                                       perm,
-                                                                       2,
-                                                                       lengthTolerance,
-                                                                       transMatrix );
-
-    // perform flux assembly in this element
+    // perform flux assembly in this element, using the transmissibility matrix precomputed by the solver
     SinglePhaseHybridFVMKernels::AssemblerKernel::Compute< NF >( er, esr, ei,
                                                                  regionFilter,
                                                                  elemRegionList,
@@ -505,7 +515,7 @@ FluxKernel::Launch( localIndex er,
                                                                  elemGhostRank[ei],
                                                                  rankOffset,
                                                                  dt,
-                                                                 transMatrix,
+                                                                 transMatrix[ei],
                                                                  localMatrix,
                                                                  localRhs );
 
@@ -563,6 +573,21 @@ INST_AssembleKernelHelper( 6 );
 
 #undef INST_AssembleKernelHelper
 
+#define INST_TransMatrixKernel( NF ) \
+  template \
+  void TransMatrixKernel::Launch< NF >( CellElementSubRegion const & subRegion, \
+                                        arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & nodePosition, \
+                                        arrayView1d< real64 const > const & transMultiplier, \
+                                        ArrayOfArraysView< localIndex const > const & faceToNodes, \
+                                        real64 const lengthTolerance, \
+                                        arrayView3d< real64 > const & transMatrix )
+
+INST_TransMatrixKernel( 4 );
+INST_TransMatrixKernel( 5 );
+INST_TransMatrixKernel( 6 );
+
+#undef INST_TransMatrixKernel
+
 #define INST_FluxKernel( NF ) \
   template \
   void FluxKernel::Launch< NF >( localIndex er, \
@@ -570,22 +595,19 @@ INST_AssembleKernelHelper( 6 );
                                  CellElementSubRegion const & subRegion, \
                                  constitutive::SingleFluidBase const & fluid, \
                                  SortedArrayView< localIndex const > const & regionFilter, \
-                                 arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & nodePosition, \
                                  arrayView2d< localIndex const > const & elemRegionList, \
                                  arrayView2d< localIndex const > const & elemSubRegionList, \
                                  arrayView2d< localIndex const > const & elemList, \
-                                 ArrayOfArraysView< localIndex const > const & faceToNodes, \
                                  arrayView1d< globalIndex const > const & faceDofNumber, \
                                  arrayView1d< integer const > const & faceGhostRank, \
                                  arrayView1d< real64 const > const & facePres, \
                                  arrayView1d< real64 const > const & dFacePres, \
                                  arrayView1d< real64 const > const & faceGravCoef, \
-                                 arrayView1d< real64 const > const & transMultiplier, \
                                  ElementViewConst< arrayView1d< real64 const > > const & mobility, \
                                  ElementViewConst< arrayView1d< real64 const > > const & dMobility_dp, \
                                  ElementViewConst< arrayView1d< globalIndex const > > const & elemDofNumber, \
                                  localIndex const rankOffset, \
-                                 real64 const lengthTolerance, \
+                                 arrayView3d< real64 const > const & transMatrix, \
                                  real64 const dt, \
                                  CRSMatrixView< real64, globalIndex const > const & localMatrix, \
                                  arrayView1d< real64 > const & localRhs )
@@ -260,6 +260,31 @@ struct AssemblerKernel
 
 };
 
+/******************************** TransMatrixKernel ********************************/
+
+struct TransMatrixKernel
+{
+
+  /**
+   * @brief Compute the transmissibility (inner product) matrices of the elements of a cell subregion
+   * @param[in] subRegion the cell element subregion
+   * @param[in] nodePosition position of the nodes
+   * @param[in] transMultiplier the transmissibility multiplier at the mesh faces
+   * @param[in] faceToNodes map from face to nodes
+   * @param[in] lengthTolerance tolerance used in the transmissibility calculations
+   * @param[out] transMatrix the transmissibility matrix of each element
+   */
+  template< localIndex NF >
+  static void
+  Launch( CellElementSubRegion const & subRegion,
+          arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & nodePosition,
+          arrayView1d< real64 const > const & transMultiplier,
+          ArrayOfArraysView< localIndex const > const & faceToNodes,
+          real64 const lengthTolerance,
+          arrayView3d< real64 > const & transMatrix );
+
+};
+
 /******************************** FluxKernel ********************************/
 
 struct FluxKernel
@@ -282,20 +307,18 @@ struct FluxKernel
    * @param[in] subRegion pointer to the cell element subregion
    * @param[in] fluid the (single-phase) fluid model associated with this subRegion
    * @param[in] regionFilter set containing the indices of the target regions
-   * @param[in] nodePosition position of the nodes
    * @param[in] elemRegionList face-to-elemRegions map
    * @param[in] elemSubRegionList face-to-elemSubRegions map
    * @param[in] elemList face-to-elemIds map
-   * @param[in] faceToNodes map from face to nodes
    * @param[in] faceDofNumber the dof numbers of the face pressures
    * @param[in] facePres the pressure at the mesh faces at the beginning of the time step
    * @param[in] dFacePres the accumulated pressure updates at the mesh face
    * @param[in] faceGravCoef the depth at the mesh faces
-   * @param[in] transMultiplier the transmissibility multiplier at the mesh faces
    * @param[in] mobility the mobilities in the domain (non-local)
    * @param[in] dMobility_dp the derivatives of the mobilities in the domain wrt cell-centered pressure (non-local)
    * @param[in] elemDofNumber the dof numbers of the cells in the domain (non-local)
    * @param[in] rankOffset the offset of this rank
+   * @param[in] transMatrix the precomputed transmissibility matrix of each element
    * @param[in] dt time step size
    * @param[inout] localMatrix the local Jacobian matrix
    * @param[inout] localRhs the local right-hand side vector
@@ -307,22 +330,19 @@ struct FluxKernel
           CellElementSubRegion const & subRegion,
           constitutive::SingleFluidBase const & fluid,
           SortedArrayView< localIndex const > const & regionFilter,
-          arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & nodePosition,
           arrayView2d< localIndex const > const & elemRegionList,
           arrayView2d< localIndex const > const & elemSubRegionList,
           arrayView2d< localIndex const > const & elemList,
-          ArrayOfArraysView< localIndex const > const & faceToNodes,
           arrayView1d< globalIndex const > const & faceDofNumber,
           arrayView1d< integer const > const & faceGhostRank,
           arrayView1d< real64 const > const & facePres,
           arrayView1d< real64 const > const & dFacePres,
           arrayView1d< real64 const > const & faceGravCoef,
-          arrayView1d< real64 const > const & transMultiplier,
           ElementViewConst< arrayView1d< real64 const > > const & mobility,
           ElementViewConst< arrayView1d< real64 const > > const & dMobility_dp,
           ElementViewConst< arrayView1d< globalIndex const > > const & elemDofNumber,
           localIndex const rankOffset,
-          real64 const lengthTolerance,
+          arrayView3d< real64 const > const & transMatrix,
           real64 const dt,
           CRSMatrixView< real64, globalIndex const > const & localMatrix,
           arrayView1d< real64 > const & localRhs );
@@ -0,0 +1,284 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include "managers/initialization.hpp"
+#include "managers/ProblemManager.hpp"
+#include "physicsSolvers/PhysicsSolverManager.hpp"
+#include "physicsSolvers/fluidFlow/SinglePhaseFVM.hpp"
+#include "physicsSolvers/fluidFlow/unitTests/testCompFlowUtils.hpp"
+
+using namespace geosx;
+using namespace geosx::dataRepository;
+using namespace geosx::testing;
+
+char const * xmlInput =
+  "<Problem>\n"
+  "  <Solvers gravityVector=\"0.0, 0.0, -9.81\">\n"
+  "    <SinglePhaseFVM name=\"singleflow\"\n"
+  "                    logLevel=\"0\"\n"
+  "                    discretization=\"tpfaFlow\"\n"
+  "                    targetRegions=\"{Region1, Region2}\"\n"
+  "                    fluidNames=\"{water}\"\n"
+  "                    solidNames=\"{rock}\">\n"
+  "      <NonlinearSolverParameters newtonTol=\"1.0e-6\"\n"
+  "                                 newtonMaxIter=\"2\"/>\n"
+  "      <LinearSolverParameters solverType=\"gmres\"\n"
+  "                              krylovTol=\"1.0e-10\"/>\n"
+  "    </SinglePhaseFVM>\n"
+  "  </Solvers>\n"
+  "  <Mesh>\n"
+  "    <InternalMesh name=\"mesh1\"\n"
+  "                  elementTypes=\"{C3D8}\" \n"
+  "                  xCoords=\"{0, 2, 4}\"\n"
+  "                  yCoords=\"{0, 2}\"\n"
+  "                  zCoords=\"{0, 2}\"\n"
+  "                  nx=\"{2, 2}\"\n"
+  "                  ny=\"{2}\"\n"
+  "                  nz=\"{2}\"\n"
+  "                  cellBlockNames=\"{cb1, cb2}\"/>\n"
+  "  </Mesh>\n"
+  "  <NumericalMethods>\n"
+  "    <FiniteVolume>\n"
+  "      <TwoPointFluxApproximation name=\"tpfaFlow\"\n"
+  "                                 fieldName=\"pressure\"\n"
+  "                                 coefficientName=\"permeability\"/>\n"
+  "    </FiniteVolume>\n"
+  "  </NumericalMethods>\n"
+  "  <ElementRegions>\n"
+  "    <CellElementRegion name=\"Region1\" cellBlocks=\"{cb1}\" materialList=\"{water, rock}\"/>\n"
+  "    <CellElementRegion name=\"Region2\" cellBlocks=\"{cb2}\" materialList=\"{water, rock}\"/>\n"
+  "  </ElementRegions>\n"
+  "  <Constitutive>\n"
+  "    <CompressibleSinglePhaseFluid name=\"water\"\n"
+  "                                  defaultDensity=\"1000\"\n"
+  "                                  defaultViscosity=\"0.001\"\n"
+  "                                  referencePressure=\"0.0\"\n"
+  "                                  referenceDensity=\"1000\"\n"
+  "                                  compressibility=\"5e-10\"\n"
+  "                                  referenceViscosity=\"0.001\"\n"
+  "                                  viscosibility=\"1e-9\"/>\n"
+  "    <PoreVolumeCompressibleSolid name=\"rock\"\n"
+  "                                 referencePressure=\"0.0\"\n"
+  "                                 compressibility=\"1e-9\"/>\n"
+  "  </Constitutive>\n"
+  "  <FieldSpecifications>\n"
+  "    <FieldSpecification name=\"permx\"\n"
+  "               component=\"0\"\n"
+  "               initialCondition=\"1\"\n"
+  "               setNames=\"{all}\"\n"
+  "               objectPath=\"ElementRegions\"\n"
+  "               fieldName=\"permeability\"\n"
+  "               scale=\"2.0e-16\"/>\n"
+  "    <FieldSpecification name=\"permy\"\n"
+  "               component=\"1\"\n"
+  "               initialCondition=\"1\"\n"
+  "               setNames=\"{all}\"\n"
+  "               objectPath=\"ElementRegions\"\n"
+  "               fieldName=\"permeability\"\n"
+  "               scale=\"2.0e-16\"/>\n"
+  "    <FieldSpecification name=\"permz\"\n"
+  "               component=\"2\"\n"
+  "               initialCondition=\"1\"\n"
+  "               setNames=\"{all}\"\n"
+  "               objectPath=\"ElementRegions\"\n"
+  "               fieldName=\"permeability\"\n"
+  "               scale=\"2.0e-16\"/>\n"
+  "    <FieldSpecification name=\"referencePorosity\"\n"
+  "               initialCondition=\"1\"\n"
+  "               setNames=\"{all}\"\n"
+  "               objectPath=\"ElementRegions\"\n"
+  "               fieldName=\"referencePorosity\"\n"
+  "               scale=\"0.05\"/>\n"
+  "    <FieldSpecification name=\"initialPressure\"\n"
+  "               initialCondition=\"1\"\n"
+  "               setNames=\"{all}\"\n"
+  "               objectPath=\"ElementRegions\"\n"
+  "               fieldName=\"pressure\"\n"
+  "               scale=\"5e6\"/>\n"
+  "  </FieldSpecifications>\n"
+  "</Problem>";
+
+/**
+ * @brief Compare the flux terms assembled through the flat element numbering (LaunchFlat)
+ *        with the ones assembled through the region/subregion/element accessors (Launch).
+ */
+class SinglePhaseFVMTest : public ::testing::Test
+{
+public:
+
+  SinglePhaseFVMTest()
+    : problemManager( std::make_unique< ProblemManager >( "Problem", nullptr ) )
+  {}
+
+protected:
+
+  using Solver = SinglePhaseFVM< SinglePhaseBase >;
+
+  void SetUp() override
+  {
+    setupProblemFromXML( *problemManager, xmlInput );
+    solver = problemManager->GetPhysicsSolverManager().GetGroup< Solver >( "singleflow" );
+
+    DomainPartition & domain = *problemManager->getDomainPartition();
+
+    solver->SetupSystem( domain,
+                         solver->getDofManager(),
+                         solver->getLocalMatrix(),
+                         solver->getLocalRhs(),
+                         solver->getLocalSolution() );
+
+    solver->ImplicitStepSetup( time, dt, domain );
+  }
+
+  /**
+   * @brief Set a pressure update that varies from cell to cell, as in a Newton iteration.
+   * @param scale magnitude of the pressure update
+   */
+  void setPressureUpdate( real64 const scale )
+  {
+    DomainPartition & domain = *problemManager->getDomainPartition();
+    MeshLevel & mesh = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
+
+    solver->forTargetSubRegions( mesh, [&]( localIndex const targetIndex,
+                                            ElementSubRegionBase & subRegion )
+    {
+      arrayView1d< real64 > const & dPres =
+        subRegion.getReference< array1d< real64 > >( Solver::viewKeyStruct::deltaPressureString );
+      dPres.move( LvArray::MemorySpace::CPU, true );
+
+      for( localIndex ei = 0; ei < subRegion.size(); ++ei )
+      {
+        dPres[ei] = scale * ( 1 + ( ei + targetIndex ) % 3 );
+      }
+
+      solver->UpdateState( subRegion, targetIndex );
+    } );
+  }
+
+  /**
+   * @brief Assemble the flux terms with or without the flat element numbering.
+   * @param useFlatCellIndex whether the flat path is used
+   * @param jacobian the assembled Jacobian, with the sparsity pattern of the solver matrix
+   * @param residual the assembled residual
+   */
+  void assembleFluxTerms( integer const useFlatCellIndex,
+                          CRSMatrix< real64, globalIndex > & jacobian,
+                          array1d< real64 > & residual )
+  {
+    DomainPartition & domain = *problemManager->getDomainPartition();
+    solver->getReference< integer >( Solver::viewKeyStruct::useFlatCellIndexString ) = useFlatCellIndex;
+
+    jacobian.setValues< parallelDevicePolicy<> >( 0.0 );
+    residual.setValues< parallelDevicePolicy<> >( 0.0 );
+
+    solver->AssembleFluxTerms( time_n,
+                               dt,
+                               domain,
+                               solver->getDofManager(),
+                               jacobian.toViewConstSizes(),
+                               residual.toView() );
+
+    jacobian.move( LvArray::MemorySpace::CPU, false );
+    residual.move( LvArray::MemorySpace::CPU, false );
+  }
+
+  /// Check that both paths give the same residual and Jacobian
+  void compareFluxTerms()
+  {
+    CRSMatrix< real64, globalIndex > jacobian( solver->getLocalMatrix() );
+    array1d< real64 > residual( solver->getLocalRhs() );
+    assembleFluxTerms( 0, jacobian, residual );
+
+    CRSMatrix< real64, globalIndex > jacobianFlat( solver->getLocalMatrix() );
+    array1d< real64 > residualFlat( solver->getLocalRhs() );
+    assembleFluxTerms( 1, jacobianFlat, residualFlat );
+
+    // both paths add the same contributions, possibly in a different order
+    real64 const relTol = 1e-12;
+
+    ASSERT_EQ( residualFlat.size(), residual.size() );
+    real64 residualNorm = 0.0;
+    for( localIndex row = 0; row < residual.size(); ++row )
+    {
+      residualNorm = std::max( residualNorm, std::fabs( residual[row] ) );
+    }
+    EXPECT_GT( residualNorm, 0.0 );
+    for( localIndex row = 0; row < residual.size(); ++row )
+    {
+      EXPECT_NEAR( residualFlat[row], residual[row], relTol * residualNorm );
+    }
+
+    ASSERT_EQ( jacobianFlat.numRows(), jacobian.numRows() );
+    for( localIndex row = 0; row < jacobian.numRows(); ++row )
+    {
+      ASSERT_EQ( jacobianFlat.numNonZeros( row ), jacobian.numNonZeros( row ) );
+      arraySlice1d< real64 const > const values = jacobian.getEntries( row );
+      arraySlice1d< real64 const > const valuesFlat = jacobianFlat.getEntries( row );
+      real64 rowNorm = 0.0;
+      for( localIndex k = 0; k < jacobian.numNonZeros( row ); ++k )
+      {
+        rowNorm = std::max( rowNorm, std::fabs( values[k] ) );
+      }
+      for( localIndex k = 0; k < jacobian.numNonZeros( row ); ++k )
+      {
+        EXPECT_EQ( jacobianFlat.getColumns( row )[k], jacobian.getColumns( row )[k] );
+        EXPECT_NEAR( valuesFlat[k], values[k], relTol * rowNorm );
+      }
+    }
+  }
+
+  static real64 constexpr time = 0.0;
+  static real64 constexpr dt = 1e2;
+
+  real64 time_n = time;
+
+  std::unique_ptr< ProblemManager > problemManager;
+  Solver * solver;
+};
+
+real64 constexpr SinglePhaseFVMTest::time;
+real64 constexpr SinglePhaseFVMTest::dt;
+
+TEST_F( SinglePhaseFVMTest, flatMatchesNestedAccessors )
+{
+  setPressureUpdate( 1e5 );
+  compareFluxTerms();
+}
+
+TEST_F( SinglePhaseFVMTest, flatMatchesNestedAccessorsAcrossIterations )
+{
+  // the cached flat copies of the DoF numbers and pressure must stay valid between Newton iterations
+  setPressureUpdate( 1e5 );
+  compareFluxTerms();
+  setPressureUpdate( -3e4 );
+  compareFluxTerms();
+
+  // and the pressure must be refreshed once the time step completes
+  DomainPartition & domain = *problemManager->getDomainPartition();
+  solver->ImplicitStepComplete( time_n, dt, domain );
+  time_n += dt;
+  solver->ImplicitStepSetup( time_n, dt, domain );
+
+  setPressureUpdate( 2e4 );
+  compareFluxTerms();
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
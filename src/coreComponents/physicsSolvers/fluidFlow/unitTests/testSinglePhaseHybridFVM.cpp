@@ -0,0 +1,240 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include "managers/initialization.hpp"
+#include "managers/ProblemManager.hpp"
+#include "physicsSolvers/PhysicsSolverManager.hpp"
+#include "finiteVolume/FluxApproximationBase.hpp"
+#include "finiteVolume/HybridFVMInnerProduct.hpp"
+#include "physicsSolvers/fluidFlow/SinglePhaseHybridFVM.hpp"
+#include "physicsSolvers/fluidFlow/unitTests/testCompFlowUtils.hpp"
+
+using namespace geosx;
+using namespace geosx::dataRepository;
+using namespace geosx::testing;
+
+char const * xmlInput =
+  "<Problem>\n"
+  "  <Solvers gravityVector=\"0.0, 0.0, -9.81\">\n"
+  "    <SinglePhaseHybridFVM name=\"singleflow\"\n"
+  "                          logLevel=\"0\"\n"
+  "                          discretization=\"tpfaFlow\"\n"
+  "                          targetRegions=\"{Region1, Region2}\"\n"
+  "                          fluidNames=\"{water}\"\n"
+  "                          solidNames=\"{rock}\">\n"
+  "      <NonlinearSolverParameters newtonTol=\"1.0e-6\"\n"
+  "                                 newtonMaxIter=\"2\"/>\n"
+  "      <LinearSolverParameters solverType=\"gmres\"\n"
+  "                              krylovTol=\"1.0e-10\"/>\n"
+  "    </SinglePhaseHybridFVM>\n"
+  "  </Solvers>\n"
+  "  <Mesh>\n"
+  "    <InternalMesh name=\"mesh1\"\n"
+  "                  elementTypes=\"{C3D8}\" \n"
+  "                  xCoords=\"{0, 2, 5}\"\n"
+  "                  yCoords=\"{0, 2}\"\n"
+  "                  zCoords=\"{0, 2}\"\n"
+  "                  nx=\"{2, 3}\"\n"
+  "                  ny=\"{2}\"\n"
+  "                  nz=\"{2}\"\n"
+  "                  cellBlockNames=\"{cb1, cb2}\"/>\n"
+  "  </Mesh>\n"
+  "  <NumericalMethods>\n"
+  "    <FiniteVolume>\n"
+  "      <TwoPointFluxApproximation name=\"tpfaFlow\"\n"
+  "                                 fieldName=\"pressure\"\n"
+  "                                 coefficientName=\"permeability\"/>\n"
+  "    </FiniteVolume>\n"
+  "  </NumericalMethods>\n"
+  "  <ElementRegions>\n"
+  "    <CellElementRegion name=\"Region1\" cellBlocks=\"{cb1}\" materialList=\"{water, rock}\"/>\n"
+  "    <CellElementRegion name=\"Region2\" cellBlocks=\"{cb2}\" materialList=\"{water, rock}\"/>\n"
+  "  </ElementRegions>\n"
+  "  <Constitutive>\n"
+  "    <CompressibleSinglePhaseFluid name=\"water\"\n"
+  "                                  defaultDensity=\"1000\"\n"
+  "                                  defaultViscosity=\"0.001\"\n"
+  "                                  referencePressure=\"0.0\"\n"
+  "                                  referenceDensity=\"1000\"\n"
+  "                                  compressibility=\"5e-10\"\n"
+  "                                  referenceViscosity=\"0.001\"\n"
+  "                                  viscosibility=\"1e-9\"/>\n"
+  "    <PoreVolumeCompressibleSolid name=\"rock\"\n"
+  "                                 referencePressure=\"0.0\"\n"
+  "                                 compressibility=\"1e-9\"/>\n"
+  "  </Constitutive>\n"
+  "  <FieldSpecifications>\n"
+  "    <FieldSpecification name=\"permx\"\n"
+  "               component=\"0\"\n"
+  "               initialCondition=\"1\"\n"
+  "               setNames=\"{all}\"\n"
+  "               objectPath=\"ElementRegions\"\n"
+  "               fieldName=\"permeability\"\n"
+  "               scale=\"2.0e-16\"/>\n"
+  "    <FieldSpecification name=\"permy\"\n"
+  "               component=\"1\"\n"
+  "               initialCondition=\"1\"\n"
+  "               setNames=\"{all}\"\n"
+  "               objectPath=\"ElementRegions\"\n"
+  "               fieldName=\"permeability\"\n"
+  "               scale=\"1.0e-16\"/>\n"
+  "    <FieldSpecification name=\"permz\"\n"
+  "               component=\"2\"\n"
+  "               initialCondition=\"1\"\n"
+  "               setNames=\"{all}\"\n"
+  "               objectPath=\"ElementRegions\"\n"
+  "               fieldName=\"permeability\"\n"
+  "               scale=\"5.0e-17\"/>\n"
+  "    <FieldSpecification name=\"referencePorosity\"\n"
+  "               initialCondition=\"1\"\n"
+  "               setNames=\"{all}\"\n"
+  "               objectPath=\"ElementRegions\"\n"
+  "               fieldName=\"referencePorosity\"\n"
+  "               scale=\"0.05\"/>\n"
+  "    <FieldSpecification name=\"initialPressure\"\n"
+  "               initialCondition=\"1\"\n"
+  "               setNames=\"{all}\"\n"
+  "               objectPath=\"ElementRegions\"\n"
+  "               fieldName=\"pressure\"\n"
+  "               scale=\"5e6\"/>\n"
+  "  </FieldSpecifications>\n"
+  "</Problem>";
+
+/**
+ * @brief Compare the transmissibility matrices precomputed by SinglePhaseHybridFVM with the ones
+ *        computed on the fly from the current geometry, as the flux kernel did before the precomputation.
+ */
+class SinglePhaseHybridFVMTest : public ::testing::Test
+{
+public:
+
+  SinglePhaseHybridFVMTest()
+    : problemManager( std::make_unique< ProblemManager >( "Problem", nullptr ) )
+  {}
+
+protected:
+
+  void SetUp() override
+  {
+    setupProblemFromXML( *problemManager, xmlInput );
+    solver = problemManager->GetPhysicsSolverManager().GetGroup< SinglePhaseHybridFVM >( "singleflow" );
+
+    DomainPartition & domain = *problemManager->getDomainPartition();
+
+    solver->SetupSystem( domain,
+                         solver->getDofManager(),
+                         solver->getLocalMatrix(),
+                         solver->getLocalRhs(),
+                         solver->getLocalSolution() );
+  }
+
+  /// Check the stored transmissibility matrix of every element against an on-the-fly computation
+  void checkTransMatrices()
+  {
+    DomainPartition & domain = *problemManager->getDomainPartition();
+    MeshLevel & mesh = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
+    NodeManager const & nodeManager = *mesh.getNodeManager();
+    FaceManager const & faceManager = *mesh.getFaceManager();
+
+    arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & nodePosition = nodeManager.referencePosition();
+    arrayView1d< real64 const > const & transMultiplier =
+      faceManager.getReference< array1d< real64 > >( string( "permeability" ) +
+                                                     FluxApproximationBase::viewKeyStruct::transMultiplierString );
+    ArrayOfArraysView< localIndex const > const & faceToNodes = faceManager.nodeList().toViewConst();
+
+    // same relative tolerance as the solver
+    real64 const lengthTolerance = domain.getMeshBody( 0 )->getGlobalLengthScale() * 1e-8;
+
+    solver->forTargetSubRegions< CellElementSubRegion >( mesh, [&]( localIndex const,
+                                                                    CellElementSubRegion & subRegion )
+    {
+      arrayView3d< real64 const > const & transMatrix =
+        subRegion.getReference< array3d< real64 > >( SinglePhaseHybridFVM::viewKeyStruct::transMatrixString );
+      transMatrix.move( LvArray::MemorySpace::CPU, false );
+
+      arrayView2d< localIndex const > const & elemToFaces = subRegion.faceList().toViewConst();
+      arrayView2d< real64 const > const & elemCenter = subRegion.getElementCenter();
+      arrayView1d< real64 const > const & elemVolume = subRegion.getElementVolume();
+      arrayView1d< R1Tensor const > const & elemPerm =
+        subRegion.getReference< array1d< R1Tensor > >( SinglePhaseBase::viewKeyStruct::permeabilityString );
+
+      ASSERT_EQ( transMatrix.size( 0 ), subRegion.size() );
+      ASSERT_EQ( transMatrix.size( 1 ), NF );
+      ASSERT_EQ( transMatrix.size( 2 ), NF );
+
+      array3d< real64 > expected( 1, NF, NF );
+      for( localIndex ei = 0; ei < subRegion.size(); ++ei )
+      {
+        real64 const perm[ 3 ] = { elemPerm[ei][0], elemPerm[ei][1], elemPerm[ei][2] };
+        HybridFVMInnerProduct::QTPFACellInnerProductKernel::Compute< NF >( nodePosition,
+                                                                           transMultiplier,
+                                                                           faceToNodes,
+                                                                           elemToFaces[ei],
+                                                                           elemCenter[ei],
+                                                                           elemVolume[ei],
+                                                                           perm,
+                                                                           2,
+                                                                           lengthTolerance,
+                                                                           expected[0] );
+
+        for( localIndex i = 0; i < NF; ++i )
+        {
+          for( localIndex j = 0; j < NF; ++j )
+          {
+            EXPECT_DOUBLE_EQ( transMatrix[ei][i][j], expected[0][i][j] );
+          }
+        }
+      }
+    } );
+  }
+
+  static localIndex constexpr NF = 6;
+  static real64 constexpr time = 0.0;
+  static real64 constexpr dt = 1e2;
+
+  std::unique_ptr< ProblemManager > problemManager;
+  SinglePhaseHybridFVM * solver;
+};
+
+localIndex constexpr SinglePhaseHybridFVMTest::NF;
+real64 constexpr SinglePhaseHybridFVMTest::time;
+real64 constexpr SinglePhaseHybridFVMTest::dt;
+
+TEST_F( SinglePhaseHybridFVMTest, precomputedTransMatricesMatchGeometry )
+{
+  checkTransMatrices();
+}
+
+TEST_F( SinglePhaseHybridFVMTest, transMatricesUnchangedAcrossSteps )
+{
+  // the matrices are computed once, and still match the geometry after several step setups
+  DomainPartition & domain = *problemManager->getDomainPartition();
+  real64 time_n = time;
+  for( int step = 0; step < 2; ++step )
+  {
+    solver->ImplicitStepSetup( time_n, dt, domain );
+    solver->ImplicitStepComplete( time_n, dt, domain );
+    time_n += dt;
+  }
+  checkTransMatrices();
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
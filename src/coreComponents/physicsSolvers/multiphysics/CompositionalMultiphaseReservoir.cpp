@@ -40,6 +40,7 @@ CompositionalMultiphaseReservoir::CompositionalMultiphaseReservoir( const std::s
   ReservoirSolverBase( name, parent )
 {
   m_linearSolverParameters.get().mgr.strategy = "CompositionalMultiphaseReservoir";
+  m_linearSolverParameters.get().cpr.fieldName = CompositionalMultiphaseFlow::viewKeyStruct::dofFieldString;
 }
 
 CompositionalMultiphaseReservoir::~CompositionalMultiphaseReservoir()
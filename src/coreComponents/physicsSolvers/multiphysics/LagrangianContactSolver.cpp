@@ -540,6 +540,7 @@ real64 LagrangianContactSolver::NonlinearImplicitStep( real64 const & time_n,
       globalIndex numStick, numSlip, numOpen;
       ComputeFractureStateStatistics( domain, numStick, numSlip, numOpen, true );
     }
+    m_precondReuse.startTimeStep();
 
     integer & activeSetIter = m_activeSetIter;
     for( activeSetIter = 0; activeSetIter < m_activeSetMaxIter; ++activeSetIter )
@@ -629,9 +630,7 @@ real64 LagrangianContactSolver::NonlinearImplicitStep( real64 const & time_n,
         }
 
         // Compose parallel LA matrix/rhs out of local LA matrix/rhs
-        m_matrix.create( m_localMatrix.toViewConst(), MPI_COMM_GEOSX );
-        m_rhs.create( m_localRhs.toViewConst(), MPI_COMM_GEOSX );
-        m_solution.createWithLocalSize( m_matrix.numLocalCols(), MPI_COMM_GEOSX );
+        ComposeParallelSystem();
 
         // Output the linear system matrix/rhs for debugging purposes
         DebugOutputSystem( time_n, cycleNumber, newtonIter, m_matrix, m_rhs );
@@ -21,6 +21,7 @@
 #include "SolidMechanicsSmallStrainQuasiStaticKernel.hpp"
 #include "SolidMechanicsSmallStrainImplicitNewmarkKernel.hpp"
 #include "SolidMechanicsSmallStrainExplicitNewmarkKernel.hpp"
+#include "SolidMechanicsSmallStrainMatrixFreeKernels.hpp"
 #include "SolidMechanicsFiniteStrainExplicitNewmarkKernel.hpp"
 
 #include "codingUtilities/Utilities.hpp"
@@ -29,6 +30,7 @@
 #include "constitutive/contact/ContactRelationBase.hpp"
 #include "finiteElement/FiniteElementDiscretizationManager.hpp"
 #include "finiteElement/Kinematics.h"
+#include "linearAlgebra/solvers/KrylovSolver.hpp"
 #include "managers/DomainPartition.hpp"
 #include "managers/FieldSpecification/FieldSpecificationManager.hpp"
 #include "managers/NumericalMethodsManager.hpp"
@@ -63,7 +65,12 @@ SolidMechanicsLagrangianFEM::SolidMechanicsLagrangianFEM( const std::string & na
   m_nonSendOrReceiveNodes(),
   m_targetNodes(),
   m_iComm(),
-  m_effectiveStress( 0 )
+  m_effectiveStress( 0 ),
+  m_assemblyMethod( AssemblyMethod::BinarySearch ),
+  m_assemblyMapSparsityVersion( -1 ),
+  m_assemblyMapTopologyVersion( -1 ),
+  m_matrixFreeOperator(),
+  m_elementBatchSize( 1 )
 {
   m_sendOrReceiveNodes.setName( "SolidMechanicsLagrangianFEM::m_sendOrReceiveNodes" );
   m_nonSendOrReceiveNodes.setName( "SolidMechanicsLagrangianFEM::m_nonSendOrReceiveNodes" );
@@ -136,6 +143,26 @@ SolidMechanicsLagrangianFEM::SolidMechanicsLagrangianFEM( const std::string & na
     setInputFlag( InputFlags::OPTIONAL )->
     setDescription( "Apply fluid pressure to produce effective stress when integrating stress." );
 
+  registerWrapper( viewKeyStruct::assemblyMethodString, &m_assemblyMethod )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setApplyDefaultValue( m_assemblyMethod )->
+    setDescription( "Method used to add the element contributions to the matrix in implicit simulations. "
+                    "The assembly maps store the positions of the element contributions in the matrix rows, "
+                    "which are computed once per sparsity pattern. The colored variant, intended for host execution, "
+                    "processes the elements one color at a time and adds their contributions without atomics. "
+                    "The matrix-free method, available for quasi-static problems without contact, only assembles the "
+                    "diagonal of the matrix, which is used by the preconditioner, and applies the stiffness operator "
+                    "element by element in the iterative linear solver. Options are:\n* " +
+                    EnumStrings< AssemblyMethod >::concat( "\n* " ) );
+
+  registerWrapper( viewKeyStruct::elementBatchSizeString, &m_elementBatchSize )->
+    setApplyDefaultValue( 1 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Number of elements processed together by the host finite element kernels, "
+                    "so that the compiler can vectorize across elements. Valid Inputs are 1, 4 and 8. "
+                    "Ignored in builds that run the kernels on the device. "
+                    "Must be 1 with the ColoredAssemblyMap assembly method, whose kernels process one element at a time." );
+
 }
 
 void SolidMechanicsLagrangianFEM::PostProcessInput()
@@ -148,6 +175,27 @@ void SolidMechanicsLagrangianFEM::PostProcessInput()
   linParams.isSymmetric = true;
   linParams.dofsPerNode = 3;
   linParams.amg.separateComponents = true;
+
+  GEOSX_ERROR_IF( m_elementBatchSize != 1 && m_elementBatchSize != 4 && m_elementBatchSize != 8,
+                  getName() << ": invalid " << viewKeyStruct::elementBatchSizeString << " " << m_elementBatchSize <<
+                  ", valid inputs are 1, 4 and 8" );
+#if defined(GEOSX_USE_CUDA)
+  GEOSX_WARNING_IF( m_elementBatchSize != 1,
+                    getName() << ": " << viewKeyStruct::elementBatchSizeString << " is ignored when the kernels run on the device" );
+#endif
+  GEOSX_ERROR_IF( m_elementBatchSize != 1 && m_assemblyMethod == AssemblyMethod::ColoredAssemblyMap,
+                  getName() << ": " << viewKeyStruct::elementBatchSizeString << " " << m_elementBatchSize <<
+                  " is not supported with the ColoredAssemblyMap assembly method, which processes one element at a time" );
+
+  if( m_assemblyMethod == AssemblyMethod::MatrixFree )
+  {
+    GEOSX_ERROR_IF( m_timeIntegrationOption != TimeIntegrationOption::QuasiStatic,
+                    getName() << ": the matrix-free assembly method requires the QuasiStatic time integration option" );
+    GEOSX_ERROR_IF( m_contactRelationName != viewKeyStruct::noContactRelationNameString,
+                    getName() << ": the matrix-free assembly method does not support contact" );
+    GEOSX_ERROR_IF( linParams.solverType == LinearSolverParameters::SolverType::direct,
+                    getName() << ": the matrix-free assembly method requires an iterative linear solver" );
+  }
 }
 
 SolidMechanicsLagrangianFEM::~SolidMechanicsLagrangianFEM()
@@ -270,19 +318,25 @@ real64 SolidMechanicsLagrangianFEM::explicitKernelDispatch( PARAMS && ... params
   real64 rval = 0;
   if( m_strainTheory==0 )
   {
-    rval = finiteElement::
-             regionBasedKernelApplication< parallelDevicePolicy< 32 >,
-                                           constitutive::SolidBase,
-                                           CellElementSubRegion,
-                                           SolidMechanicsLagrangianFEMKernels::ExplicitSmallStrain >( std::forward< PARAMS >( params )... );
+    rval = kernelPolicyDispatch( [&]( auto policy )
+    {
+      return finiteElement::
+               regionBasedKernelApplication< decltype( policy ),
+                                             constitutive::SolidBase,
+                                             CellElementSubRegion,
+                                             SolidMechanicsLagrangianFEMKernels::ExplicitSmallStrain >( std::forward< PARAMS >( params )... );
+    } );
   }
   else if( m_strainTheory==1 )
   {
-    rval = finiteElement::
-             regionBasedKernelApplication< parallelDevicePolicy< 32 >,
-                                           constitutive::SolidBase,
-                                           CellElementSubRegion,
-                                           SolidMechanicsLagrangianFEMKernels::ExplicitFiniteStrain >( std::forward< PARAMS >( params )... );
+    rval = kernelPolicyDispatch( [&]( auto policy )
+    {
+      return finiteElement::
+               regionBasedKernelApplication< decltype( policy ),
+                                             constitutive::SolidBase,
+                                             CellElementSubRegion,
+                                             SolidMechanicsLagrangianFEMKernels::ExplicitFiniteStrain >( std::forward< PARAMS >( params )... );
+    } );
   }
   else
   {
@@ -672,6 +726,7 @@ void SolidMechanicsLagrangianFEM::ApplyDisplacementBC_implicit( real64 const tim
 {
   GEOSX_MARK_FUNCTION;
   string const dofKey = dofManager.getKey( keys::TotalDisplacement );
+  bool const matrixFree = isMatrixFree( localMatrix );
 
   FieldSpecificationManager const & fsManager = FieldSpecificationManager::get();
 
@@ -694,6 +749,13 @@ void SolidMechanicsLagrangianFEM::ApplyDisplacementBC_implicit( real64 const tim
                                                                       dofManager.rankOffset(),
                                                                       localMatrix,
                                                                       localRhs );
+
+    // The matrix-free operator must reproduce the rows modified above
+    if( matrixFree )
+    {
+      arrayView1d< globalIndex const > const & dofNumber = targetGroup->getReference< globalIndex_array >( dofKey );
+      m_matrixFreeOperator->addConstrainedDofs( targetSet, dofNumber, bc->GetComponent() );
+    }
   } );
 }
 
@@ -979,6 +1041,28 @@ void SolidMechanicsLagrangianFEM::SetupSystem( DomainPartition & domain,
   GEOSX_MARK_FUNCTION;
   SolverBase::SetupSystem( domain, dofManager, localMatrix, localRhs, localSolution, setSparisty );
 
+  m_matrixFreeOperator.reset();
+
+  // The matrix-free system only stores the diagonal, and only applies to the system owned by this solver
+  if( m_assemblyMethod == AssemblyMethod::MatrixFree && &localMatrix == &m_localMatrix )
+  {
+    SparsityPattern< globalIndex > sparsityPattern( dofManager.numLocalDofs(),
+                                                    dofManager.numGlobalDofs(),
+                                                    1 );
+    globalIndex const rankOffset = dofManager.rankOffset();
+    for( localIndex localRow = 0; localRow < dofManager.numLocalDofs(); ++localRow )
+    {
+      sparsityPattern.insertNonZero( localRow, rankOffset + localRow );
+    }
+    localMatrix.assimilate< parallelDevicePolicy<> >( std::move( sparsityPattern ) );
+
+    m_matrixFreeOperator = std::make_unique< SolidMechanicsMatrixFreeOperator >( *this,
+                                                                                 domain,
+                                                                                 dofManager,
+                                                                                 localMatrix.toViewConst() );
+    return;
+  }
+
   MeshLevel & mesh = *(domain.getMeshBodies()->GetGroup< MeshBody >( 0 )->getMeshLevel( 0 ));
   NodeManager const & nodeManager = *(mesh.getNodeManager());
   arrayView1d< globalIndex const > const &
@@ -1019,6 +1103,26 @@ void SolidMechanicsLagrangianFEM::SetupSystem( DomainPartition & domain,
   sparsityPattern.compress();
   localMatrix.assimilate< parallelDevicePolicy<> >( std::move( sparsityPattern ) );
 
+  // The assembly maps only depend on the sparsity pattern, so they are kept as long as
+  // neither the DoF numbering nor the mesh topology change between calls.
+  if( ( m_assemblyMethod == AssemblyMethod::AssemblyMap || m_assemblyMethod == AssemblyMethod::ColoredAssemblyMap ) &&
+      &dofManager == &m_dofManager &&
+      ( dofManager.sparsityVersion() != m_assemblyMapSparsityVersion ||
+        mesh.topologyVersion() != m_assemblyMapTopologyVersion ) )
+  {
+    finiteElement::
+      fillAssemblyMaps< CellElementSubRegion,
+                        SolidMechanicsLagrangianFEMKernels::QuasiStatic >( mesh,
+                                                                           targetRegionNames(),
+                                                                           this->getDiscretizationName(),
+                                                                           dofNumber,
+                                                                           dofManager.rankOffset(),
+                                                                           localMatrix.toViewConst(),
+                                                                           this->getName() + viewKeyStruct::assemblyMapString,
+                                                                           m_assemblyMethod == AssemblyMethod::ColoredAssemblyMap );
+    m_assemblyMapSparsityVersion = dofManager.sparsityVersion();
+    m_assemblyMapTopologyVersion = mesh.topologyVersion();
+  }
 
 }
 
@@ -1046,7 +1150,16 @@ void SolidMechanicsLagrangianFEM::AssembleSystem( real64 const GEOSX_UNUSED_PARA
   }
   else
   {
-    if( m_timeIntegrationOption == TimeIntegrationOption::QuasiStatic )
+    if( m_timeIntegrationOption == TimeIntegrationOption::QuasiStatic && isMatrixFree( localMatrix ) )
+    {
+      GEOSX_UNUSED_VAR( dt );
+      AssemblyLaunch< constitutive::SolidBase,
+                      SolidMechanicsLagrangianFEMKernels::QuasiStaticDiagonal >( domain,
+                                                                                 dofManager,
+                                                                                 localMatrix,
+                                                                                 localRhs );
+    }
+    else if( m_timeIntegrationOption == TimeIntegrationOption::QuasiStatic )
     {
       GEOSX_UNUSED_VAR( dt );
       AssemblyLaunch< constitutive::SolidBase,
@@ -1248,7 +1361,33 @@ void SolidMechanicsLagrangianFEM::SolveSystem( DofManager const & dofManager,
                                                ParallelVector & solution )
 {
   solution.zero();
-  SolverBase::SolveSystem( dofManager, matrix, rhs, solution );
+
+  if( m_matrixFreeOperator == nullptr || &matrix != &m_matrix )
+  {
+    SolverBase::SolveSystem( dofManager, matrix, rhs, solution );
+    return;
+  }
+
+  GEOSX_MARK_FUNCTION;
+
+  // The assembled matrix only holds the diagonal of the stiffness, which is what the preconditioner is built on
+  LinearSolverParameters const & params = m_linearSolverParameters.get();
+  std::unique_ptr< PreconditionerBase< LAInterface > > precond = LAInterface::createPreconditioner( params );
+  precond->compute( matrix );
+
+  std::unique_ptr< KrylovSolver< ParallelVector > > solver =
+    KrylovSolver< ParallelVector >::Create( params, *m_matrixFreeOperator, *precond );
+  solver->solve( rhs, solution );
+  m_linearSolverResult = solver->result();
+
+  if( params.stopIfError )
+  {
+    GEOSX_ERROR_IF( m_linearSolverResult.breakdown(), "Linear solution breakdown -> simulation STOP" );
+  }
+  else
+  {
+    GEOSX_WARNING_IF( !m_linearSolverResult.success(), "Linear solution failed" );
+  }
 }
 
 void SolidMechanicsLagrangianFEM::ResetStateToBeginningOfStep( DomainPartition & domain )
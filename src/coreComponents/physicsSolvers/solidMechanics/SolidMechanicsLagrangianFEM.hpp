@@ -26,6 +26,7 @@
 #include "physicsSolvers/SolverBase.hpp"
 
 #include "SolidMechanicsLagrangianFEMKernels.hpp"
+#include "SolidMechanicsMatrixFreeOperator.hpp"
 
 namespace geosx
 {
@@ -51,6 +52,19 @@ public:
     ExplicitDynamic   //!< ExplicitDynamic
   };
 
+  /**
+   * @enum AssemblyMethod
+   *
+   * The options for adding the element contributions to the global system
+   */
+  enum class AssemblyMethod : integer
+  {
+    BinarySearch,       //!< Binary search over the row columns, with atomics
+    AssemblyMap,        //!< Precomputed positions in the matrix rows, with atomics
+    ColoredAssemblyMap, //!< Precomputed positions in the matrix rows, elements processed by color without atomics
+    MatrixFree          //!< Only the diagonal is assembled, the matrix is applied element by element in the linear solver
+  };
+
   /**
    * Constructor
    * @param name The name of the solver instance
@@ -176,6 +190,15 @@ public:
   template< typename ... PARAMS >
   real64 explicitKernelDispatch( PARAMS && ... params );
 
+  /**
+   * @brief Call a generic lambda with the kernel launch policy selected by the element batch size.
+   * @tparam LAMBDA The type of @p lambda.
+   * @param lambda The lambda, that takes an instance of the policy as its argument.
+   * @return The value returned by @p lambda.
+   */
+  template< typename LAMBDA >
+  real64 kernelPolicyDispatch( LAMBDA && lambda ) const;
+
   /**
    * Applies displacement boundary conditions to the system for implicit time integration
    * @param time The time to use for any lookups associated with this BC
@@ -222,6 +245,8 @@ public:
     static constexpr auto stiffnessDampingString = "stiffnessDamping";
     static constexpr auto useVelocityEstimateForQSString = "useVelocityForQS";
     static constexpr auto timeIntegrationOptionString = "timeIntegrationOption";
+    static constexpr auto assemblyMethodString = "assemblyMethod";
+    static constexpr auto elementBatchSizeString = "elementBatchSize";
     static constexpr auto maxNumResolvesString = "maxNumResolves";
     static constexpr auto strainTheoryString = "strainTheory";
     static constexpr auto solidMaterialNamesString = "solidMaterialNames";
@@ -234,6 +259,7 @@ public:
     static constexpr auto elemsAttachedToSendOrReceiveNodes = "elemsAttachedToSendOrReceiveNodes";
     static constexpr auto elemsNotAttachedToSendOrReceiveNodes = "elemsNotAttachedToSendOrReceiveNodes";
     static constexpr auto effectiveStress = "effectiveStress";
+    static constexpr auto assemblyMapString = "AssemblyMap";
 
     dataRepository::ViewKey vTilde = { vTildeString };
     dataRepository::ViewKey uhatTilde = { uhatTildeString };
@@ -267,6 +293,12 @@ public:
 
   real64 & getMaxForce() { return m_maxForce; }
 
+  /**
+   * @brief Get the matrix-free stiffness operator.
+   * @return the operator, or nullptr if the system of the solver is assembled
+   */
+  SolidMechanicsMatrixFreeOperator const * getMatrixFreeOperator() const { return m_matrixFreeOperator.get(); }
+
 
 protected:
   virtual void PostProcessInput() override final;
@@ -294,12 +326,63 @@ protected:
   /// variant of the solid mechanics kernels.
   integer m_effectiveStress;
 
+  /// The method used to add the element contributions to the global system.
+  AssemblyMethod m_assemblyMethod;
+
+  /// The DoF sparsity version of m_dofManager for which the assembly maps were computed.
+  integer m_assemblyMapSparsityVersion;
+
+  /// The mesh topology version for which the assembly maps were computed.
+  integer m_assemblyMapTopologyVersion;
+
+  /// The matrix-free stiffness operator, only set when the solver solves its own system matrix-free.
+  std::unique_ptr< SolidMechanicsMatrixFreeOperator > m_matrixFreeOperator;
+
+  /// The number of elements processed together by the host kernel launches.
+  integer m_elementBatchSize;
+
   SolidMechanicsLagrangianFEM();
 
+private:
+
+  /**
+   * @brief Get the name of the assembly maps to pass to the kernels.
+   * @param mesh The mesh the kernels are launched on.
+   * @param dofManager The DoF manager of the system the kernels assemble into.
+   * @return The name of the assembly maps registered on the subregions, or an
+   *         empty string if there are no up-to-date maps for the system of @p dofManager
+   *         (e.g. when a coupled solver assembles into its own matrix).
+   */
+  string getAssemblyMapName( MeshLevel const & mesh,
+                             DofManager const & dofManager ) const
+  {
+    if( m_assemblyMethod == AssemblyMethod::BinarySearch ||
+        m_assemblyMethod == AssemblyMethod::MatrixFree ||
+        &dofManager != &m_dofManager ||
+        dofManager.sparsityVersion() != m_assemblyMapSparsityVersion ||
+        mesh.topologyVersion() != m_assemblyMapTopologyVersion )
+    {
+      return string();
+    }
+    return this->getName() + viewKeyStruct::assemblyMapString;
+  }
+
+  /**
+   * @brief Check whether the system assembled into a matrix is solved matrix-free.
+   * @param localMatrix The matrix the kernels assemble into.
+   * @return true if @p localMatrix is the diagonal-only matrix of the matrix-free system.
+   */
+  bool isMatrixFree( CRSMatrixView< real64, globalIndex const > const & localMatrix ) const
+  {
+    return m_matrixFreeOperator != nullptr && localMatrix.getOffsets() == m_localMatrix.getOffsets();
+  }
+
 };
 
 ENUM_STRINGS( SolidMechanicsLagrangianFEM::TimeIntegrationOption, "QuasiStatic", "ImplicitDynamic", "ExplicitDynamic" )
 
+ENUM_STRINGS( SolidMechanicsLagrangianFEM::AssemblyMethod, "BinarySearch", "AssemblyMap", "ColoredAssemblyMap", "MatrixFree" )
+
 //**********************************************************************************************************************
 //**********************************************************************************************************************
 //**********************************************************************************************************************
@@ -330,20 +413,26 @@ void SolidMechanicsLagrangianFEM::AssemblyLaunch( DomainPartition & domain,
                                         gravityVector().Data()[1],
                                         gravityVector().Data()[2] };
 
-  m_maxForce = finiteElement::
-                 regionBasedKernelApplication< parallelDevicePolicy< 32 >,
-                                               CONSTITUTIVE_BASE,
-                                               CellElementSubRegion,
-                                               KERNEL_TEMPLATE >( mesh,
-                                                                  targetRegionNames(),
-                                                                  this->getDiscretizationName(),
-                                                                  m_solidMaterialNames,
-                                                                  dofNumber,
-                                                                  dofManager.rankOffset(),
-                                                                  localMatrix,
-                                                                  localRhs,
-                                                                  gravityVectorData,
-                                                                  std::forward< PARAMS >( params )... );
+  string const assemblyMapName = getAssemblyMapName( mesh, dofManager );
+
+  m_maxForce = kernelPolicyDispatch( [&]( auto policy )
+  {
+    return finiteElement::
+             regionBasedKernelApplication< decltype( policy ),
+                                           CONSTITUTIVE_BASE,
+                                           CellElementSubRegion,
+                                           KERNEL_TEMPLATE >( mesh,
+                                                              targetRegionNames(),
+                                                              this->getDiscretizationName(),
+                                                              m_solidMaterialNames,
+                                                              dofNumber,
+                                                              dofManager.rankOffset(),
+                                                              localMatrix,
+                                                              localRhs,
+                                                              gravityVectorData,
+                                                              assemblyMapName,
+                                                              std::forward< PARAMS >( params )... );
+  } );
 
 
   ApplyContactConstraint( dofManager,
@@ -353,6 +442,22 @@ void SolidMechanicsLagrangianFEM::AssemblyLaunch( DomainPartition & domain,
 
 }
 
+template< typename LAMBDA >
+real64 SolidMechanicsLagrangianFEM::kernelPolicyDispatch( LAMBDA && lambda ) const
+{
+#if !defined(GEOSX_USE_CUDA)
+  if( m_elementBatchSize == 4 )
+  {
+    return lambda( batchedHostPolicy< 4 >() );
+  }
+  else if( m_elementBatchSize == 8 )
+  {
+    return lambda( batchedHostPolicy< 8 >() );
+  }
+#endif
+  return lambda( parallelDevicePolicy< 32 >() );
+}
+
 } /* namespace geosx */
 
 #endif /* GEOSX_PHYSICSSOLVERS_SOLIDMECHANICS_SOLIDMECHANICSLAGRANGIANFEM_HPP_ */
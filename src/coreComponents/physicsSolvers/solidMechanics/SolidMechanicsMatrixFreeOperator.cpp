@@ -0,0 +1,129 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file SolidMechanicsMatrixFreeOperator.cpp
+ */
+
+#include "SolidMechanicsMatrixFreeOperator.hpp"
+
+#include "SolidMechanicsLagrangianFEM.hpp"
+#include "SolidMechanicsSmallStrainMatrixFreeKernels.hpp"
+
+#include "common/TimingMacros.hpp"
+#include "managers/DomainPartition.hpp"
+#include "mpiCommunications/CommunicationTools.hpp"
+
+namespace geosx
+{
+
+using namespace dataRepository;
+
+SolidMechanicsMatrixFreeOperator::SolidMechanicsMatrixFreeOperator( SolidMechanicsLagrangianFEM const & solver,
+                                                                    DomainPartition & domain,
+                                                                    DofManager const & dofManager,
+                                                                    CRSMatrixView< real64 const, globalIndex const > const & diagonal ):
+  LinearOperator< ParallelVector >(),
+  m_solver( solver ),
+  m_domain( domain ),
+  m_mesh( *domain.getMeshBody( 0 )->getMeshLevel( 0 ) ),
+  m_fieldName( solver.getName() + "MatrixFreeInput" ),
+  m_dofManager( dofManager ),
+  m_diagonal( diagonal ),
+  m_constrained( dofManager.numLocalDofs() ),
+  m_localDst( dofManager.numLocalDofs() )
+{
+  NodeManager & nodeManager = *m_mesh.getNodeManager();
+  if( !nodeManager.hasWrapper( m_fieldName ) )
+  {
+    nodeManager.registerWrapper< array2d< real64 > >( m_fieldName )->
+      setPlotLevel( PlotLevel::NOPLOT )->
+      setRestartFlags( RestartFlags::NO_WRITE )->
+      setRegisteringObjects( solver.getName() )->
+      setDescription( "An array that holds the input of the matrix-free stiffness operator on the nodes." )->
+      reference().resizeDimension< 1 >( 3 );
+  }
+}
+
+void SolidMechanicsMatrixFreeOperator::addConstrainedDofs( SortedArrayView< localIndex const > const & targetSet,
+                                                           arrayView1d< globalIndex const > const & dofNumber,
+                                                           integer const component )
+{
+  globalIndex const rankOffset = m_dofManager.rankOffset();
+  arrayView1d< integer > const & constrained = m_constrained;
+
+  forAll< parallelDevicePolicy< 32 > >( targetSet.size(), [=] GEOSX_HOST_DEVICE ( localIndex const i )
+  {
+    globalIndex const localRow = dofNumber[ targetSet[ i ] ] + component - rankOffset;
+    if( localRow >= 0 && localRow < constrained.size() )
+    {
+      constrained[ localRow ] = 1;
+    }
+  } );
+}
+
+void SolidMechanicsMatrixFreeOperator::apply( ParallelVector const & src,
+                                              ParallelVector & dst ) const
+{
+  GEOSX_MARK_FUNCTION;
+
+  // Scatter the input to the nodes, the elements also need the values on the ghosts
+  m_dofManager.copyVectorToField( src, keys::TotalDisplacement, m_fieldName, 1.0 );
+
+  std::map< string, string_array > fieldNames;
+  fieldNames["node"].emplace_back( m_fieldName );
+  CommunicationTools::SynchronizeFields( fieldNames,
+                                         &m_mesh,
+                                         m_domain.getNeighbors(),
+                                         true );
+
+  NodeManager const & nodeManager = *m_mesh.getNodeManager();
+  arrayView1d< globalIndex const > const & dofNumber =
+    nodeManager.getReference< globalIndex_array >( m_dofManager.getKey( keys::TotalDisplacement ) );
+  arrayView2d< real64 const > const & srcField = nodeManager.getReference< array2d< real64 > >( m_fieldName );
+
+  arrayView1d< real64 > const & localDst = m_localDst;
+  localDst.setValues< parallelDevicePolicy< 32 > >( 0 );
+
+  finiteElement::
+    regionBasedKernelApplication< parallelDevicePolicy< 32 >,
+                                  constitutive::SolidBase,
+                                  CellElementSubRegion,
+                                  SolidMechanicsLagrangianFEMKernels::QuasiStaticOperator >( m_mesh,
+                                                                                             m_solver.targetRegionNames(),
+                                                                                             m_solver.getDiscretizationName(),
+                                                                                             m_solver.solidMaterialNames(),
+                                                                                             dofNumber,
+                                                                                             m_dofManager.rankOffset(),
+                                                                                             srcField,
+                                                                                             localDst );
+
+  // The rows of the constrained dofs only keep their diagonal, as in the assembled matrix
+  arrayView1d< real64 const > const & localDstConst = m_localDst.toViewConst();
+  arrayView1d< integer const > const & constrained = m_constrained.toViewConst();
+  CRSMatrixView< real64 const, globalIndex const > const & diagonal = m_diagonal;
+  localDstConst.move( LvArray::MemorySpace::CPU, false );
+  constrained.move( LvArray::MemorySpace::CPU, false );
+  diagonal.move( LvArray::MemorySpace::CPU, false );
+
+  real64 const * const srcValues = src.extractLocalVector();
+  real64 * const dstValues = dst.extractLocalVector();
+
+  forAll< parallelHostPolicy >( dst.localSize(), [=] ( localIndex const i )
+  {
+    dstValues[ i ] = constrained[ i ] ? diagonal.getEntries( i )[ 0 ] * srcValues[ i ] : localDstConst[ i ];
+  } );
+}
+
+} /* namespace geosx */
@@ -0,0 +1,120 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file SolidMechanicsMatrixFreeOperator.hpp
+ */
+
+#ifndef GEOSX_PHYSICSSOLVERS_SOLIDMECHANICS_SOLIDMECHANICSMATRIXFREEOPERATOR_HPP_
+#define GEOSX_PHYSICSSOLVERS_SOLIDMECHANICS_SOLIDMECHANICSMATRIXFREEOPERATOR_HPP_
+
+#include "linearAlgebra/DofManager.hpp"
+#include "linearAlgebra/interfaces/InterfaceTypes.hpp"
+#include "linearAlgebra/interfaces/LinearOperator.hpp"
+
+namespace geosx
+{
+
+class DomainPartition;
+class MeshLevel;
+class SolidMechanicsLagrangianFEM;
+
+/**
+ * @class SolidMechanicsMatrixFreeOperator
+ *
+ * Quasi-static small strain stiffness operator of SolidMechanicsLagrangianFEM
+ * applied element by element, without storing the matrix.
+ *
+ * The operator reproduces the matrix that the solver would assemble after the
+ * application of the displacement boundary conditions: the rows of the
+ * constrained dofs only keep their diagonal, which is read from the
+ * diagonal-only matrix assembled by the solver.
+ */
+class SolidMechanicsMatrixFreeOperator : public LinearOperator< ParallelVector >
+{
+public:
+
+  /**
+   * @brief Constructor.
+   * @param solver the solver providing the regions, discretization and materials
+   * @param domain the domain partition
+   * @param dofManager the dof manager of the solver
+   * @param diagonal the local diagonal-only matrix assembled by the solver
+   */
+  SolidMechanicsMatrixFreeOperator( SolidMechanicsLagrangianFEM const & solver,
+                                    DomainPartition & domain,
+                                    DofManager const & dofManager,
+                                    CRSMatrixView< real64 const, globalIndex const > const & diagonal );
+
+  /**
+   * @brief Flag dofs as constrained by a displacement boundary condition.
+   * @param targetSet the constrained nodes
+   * @param dofNumber the dof number of the nodes
+   * @param component the constrained component
+   */
+  void addConstrainedDofs( SortedArrayView< localIndex const > const & targetSet,
+                           arrayView1d< globalIndex const > const & dofNumber,
+                           integer const component );
+
+  /**
+   * @copydoc LinearOperator::apply
+   */
+  virtual void apply( ParallelVector const & src, ParallelVector & dst ) const override;
+
+  /**
+   * @copydoc LinearOperator::numGlobalRows
+   */
+  virtual globalIndex numGlobalRows() const override
+  {
+    return m_dofManager.numGlobalDofs();
+  }
+
+  /**
+   * @copydoc LinearOperator::numGlobalCols
+   */
+  virtual globalIndex numGlobalCols() const override
+  {
+    return m_dofManager.numGlobalDofs();
+  }
+
+private:
+
+  /// The solver the operator belongs to
+  SolidMechanicsLagrangianFEM const & m_solver;
+
+  /// The domain partition
+  DomainPartition & m_domain;
+
+  /// The mesh level the operator is applied on
+  MeshLevel & m_mesh;
+
+  /// The name of the nodal field holding the input of the operator
+  string const m_fieldName;
+
+  /// The dof manager of the solver
+  DofManager const & m_dofManager;
+
+  /// The diagonal of the stiffness matrix
+  CRSMatrixView< real64 const, globalIndex const > const m_diagonal;
+
+  /// Flags for the locally owned dofs constrained by a boundary condition
+  array1d< integer > m_constrained;
+
+  /// Locally owned rows of the result, accumulated by the kernels
+  mutable array1d< real64 > m_localDst;
+};
+
+} /* namespace geosx */
+
+#endif /* GEOSX_PHYSICSSOLVERS_SOLIDMECHANICS_SOLIDMECHANICSMATRIXFREEOPERATOR_HPP_ */
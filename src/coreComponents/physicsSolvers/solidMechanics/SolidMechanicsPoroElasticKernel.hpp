@@ -66,6 +66,8 @@ public:
    * @brief Constructor
    * @copydoc geosx::finiteElement::ImplicitKernelBase::ImplicitKernelBase
    * @param inputGravityVector The gravity vector.
+   * @param assemblyMapName The name of the assembly map matching @p inputMatrix,
+   *                        or an empty string if there is none.
    */
   PoroElastic( NodeManager const & nodeManager,
                EdgeManager const & edgeManager,
@@ -77,7 +79,8 @@ public:
                globalIndex const rankOffset,
                CRSMatrixView< real64, globalIndex const > const & inputMatrix,
                arrayView1d< real64 > const & inputRhs,
-               real64 const (&inputGravityVector)[3] ):
+               real64 const (&inputGravityVector)[3],
+               string const & assemblyMapName ):
     Base( nodeManager,
           edgeManager,
           faceManager,
@@ -88,7 +91,8 @@ public:
           rankOffset,
           inputMatrix,
           inputRhs,
-          inputGravityVector ),
+          inputGravityVector,
+          assemblyMapName ),
     m_fluidPressure( elementSubRegion.template getReference< array1d< real64 > >( "pressure" ) ),
     m_deltaFluidPressure( elementSubRegion.template getReference< array1d< real64 > >( "deltaPressure" ) )
   {}
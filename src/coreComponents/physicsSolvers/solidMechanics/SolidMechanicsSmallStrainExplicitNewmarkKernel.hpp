@@ -282,7 +282,7 @@ public:
    */
   template< typename POLICY,
             typename KERNEL_TYPE >
-  static real64
+  static std::enable_if_t< !isBatchedPolicy< POLICY >::value, real64 >
   kernelLaunch( localIndex const numElems,
                 KERNEL_TYPE const & kernelComponent )
   {
@@ -308,6 +308,26 @@ public:
     return 0;
   }
 
+  /**
+   * @copydoc kernelLaunch
+   *
+   * Batched variant, processes the elements of the list in batches.
+   */
+  template< typename POLICY,
+            typename KERNEL_TYPE >
+  static std::enable_if_t< isBatchedPolicy< POLICY >::value, real64 >
+  kernelLaunch( localIndex const numElems,
+                KERNEL_TYPE const & kernelComponent )
+  {
+    GEOSX_UNUSED_VAR( numElems );
+
+    SortedArrayView< localIndex const > const & elementList = kernelComponent.m_elementList;
+    Base::template batchedKernelLaunch< POLICY, KERNEL_TYPE >( elementList.size(),
+                                                               kernelComponent,
+                                                               [=] ( localIndex const index ) { return elementList[ index ]; } );
+    return 0;
+  }
+
 
 protected:
   /// The array containing the nodal position array.
@@ -90,6 +90,7 @@ public:
                    CRSMatrixView< real64, globalIndex const > const & inputMatrix,
                    arrayView1d< real64 > const & inputRhs,
                    real64 const (&inputGravityVector)[3],
+                   string const & assemblyMapName,
                    real64 const inputNewmarkGamma,
                    real64 const inputNewmarkBeta,
                    real64 const inputMassDamping,
@@ -105,7 +106,8 @@ public:
           rankOffset,
           inputMatrix,
           inputRhs,
-          inputGravityVector ),
+          inputGravityVector,
+          assemblyMapName ),
     m_vtilde( nodeManager.totalDisplacement()),
     m_uhattilde( nodeManager.totalDisplacement()),
     m_newmarkGamma( inputNewmarkGamma ),
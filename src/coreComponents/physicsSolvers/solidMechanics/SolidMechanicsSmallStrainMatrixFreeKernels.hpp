@@ -0,0 +1,269 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file SolidMechanicsSmallStrainMatrixFreeKernels.hpp
+ */
+
+#ifndef GEOSX_PHYSICSSOLVERS_SOLIDMECHANICS_SOLIDMECHANICSSMALLSTRAINMATRIXFREEKERNELS_HPP_
+#define GEOSX_PHYSICSSOLVERS_SOLIDMECHANICS_SOLIDMECHANICSSMALLSTRAINMATRIXFREEKERNELS_HPP_
+
+#include "SolidMechanicsSmallStrainQuasiStaticKernel.hpp"
+
+namespace geosx
+{
+
+namespace SolidMechanicsLagrangianFEMKernels
+{
+
+/**
+ * @brief Quasi-static assembly of the residual and of the diagonal of the
+ *   stiffness matrix.
+ * @copydoc geosx::SolidMechanicsLagrangianFEMKernels::QuasiStatic
+ *
+ * ### QuasiStaticDiagonal Description
+ * Performs the same integration as QuasiStatic, including the constitutive
+ * update, but only adds the diagonal of the element matrices to
+ * @p m_matrix. The matrix is expected to have a single entry per row, the
+ * diagonal, as used by the matrix-free solution of the linear systems.
+ */
+template< typename SUBREGION_TYPE,
+          typename CONSTITUTIVE_TYPE,
+          typename FE_TYPE >
+class QuasiStaticDiagonal : public QuasiStatic< SUBREGION_TYPE,
+                                                CONSTITUTIVE_TYPE,
+                                                FE_TYPE >
+{
+public:
+  /// Alias for the base class;
+  using Base = QuasiStatic< SUBREGION_TYPE,
+                            CONSTITUTIVE_TYPE,
+                            FE_TYPE >;
+
+  using Base::numNodesPerElem;
+  using Base::numDofPerTestSupportPoint;
+  using Base::m_dofRankOffset;
+  using Base::m_matrix;
+  using Base::m_rhs;
+  using StackVariables = typename Base::StackVariables;
+
+  using Base::Base;
+
+  /**
+   * @copydoc geosx::finiteElement::ImplicitKernelBase::complete
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  real64 complete( localIndex const GEOSX_UNUSED_PARAM( k ),
+                   StackVariables & stack ) const
+  {
+    real64 maxForce = 0;
+
+    // upperBTDB already filled the diagonal, the lower part is not needed
+    for( int localNode = 0; localNode < numNodesPerElem; ++localNode )
+    {
+      for( int dim = 0; dim < numDofPerTestSupportPoint; ++dim )
+      {
+        localIndex const i = numDofPerTestSupportPoint * localNode + dim;
+        localIndex const dof = LvArray::integerConversion< localIndex >( stack.localRowDofIndex[ i ] - m_dofRankOffset );
+        if( dof < 0 || dof >= m_matrix.numRows() ) continue;
+        RAJA::atomicAdd< parallelDeviceAtomic >( &m_matrix.getEntries( dof )[0], stack.localJacobian[ i ][ i ] );
+        RAJA::atomicAdd< parallelDeviceAtomic >( &m_rhs[ dof ], stack.localResidual[ i ] );
+        maxForce = fmax( maxForce, fabs( stack.localResidual[ i ] ) );
+      }
+    }
+
+    return maxForce;
+  }
+};
+
+/**
+ * @brief Applies the quasi-static stiffness operator to a nodal field without
+ *   forming the matrix.
+ * @copydoc geosx::SolidMechanicsLagrangianFEMKernels::QuasiStatic
+ *
+ * ### QuasiStaticOperator Description
+ * Computes @f$ y = K x @f$ element by element, where @f$ K @f$ is the
+ * jacobian assembled by QuasiStatic. The element matrices are formed from the
+ * current constitutive stiffness, the constitutive state is not updated. The
+ * input @f$ x @f$ is a nodal field that must be synchronized on the ghost
+ * nodes, and the locally owned rows of the output @f$ y @f$ are accumulated in
+ * @p m_rhs.
+ */
+template< typename SUBREGION_TYPE,
+          typename CONSTITUTIVE_TYPE,
+          typename FE_TYPE >
+class QuasiStaticOperator : public QuasiStatic< SUBREGION_TYPE,
+                                                CONSTITUTIVE_TYPE,
+                                                FE_TYPE >
+{
+public:
+  /// Alias for the base class;
+  using Base = QuasiStatic< SUBREGION_TYPE,
+                            CONSTITUTIVE_TYPE,
+                            FE_TYPE >;
+
+  using Base::numNodesPerElem;
+  using Base::numDofPerTestSupportPoint;
+  using Base::numDofPerTrialSupportPoint;
+  using Base::m_dofRankOffset;
+  using Base::m_rhs;
+  using Base::m_elemsToNodes;
+  using Base::m_constitutiveUpdate;
+  using Base::m_finiteElementSpace;
+
+  /**
+   * @brief Constructor
+   * @param nodeManager Reference to the NodeManager object.
+   * @param edgeManager Reference to the EdgeManager object.
+   * @param faceManager Reference to the FaceManager object.
+   * @param elementSubRegion Reference to the subregion object.
+   * @param finiteElementSpace Placeholder for the finite element space object.
+   * @param inputConstitutiveType The constitutive relation object.
+   * @param inputDofNumber The dof number of the nodes.
+   * @param rankOffset The global rank offset.
+   * @param inputSrc The nodal field the operator is applied to.
+   * @param inputDst The locally owned rows of the result.
+   */
+  QuasiStaticOperator( NodeManager const & nodeManager,
+                       EdgeManager const & edgeManager,
+                       FaceManager const & faceManager,
+                       SUBREGION_TYPE const & elementSubRegion,
+                       FE_TYPE const & finiteElementSpace,
+                       CONSTITUTIVE_TYPE * const inputConstitutiveType,
+                       arrayView1d< globalIndex const > const & inputDofNumber,
+                       globalIndex const rankOffset,
+                       arrayView2d< real64 const > const & inputSrc,
+                       arrayView1d< real64 > const & inputDst ):
+    Base( nodeManager,
+          edgeManager,
+          faceManager,
+          elementSubRegion,
+          finiteElementSpace,
+          inputConstitutiveType,
+          inputDofNumber,
+          rankOffset,
+          CRSMatrixView< real64, globalIndex const >(),
+          inputDst,
+          { 0.0, 0.0, 0.0 },
+          string() ),
+    m_src( inputSrc )
+  {}
+
+  /**
+   * @class StackVariables
+   * @copydoc geosx::SolidMechanicsLagrangianFEMKernels::QuasiStatic::StackVariables
+   *
+   * Adds a stack array for the element local values of the input field.
+   */
+  struct StackVariables : public Base::StackVariables
+  {
+public:
+
+    /// Constructor.
+    GEOSX_HOST_DEVICE
+    StackVariables():
+      Base::StackVariables(),
+      srcLocal()
+    {}
+
+    /// Stack storage for the element local values of the input field.
+    real64 srcLocal[ numNodesPerElem ][ numDofPerTrialSupportPoint ];
+  };
+
+  /**
+   * @copydoc geosx::SolidMechanicsLagrangianFEMKernels::QuasiStatic::setup
+   *
+   * The element local values of the input field are gathered as well.
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  void setup( localIndex const k,
+              StackVariables & stack ) const
+  {
+    Base::setup( k, stack );
+    for( localIndex a = 0; a < numNodesPerElem; ++a )
+    {
+      localIndex const localNodeIndex = m_elemsToNodes( k, a );
+      for( int i = 0; i < 3; ++i )
+      {
+        stack.srcLocal[ a ][ i ] = m_src[ localNodeIndex ][ i ];
+      }
+    }
+  }
+
+  /**
+   * @copydoc geosx::finiteElement::KernelBase::quadraturePointKernel
+   *
+   * Only the element stiffness is integrated, the constitutive update and the
+   * residual are skipped.
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  void quadraturePointKernel( localIndex const k,
+                              localIndex const q,
+                              StackVariables & stack ) const
+  {
+    real64 dNdX[ numNodesPerElem ][ 3 ];
+    real64 const detJ = m_finiteElementSpace.template getGradN< FE_TYPE >( k, q, stack.xLocal, dNdX );
+
+    typename CONSTITUTIVE_TYPE::KernelWrapper::DiscretizationOps stiffnessHelper;
+    m_constitutiveUpdate.setDiscretizationOps( k, q, stiffnessHelper );
+
+    stiffnessHelper.template upperBTDB< numNodesPerElem >( dNdX, -detJ, stack.localJacobian );
+  }
+
+  /**
+   * @copydoc geosx::finiteElement::ImplicitKernelBase::complete
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  real64 complete( localIndex const GEOSX_UNUSED_PARAM( k ),
+                   StackVariables & stack ) const
+  {
+    CONSTITUTIVE_TYPE::KernelWrapper::DiscretizationOps::template fillLowerBTDB< numNodesPerElem >( stack.localJacobian );
+
+    for( int localNode = 0; localNode < numNodesPerElem; ++localNode )
+    {
+      for( int dim = 0; dim < numDofPerTestSupportPoint; ++dim )
+      {
+        localIndex const i = numDofPerTestSupportPoint * localNode + dim;
+        localIndex const dof = LvArray::integerConversion< localIndex >( stack.localRowDofIndex[ i ] - m_dofRankOffset );
+        if( dof < 0 || dof >= m_rhs.size() ) continue;
+
+        real64 value = 0;
+        for( int b = 0; b < numNodesPerElem; ++b )
+        {
+          for( int j = 0; j < numDofPerTrialSupportPoint; ++j )
+          {
+            value += stack.localJacobian[ i ][ numDofPerTrialSupportPoint * b + j ] * stack.srcLocal[ b ][ j ];
+          }
+        }
+        RAJA::atomicAdd< parallelDeviceAtomic >( &m_rhs[ dof ], value );
+      }
+    }
+
+    return 0;
+  }
+
+protected:
+  /// The nodal field the operator is applied to.
+  arrayView2d< real64 const > const m_src;
+};
+
+} // namespace SolidMechanicsLagrangianFEMKernels
+
+} // namespace geosx
+
+#endif // GEOSX_PHYSICSSOLVERS_SOLIDMECHANICS_SOLIDMECHANICSSMALLSTRAINMATRIXFREEKERNELS_HPP_
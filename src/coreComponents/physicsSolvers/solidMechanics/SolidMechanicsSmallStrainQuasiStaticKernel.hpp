@@ -87,6 +87,8 @@ public:
    * @brief Constructor
    * @copydoc geosx::finiteElement::ImplicitKernelBase::ImplicitKernelBase
    * @param inputGravityVector The gravity vector.
+   * @param assemblyMapName The name of the assembly map matching @p inputMatrix,
+   *                        or an empty string if there is none.
    */
   QuasiStatic( NodeManager const & nodeManager,
                EdgeManager const & edgeManager,
@@ -98,7 +100,8 @@ public:
                globalIndex const rankOffset,
                CRSMatrixView< real64, globalIndex const > const & inputMatrix,
                arrayView1d< real64 > const & inputRhs,
-               real64 const (&inputGravityVector)[3] ):
+               real64 const (&inputGravityVector)[3],
+               string const & assemblyMapName ):
     Base( nodeManager,
           edgeManager,
           faceManager,
@@ -108,7 +111,8 @@ public:
           inputDofNumber,
           rankOffset,
           inputMatrix,
-          inputRhs ),
+          inputRhs,
+          assemblyMapName ),
     m_X( nodeManager.referencePosition()),
     m_disp( nodeManager.totalDisplacement()),
     m_uhat( nodeManager.incrementalDisplacement()),
@@ -285,7 +289,6 @@ public:
   real64 complete( localIndex const k,
                    StackVariables & stack ) const
   {
-    GEOSX_UNUSED_VAR( k );
     real64 maxForce = 0;
 
     CONSTITUTIVE_TYPE::KernelWrapper::DiscretizationOps::template fillLowerBTDB< numNodesPerElem >( stack.localJacobian );
@@ -296,12 +299,7 @@ public:
       {
         localIndex const dof = LvArray::integerConversion< localIndex >( stack.localRowDofIndex[ numDofPerTestSupportPoint * localNode + dim ] - m_dofRankOffset );
         if( dof < 0 || dof >= m_matrix.numRows() ) continue;
-        m_matrix.template addToRowBinarySearchUnsorted< parallelDeviceAtomic >( dof,
-                                                                                stack.localRowDofIndex,
-                                                                                stack.localJacobian[ numDofPerTestSupportPoint * localNode + dim ],
-                                                                                numNodesPerElem * numDofPerTrialSupportPoint );
-
-        RAJA::atomicAdd< parallelDeviceAtomic >( &m_rhs[ dof ], stack.localResidual[ numDofPerTestSupportPoint * localNode + dim ] );
+        this->addToGlobalRow( k, numDofPerTestSupportPoint * localNode + dim, dof, stack );
         maxForce = fmax( maxForce, fabs( stack.localResidual[ numDofPerTestSupportPoint * localNode + dim ] ) );
       }
     }
@@ -336,5 +334,6 @@ protected:
 } // namespace geosx
 
 #include "finiteElement/kernelInterface/SparsityKernelBase.hpp"
+#include "finiteElement/kernelInterface/AssemblyMapKernelBase.hpp"
 
 #endif // GEOSX_PHYSICSSOLVERS_SOLIDMECHANICS_SOLIDMECHANICSSMALLSTRAINQUASISTATIC_HPP_
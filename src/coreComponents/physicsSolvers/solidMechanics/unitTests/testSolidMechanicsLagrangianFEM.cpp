@@ -0,0 +1,499 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// Source includes
+#include "codingUtilities/UnitTestUtilities.hpp"
+#include "finiteElement/kernelInterface/AssemblyMapKernelBase.hpp"
+#include "managers/initialization.hpp"
+#include "managers/DomainPartition.hpp"
+#include "managers/ProblemManager.hpp"
+#include "mesh/CellElementSubRegion.hpp"
+#include "physicsSolvers/PhysicsSolverManager.hpp"
+#include "physicsSolvers/solidMechanics/SolidMechanicsLagrangianFEM.hpp"
+#include "linearAlgebra/unitTests/testDofManagerUtils.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+
+using namespace geosx;
+using namespace geosx::testing;
+
+/**
+ * @brief Get the input of a small problem.
+ * @param assemblyMethod the assembly method of the solver
+ * @param timeIntegrationOption the time integration option of the solver
+ * @param elementBatchSize the number of elements processed together by the kernels
+ * @return the XML input
+ */
+string solidMechanicsInput( string const & assemblyMethod,
+                            string const & timeIntegrationOption,
+                            integer const elementBatchSize )
+{
+  return
+    "<Problem>\n"
+    "  <Solvers gravityVector=\"0.0, 0.0, -9.81\">\n"
+    "    <SolidMechanics_LagrangianFEM name=\"lagsolve\"\n"
+    "                                  timeIntegrationOption=\"" + timeIntegrationOption + "\"\n"
+    "                                  assemblyMethod=\"" + assemblyMethod + "\"\n"
+    "                                  elementBatchSize=\"" + std::to_string( elementBatchSize ) + "\"\n"
+    "                                  discretization=\"FE1\"\n"
+    "                                  targetRegions=\"{Region1}\"\n"
+    "                                  solidMaterialNames=\"{shale}\">\n"
+    "      <LinearSolverParameters solverType=\"cg\"\n"
+    "                              preconditionerType=\"jacobi\"\n"
+    "                              krylovTol=\"1.0e-12\"\n"
+    "                              krylovMaxIter=\"1000\"/>\n"
+    "    </SolidMechanics_LagrangianFEM>\n"
+    "  </Solvers>\n"
+    "  <Mesh>\n"
+    "    <InternalMesh name=\"mesh1\"\n"
+    "                  elementTypes=\"{C3D8}\"\n"
+    "                  xCoords=\"{0, 5}\"\n"
+    "                  yCoords=\"{0, 3}\"\n"
+    "                  zCoords=\"{0, 2}\"\n"
+    "                  nx=\"{5}\"\n"
+    "                  ny=\"{3}\"\n"
+    "                  nz=\"{2}\"\n"
+    "                  cellBlockNames=\"{cb1}\"/>\n"
+    "  </Mesh>\n"
+    "  <NumericalMethods>\n"
+    "    <FiniteElements>\n"
+    "      <FiniteElementSpace name=\"FE1\"\n"
+    "                          order=\"1\"/>\n"
+    "    </FiniteElements>\n"
+    "  </NumericalMethods>\n"
+    "  <ElementRegions>\n"
+    "    <CellElementRegion name=\"Region1\"\n"
+    "                       cellBlocks=\"{cb1}\"\n"
+    "                       materialList=\"{shale}\"/>\n"
+    "  </ElementRegions>\n"
+    "  <Constitutive>\n"
+    "    <LinearElasticIsotropic name=\"shale\"\n"
+    "                            defaultDensity=\"2700\"\n"
+    "                            defaultBulkModulus=\"5.5556e9\"\n"
+    "                            defaultShearModulus=\"4.16667e9\"/>\n"
+    "  </Constitutive>\n"
+    "  <FieldSpecifications>\n"
+    "    <FieldSpecification name=\"xnegconstraint\"\n"
+    "                        objectPath=\"nodeManager\"\n"
+    "                        fieldName=\"TotalDisplacement\"\n"
+    "                        component=\"0\"\n"
+    "                        scale=\"0.0\"\n"
+    "                        setNames=\"{xneg}\"/>\n"
+    "    <FieldSpecification name=\"yconstraint\"\n"
+    "                        objectPath=\"nodeManager\"\n"
+    "                        fieldName=\"TotalDisplacement\"\n"
+    "                        component=\"1\"\n"
+    "                        scale=\"0.0\"\n"
+    "                        setNames=\"{xneg}\"/>\n"
+    "    <FieldSpecification name=\"zconstraint\"\n"
+    "                        objectPath=\"nodeManager\"\n"
+    "                        fieldName=\"TotalDisplacement\"\n"
+    "                        component=\"2\"\n"
+    "                        scale=\"0.0\"\n"
+    "                        setNames=\"{xneg, zneg}\"/>\n"
+    "    <FieldSpecification name=\"xposdisplacement\"\n"
+    "                        objectPath=\"nodeManager\"\n"
+    "                        fieldName=\"TotalDisplacement\"\n"
+    "                        component=\"0\"\n"
+    "                        scale=\"1.0e-4\"\n"
+    "                        setNames=\"{xpos}\"/>\n"
+    "  </FieldSpecifications>\n"
+    "</Problem>";
+}
+
+class SolidMechanicsLagrangianFEMTest : public ::testing::Test
+{
+protected:
+
+  /**
+   * @brief Set up the problem and the system of the solver.
+   * @param assemblyMethod the assembly method of the solver
+   * @param timeIntegrationOption the time integration option of the solver
+   * @param elementBatchSize the number of elements processed together by the kernels
+   */
+  void setupProblem( string const & assemblyMethod,
+                     string const & timeIntegrationOption = "QuasiStatic",
+                     integer const elementBatchSize = 1 )
+  {
+    // only one problem may exist at a time
+    problemManager.reset();
+    problemManager = std::make_unique< ProblemManager >( "Problem", nullptr );
+    setupProblemFromXML( problemManager.get(), solidMechanicsInput( assemblyMethod, timeIntegrationOption, elementBatchSize ).c_str() );
+
+    solver = problemManager->GetPhysicsSolverManager().GetGroup< SolidMechanicsLagrangianFEM >( "lagsolve" );
+    domain = problemManager->getDomainPartition();
+    mesh = domain->getMeshBody( 0 )->getMeshLevel( 0 );
+
+    setupSystem();
+
+    // a smooth, non-trivial displacement increment so that the residual does not vanish
+    NodeManager & nodeManager = *mesh->getNodeManager();
+    arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & X = nodeManager.referencePosition();
+    arrayView2d< real64, nodes::INCR_DISPLACEMENT_USD > const & uhat = nodeManager.incrementalDisplacement();
+    X.move( LvArray::MemorySpace::CPU, false );
+    uhat.move( LvArray::MemorySpace::CPU, true );
+    for( localIndex a = 0; a < nodeManager.size(); ++a )
+    {
+      for( int i = 0; i < 3; ++i )
+      {
+        uhat( a, i ) = 1.0e-3 * std::sin( X( a, 0 ) + 2.0 * X( a, 1 ) + 3.0 * X( a, 2 ) + i );
+      }
+    }
+  }
+
+  /**
+   * @brief Set up the system of the solver.
+   */
+  void setupSystem()
+  {
+    solver->SetupSystem( *domain,
+                         solver->getDofManager(),
+                         solver->getLocalMatrix(),
+                         solver->getLocalRhs(),
+                         solver->getLocalSolution() );
+  }
+
+  /**
+   * @brief Assemble the system of the solver.
+   */
+  void assemble()
+  {
+    solver->AssembleSystem( time,
+                            dt,
+                            *domain,
+                            solver->getDofManager(),
+                            solver->getLocalMatrix().toViewConstSizes(),
+                            solver->getLocalRhs() );
+  }
+
+  /**
+   * @brief Apply the boundary conditions to the system of the solver.
+   */
+  void applyBoundaryConditions()
+  {
+    solver->ApplyBoundaryConditions( time,
+                                     dt,
+                                     *domain,
+                                     solver->getDofManager(),
+                                     solver->getLocalMatrix().toViewConstSizes(),
+                                     solver->getLocalRhs() );
+  }
+
+  /**
+   * @brief Get the element coloring of the assembly maps of the single subregion.
+   * @return the color offsets
+   */
+  array1d< localIndex > & colorOffsets()
+  {
+    CellElementSubRegion & subRegion =
+      *mesh->getElemManager()->GetRegion< CellElementRegion >( "Region1" )->GetSubRegion< CellElementSubRegion >( "cb1" );
+    return subRegion.getReference< array1d< localIndex > >( solver->getName() +
+                                                            SolidMechanicsLagrangianFEM::viewKeyStruct::assemblyMapString +
+                                                            finiteElement::AssemblyMapKeys::colorOffsetsString );
+  }
+
+  /**
+   * @brief Compare the system of the solver to a reference system.
+   * @param matrix the reference matrix
+   * @param rhs the reference right-hand side
+   */
+  void compareSystem( CRSMatrix< real64, globalIndex > const & matrix,
+                      array1d< real64 > const & rhs ) const
+  {
+    compareLocalMatrices( solver->getLocalMatrix().toViewConst(), matrix.toViewConst(), relTol, absTol );
+
+    arrayView1d< real64 const > const & localRhs = solver->getLocalRhs();
+    localRhs.move( LvArray::MemorySpace::CPU, false );
+    rhs.move( LvArray::MemorySpace::CPU, false );
+    ASSERT_EQ( localRhs.size(), rhs.size() );
+    for( localIndex i = 0; i < rhs.size(); ++i )
+    {
+      checkRelativeError( localRhs[i], rhs[i], relTol, absTol, "Row " + std::to_string( i ) );
+    }
+  }
+
+  static real64 constexpr time = 0.0;
+  static real64 constexpr dt = 1.0;
+
+  // the contributions are summed in a different order by the assembly methods, and the matrix
+  // entries are of the order of the moduli, so entries that cancel out are only zero up to round-off
+  static real64 constexpr relTol = 1.0e-12;
+  static real64 constexpr absTol = 1.0e-2;
+
+  // stable time step of the explicit problem
+  static real64 constexpr explicitDt = 1.0e-5;
+
+  std::unique_ptr< ProblemManager > problemManager;
+  SolidMechanicsLagrangianFEM * solver = nullptr;
+  DomainPartition * domain = nullptr;
+  MeshLevel * mesh = nullptr;
+};
+
+real64 constexpr SolidMechanicsLagrangianFEMTest::time;
+real64 constexpr SolidMechanicsLagrangianFEMTest::dt;
+real64 constexpr SolidMechanicsLagrangianFEMTest::relTol;
+real64 constexpr SolidMechanicsLagrangianFEMTest::absTol;
+real64 constexpr SolidMechanicsLagrangianFEMTest::explicitDt;
+
+TEST_F( SolidMechanicsLagrangianFEMTest, assemblyMethodsAreEquivalent )
+{
+  setupProblem( "BinarySearch" );
+  assemble();
+  CRSMatrix< real64, globalIndex > const matrix( solver->getLocalMatrix() );
+  array1d< real64 > const rhs( solver->getLocalRhs() );
+
+  {
+    SCOPED_TRACE( "AssemblyMap" );
+    setupProblem( "AssemblyMap" );
+    EXPECT_TRUE( colorOffsets().empty() );
+    assemble();
+    compareSystem( matrix, rhs );
+  }
+
+  {
+    SCOPED_TRACE( "ColoredAssemblyMap" );
+    setupProblem( "ColoredAssemblyMap" );
+    EXPECT_FALSE( colorOffsets().empty() );
+    assemble();
+    compareSystem( matrix, rhs );
+  }
+
+  {
+    // when the elements cannot be colored, the color offsets are left empty and the
+    // contributions are added with atomics through the assembly map
+    SCOPED_TRACE( "ColoredAssemblyMap without colors" );
+    colorOffsets().clear();
+    assemble();
+    compareSystem( matrix, rhs );
+  }
+}
+
+TEST_F( SolidMechanicsLagrangianFEMTest, assemblyMapsAreKeptForTheSameSparsity )
+{
+  setupProblem( "ColoredAssemblyMap" );
+  assemble();
+  CRSMatrix< real64, globalIndex > const matrix( solver->getLocalMatrix() );
+  array1d< real64 > const rhs( solver->getLocalRhs() );
+
+  // the maps are not recomputed by a new setup of the same system
+  colorOffsets().clear();
+  setupSystem();
+  EXPECT_TRUE( colorOffsets().empty() );
+  assemble();
+  compareSystem( matrix, rhs );
+
+  // but they are after a change of the mesh topology
+  mesh->modifiedTopology();
+  setupSystem();
+  EXPECT_FALSE( colorOffsets().empty() );
+  assemble();
+  compareSystem( matrix, rhs );
+}
+
+TEST_F( SolidMechanicsLagrangianFEMTest, matrixFreeOperatorMatchesAssembledMatrix )
+{
+  setupProblem( "BinarySearch" );
+  assemble();
+  applyBoundaryConditions();
+  solver->ComposeParallelSystem();
+
+  ParallelMatrix const & matrix = solver->getSystemMatrix();
+  ParallelVector src;
+  src.createWithLocalSize( matrix.numLocalRows(), MPI_COMM_GEOSX );
+  src.rand( 2020 );
+  ParallelVector expected( src );
+  matrix.apply( src, expected );
+
+  setupProblem( "MatrixFree" );
+  assemble();
+  applyBoundaryConditions();
+
+  SolidMechanicsMatrixFreeOperator const * const matrixFreeOperator = solver->getMatrixFreeOperator();
+  ASSERT_NE( matrixFreeOperator, nullptr );
+  ASSERT_EQ( matrixFreeOperator->numGlobalRows(), matrix.numGlobalRows() );
+
+  ParallelVector result( src );
+  result.zero();
+  matrixFreeOperator->apply( src, result );
+
+  // the rows of the constrained dofs only hold the diagonal, the others the full stiffness
+  real64 const * const resultValues = result.extractLocalVector();
+  real64 const * const expectedValues = expected.extractLocalVector();
+  for( localIndex i = 0; i < expected.localSize(); ++i )
+  {
+    checkRelativeError( resultValues[i], expectedValues[i], relTol, absTol, "Row " + std::to_string( i ) );
+  }
+}
+
+TEST_F( SolidMechanicsLagrangianFEMTest, matrixFreeSolutionMatchesAssembledSolution )
+{
+  setupProblem( "BinarySearch" );
+  solver->SolverStep( time, dt, 0, *domain );
+  array2d< real64, nodes::TOTAL_DISPLACEMENT_PERM > const expected( mesh->getNodeManager()->totalDisplacement() );
+
+  setupProblem( "MatrixFree" );
+  solver->SolverStep( time, dt, 0, *domain );
+  arrayView2d< real64 const, nodes::TOTAL_DISPLACEMENT_USD > const & result = mesh->getNodeManager()->totalDisplacement();
+
+  expected.move( LvArray::MemorySpace::CPU, false );
+  result.move( LvArray::MemorySpace::CPU, false );
+  ASSERT_EQ( result.size( 0 ), expected.size( 0 ) );
+  for( localIndex a = 0; a < expected.size( 0 ); ++a )
+  {
+    for( int i = 0; i < 3; ++i )
+    {
+      // both linear solves converge to krylovTol
+      checkRelativeError( result( a, i ), expected( a, i ), 1.0e-6, 1.0e-12,
+                          "Node " + std::to_string( a ) + ", component " + std::to_string( i ) );
+    }
+  }
+}
+
+TEST_F( SolidMechanicsLagrangianFEMTest, elementBatchesMatchSingleElements )
+{
+  setupProblem( "BinarySearch" );
+  assemble();
+  CRSMatrix< real64, globalIndex > const matrix( solver->getLocalMatrix() );
+  array1d< real64 > const rhs( solver->getLocalRhs() );
+
+  // the last batch is incomplete, its elements are processed one by one
+  localIndex const numElems = mesh->getElemManager()->getNumberOfElements();
+  ASSERT_NE( numElems % 4, 0 );
+  ASSERT_NE( numElems % 8, 0 );
+
+  for( integer const elementBatchSize : { 4, 8 } )
+  {
+    SCOPED_TRACE( "elementBatchSize " + std::to_string( elementBatchSize ) );
+    setupProblem( "BinarySearch", "QuasiStatic", elementBatchSize );
+    assemble();
+    compareSystem( matrix, rhs );
+  }
+}
+
+TEST_F( SolidMechanicsLagrangianFEMTest, explicitElementBatchesMatchSingleElements )
+{
+  // a few explicit steps from a non-trivial velocity field
+  auto runExplicitSteps = [this]( integer const elementBatchSize )
+  {
+    setupProblem( "BinarySearch", "ExplicitDynamic", elementBatchSize );
+
+    NodeManager & nodeManager = *mesh->getNodeManager();
+    arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & X = nodeManager.referencePosition();
+    arrayView2d< real64, nodes::VELOCITY_USD > const & velocity = nodeManager.velocity();
+    X.move( LvArray::MemorySpace::CPU, false );
+    velocity.move( LvArray::MemorySpace::CPU, true );
+    for( localIndex a = 0; a < nodeManager.size(); ++a )
+    {
+      for( int i = 0; i < 3; ++i )
+      {
+        velocity( a, i ) = std::cos( 3.0 * X( a, 0 ) + 2.0 * X( a, 1 ) + X( a, 2 ) + i );
+      }
+    }
+
+    for( integer cycle = 0; cycle < 3; ++cycle )
+    {
+      solver->SolverStep( cycle * explicitDt, explicitDt, cycle, *domain );
+    }
+  };
+
+  runExplicitSteps( 1 );
+  array2d< real64, nodes::TOTAL_DISPLACEMENT_PERM > const expectedDisplacement( mesh->getNodeManager()->totalDisplacement() );
+  array2d< real64, nodes::VELOCITY_PERM > const expectedVelocity( mesh->getNodeManager()->velocity() );
+  expectedDisplacement.move( LvArray::MemorySpace::CPU, false );
+  expectedVelocity.move( LvArray::MemorySpace::CPU, false );
+
+  for( integer const elementBatchSize : { 4, 8 } )
+  {
+    SCOPED_TRACE( "elementBatchSize " + std::to_string( elementBatchSize ) );
+    runExplicitSteps( elementBatchSize );
+
+    NodeManager const & nodeManager = *mesh->getNodeManager();
+    arrayView2d< real64 const, nodes::TOTAL_DISPLACEMENT_USD > const & displacement = nodeManager.totalDisplacement();
+    arrayView2d< real64 const, nodes::VELOCITY_USD > const & velocity = nodeManager.velocity();
+    displacement.move( LvArray::MemorySpace::CPU, false );
+    velocity.move( LvArray::MemorySpace::CPU, false );
+    ASSERT_EQ( nodeManager.size(), expectedVelocity.size( 0 ) );
+    for( localIndex a = 0; a < nodeManager.size(); ++a )
+    {
+      for( int i = 0; i < 3; ++i )
+      {
+        string const name = "Node " + std::to_string( a ) + ", component " + std::to_string( i );
+        checkRelativeError( displacement( a, i ), expectedDisplacement( a, i ), relTol, 1.0e-15, name );
+        checkRelativeError( velocity( a, i ), expectedVelocity( a, i ), relTol, 1.0e-12, name );
+      }
+    }
+  }
+}
+
+/**
+ * @brief A subregion of two-node elements that all share their first node.
+ */
+struct FanSubRegion
+{
+  explicit FanSubRegion( localIndex const numElems ):
+    m_nodeList( numElems, 2 )
+  {
+    for( localIndex k = 0; k < numElems; ++k )
+    {
+      m_nodeList( k, 0 ) = 0;
+      m_nodeList( k, 1 ) = k + 1;
+    }
+  }
+
+  array2d< localIndex > const & nodeList() const { return m_nodeList; }
+
+  localIndex size() const { return m_nodeList.size( 0 ); }
+
+  localIndex numNodesPerElement() const { return m_nodeList.size( 1 ); }
+
+  array2d< localIndex > m_nodeList;
+};
+
+TEST( AssemblyMapColoring, colorsElementsSharingANode )
+{
+  // each element needs its own color
+  FanSubRegion const subRegion( 64 );
+  array1d< localIndex > colorOffsets;
+  array1d< localIndex > coloredElements;
+
+  ASSERT_TRUE( finiteElement::colorElements( subRegion, subRegion.size() + 1, colorOffsets, coloredElements ) );
+  ASSERT_EQ( colorOffsets.size(), 65 );
+  ASSERT_EQ( coloredElements.size(), 64 );
+  for( localIndex color = 0; color < 64; ++color )
+  {
+    EXPECT_EQ( colorOffsets[color], color );
+    EXPECT_EQ( coloredElements[color], color );
+  }
+}
+
+TEST( AssemblyMapColoring, moreThan64ColorsFails )
+{
+  FanSubRegion const subRegion( 65 );
+  array1d< localIndex > colorOffsets;
+  array1d< localIndex > coloredElements;
+
+  EXPECT_FALSE( finiteElement::colorElements( subRegion, subRegion.size() + 1, colorOffsets, coloredElements ) );
+  EXPECT_TRUE( colorOffsets.empty() );
+  EXPECT_TRUE( coloredElements.empty() );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
@@ -636,6 +636,15 @@ int SurfaceGenerator::SeparationDriver( DomainPartition & domain,
 
 #endif
 
+    // split objects invalidate the communication plans cached on the mesh level, on every rank
+    localIndex const numNewObjects = LvArray::integerConversion< localIndex >( modifiedObjects.newNodes.size()
+                                                                              + modifiedObjects.newEdges.size()
+                                                                              + modifiedObjects.newFaces.size() );
+    if( MpiWrapper::Sum( numNewObjects ) > 0 )
+    {
+      mesh.modifiedTopology();
+    }
+
     ArrayOfArraysView< localIndex const > const faceToNodeMap = faceManager.nodeList().toViewConst();
 
     elementManager.forElementSubRegionsComplete< FaceElementSubRegion >( [&]( localIndex const er,
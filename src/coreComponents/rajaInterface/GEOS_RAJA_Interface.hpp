@@ -59,6 +59,35 @@ using parallelDeviceAtomic = parallelHostAtomic;
 
 #endif
 
+/**
+ * @brief Host policy for the finite element kernel launches that processes
+ *   @p BATCH_SIZE consecutive elements per loop iteration.
+ * @tparam BATCH_SIZE The number of elements in a batch.
+ *
+ * The elements of a batch are interleaved at each stage of the kernel so that
+ * the compiler can vectorize across elements. Outside of the kernel launches
+ * it behaves as parallelHostPolicy.
+ */
+template< int BATCH_SIZE >
+struct batchedHostPolicy : public parallelHostPolicy
+{
+  static_assert( BATCH_SIZE > 0, "The batch size must be positive" );
+
+  /// The number of elements in a batch
+  static constexpr int batchSize = BATCH_SIZE;
+};
+
+/**
+ * @brief Trait to detect the batched host policies.
+ * @tparam POLICY The policy to inspect.
+ */
+template< typename POLICY >
+struct isBatchedPolicy : std::false_type {};
+
+/// @copydoc isBatchedPolicy
+template< int BATCH_SIZE >
+struct isBatchedPolicy< batchedHostPolicy< BATCH_SIZE > > : std::true_type {};
+
 namespace internalRajaInterface
 {
 template< typename >
@@ -80,6 +109,10 @@ struct PolicyMap< RAJA::omp_parallel_for_exec >
 };
 #endif
 
+template< int BATCH_SIZE >
+struct PolicyMap< batchedHostPolicy< BATCH_SIZE > > : PolicyMap< parallelHostPolicy >
+{};
+
 #if defined(GEOSX_USE_CUDA)
 template< unsigned long BLOCK_SIZE >
 struct PolicyMap< RAJA::cuda_exec< BLOCK_SIZE > >
@@ -71,6 +71,12 @@
 /// Enables use of SuiteSparse library (CMake option ENABLE_SUITESPARSE)
 #define GEOSX_USE_SUITESPARSE
 
+/// Enables use of METIS library (CMake option ENABLE_METIS)
+#define GEOSX_USE_METIS
+
+/// Enables use of ParMETIS library (CMake option ENABLE_PARMETIS)
+#define GEOSX_USE_PARMETIS
+
 /// Choice of global linear algebra interface (CMake option GEOSX_LA_INTERFACE)
 #define GEOSX_LA_INTERFACE Trilinos
 /// Macro defined when Trilinos interface is selected